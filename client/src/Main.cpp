@@ -5,11 +5,11 @@
 ** Main
 */
 
-#include <iostream>
 #include "ArgParser.hpp"
 #include "ClientRuntime.hpp"
 #include "EventBus.hpp"
 #include "EventRegistry.hpp"
+#include "Log.hpp"
 #include "SfmlGraphics.hpp"
 #include "UDPClient.hpp"
 
@@ -20,7 +20,7 @@ namespace
         try {
             return argParser.parse();
         } catch (std::exception &e) {
-            std::cerr << "{Main}: " << e.what() << std::endl;
+            Log::error("main", "failed to parse arguments", {{"error", e.what()}});
             return Utils::ArgParseResult::Error;
         }
     }
@@ -54,16 +54,18 @@ int main(const int argc, char **argv)
         Engine::EventRegistry eventRegistry(eventBus);
 
         createEventHandler(eventRegistry, clientRuntime, eventBus);
-        std::cout << "Connecting to " << argParser.getHost() << ":" << argParser.getPort() << "..." << std::endl;
+        Log::info("main", "connecting", {{"host", argParser.getHost()}, {"port", argParser.getPort()}});
         client->configure(argParser.getHost(), argParser.getPort());
 
         clientRuntime.start();
         clientRuntime.runDisplay();
         clientRuntime.wait();
 
+        Log::flush();
         return 0;
     } catch (std::exception &e) {
-        std::cerr << "{Main}: " << e.what() << std::endl;
+        Log::error("main", "fatal error", {{"error", e.what()}});
+        Log::flush();
         return 84;
     }
 }
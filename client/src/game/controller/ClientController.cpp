@@ -6,6 +6,7 @@
 */
 
 #include "ClientController.hpp"
+#include "Log.hpp"
 
 namespace Ecs
 {
@@ -15,22 +16,22 @@ namespace Ecs
 
     void ClientController::onAccept()
     {
-        std::cout << "onAccept" << std::endl;
+        Log::debug("ClientController::onAccept", "received");
     }
 
     void ClientController::onReject()
     {
-        std::cout << "onReject" << std::endl;
+        Log::debug("ClientController::onReject", "received");
     }
 
     void ClientController::onPong()
     {
-        std::cout << "onPong" << std::endl;
+        Log::debug("ClientController::onPong", "received");
     }
 
     void ClientController::onGameOver()
     {
-        std::cout << "onGameOver" << std::endl;
+        Log::debug("ClientController::onGameOver", "received");
     }
 
     void ClientController::onSnapshot(const std::vector<SnapshotEntity> &data)
@@ -40,6 +41,6 @@ namespace Ecs
 
     void ClientController::onScore(const uint32_t score)
     {
-        std::cout << "onScore: " << score << std::endl;
+        Log::debug("ClientController::onScore", "received", {{"score", score}});
     }
 }; // namespace Ecs
@@ -6,6 +6,7 @@
 */
 
 #include "ClientWorld.hpp"
+#include "Log.hpp"
 
 namespace World
 {
@@ -75,7 +76,7 @@ namespace World
             _registry.emplaceComponent<Ecs::AnimationState>(entity,
                 Ecs::AnimationState{.currentAnimation = sprite.defaultAnimation, .frameIndex = 0, .elapsed = 0.f});
         } catch (const std::exception &e) {
-            std::cerr << "{ClientWorld::applyCreate} " << e.what() << std::endl;
+            Log::error("ClientWorld::applyCreate", "failed to create entity", {{"error", e.what()}});
         }
     }
 
@@ -5,6 +5,7 @@
 ** SfmlRenderer
 */
 #include "SfmlRenderer.hpp"
+#include "Log.hpp"
 
 namespace Graphics
 {
@@ -104,7 +105,8 @@ namespace Graphics
             else
                 _window->draw(sprite);
         } catch (const std::exception &e) {
-            std::cerr << "{SfmlRenderer::draw}: " << e.what() << std::endl;
+            static Log::RateLimit limit;
+            limit.warn("SfmlRenderer::draw", "failed to draw sprite", {{"error", e.what()}});
         }
     }
 
@@ -118,9 +120,11 @@ namespace Graphics
             else
                 _window->draw(sfText.get());
         } catch (const std::bad_cast &) {
-            std::cerr << "{SfmlRenderer::draw}: IText is not a SfmlText\n";
+            static Log::RateLimit limit;
+            limit.warn("SfmlRenderer::draw", "IText is not a SfmlText");
         } catch (const TextError &e) {
-            std::cerr << "{SfmlRenderer::draw}: " << e.what() << '\n';
+            static Log::RateLimit limit;
+            limit.warn("SfmlRenderer::draw", "failed to draw text", {{"error", e.what()}});
         }
     }
 
@@ -142,7 +146,7 @@ namespace Graphics
         if (!_renderTextureManager) {
             _renderTextureManager = std::make_unique<RenderTextureManager>(windowSize.x, windowSize.y);
             if (!_renderTextureManager->isAvailable()) {
-                std::cerr << "{SfmlRenderer::setColorBlindMode} Failed to create render texture" << std::endl;
+                Log::error("SfmlRenderer::setColorBlindMode", "failed to create render texture");
             }
             return;
         }
@@ -151,7 +155,7 @@ namespace Graphics
             !_renderTextureManager->isAvailable() || _renderTextureManager->getRenderTexture()->getSize() != windowSize;
 
         if (needsResize && !_renderTextureManager->resize(windowSize.x, windowSize.y)) {
-            std::cerr << "{SfmlRenderer::setColorBlindMode} Failed to resize render texture" << std::endl;
+            Log::error("SfmlRenderer::setColorBlindMode", "failed to resize render texture");
         }
     }
 
@@ -6,6 +6,7 @@
 */
 
 #include "RenderTextureManager.hpp"
+#include "Log.hpp"
 
 namespace Graphics
 {
@@ -13,7 +14,7 @@ namespace Graphics
     {
         _renderTexture = std::make_unique<sf::RenderTexture>();
         if (!_renderTexture->resize({initialWidth, initialHeight})) {
-            std::cerr << "{RenderTextureManager::RenderTextureManager} Failed to create render texture" << std::endl;
+            Log::error("RenderTextureManager::RenderTextureManager", "failed to create render texture");
             return;
         }
     }
@@ -26,12 +27,12 @@ namespace Graphics
     bool RenderTextureManager::resize(unsigned int width, unsigned int height)
     {
         if (!_renderTexture) {
-            std::cerr << "{RenderTextureManager::resize} Render texture is not initialized" << std::endl;
+            Log::error("RenderTextureManager::resize", "render texture is not initialized");
             return false;
         }
 
         if (!_renderTexture->resize({width, height})) {
-            std::cerr << "{RenderTextureManager::resize} Failed to resize render texture" << std::endl;
+            Log::error("RenderTextureManager::resize", "failed to resize render texture");
             return false;
         }
 
@@ -61,7 +62,7 @@ namespace Graphics
     {
         if (!_renderTexture || _renderTexture->getTexture().getSize().x == 0
             || _renderTexture->getTexture().getSize().y == 0) {
-            std::cerr << "{RenderTextureManager::getSprite} Render texture is not available" << std::endl;
+            Log::error("RenderTextureManager::getSprite", "render texture is not available");
         }
         return sf::Sprite(_renderTexture->getTexture());
     }
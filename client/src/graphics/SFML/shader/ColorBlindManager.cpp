@@ -6,6 +6,7 @@
 */
 
 #include "ColorBlindManager.hpp"
+#include "Log.hpp"
 
 namespace Graphics
 {
@@ -14,20 +15,20 @@ namespace Graphics
         : _mode(ColorBlindMode::NONE), _shaderLoaded(false)
     {
         if (!sf::Shader::isAvailable()) {
-            std::cerr << "ColorBlindManager: Shaders are not supported on this system\n";
+            Log::warn("ColorBlindManager::ColorBlindManager", "shaders are not supported on this system");
             _shaderLoaded = false;
             return;
         }
         const auto [data, size] = resourceManager->loadResource("shaders/colorblind.frag");
         if (!data || size == 0) {
             _shaderLoaded = false;
-            std::cerr << "ColorBlindManager: Failed to load colorblind shader resource\n";
+            Log::error("ColorBlindManager::ColorBlindManager", "failed to load colorblind shader resource");
             return;
         }
         const std::string shaderCode(reinterpret_cast<const char *>(data), size);
         if (!_shader.loadFromMemory(shaderCode, sf::Shader::Type::Fragment)) {
             _shaderLoaded = false;
-            std::cerr << "ColorBlindManager: Failed to compile colorblind shader\n";
+            Log::error("ColorBlindManager::ColorBlindManager", "failed to compile colorblind shader");
             return;
         }
         _shaderLoaded = true;
@@ -6,6 +6,7 @@
 */
 
 #include "UDPClient.hpp"
+#include "Log.hpp"
 
 namespace Network
 {
@@ -43,7 +44,8 @@ namespace Network
         {
             std::scoped_lock lock(_packetDataMutex);
             if (!_ringBuffer.push(pkt)) {
-                std::cerr << "{UDPClient::receivePackets} Warning: RX buffer overflow, packet dropped\n";
+                static Log::RateLimit limit;
+                limit.warn("UDPClient::receivePackets", "RX buffer overflow, packet dropped");
             }
         }
     }
@@ -55,7 +57,7 @@ namespace Network
         if (_socketFd != kInvalidSocket) {
             _netWrapper.closeSocket(_socketFd);
             _socketFd = kInvalidSocket;
-            std::cout << "{UDPClient::close} UDP Client stopped." << std::endl;
+            Log::info("UDPClient::close", "client stopped");
         }
 
         (void) _netWrapper.cleanupNetwork();
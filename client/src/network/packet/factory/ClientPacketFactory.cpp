@@ -6,6 +6,7 @@
 */
 
 #include "ClientPacketFactory.hpp"
+#include "Log.hpp"
 
 namespace Network
 {
@@ -33,32 +34,81 @@ namespace Network
         try {
             return makePacket<DefaultData>(basePacket);
         } catch (const FactoryError &e) {
-            std::cerr << "{ClientPacketFactory::makePing} " << e.what() << std::endl;
+            Log::error("ClientPacketFactory::makePing", "failed to create packet", {{"error", e.what()}});
             return nullptr;
         }
     }
 
-    std::shared_ptr<Net::IPacket> ClientPacketFactory::makeInput(const PlayerInput &input) const noexcept
+    uint8_t ClientPacketFactory::packFlags(const PlayerInput &input) noexcept
     {
-        PlayerInputData packet{};
-        packet.header = makeHeader(Net::Protocol::UDP::INPUT, sizeof(PlayerInputData));
-
-        packet.flags = 0;
+        uint8_t flags = 0;
         if (input.up)
-            packet.flags |= 0x01;
+            flags |= 0x01;
         if (input.down)
-            packet.flags |= 0x02;
+            flags |= 0x02;
         if (input.left)
-            packet.flags |= 0x04;
+            flags |= 0x04;
         if (input.right)
-            packet.flags |= 0x08;
+            flags |= 0x08;
         if (input.shoot)
-            packet.flags |= 0x10;
+            flags |= 0x10;
+        return flags;
+    }
+
+    std::shared_ptr<Net::IPacket> ClientPacketFactory::makeInput(const PlayerInput &input) const noexcept
+    {
+        PlayerInputData packet{};
+        packet.header = makeHeader(Net::Protocol::UDP::INPUT, sizeof(PlayerInputData));
+        packet.flags = packFlags(input);
 
         try {
             return makePacket<PlayerInputData>(packet);
         } catch (const FactoryError &e) {
-            std::cerr << "{ClientPacketFactory::makePlayerInput} " << e.what() << std::endl;
+            Log::error("ClientPacketFactory::makePlayerInput", "failed to create packet", {{"error", e.what()}});
+            return nullptr;
+        }
+    }
+
+    std::shared_ptr<Net::IPacket> ClientPacketFactory::makeInput(
+        const PlayerInput &input, const AckFields &ack) const noexcept
+    {
+        PlayerInputAckData packet{};
+        packet.header = makeHeader(Net::Protocol::UDP::INPUT, sizeof(PlayerInputAckData));
+        packet.flags = packFlags(input);
+        packet.fields = Net::Reliable::swapAck(ack);
+
+        try {
+            return makePacket<PlayerInputAckData>(packet);
+        } catch (const FactoryError &e) {
+            Log::error("ClientPacketFactory::makeInput", "failed to create packet", {{"error", e.what()}});
+            return nullptr;
+        }
+    }
+
+    std::shared_ptr<Net::IPacket> ClientPacketFactory::makeConnect(const uint64_t cookie) const noexcept
+    {
+        ConnectData packet{};
+        packet.header = makeHeader(Net::Protocol::UDP::CONNECT, sizeof(ConnectData));
+        packet.cookie = htonll(cookie);
+
+        try {
+            return makePacket<ConnectData>(packet);
+        } catch (const FactoryError &e) {
+            Log::error("ClientPacketFactory::makeConnect", "failed to create packet", {{"error", e.what()}});
+            return nullptr;
+        }
+    }
+
+    std::shared_ptr<Net::IPacket> ClientPacketFactory::makeAck(const AckFields &ack) const noexcept
+    {
+        AckData packet{};
+        packet.header = makeHeader(Net::Protocol::UDP::ACK, sizeof(AckData));
+        packet.fields = Net::Reliable::swapAck(ack);
+
+        try {
+            return makePacket<AckData>(packet);
+        } catch (const FactoryError &e) {
+            Log::error("ClientPacketFactory::makeAck", "failed to create packet", {{"error", e.what()}});
             return nullptr;
         }
     }
@@ -12,11 +12,13 @@
 #include <iostream>
 #include <memory>
 #include <string>
+#include "ConnectData.hpp"
 #include "DefaultData.hpp"
 #include "Endian.hpp"
 #include "HeaderData.hpp"
 #include "IPacket.hpp"
 #include "InputData.hpp"
+#include "ReliableChannel.hpp"
 #include "UDPTypesData.hpp"
 
 namespace Network
@@ -74,6 +76,13 @@ namespace Network
          */
         [[nodiscard]] std::shared_ptr<Net::IPacket> makeBase(uint8_t flag) const noexcept;
 
+        /**
+         * @brief Creates a connection request
+         * @param cookie The cookie received in the server's CHALLENGE, 0 on the first attempt
+         * @return A shared pointer to the created packet
+         */
+        [[nodiscard]] std::shared_ptr<Net::IPacket> makeConnect(uint64_t cookie) const noexcept;
+
         /**
          * @brief Creates a player input packet
          * @param input The PlayerInput structure containing input states
@@ -81,7 +90,30 @@ namespace Network
          */
         [[nodiscard]] std::shared_ptr<Net::IPacket> makeInput(const PlayerInput &input) const noexcept;
 
+        /**
+         * @brief Creates a player input packet that also acknowledges reliable messages
+         * @param input The PlayerInput structure containing input states
+         * @param ack The acknowledgement state, in host byte order
+         * @return A shared pointer to the created packet
+         */
+        [[nodiscard]] std::shared_ptr<Net::IPacket> makeInput(
+            const PlayerInput &input, const AckFields &ack) const noexcept;
+
+        /**
+         * @brief Creates a standalone acknowledgement packet
+         * @param ack The acknowledgement state, in host byte order
+         * @return A shared pointer to the created packet
+         */
+        [[nodiscard]] std::shared_ptr<Net::IPacket> makeAck(const AckFields &ack) const noexcept;
+
       private:
+        /**
+         * @brief Packs a PlayerInput into the INPUT flags byte
+         * @param input The PlayerInput structure containing input states
+         * @return Bit 0 up, 1 down, 2 left, 3 right, 4 shoot
+         */
+        [[nodiscard]] static uint8_t packFlags(const PlayerInput &input) noexcept;
+
         /**
          * @brief Creates a packet header with the specified parameters
          * @param type The type of the packet
@@ -100,7 +132,7 @@ namespace Network
         [[nodiscard]] std::shared_ptr<Net::IPacket> makePacket(const Type &packetData) const;
 
         std::shared_ptr<Net::IPacket> _packet = nullptr; ///> Template packet for cloning
-        static constexpr uint8_t VERSION = 1;            ///> Protocol version
+        static constexpr uint8_t VERSION = 2;            ///> Protocol version (2: compact snapshots)
     };
 
 } // namespace Network
@@ -6,6 +6,7 @@
 */
 
 #include "PacketRouter.hpp"
+#include "Log.hpp"
 
 namespace Ecs
 {
@@ -36,47 +37,60 @@ namespace Ecs
         switch (header.type) {
             case Net::Protocol::UDP::ACCEPT: handleAccept(); break;
             case Net::Protocol::UDP::REJECT: handleReject(); break;
+            case Net::Protocol::UDP::CHALLENGE: handleChallenge(payload, payloadSize); break;
             case Net::Protocol::UDP::GAME_OVER: handleGameOver(); break;
             case Net::Protocol::UDP::PONG: handlePong(); break;
-            case Net::Protocol::UDP::SNAPSHOT: handleSnapEntity(payload, payloadSize); break;
+            case Net::Protocol::UDP::SNAPSHOT: handleSnapEntity(header.version, payload, payloadSize); break;
             case Net::Protocol::UDP::SCORE: handleScore(payload, payloadSize); break;
-            default:
-                std::cerr << "{PacketRouter::dispatchPacket} Unknown packet type: " << static_cast<int>(header.type)
-                          << '\n';
+            case Net::Protocol::UDP::RELIABLE: handleReliable(payload, payloadSize); break;
+            case Net::Protocol::UDP::BATCH: handleBatch(payload, payloadSize); break;
+            default: {
+                static Log::RateLimit limit;
+                limit.warn("PacketRouter::dispatchPacket", "unknown packet type", {{"type", header.type}});
                 break;
+            }
         }
     }
 
     bool PacketRouter::isHeaderValid(const Net::IPacket &packet, const HeaderData &header)
     {
         if (packet.size() < sizeof(HeaderData)) {
-            std::cerr << "{PacketRouter::isHeaderValid} Dropped: packet too small\n";
+            static Log::RateLimit limit;
+            limit.warn("PacketRouter::isHeaderValid", "dropped: packet too small");
             return false;
         }
 
-        if (header.version != PROTOCOL_VERSION) {
-            std::cerr << "{PacketRouter::isHeaderValid} Dropped: wrong protocol version "
-                      << static_cast<int>(header.version) << " (expected " << static_cast<int>(1) << ")" << std::endl;
+        if (!isVersionSupported(header.version)) {
+            static Log::RateLimit limit;
+            limit.warn("PacketRouter::isHeaderValid", "dropped: wrong protocol version",
+                {{"version", header.version}, {"min", MIN_PROTOCOL_VERSION}, {"max", PROTOCOL_VERSION}});
             return false;
         }
 
         if (const std::uint16_t declaredSize = ntohs(header.size);
             declaredSize != static_cast<std::uint16_t>(packet.size())) {
-            std::cerr << "{PacketRouter::isHeaderValid} Dropped: size mismatch (header=" + std::to_string(declaredSize)
-                    + ", actual=" + std::to_string(static_cast<std::uint16_t>(packet.size())) + ")\n";
+            static Log::RateLimit limit;
+            limit.warn("PacketRouter::isHeaderValid", "dropped: size mismatch",
+                {{"header", declaredSize}, {"actual", packet.size()}});
             return false;
         }
 
         return true;
     }
 
+    bool PacketRouter::isVersionSupported(const std::uint8_t version) noexcept
+    {
+        return version >= MIN_PROTOCOL_VERSION && version <= PROTOCOL_VERSION;
+    }
+
     bool PacketRouter::isPacketValid(const std::shared_ptr<Net::IPacket> &packet) noexcept
     {
         if (!packet)
             return false;
 
         if (packet->size() < sizeof(HeaderData)) {
-            std::cerr << "{PacketRouter::isPacketValid} Dropped: packet too small\n";
+            static Log::RateLimit limit;
+            limit.warn("PacketRouter::isPacketValid", "dropped: packet too small");
             return false;
         }
         return true;
@@ -111,10 +125,11 @@ namespace Ecs
         _sink->onGameOver();
     }
 
-    void PacketRouter::handleSnapEntity(const uint8_t *payload, const size_t size) const
+    void PacketRouter::handleSnapEntity(const std::uint8_t version, const uint8_t *payload, const size_t size) const
     {
         if (size < sizeof(SnapshotBatchHeader)) {
-            std::cerr << "{PacketRouter::handleSnapEntity} Snapshot batch too small\n";
+            static Log::RateLimit limit;
+            limit.warn("PacketRouter::handleSnapEntity", "snapshot batch too small");
             return;
         }
 
@@ -127,6 +142,15 @@ namespace Ecs
         std::vector<SnapshotEntity> entities;
         entities.reserve(count);
 
+        if (version == Net::Snapshot::COMPACT_VERSION) {
+            if (!Net::Snapshot::decodeCompact(cursor, size - sizeof(SnapshotBatchHeader), count, entities)) {
+                static Log::RateLimit limit;
+                limit.warn("PacketRouter::handleSnapEntity", "compact snapshot truncated");
+            }
+            _sink->onSnapshot(entities);
+            return;
+        }
+
         for (uint16_t i = 0; i < count; ++i) {
             if (cursor + sizeof(SnapshotEntityData) > payload + size)
                 break;
@@ -149,7 +173,8 @@ namespace Ecs
     void PacketRouter::handleScore(const uint8_t *payload, size_t size) const
     {
         if (size < sizeof(ScoreData)) {
-            std::cerr << "{PacketRouter::handleScore} Score packet too small\n";
+            static Log::RateLimit limit;
+            limit.warn("PacketRouter::handleScore", "score packet too small");
             return;
         }
 
@@ -159,4 +184,88 @@ namespace Ecs
 
         _sink->onScore(score);
     }
+
+    void PacketRouter::handleReliable(const uint8_t *payload, const size_t size) const
+    {
+        if (size < sizeof(ReliableHeader) + sizeof(HeaderData)) {
+            static Log::RateLimit limit;
+            limit.warn("PacketRouter::handleReliable", "reliable packet too small");
+            return;
+        }
+
+        ReliableHeader reliable{};
+        std::memcpy(&reliable, payload, sizeof(reliable));
+
+        std::vector<std::vector<uint8_t>> delivered;
+        {
+            std::scoped_lock lock(_reliableMutex);
+            _reliable.receive(ntohs(reliable.seq), payload + sizeof(ReliableHeader), size - sizeof(ReliableHeader),
+                [&delivered](const uint8_t *inner, const size_t innerSize) {
+                    delivered.emplace_back(inner, inner + innerSize);
+                });
+        }
+        // Dispatched with the lock released: a delivered BATCH may itself hold a RELIABLE.
+        for (const auto &inner : delivered) {
+            HeaderData header{};
+            std::memcpy(&header, inner.data(), sizeof(header));
+            if (!isVersionSupported(header.version) || ntohs(header.size) != inner.size()
+                || header.type == Net::Protocol::UDP::RELIABLE) {
+                static Log::RateLimit limit;
+                limit.warn("PacketRouter::handleReliable", "dropped: invalid wrapped packet");
+                continue;
+            }
+            dispatchPacket(header, inner.data(), inner.size());
+        }
+    }
+
+    void PacketRouter::handleBatch(const uint8_t *payload, const size_t size) const
+    {
+        size_t offset = sizeof(HeaderData);
+
+        while (offset + sizeof(HeaderData) <= size) {
+            HeaderData header{};
+            std::memcpy(&header, payload + offset, sizeof(header));
+            const std::uint16_t innerSize = ntohs(header.size);
+            if (!isVersionSupported(header.version) || innerSize < sizeof(HeaderData) || innerSize > size - offset
+                || header.type == Net::Protocol::UDP::BATCH) {
+                static Log::RateLimit limit;
+                limit.warn("PacketRouter::handleBatch", "dropped: invalid packed packet");
+                return;
+            }
+            dispatchPacket(header, payload + offset, innerSize);
+            offset += innerSize;
+        }
+    }
+
+    void PacketRouter::handleChallenge(const uint8_t *payload, const size_t size) const
+    {
+        if (size < sizeof(ConnectData)) {
+            static Log::RateLimit limit;
+            limit.warn("PacketRouter::handleChallenge", "dropped: packet too small");
+            return;
+        }
+        ConnectData challenge{};
+        std::memcpy(&challenge, payload, sizeof(challenge));
+        if (const uint64_t cookie = ntohll(challenge.cookie); cookie != 0)
+            _challenge.store(cookie, std::memory_order_relaxed);
+    }
+
+    bool PacketRouter::ackPending() const
+    {
+        std::scoped_lock lock(_reliableMutex);
+        return _reliable.ackPending();
+    }
+
+    AckFields PacketRouter::takeAck() const
+    {
+        std::scoped_lock lock(_reliableMutex);
+        return _reliable.takeAck();
+    }
+
+    std::optional<uint64_t> PacketRouter::takeChallenge() const
+    {
+        if (const uint64_t cookie = _challenge.exchange(0, std::memory_order_relaxed); cookie != 0)
+            return cookie;
+        return std::nullopt;
+    }
 } // namespace Ecs
@@ -7,17 +7,24 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstring>
 #include <iostream>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
 
+#include "ConnectData.hpp"
 #include "DefaultData.hpp"
 #include "Endian.hpp"
 #include "HeaderData.hpp"
 #include "IClientMessageSink.hpp"
 #include "IPacket.hpp"
+#include "ReliableChannel.hpp"
 #include "ScoreData.hpp"
 #include "SnapEntityData.hpp"
+#include "SnapshotCodec.hpp"
 #include "UDPTypesData.hpp"
 
 namespace Ecs
@@ -62,6 +69,24 @@ namespace Ecs
          */
         void handlePacket(const std::shared_ptr<Net::IPacket> &packet) const;
 
+        /**
+         * @brief Tells whether reliable messages were received since the last takeAck().
+         * @return True if the server is waiting for an acknowledgement.
+         */
+        [[nodiscard]] bool ackPending() const;
+
+        /**
+         * @brief Gets the acknowledgement state of the reliable channel and clears the pending flag.
+         * @return The fields to send to the server, in host byte order.
+         */
+        [[nodiscard]] AckFields takeAck() const;
+
+        /**
+         * @brief Gets the cookie of the last CHALLENGE received, once.
+         * @return The cookie to echo in a new CONNECT, or nothing if no CHALLENGE arrived since the last call.
+         */
+        [[nodiscard]] std::optional<uint64_t> takeChallenge() const;
+
       private:
         /**
          * @brief Validates the header of an incoming packet.
@@ -78,6 +103,13 @@ namespace Ecs
          */
         [[nodiscard]] static bool isPacketValid(const std::shared_ptr<Net::IPacket> &packet) noexcept;
 
+        /**
+         * @brief Tells whether a header version is one this client understands.
+         * @param version The version of the incoming packet.
+         * @return True if the version is supported, false otherwise.
+         */
+        [[nodiscard]] static bool isVersionSupported(std::uint8_t version) noexcept;
+
         /**
          * @brief Handler for ACCEPT packets.
          */
@@ -88,6 +120,11 @@ namespace Ecs
          */
         void handleReject() const;
 
+        /**
+         * @brief Handler for CHALLENGE packets: keeps the cookie for the next CONNECT.
+         */
+        void handleChallenge(const uint8_t *payload, size_t size) const;
+
         /**
          * @brief Handler for PONG packets.
          */
@@ -99,15 +136,25 @@ namespace Ecs
         void handleGameOver() const;
 
         /**
-         * @brief Handler for SNAP_ENTITY packets.
+         * @brief Handler for SNAP_ENTITY packets, in the format selected by the header version.
          */
-        void handleSnapEntity(const uint8_t *payload, size_t size) const;
+        void handleSnapEntity(std::uint8_t version, const uint8_t *payload, size_t size) const;
 
         /**
          * @brief Handler for SCORE packets.
          */
         void handleScore(const uint8_t *payload, size_t size) const;
 
+        /**
+         * @brief Handler for RELIABLE packets: dispatches the wrapped packets in order, once.
+         */
+        void handleReliable(const uint8_t *payload, size_t size) const;
+
+        /**
+         * @brief Handler for BATCH packets: dispatches every packet packed in the datagram.
+         */
+        void handleBatch(const uint8_t *payload, size_t size) const;
+
         /**
          * @brief Extracts the header from the incoming packet.
          * @param packet The incoming IPacket to extract the header from.
@@ -124,8 +171,13 @@ namespace Ecs
          */
         void dispatchPacket(const HeaderData &header, const std::uint8_t *payload, std::size_t payloadSize) const;
 
-        static constexpr std::uint8_t PROTOCOL_VERSION = 1; ///> Expected protocol version for incoming packets.
+        static constexpr std::uint8_t MIN_PROTOCOL_VERSION = 1; ///> Oldest protocol version accepted.
+        static constexpr std::uint8_t PROTOCOL_VERSION = 2;     ///> Newest protocol version accepted.
 
         std::shared_ptr<IClientMessageSink> _sink; ///> Pointer to the IClientMessageSink for handling routed messages.
+
+        mutable std::mutex _reliableMutex;           ///> Protects _reliable (acks are read by the input thread)
+        mutable Net::Reliable::Receiver _reliable;   ///> Receiving side of the server's reliable channel
+        mutable std::atomic<uint64_t> _challenge{0}; ///> Cookie of the last CHALLENGE not taken yet, 0 if none
     };
 } // namespace Ecs
\ No newline at end of file
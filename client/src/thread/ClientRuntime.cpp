@@ -6,6 +6,7 @@
 */
 
 #include "ClientRuntime.hpp"
+#include "Log.hpp"
 
 namespace
 {
@@ -54,11 +55,11 @@ namespace Thread
             _client->start();
         } catch (const std::exception &e) {
             stop();
-            std::cerr << "Failed to start client: " << e.what() << std::endl;
+            Log::error("ClientRuntime::start", "failed to start client", {{"error", e.what()}});
             return;
         }
         _running = true;
-        _client->sendPacket(*_packetFactory.makeBase(Net::Protocol::UDP::CONNECT));
+        _client->sendPacket(*_packetFactory.makeConnect(0));
         setupEventsRegistry();
         _receiverThread = std::thread(&ClientRuntime::runReceiver, this);
         _updaterThread = std::thread(&ClientRuntime::runUpdater, this);
@@ -157,6 +158,10 @@ namespace Thread
             accumulator += frameDt;
 
             processNetworkPackets(deadline, 256);
+            if (const auto cookie = _packetRouter->takeChallenge())
+                _client->sendPacket(*_packetFactory.makeConnect(*cookie));
+            if (_packetRouter->ackPending())
+                _client->sendPacket(*_packetFactory.makeAck(_packetRouter->takeAck()));
             applyWorldCommands(deadline, 500);
 
             int steps = 0;
@@ -183,23 +188,23 @@ namespace Thread
     void ClientRuntime::setupEventsRegistry() const
     {
         _eventRegistry->onKeyPressed(Engine::Key::Up, [this]() {
-            _client->sendPacket(*_packetFactory.makeInput(PlayerInput{true, false, false, false, false}));
+            sendInput(PlayerInput{true, false, false, false, false});
         });
 
         _eventRegistry->onKeyPressed(Engine::Key::Down, [this]() {
-            _client->sendPacket(*_packetFactory.makeInput(PlayerInput{false, true, false, false, false}));
+            sendInput(PlayerInput{false, true, false, false, false});
         });
 
         _eventRegistry->onKeyPressed(Engine::Key::Left, [this]() {
-            _client->sendPacket(*_packetFactory.makeInput(PlayerInput{false, false, true, false, false}));
+            sendInput(PlayerInput{false, false, true, false, false});
         });
 
         _eventRegistry->onKeyPressed(Engine::Key::Right, [this]() {
-            _client->sendPacket(*_packetFactory.makeInput(PlayerInput{false, false, false, true, false}));
+            sendInput(PlayerInput{false, false, false, true, false});
         });
 
         _eventRegistry->onKeyReleased(Engine::Key::Space, [this]() {
-            _client->sendPacket(*_packetFactory.makeInput(PlayerInput{false, false, false, false, true}));
+            sendInput(PlayerInput{false, false, false, false, true});
         });
 
         _eventBus->on<Engine::KeyPressed>([this](const Engine::KeyPressed &e) {
@@ -225,6 +230,14 @@ namespace Thread
         });
     }
 
+    void ClientRuntime::sendInput(const PlayerInput &input) const
+    {
+        if (_packetRouter->ackPending())
+            _client->sendPacket(*_packetFactory.makeInput(input, _packetRouter->takeAck()));
+        else
+            _client->sendPacket(*_packetFactory.makeInput(input));
+    }
+
     void ClientRuntime::processNetworkPackets(const steadyClock::time_point deadline, const int maxPackets) const
     {
         int processedPacket = 0;
@@ -172,6 +172,12 @@ namespace Thread
          */
         void setupEventsRegistry() const;
 
+        /**
+         * @brief Sends an input packet that also acknowledges the reliable messages received.
+         * @param input The input to send.
+         */
+        void sendInput(const PlayerInput &input) const;
+
         /**
          * @brief Processes incoming network packets up to a specified deadline and maximum count.
          * @param deadline The time point by which to stop processing packets.
@@ -1,5 +1,6 @@
 #include "ArgParser.hpp"
 #include <iostream>
+#include "Log.hpp"
 
 using namespace Utils;
 
@@ -29,7 +30,7 @@ ArgParseResult ArgParser::parse()
             continue;
         }
 
-        std::cerr << "{ArgParser}: Unknown argument: " << arg << std::endl;
+        Log::error("ArgParser::parse", "unknown argument", {{"arg", arg}});
         return ArgParseResult::Error;
     }
     return ArgParseResult::Success;
@@ -64,7 +65,7 @@ bool ArgParser::parsePort(const std::string &value)
         _port = port;
         return true;
     } catch (...) {
-        std::cerr << "{ArgParser}: Invalid port number." << std::endl;
+        Log::error("ArgParser::parsePort", "invalid port number", {{"value", value}});
         return false;
     }
 }
@@ -72,7 +73,7 @@ bool ArgParser::parsePort(const std::string &value)
 bool ArgParser::parseHost(const std::string &value)
 {
     if (value.empty()) {
-        std::cerr << "{ArgParser}: Invalid host value." << std::endl;
+        Log::error("ArgParser::parseHost", "invalid host value");
         return false;
     }
     _host = value;
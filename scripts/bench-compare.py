@@ -0,0 +1,84 @@
+#!/usr/bin/env python3
+"""
+Benchmark Comparator
+Compares Google Benchmark JSON results against a stored baseline and flags regressions.
+"""
+
+import argparse
+import json
+import sys
+
+NANOSECONDS = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+
+
+def load(path: str, metric: str) -> dict:
+    """Returns the time of each benchmark in nanoseconds, the median when repetitions were run."""
+    with open(path, "r") as f:
+        report = json.load(f)
+
+    runs = {}
+    medians = {}
+    for bench in report.get("benchmarks", []):
+        if bench.get("error_occurred"):
+            continue
+        time = float(bench[metric]) * NANOSECONDS[bench.get("time_unit", "ns")]
+        if bench.get("run_type") == "aggregate":
+            if bench.get("aggregate_name") == "median":
+                medians[bench["run_name"]] = time
+            continue
+        name = bench.get("run_name", bench["name"])
+        runs[name] = min(time, runs.get(name, time))
+    runs.update(medians)
+    return runs
+
+
+def compare(baseline: dict, current: dict, threshold: float) -> int:
+    """Prints the comparison table and returns the number of regressions."""
+    regressions = 0
+    width = max((len(name) for name in baseline.keys() | current.keys()), default=10)
+
+    print(f"{'benchmark':<{width}}  {'baseline':>12}  {'current':>12}  {'delta':>8}  status")
+    for name in sorted(baseline.keys() | current.keys()):
+        if name not in current:
+            print(f"{name:<{width}}  {baseline[name]:>10.1f}ns  {'-':>12}  {'-':>8}  missing")
+            continue
+        if name not in baseline:
+            print(f"{name:<{width}}  {'-':>12}  {current[name]:>10.1f}ns  {'-':>8}  new")
+            continue
+        delta = (current[name] - baseline[name]) / baseline[name] if baseline[name] > 0 else 0.0
+        status = "ok"
+        if delta > threshold:
+            status = "REGRESSION"
+            regressions += 1
+        elif delta < -threshold:
+            status = "improved"
+        print(f"{name:<{width}}  {baseline[name]:>10.1f}ns  {current[name]:>10.1f}ns  {delta:>+7.1%}  {status}")
+    return regressions
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description="Flag benchmark regressions against a baseline.")
+    parser.add_argument("baseline", help="baseline JSON written with --benchmark_out")
+    parser.add_argument("current", help="current JSON written with --benchmark_out")
+    parser.add_argument("--threshold", type=float, default=0.10,
+                        help="slowdown above which a benchmark regressed (default: 0.10 for 10%%)")
+    parser.add_argument("--metric", choices=["real_time", "cpu_time"], default="cpu_time",
+                        help="time compared (default: cpu_time)")
+    args = parser.parse_args()
+
+    try:
+        baseline = load(args.baseline, args.metric)
+        current = load(args.current, args.metric)
+    except (OSError, ValueError, KeyError) as e:
+        print(f"Error: {e}", file=sys.stderr)
+        return 2
+
+    regressions = compare(baseline, current, args.threshold)
+    if regressions:
+        print(f"{regressions} regression(s) above {args.threshold:.0%}", file=sys.stderr)
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
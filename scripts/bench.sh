@@ -0,0 +1,72 @@
+#!/bin/bash
+##
+## EPITECH PROJECT, 2025
+## rtype
+## File description:
+## bench
+##
+
+set -euo pipefail
+
+# bench.sh - runs every benchmark executable, writes JSON results and compares them to a baseline
+#
+# Usage: scripts/bench.sh [-o results_dir] [-b baseline_dir] [-t threshold] [-- benchmark args]
+#   -o  directory receiving <executable>.json (default: benchmarks/results)
+#   -b  directory of baseline JSON files to compare against; exits 1 on regression
+#   -t  slowdown flagged as a regression (default: 0.10)
+# Save a baseline by copying a results directory, e.g. cp -r benchmarks/results benchmarks/baseline
+
+RED="\033[0;31m"
+GREEN="\033[0;32m"
+BLUE="\033[0;34m"
+NC="\033[0m"
+
+PROJECT_ROOT="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+cd "$PROJECT_ROOT"
+
+OUT_DIR="benchmarks/results"
+BASELINE_DIR=""
+THRESHOLD="0.10"
+
+while getopts "o:b:t:" opt; do
+    case "$opt" in
+        o) OUT_DIR="$OPTARG" ;;
+        b) BASELINE_DIR="$OPTARG" ;;
+        t) THRESHOLD="$OPTARG" ;;
+        *) exit 2 ;;
+    esac
+done
+shift $((OPTIND - 1))
+
+mkdir -p "$OUT_DIR"
+FAILED=0
+FOUND=0
+
+for exe in benchmarks/benchmarks_*; do
+    [[ -x "$exe" && -f "$exe" ]] || continue
+    FOUND=1
+    name="$(basename "$exe")"
+    echo -e "${BLUE}Running $name...${NC}"
+    "$exe" --benchmark_out="$OUT_DIR/$name.json" --benchmark_out_format=json "$@"
+
+    if [[ -n "$BASELINE_DIR" ]]; then
+        if [[ ! -f "$BASELINE_DIR/$name.json" ]]; then
+            echo -e "${RED}No baseline for $name${NC}"
+            continue
+        fi
+        if ! python3 scripts/bench-compare.py "$BASELINE_DIR/$name.json" "$OUT_DIR/$name.json" \
+            --threshold "$THRESHOLD"; then
+            FAILED=1
+        fi
+    fi
+done
+
+if [[ $FOUND -eq 0 ]]; then
+    echo -e "${RED}No benchmark executable in benchmarks/, build with -DBUILD_BENCHMARKS=ON${NC}"
+    exit 2
+fi
+if [[ $FAILED -ne 0 ]]; then
+    echo -e "${RED}Benchmark regressions found${NC}"
+    exit 1
+fi
+echo -e "${GREEN}Results written to $OUT_DIR${NC}"
@@ -0,0 +1,52 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** benchCollision
+*/
+
+#include <benchmark/benchmark.h>
+#include "CollisionSystem.hpp"
+#include "World.hpp"
+
+namespace
+{
+    constexpr int Players = 4;
+
+    /**
+     * @brief Fills a world with the players and a grid of enemies, some of them overlapping the players.
+     */
+    void populate(Game::World &world, const int64_t enemies)
+    {
+        auto &reg = world.registry();
+
+        for (int i = 0; i < Players; i++) {
+            const Ecs::Entity ship = reg.createEntity();
+            reg.emplaceComponent<Ecs::Position>(ship, Ecs::Position{100.f, 100.f + 120.f * static_cast<float>(i)});
+            reg.emplaceComponent<Ecs::Collision>(ship, Ecs::Collision{30.f, 30.f});
+            reg.emplaceComponent<Ecs::Health>(ship, Ecs::Health{100, 100});
+        }
+        for (int64_t i = 0; i < enemies; i++) {
+            const Ecs::Entity enemy = reg.createEntity();
+            const auto x = static_cast<float>(i % 32) * 25.f;
+            const auto y = static_cast<float>(i / 32) * 25.f;
+            reg.emplaceComponent<Ecs::Position>(enemy, Ecs::Position{x, y});
+            reg.emplaceComponent<Ecs::Collision>(enemy, Ecs::Collision{20.f, 20.f});
+            reg.emplaceComponent<Ecs::Health>(enemy, Ecs::Health{10, 10});
+            reg.emplaceComponent<Ecs::AIBrain>(enemy);
+        }
+    }
+} // namespace
+
+static void BM_CollisionSystem(benchmark::State &state)
+{
+    Game::World world;
+    populate(world, state.range(0));
+
+    for (auto _ : state) {
+        Game::CollisionSystem::update(world);
+        world.events().process();
+    }
+    state.SetItemsProcessed(state.iterations() * (state.range(0) + Players));
+}
+BENCHMARK(BM_CollisionSystem)->Arg(16)->Arg(64)->Arg(256)->Arg(1024);
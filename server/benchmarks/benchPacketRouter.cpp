@@ -0,0 +1,133 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** benchPacketRouter
+*/
+
+#include <benchmark/benchmark.h>
+#include <cstring>
+#ifdef _WIN32
+    #include <winsock2.h>
+#else
+    #include <arpa/inet.h>
+    #include <netinet/in.h>
+#endif
+#include "IServer.hpp"
+#include "InputData.hpp"
+#include "RoomManager.hpp"
+#include "SessionManager.hpp"
+#include "UDPPacket.hpp"
+#include "UDPPacketFactory.hpp"
+#include "UDPPacketRouter.hpp"
+
+namespace
+{
+    constexpr int Players = 4;
+
+    class NullServer : public Net::Server::IServer {
+      public:
+        void configure(const std::string &, int32_t) override
+        {
+        }
+
+        void setNonBlocking(bool) noexcept override
+        {
+        }
+
+        bool isStoredIpCorrect() const noexcept override
+        {
+            return true;
+        }
+
+        bool isStoredPortCorrect() const noexcept override
+        {
+            return true;
+        }
+
+        bool sendPacket(const Net::IPacket &) noexcept override
+        {
+            return true;
+        }
+
+        void start() override
+        {
+        }
+
+        void stop() noexcept override
+        {
+        }
+
+        bool isRunning() const noexcept override
+        {
+            return false;
+        }
+
+        void setRunning(bool) noexcept override
+        {
+        }
+
+        void readPackets() noexcept override
+        {
+        }
+
+        bool popPacket(std::shared_ptr<Net::IPacket> &) noexcept override
+        {
+            return false;
+        }
+    };
+
+    /**
+     * @brief A router with Players sessions, each joined to its running room as on CONNECT.
+     */
+    struct RouterFixture {
+        std::shared_ptr<Net::Server::SessionManager> sessions = std::make_shared<Net::Server::SessionManager>();
+        std::shared_ptr<Net::Factory::UDPPacketFactory> factory =
+            std::make_shared<Net::Factory::UDPPacketFactory>(std::make_shared<Net::UDPPacket>());
+        std::shared_ptr<Engine::RoomManager> rooms = std::make_shared<Engine::RoomManager>(
+            sessions, std::make_shared<NullServer>(), factory, "levels/level1.json");
+        Net::UDPPacketRouter router{sessions, rooms};
+        std::vector<std::shared_ptr<Net::IPacket>> inputs;
+
+        RouterFixture()
+        {
+            for (int i = 0; i < Players; i++) {
+                sockaddr_in addr{};
+                addr.sin_family = AF_INET;
+                addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+                addr.sin_port = htons(static_cast<uint16_t>(40000 + i));
+                const int sessionId = sessions->getOrCreateSession(addr);
+                if (!rooms->onPlayerConnect(sessionId))
+                    continue;
+
+                PlayerInputData data{};
+                data.header.type = Net::Protocol::UDP::INPUT;
+                data.header.version = 1;
+                data.header.size = htons(sizeof(PlayerInputData));
+                data.flags = 0x11;
+                auto packet = std::make_shared<Net::UDPPacket>();
+                std::memcpy(packet->buffer(), &data, sizeof(data));
+                packet->setSize(sizeof(data));
+                packet->setAddress(addr);
+                inputs.push_back(packet);
+            }
+        }
+    };
+} // namespace
+
+static void BM_UDPPacketRouterInput(benchmark::State &state)
+{
+    static RouterFixture fixture;
+    const auto &inputs = fixture.inputs;
+    if (inputs.empty()) {
+        state.SkipWithError("No room could be joined");
+        return;
+    }
+
+    auto i = static_cast<std::size_t>(state.thread_index());
+    for (auto _ : state)
+        fixture.router.handlePacket(inputs[i++ % inputs.size()]);
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_UDPPacketRouterInput)->ThreadRange(1, 4)->UseRealTime();
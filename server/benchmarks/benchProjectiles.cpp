@@ -0,0 +1,85 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** benchProjectiles
+*/
+
+#include <benchmark/benchmark.h>
+#include "CollisionSystem.hpp"
+#include "LifetimeSystem.hpp"
+#include "MovementSystem.hpp"
+#include "ProjectileSystem.hpp"
+#include "World.hpp"
+
+namespace
+{
+    constexpr float Dt = 1.f / 60.f;
+    constexpr int Ships = 8;
+
+    void addShips(Game::World &world)
+    {
+        auto &reg = world.registry();
+
+        for (int i = 0; i < Ships; i++) {
+            const Ecs::Entity ship = reg.createEntity();
+            reg.emplaceComponent<Ecs::Position>(ship, Ecs::Position{700.f, 40.f + 60.f * static_cast<float>(i)});
+            reg.emplaceComponent<Ecs::Velocity>(ship, Ecs::Velocity{0.f, 0.f});
+            reg.emplaceComponent<Ecs::Collision>(ship, Ecs::Collision{30.f, 30.f});
+            reg.emplaceComponent<Ecs::Health>(ship, Ecs::Health{100, 100});
+        }
+    }
+
+    ShootEvent bullet(const int64_t i)
+    {
+        const auto x = static_cast<float>(i % 32) * 16.f;
+        const auto y = static_cast<float>(i / 32) * 16.f;
+        return ShootEvent{x, y, 0.f, 0.f, 20, static_cast<size_t>(i), {8.f, 8.f}, 1e9f};
+    }
+} // namespace
+
+static void BM_EcsProjectiles(benchmark::State &state)
+{
+    Game::World world;
+    auto &reg = world.registry();
+    addShips(world);
+    for (int64_t i = 0; i < state.range(0); i++) {
+        const ShootEvent event = bullet(i);
+        const Ecs::Entity proj = reg.createEntity();
+        reg.emplaceComponent<Ecs::Position>(proj, Ecs::Position{event.x, event.y});
+        reg.emplaceComponent<Ecs::Velocity>(proj, Ecs::Velocity{event.vx, event.vy});
+        reg.emplaceComponent<Ecs::Damage>(proj, Ecs::Damage{event.damage});
+        reg.emplaceComponent<Ecs::Damageable>(proj);
+        reg.emplaceComponent<Ecs::Collision>(proj, Ecs::Collision{8.f, 8.f});
+        reg.emplaceComponent<Ecs::Drawable>(proj, Ecs::Drawable{6, true});
+        reg.emplaceComponent<Ecs::Health>(proj, Ecs::Health{1, 1});
+        reg.emplaceComponent<Ecs::Lifetime>(proj, Ecs::Lifetime{event.lifetime});
+        reg.emplaceComponent<Ecs::Projectile>(proj, Ecs::Projectile{event.shooter});
+    }
+
+    for (auto _ : state) {
+        Game::MovementSystem::update(world, Dt);
+        Game::CollisionSystem::update(world);
+        Game::LifetimeSystem::update(world, Dt);
+        world.events().process();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_EcsProjectiles)->Arg(128)->Arg(512)->Arg(2048);
+
+static void BM_PoolProjectiles(benchmark::State &state)
+{
+    Game::World world;
+    addShips(world);
+    for (int64_t i = 0; i < state.range(0); i++)
+        world.events().emit(bullet(i));
+    world.events().process();
+
+    for (auto _ : state) {
+        Game::ProjectileSystem::update(world, Dt);
+        world.events().process();
+        world.projectiles().compact();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_PoolProjectiles)->Arg(128)->Arg(512)->Arg(2048);
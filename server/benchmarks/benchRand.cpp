@@ -0,0 +1,69 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** benchRand
+*/
+
+#include <benchmark/benchmark.h>
+#include <random>
+#include "Rand.hpp"
+
+static void BM_Mt19937_Raw(benchmark::State &state)
+{
+    std::mt19937 rng{42};
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(rng());
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Mt19937_Raw);
+
+static void BM_Generator_Raw(benchmark::State &state)
+{
+    Rand::Generator rng{42};
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(rng());
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Generator_Raw);
+
+static void BM_Mt19937_EnemyY(benchmark::State &state)
+{
+    std::mt19937 rng{42};
+    std::uniform_real_distribution<float> enemyY(Rand::EnemyY.min, Rand::EnemyY.max);
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(enemyY(rng));
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Mt19937_EnemyY);
+
+static void BM_Generator_EnemyY(benchmark::State &state)
+{
+    Rand::Generator rng{42};
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(rng.uniform(Rand::EnemyY));
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Generator_EnemyY);
+
+static void BM_Mt19937_Construct(benchmark::State &state)
+{
+    for (auto _ : state) {
+        std::mt19937 rng{42};
+        benchmark::DoNotOptimize(rng());
+    }
+}
+BENCHMARK(BM_Mt19937_Construct);
+
+static void BM_Generator_Construct(benchmark::State &state)
+{
+    for (auto _ : state) {
+        Rand::Generator rng{42};
+        benchmark::DoNotOptimize(rng());
+    }
+}
+BENCHMARK(BM_Generator_Construct);
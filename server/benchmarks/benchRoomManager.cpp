@@ -0,0 +1,133 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** benchRoomManager
+*/
+
+#include <benchmark/benchmark.h>
+#include "IServer.hpp"
+#include "RoomManager.hpp"
+#include "SessionManager.hpp"
+#include "UDPPacket.hpp"
+#include "UDPPacketFactory.hpp"
+
+namespace
+{
+    constexpr int Rooms = 10000;
+    constexpr int PlayersPerRoom = 2;
+
+    class NullServer : public Net::Server::IServer {
+      public:
+        void configure(const std::string &, int32_t) override
+        {
+        }
+
+        void setNonBlocking(bool) noexcept override
+        {
+        }
+
+        bool isStoredIpCorrect() const noexcept override
+        {
+            return true;
+        }
+
+        bool isStoredPortCorrect() const noexcept override
+        {
+            return true;
+        }
+
+        bool sendPacket(const Net::IPacket &) noexcept override
+        {
+            return true;
+        }
+
+        void start() override
+        {
+        }
+
+        void stop() noexcept override
+        {
+        }
+
+        bool isRunning() const noexcept override
+        {
+            return false;
+        }
+
+        void setRunning(bool) noexcept override
+        {
+        }
+
+        void readPackets() noexcept override
+        {
+        }
+
+        bool popPacket(std::shared_ptr<Net::IPacket> &) noexcept override
+        {
+            return false;
+        }
+    };
+
+    /**
+     * @brief Rooms rooms of PlayersPerRoom players each, sessions 1 to Rooms * PlayersPerRoom.
+     */
+    Engine::RoomManager &populatedManager()
+    {
+        static Engine::RoomManager manager(std::make_shared<Net::Server::SessionManager>(),
+            std::make_shared<NullServer>(),
+            std::make_shared<Net::Factory::UDPPacketFactory>(std::make_shared<Net::UDPPacket>()), "");
+        static const bool populated = [] {
+            for (int r = 0; r < Rooms; r++) {
+                const Engine::RoomId room = manager.createRoom("room " + std::to_string(r), 4);
+                for (int p = 1; p <= PlayersPerRoom; p++)
+                    manager.addPlayerToRoom(room, r * PlayersPerRoom + p);
+            }
+            return true;
+        }();
+        (void) populated;
+        return manager;
+    }
+} // namespace
+
+static void BM_RoomManagerLookup(benchmark::State &state)
+{
+    auto &manager = populatedManager();
+    int session = 1 + state.thread_index() * 7919;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(manager.getRoomById(manager.getRoomIdOfPlayer(session)));
+        session = session % (Rooms * PlayersPerRoom) + 1;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_RoomManagerLookup)->ThreadRange(1, 8)->UseRealTime();
+
+static void BM_RoomManagerJoinLeave(benchmark::State &state)
+{
+    auto &manager = populatedManager();
+    const int session = Rooms * PlayersPerRoom + 1 + state.thread_index();
+    const auto room = static_cast<Engine::RoomId>(1 + state.thread_index() * 97 % Rooms);
+
+    for (auto _ : state) {
+        manager.addPlayerToRoom(room, session);
+        benchmark::DoNotOptimize(manager.removePlayer(session));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_RoomManagerJoinLeave)->ThreadRange(1, 8)->UseRealTime();
+
+static void BM_RoomManagerCreateRemove(benchmark::State &state)
+{
+    auto &manager = populatedManager();
+
+    for (auto _ : state) {
+        const Engine::RoomId room = manager.createRoom("churn", 4);
+        manager.removeRoom(room);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_RoomManagerCreateRemove)->ThreadRange(1, 4)->UseRealTime();
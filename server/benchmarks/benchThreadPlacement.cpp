@@ -0,0 +1,178 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** benchThreadPlacement
+*/
+
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include "ThreadPlacement.hpp"
+
+#ifdef __linux__
+    #include <sched.h>
+#endif
+
+namespace
+{
+    /**
+     * @brief A thread answering every ping of the benchmark thread, like a room answering its processor.
+     */
+    class PingPong {
+      public:
+        explicit PingPong(const Utils::ThreadPlacement &placement)
+            : _thread([this, &placement] {
+                  placement.apply("room", 0);
+                  run();
+              })
+        {
+        }
+
+        ~PingPong()
+        {
+            _stop.store(true, std::memory_order_relaxed);
+            _ping.fetch_add(1, std::memory_order_release);
+            _thread.join();
+        }
+
+        void roundTrip() noexcept
+        {
+            const std::uint64_t sequence = _ping.fetch_add(1, std::memory_order_release) + 1;
+
+            while (_pong.load(std::memory_order_acquire) != sequence)
+                continue;
+        }
+
+      private:
+        void run() noexcept
+        {
+            std::uint64_t seen = 0;
+
+            while (true) {
+                std::uint64_t ping = seen;
+                while ((ping = _ping.load(std::memory_order_acquire)) == seen)
+                    continue;
+                if (_stop.load(std::memory_order_relaxed))
+                    return;
+                seen = ping;
+                _pong.store(ping, std::memory_order_release);
+            }
+        }
+
+        alignas(64) std::atomic<std::uint64_t> _ping{0};
+        alignas(64) std::atomic<std::uint64_t> _pong{0};
+        std::atomic<bool> _stop{false};
+        std::thread _thread;
+    };
+
+    /**
+     * @brief Threads competing for the CPUs, yielding now and then like the other threads of a loaded server.
+     */
+    class Noise {
+      public:
+        explicit Noise(const std::size_t threads)
+        {
+            for (std::size_t i = 0; i < threads; i++)
+                _threads.emplace_back([this] {
+                    std::uint64_t spins = 0;
+                    while (!_stop.load(std::memory_order_relaxed))
+                        if (++spins % 4096 == 0)
+                            std::this_thread::yield();
+                });
+        }
+
+        ~Noise()
+        {
+            _stop.store(true);
+            for (auto &thread : _threads)
+                thread.join();
+        }
+
+      private:
+        std::atomic<bool> _stop{false};
+        std::vector<std::thread> _threads;
+    };
+
+    /**
+     * @brief Restores the affinity of the benchmark thread once the benchmark pinned it.
+     */
+    class AffinityGuard {
+      public:
+        AffinityGuard() noexcept
+        {
+#ifdef __linux__
+            CPU_ZERO(&_saved);
+            sched_getaffinity(0, sizeof(_saved), &_saved);
+#endif
+        }
+
+        ~AffinityGuard()
+        {
+#ifdef __linux__
+            sched_setaffinity(0, sizeof(_saved), &_saved);
+#endif
+        }
+
+      private:
+#ifdef __linux__
+        cpu_set_t _saved{};
+#endif
+    };
+
+    /**
+     * @brief Times round trips between two threads, with Arg(0) noisy threads around, and reports their tail.
+     */
+    void handoff(benchmark::State &state, const bool pinned)
+    {
+        if (std::thread::hardware_concurrency() < 2) {
+            state.SkipWithError("Needs two CPUs");
+            return;
+        }
+        Utils::ThreadPlacement placement;
+        if (pinned) {
+            placement.pin("processor=0");
+            placement.pin("room=1");
+        }
+        const AffinityGuard guard;
+        placement.apply("processor", 0);
+        PingPong pingPong(placement);
+        const Noise noise(static_cast<std::size_t>(state.range(0)));
+        std::vector<std::int64_t> samples;
+        samples.reserve(1 << 20);
+
+        for (auto _ : state) {
+            const auto start = std::chrono::steady_clock::now();
+            pingPong.roundTrip();
+            const auto elapsed = std::chrono::steady_clock::now() - start;
+            if (samples.size() < samples.capacity())
+                samples.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+        }
+        std::ranges::sort(samples);
+        const auto percentile = [&samples](const double rank) {
+            const auto at = static_cast<std::size_t>(rank * static_cast<double>(samples.size() - 1));
+            return static_cast<double>(samples[at]);
+        };
+        if (!samples.empty()) {
+            state.counters["p50_ns"] = percentile(0.5);
+            state.counters["p99_ns"] = percentile(0.99);
+            state.counters["p999_ns"] = percentile(0.999);
+        }
+    }
+
+    void BM_Handoff_Floating(benchmark::State &state)
+    {
+        handoff(state, false);
+    }
+
+    void BM_Handoff_Pinned(benchmark::State &state)
+    {
+        handoff(state, true);
+    }
+} // namespace
+
+BENCHMARK(BM_Handoff_Floating)->Arg(0)->Arg(4)->UseRealTime();
+BENCHMARK(BM_Handoff_Pinned)->Arg(0)->Arg(4)->UseRealTime();
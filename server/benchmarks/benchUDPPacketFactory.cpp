@@ -0,0 +1,79 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** benchUDPPacketFactory
+*/
+
+#include <benchmark/benchmark.h>
+#include <vector>
+#include "SnapshotCodec.hpp"
+#include "UDPPacket.hpp"
+#include "UDPPacketFactory.hpp"
+
+namespace
+{
+    const Net::Factory::UDPPacketFactory Factory(std::make_shared<Net::UDPPacket>());
+
+    sockaddr_in address()
+    {
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(4242);
+        return addr;
+    }
+
+    std::vector<SnapshotEntity> entities(const int64_t count)
+    {
+        std::vector<SnapshotEntity> out;
+
+        for (int64_t i = 0; i < count; i++)
+            out.push_back({static_cast<size_t>(i), static_cast<float>(i % 800), static_cast<float>(i % 600),
+                static_cast<unsigned int>(i % 8)});
+        return out;
+    }
+} // namespace
+
+static void BM_UDPPacketFactory_Default(benchmark::State &state)
+{
+    const sockaddr_in addr = address();
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(Factory.makeDefault(addr, Net::Protocol::UDP::PONG));
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_UDPPacketFactory_Default);
+
+static void BM_UDPPacketFactory_Damage(benchmark::State &state)
+{
+    const sockaddr_in addr = address();
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(Factory.makeDamage(addr, 42, 10));
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_UDPPacketFactory_Damage);
+
+static void BM_UDPPacketFactory_Score(benchmark::State &state)
+{
+    const sockaddr_in addr = address();
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(Factory.createScorePacket(addr, 1337));
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_UDPPacketFactory_Score);
+
+static void BM_UDPPacketFactory_Snapshot(benchmark::State &state)
+{
+    const std::vector<SnapshotEntity> snapshot = entities(state.range(0));
+    const auto version = static_cast<uint8_t>(state.range(1));
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(Factory.createSnapshotPacket(snapshot, version));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+// Legacy snapshots hold fewer entities per datagram than compact ones
+BENCHMARK(BM_UDPPacketFactory_Snapshot)
+    ->ArgsProduct({{16, 48}, {Net::Snapshot::LEGACY_VERSION}})
+    ->ArgsProduct({{16, 48, 128, 512}, {Net::Snapshot::COMPACT_VERSION}});
@@ -0,0 +1,184 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Main
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <vector>
+#include "GameServer.hpp"
+#include "NullServer.hpp"
+#include "ReplayReader.hpp"
+#include "UDPPacket.hpp"
+
+namespace
+{
+    /**
+     * @brief Command-line options of the replay runner.
+     */
+    struct Options {
+        std::string recording;   ///> Recording to replay
+        std::string timingsPath; ///> Optional per-tick CSV output
+        bool verify = true;      ///> Compare world hashes against the recording
+    };
+
+    void displayHelp(const char *binary)
+    {
+        std::cout << "[USAGE]: " << binary << " <recording.rtrp> [options]\n\n"
+                  << "Replays a room recording headless, as fast as possible.\n\n"
+                  << "Options:\n"
+                  << "  --timings <file>  Write per-tick system timings (CSV) to <file>\n"
+                  << "  --no-verify       Do not compare world hashes with the recording\n"
+                  << "  -h, --help        Display this help message\n";
+    }
+
+    bool parseOptions(const int argc, char **argv, Options &opts)
+    {
+        for (int i = 1; i < argc; i++) {
+            const std::string arg = argv[i];
+
+            if (arg == "--timings" && i + 1 < argc) {
+                opts.timingsPath = argv[++i];
+            } else if (arg == "--no-verify") {
+                opts.verify = false;
+            } else if (!arg.starts_with("-") && opts.recording.empty()) {
+                opts.recording = arg;
+            } else {
+                std::cerr << "{replay}: Unknown argument: " << arg << std::endl;
+                return false;
+            }
+        }
+        return !opts.recording.empty();
+    }
+
+    Game::GameServer::GameCommand toGameCommand(const Game::Replay::Command &recorded)
+    {
+        Game::GameServer::GameCommand cmd;
+        cmd.type = static_cast<Game::GameServer::GameCommand::Type>(recorded.type);
+        cmd.sessionId = recorded.sessionId;
+        cmd.input = Game::Replay::unpackInput(recorded.inputFlags);
+        return cmd;
+    }
+
+    double percentile(std::vector<double> values, const double p)
+    {
+        if (values.empty())
+            return 0.0;
+        const auto idx = static_cast<size_t>(p * static_cast<double>(values.size() - 1));
+        std::nth_element(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(idx), values.end());
+        return values[idx];
+    }
+
+    void writeCsvHeader(std::ofstream &csv)
+    {
+        csv << "tick,hash_ok,total_us";
+        for (const auto *name : Game::GameServer::StepProfile::NAMES)
+            csv << "," << name << "_us";
+        csv << "\n";
+    }
+
+    int replay(const Options &opts)
+    {
+        Game::ReplayReader reader(opts.recording);
+        const auto &header = reader.header();
+
+        Game::GameServer gs(std::make_shared<Net::Server::SessionManager>(), std::make_shared<Replay::NullServer>(),
+            std::make_shared<Net::Factory::UDPPacketFactory>(std::make_shared<Net::UDPPacket>()), header.levelPath,
+            header.seed);
+        gs.setProfiling(true);
+
+        std::ofstream csv;
+        if (!opts.timingsPath.empty()) {
+            csv.open(opts.timingsPath, std::ios::trunc);
+            if (!csv.is_open())
+                throw Game::ReplayError("{replay} Failed to open timings file: " + opts.timingsPath);
+            writeCsvHeader(csv);
+        }
+
+        std::vector<double> totals;
+        Game::GameServer::StepProfile sums;
+        size_t mismatches = 0;
+        std::uint64_t firstMismatch = 0;
+        Game::ReplayReader::Record record;
+
+        while (reader.next(record)) {
+            if (record.kind == Game::ReplayReader::Record::Kind::Command) {
+                if (record.command.tick != gs.tickIndex())
+                    throw Game::ReplayError("{replay} Command recorded for tick " + std::to_string(record.command.tick)
+                        + " found at tick " + std::to_string(gs.tickIndex()));
+                gs.applyCommand(toGameCommand(record.command));
+                continue;
+            }
+
+            const auto start = std::chrono::steady_clock::now();
+            gs.step();
+            const double total =
+                std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+            const bool hashOk = !opts.verify || gs.stateHash() == record.hash;
+
+            if (!hashOk && mismatches++ == 0)
+                firstMismatch = gs.tickIndex();
+            totals.push_back(total);
+            const auto &profile = gs.lastStepProfile();
+            for (size_t i = 0; i < profile.micros.size(); i++)
+                sums.micros[i] += profile.micros[i];
+            if (csv.is_open()) {
+                csv << gs.tickIndex() << "," << (hashOk ? 1 : 0) << "," << total;
+                for (const double us : profile.micros)
+                    csv << "," << us;
+                csv << "\n";
+            }
+        }
+
+        const double ticks = static_cast<double>(std::max<size_t>(totals.size(), 1));
+        std::cout << std::fixed << std::setprecision(2) << "recording: " << opts.recording << "\n"
+                  << "level:     " << header.levelPath << "\n"
+                  << "seed:      " << header.seed << "\n"
+                  << "ticks:     " << totals.size() << "\n"
+                  << "step us:   mean " << std::accumulate(totals.begin(), totals.end(), 0.0) / ticks << "  p50 "
+                  << percentile(totals, 0.50) << "  p99 " << percentile(totals, 0.99) << "  max "
+                  << (totals.empty() ? 0.0 : *std::ranges::max_element(totals)) << "\n";
+        for (size_t i = 0; i < sums.micros.size(); i++)
+            std::cout << "  " << std::left << std::setw(10) << Game::GameServer::StepProfile::NAMES[i] << std::right
+                      << " mean " << sums.micros[i] / ticks << " us\n";
+
+        if (!opts.verify)
+            return 0;
+        if (mismatches != 0) {
+            std::cerr << "{replay}: " << mismatches << " tick(s) diverged, first at tick " << firstMismatch
+                      << std::endl;
+            return 84;
+        }
+        std::cout << "hashes:    all " << totals.size() << " ticks match\n";
+        return 0;
+    }
+} // namespace
+
+int main(const int argc, char **argv)
+{
+    Options opts;
+
+    for (int i = 1; i < argc; i++) {
+        if (const std::string arg = argv[i]; arg == "-h" || arg == "--help") {
+            displayHelp(argv[0]);
+            return 0;
+        }
+    }
+    if (!parseOptions(argc, argv, opts)) {
+        std::cerr << "{replay}: Error parsing arguments. Use --help for usage information." << std::endl;
+        return 84;
+    }
+    try {
+        return replay(opts);
+    } catch (const std::exception &e) {
+        std::cerr << "{replay}: " << e.what() << std::endl;
+        return 84;
+    }
+}
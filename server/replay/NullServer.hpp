@@ -0,0 +1,71 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** NullServer
+*/
+
+#pragma once
+
+#include "IServer.hpp"
+
+namespace Replay
+{
+    /**
+     * @class NullServer
+     * @brief Socket-less IServer that drops every outgoing packet.
+     *
+     * Lets a GameServer run headless during a replay.
+     */
+    class NullServer final : public Net::Server::IServer {
+      public:
+        void configure(const std::string &, int32_t) override
+        {
+        }
+
+        void setNonBlocking(bool) noexcept override
+        {
+        }
+
+        bool isStoredIpCorrect() const noexcept override
+        {
+            return true;
+        }
+
+        bool isStoredPortCorrect() const noexcept override
+        {
+            return true;
+        }
+
+        bool sendPacket(const Net::IPacket &) noexcept override
+        {
+            return true;
+        }
+
+        void start() override
+        {
+        }
+
+        void stop() noexcept override
+        {
+        }
+
+        bool isRunning() const noexcept override
+        {
+            return false;
+        }
+
+        void setRunning(bool) noexcept override
+        {
+        }
+
+        void readPackets() noexcept override
+        {
+        }
+
+        bool popPacket(std::shared_ptr<Net::IPacket> &) noexcept override
+        {
+            return false;
+        }
+    };
+} // namespace Replay
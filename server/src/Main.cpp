@@ -5,8 +5,12 @@
 ** Main
 */
 
+#include <filesystem>
 #include <string>
+#include <vector>
 #include "ArgParser.hpp"
+#include "GatewayRuntime.hpp"
+#include "Log.hpp"
 #include "ServerRuntime.hpp"
 #include "SignalHandler.hpp"
 #include "TCPServer.hpp"
@@ -14,7 +18,8 @@
 
 namespace
 {
-    std::shared_ptr<Signal::SignalHandler> startSignalHandler(Net::Thread::ServerRuntime &runtime)
+    template <typename Runtime>
+    std::shared_ptr<Signal::SignalHandler> startSignalHandler(Runtime &runtime)
     {
         auto signalHandler = std::make_shared<Signal::SignalHandler>();
 
@@ -24,6 +29,87 @@ namespace
         });
         return signalHandler;
     }
+
+    std::vector<std::shared_ptr<Net::Server::IServer>> makeUdpServers(
+        const std::string &host, const int port, const std::size_t shards)
+    {
+        std::vector<std::shared_ptr<Net::Server::IServer>> udpServers;
+
+        for (std::size_t i = 0; i < shards; i++) {
+            const auto udpServer = std::make_shared<Net::Server::UDPServer>();
+            udpServer->setReusePort(shards > 1);
+            udpServer->configure(host, port);
+            udpServers.push_back(udpServer);
+        }
+        return udpServers;
+    }
+
+    /**
+     * @brief Hosts the lobby and the rooms in this process.
+     */
+    void runServer(const Utils::ArgParser &parser)
+    {
+        const int port = parser.getPort();
+        const auto tcpServer = std::make_shared<Net::Server::TCPServer>();
+        Net::Thread::ServerRuntime runtime(
+            makeUdpServers(parser.getHost(), port + 1, parser.getUdpShards()), tcpServer, parser.getRecordDir());
+
+        runtime.setJobThreads(parser.getJobThreads());
+        runtime.setPlacement(std::make_shared<const Utils::ThreadPlacement>(parser.getPlacement()));
+        runtime.setUdpPort(static_cast<std::uint16_t>(port + 1));
+        const auto signalHandler = startSignalHandler(runtime);
+        tcpServer->configure(parser.getHost(), port);
+        runtime.start();
+        runtime.wait();
+        signalHandler->stop();
+    }
+
+    /**
+     * @brief Hosts the rooms a gateway places here, playing on the UDP port after --port.
+     */
+    void runWorker(const Utils::ArgParser &parser)
+    {
+        const auto port = static_cast<std::uint16_t>(parser.getPort() + 1);
+        Net::Thread::ServerRuntime runtime(
+            makeUdpServers(parser.getHost(), port, parser.getUdpShards()), nullptr, parser.getRecordDir());
+
+        runtime.setJobThreads(parser.getJobThreads());
+        runtime.setPlacement(std::make_shared<const Utils::ThreadPlacement>(parser.getPlacement()));
+        runtime.setControlChannel(std::make_shared<Gateway::ControlChannel>(parser.getWorkerFd()), port);
+        const auto signalHandler = startSignalHandler(runtime);
+        runtime.start();
+        runtime.wait();
+        signalHandler->stop();
+    }
+
+    /**
+     * @brief Hosts the lobby and spreads the rooms over game workers, worker i started with --port <port> + i.
+     */
+    void runGateway(const Utils::ArgParser &parser)
+    {
+        const int port = parser.getPort();
+        const auto tcpServer = std::make_shared<Net::Server::TCPServer>();
+        std::error_code ec;
+        const auto self = std::filesystem::read_symlink("/proc/self/exe", ec);
+        const std::string executable = ec ? "/proc/self/exe" : self.string();
+
+        if (port + static_cast<int>(parser.getWorkers()) > 65535)
+            throw Utils::ParserError("{main} Not enough ports after --port for every worker");
+        Net::Thread::GatewayRuntime runtime(tcpServer, parser.getWorkers(), [&parser, port, executable](const std::size_t i) {
+            std::vector<std::string> args{"--host", parser.getHost(), "--port",
+                std::to_string(port + static_cast<int>(i)), "--udp-shards", std::to_string(parser.getUdpShards()),
+                "--jobs", std::to_string(parser.getJobThreads())};
+            if (!parser.getRecordDir().empty())
+                args.insert(args.end(), {"--record", parser.getRecordDir()});
+            return Gateway::WorkerProcess::spawn(executable, args);
+        });
+        runtime.setPlacement(std::make_shared<const Utils::ThreadPlacement>(parser.getPlacement()));
+        const auto signalHandler = startSignalHandler(runtime);
+        tcpServer->configure(parser.getHost(), port);
+        runtime.start();
+        runtime.wait();
+        signalHandler->stop();
+    }
 } // namespace
 
 int main(const int argc, char **argv)
@@ -32,25 +118,21 @@ int main(const int argc, char **argv)
     if (const Utils::ArgParseResult result = parser.parse(); result == Utils::ArgParseResult::HelpDisplayed) {
         return 0;
     } else if (result == Utils::ArgParseResult::Error) {
-        std::cerr << "{main}: Error parsing arguments. Use --help for usage information." << std::endl;
+        Log::error("main", "error parsing arguments, use --help for usage information");
+        Log::flush();
         return 84;
     }
-    const int port = parser.getPort();
-    auto host = parser.getHost();
     try {
-        const auto udpServer = std::make_shared<Net::Server::UDPServer>();
-        const auto tcpServer = std::make_shared<Net::Server::TCPServer>();
-
-        Net::Thread::ServerRuntime runtime(udpServer, tcpServer);
-        const auto signalHandler = startSignalHandler(runtime);
-
-        tcpServer->configure(host, port);
-        udpServer->configure(host, port + 1);
-        runtime.start();
-        runtime.wait();
-        signalHandler->stop();
+        if (parser.getWorkerFd() >= 0)
+            runWorker(parser);
+        else if (parser.getWorkers() > 0)
+            runGateway(parser);
+        else
+            runServer(parser);
+        Log::flush();
     } catch (const std::exception &e) {
-        std::cerr << "{main}: " << e.what() << std::endl;
+        Log::error("main", "fatal error", {{"error", e.what()}});
+        Log::flush();
         return 84;
     }
     return 0;
@@ -46,6 +46,7 @@ struct ShootEvent {
 /**
  * @struct DestroyEvent
  * @brief Event triggered when an entity is destroyed.
+ * The world destroys the entity when the registry is flushed, at the end of the step.
  */
 struct DestroyEvent {
     size_t entityId; ///> ID of the entity to be destroyed
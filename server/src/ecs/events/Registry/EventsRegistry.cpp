@@ -6,11 +6,18 @@
 */
 
 #include "EventsRegistry.hpp"
+#include <algorithm>
 
 namespace Ecs
 {
+    EventsRegistry::EventsRegistry(std::pmr::memory_resource *events, std::pmr::memory_resource *storage)
+        : _events(events), _queue(std::pmr::deque<QueuedEvent>(storage)), _deferred(storage)
+    {
+    }
+
     void EventsRegistry::process()
     {
+        mergeDeferred();
         while (!_queue.empty()) {
             const auto qe = std::move(_queue.front());
             _queue.pop();
@@ -24,4 +31,19 @@ namespace Ecs
         }
     }
 
+    void EventsRegistry::mergeDeferred()
+    {
+        std::scoped_lock lock(_deferredMutex);
+
+        if (_deferred.empty())
+            return;
+        std::ranges::stable_sort(_deferred, [](const DeferredEvent &a, const DeferredEvent &b) {
+            return a.chunk.section != b.chunk.section ? a.chunk.section < b.chunk.section
+                                                      : a.chunk.index < b.chunk.index;
+        });
+        for (auto &deferred : _deferred)
+            _queue.push(std::move(deferred.event));
+        _deferred.clear();
+    }
+
 } // namespace Ecs
\ No newline at end of file
@@ -9,10 +9,13 @@
 
 #include <functional>
 #include <memory>
+#include <memory_resource>
+#include <mutex>
 #include <queue>
 #include <typeindex>
 #include <vector>
 #include "Events.hpp"
+#include "JobSystem.hpp"
 #include <unordered_map>
 
 namespace Ecs
@@ -21,9 +24,24 @@ namespace Ecs
      * @brief Registry for event handling in the ECS framework.
      * Allows subscribing to events and emitting them.
      * Events are processed in a queued manner to ensure order of handling.
+     * Events emitted from a chunk of a parallel view are buffered and queued in chunk order, so the
+     * queue holds them in the order a serial run would have emitted them.
      */
     class EventsRegistry {
       public:
+        /**
+         * @brief Constructs a registry allocating from the default resource.
+         */
+        EventsRegistry() = default;
+
+        /**
+         * @brief Constructs a registry allocating from memory resources.
+         * @param events Resource of the event payloads, which may be released once process() returned.
+         * @param storage Resource of the queues.
+         */
+        explicit EventsRegistry(
+            std::pmr::memory_resource *events, std::pmr::memory_resource *storage = std::pmr::get_default_resource());
+
         /**
          * @brief Subscribe to a specific event type with a callback function.
          * @tparam Event The type of event to subscribe to.
@@ -34,6 +52,7 @@ namespace Ecs
 
         /**
          * @brief Emit an event, queuing it for processing
+         * Safe to call from the chunks of a parallel view.
          * @tparam Event The type of event to emit.
          * @param event The event instance to emit.
          */
@@ -58,7 +77,24 @@ namespace Ecs
             std::shared_ptr<const void> data; ///> Shared pointer to the event data
         };
 
-        std::queue<QueuedEvent> _queue; ///> Queue of events to be processed
+        /**
+         * @brief Event emitted from a chunk of a parallel view, waiting to be queued.
+         */
+        struct DeferredEvent {
+            JobSystem::Chunk chunk; ///> Chunk that emitted the event
+            QueuedEvent event;      ///> The event
+        };
+
+        /**
+         * @brief Queues the deferred events, ordered by run and chunk.
+         */
+        void mergeDeferred();
+
+        std::pmr::memory_resource *_events = std::pmr::get_default_resource(); ///> Resource of the event payloads
+        std::queue<QueuedEvent, std::pmr::deque<QueuedEvent>> _queue;          ///> Queue of events to be processed
+
+        std::mutex _deferredMutex;                 ///> Protects _deferred
+        std::pmr::vector<DeferredEvent> _deferred; ///> Events emitted from parallel chunks
     };
 } // namespace Ecs
 
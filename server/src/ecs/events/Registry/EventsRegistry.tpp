@@ -21,7 +21,18 @@ namespace Ecs
     template <typename Event>
     void EventsRegistry::emit(const Event &event)
     {
-        _queue.push(QueuedEvent{typeid(Event), std::make_shared<Event>(event)});
+        const auto queued = [&] {
+            const std::pmr::polymorphic_allocator<Event> allocator(_events);
+            return QueuedEvent{typeid(Event), std::allocate_shared<Event>(allocator, event)};
+        };
+
+        if (const auto *chunk = JobSystem::currentChunk()) {
+            std::scoped_lock lock(_deferredMutex);
+            _deferred.push_back(DeferredEvent{*chunk, queued()});
+            return;
+        }
+        mergeDeferred();
+        _queue.push(queued());
     }
 
 } // namespace Ecs
@@ -6,63 +6,60 @@
 */
 
 #include "CollisionSystem.hpp"
+#include <vector>
 
 namespace
 {
-    [[nodiscard]] bool intersects(
-        const Ecs::Position &a, const Ecs::Collision &ac, const Ecs::Position &b, const Ecs::Collision &bc)
-    {
-        return !(a.x > b.x + bc.width || a.x + ac.width < b.x || a.y > b.y + bc.height || a.y + ac.height < b.y);
-    }
-
-    [[nodiscard]] bool bothAI(const Ecs::Registry &reg, const size_t a, const size_t b)
-    {
-        return reg.hasComponent<Ecs::AIBrain>(Ecs::Entity(a)) && reg.hasComponent<Ecs::AIBrain>(Ecs::Entity(b));
-    }
+    /**
+     * @brief What the pair test needs to know about an entity, gathered in one pass.
+     */
+    struct Collider {
+        size_t id;               ///> Entity ID
+        Ecs::Position pos;       ///> Top-left corner
+        Ecs::Collision col;      ///> Collision box
+        bool ai = false;         ///> Whether the entity is an enemy
+        bool projectile = false; ///> Whether the entity is a projectile
+        size_t shooter = 0;      ///> Shooter of the projectile
+    };
 
-    [[nodiscard]] bool sameShooter(Ecs::Registry &reg, const size_t a, const size_t b)
+    [[nodiscard]] bool intersects(const Collider &a, const Collider &b)
     {
-        const auto &shootArr = reg.getComponents<Ecs::Projectile>();
-        return shootArr.at(a) && shootArr.at(b) && shootArr.at(a)->shooter == shootArr.at(b)->shooter;
+        return !(a.pos.x > b.pos.x + b.col.width || a.pos.x + a.col.width < b.pos.x
+            || a.pos.y > b.pos.y + b.col.height || a.pos.y + a.col.height < b.pos.y);
     }
 
-    [[nodiscard]] bool projectileHitsShooter(Ecs::Registry &reg, const size_t projectileIdx, const size_t targetIdx)
+    /**
+     * @brief Tells whether two overlapping entities ignore each other: two enemies, a projectile
+     * and its shooter, or two projectiles of the same shooter.
+     */
+    [[nodiscard]] bool ignored(const Collider &a, const Collider &b)
     {
-        const auto &projectile = reg.getComponents<Ecs::Projectile>().at(projectileIdx);
-        return projectile && projectile->shooter == targetIdx;
+        if (a.ai && b.ai)
+            return true;
+        if ((a.projectile && a.shooter == b.id) || (b.projectile && b.shooter == a.id))
+            return true;
+        return a.projectile && b.projectile && a.shooter == b.shooter;
     }
 } // namespace
 
 namespace Game
 {
-
     void CollisionSystem::update(IGameWorld &world)
     {
-        auto &reg = world.registry();
+        std::vector<Collider> colliders;
 
-        auto &posArr = reg.getComponents<Ecs::Position>();
-        auto &colArr = reg.getComponents<Ecs::Collision>();
+        world.registry().view<Ecs::Position, Ecs::Collision>(Ecs::Optional<Ecs::AIBrain, Ecs::Projectile>{},
+            [&colliders](const Ecs::Entity e, const Ecs::Position &pos, const Ecs::Collision &col,
+                const Ecs::AIBrain *ai, const Ecs::Projectile *projectile) {
+                colliders.push_back({static_cast<size_t>(e), pos, col, ai != nullptr, projectile != nullptr,
+                    projectile ? projectile->shooter : 0});
+            });
 
-        for (size_t i = 0; i < posArr.size(); i++) {
-            const auto &posA = posArr.at(i);
-            const auto &colA = colArr.at(i);
-            if (!posA || !colA)
-                continue;
-
-            for (size_t j = i + 1; j < posArr.size(); j++) {
-                const auto &posB = posArr.at(j);
-                const auto &colB = colArr.at(j);
-                if (!posB || !colB)
-                    continue;
-                if (!intersects(*posA, *colA, *posB, *colB))
-                    continue;
-                if (bothAI(reg, i, j))
-                    continue;
-                if (projectileHitsShooter(reg, i, j) || projectileHitsShooter(reg, j, i))
-                    continue;
-                if (sameShooter(reg, i, j))
+        for (size_t i = 0; i < colliders.size(); i++) {
+            for (size_t j = i + 1; j < colliders.size(); j++) {
+                if (!intersects(colliders[i], colliders[j]) || ignored(colliders[i], colliders[j]))
                     continue;
-                world.events().emit(CollisionEvent{i, j});
+                world.events().emit(CollisionEvent{colliders[i].id, colliders[j].id});
             }
         }
     }
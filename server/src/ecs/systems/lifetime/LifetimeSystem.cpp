@@ -10,14 +10,18 @@
 
 namespace Game
 {
-    void LifetimeSystem::update(IGameWorld &world, const float dt)
+    void LifetimeSystem::update(IGameWorld &world, const float dt, Ecs::JobSystem *jobs)
     {
         auto &reg = world.registry();
-
-        reg.view<Ecs::Lifetime>([&](const Ecs::Entity e, Ecs::Lifetime &life) {
+        const auto age = [&](const Ecs::Entity e, Ecs::Lifetime &life) {
             life.remaining -= dt;
             if (life.remaining <= 0.f)
                 world.events().emit<DestroyEvent>(DestroyEvent{static_cast<size_t>(e)});
-        });
+        };
+
+        if (jobs)
+            reg.parallelView<Ecs::Lifetime>(*jobs, age);
+        else
+            reg.view<Ecs::Lifetime>(age);
     }
 } // namespace Game
\ No newline at end of file
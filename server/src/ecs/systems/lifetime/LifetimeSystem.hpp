@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include "JobSystem.hpp"
 #include "World.hpp"
 
 namespace Game
@@ -23,7 +24,8 @@ namespace Game
          *
          * @param world The game world containing components.
          * @param dt The delta time since the last update.
+         * @param jobs Job system splitting the entities into parallel chunks, or nullptr to run serially.
          */
-        static void update(IGameWorld &world, float dt);
+        static void update(IGameWorld &world, float dt, Ecs::JobSystem *jobs = nullptr);
     };
 } // namespace Game
\ No newline at end of file
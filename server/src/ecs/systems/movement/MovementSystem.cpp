@@ -9,17 +9,20 @@
 
 namespace Game
 {
-    void MovementSystem::update(IGameWorld &world, const float dt)
+    void MovementSystem::update(IGameWorld &world, const float dt, Ecs::JobSystem *jobs)
     {
         auto &reg = world.registry();
+        const auto move = [&](const Ecs::Entity entity, Ecs::Position &pos, const Ecs::Velocity &vel) {
+            pos.x += vel.vx * dt;
+            pos.y += vel.vy * dt;
 
-        reg.view<Ecs::Position, Ecs::Velocity>(
-            [&](const Ecs::Entity entity, Ecs::Position &pos, const Ecs::Velocity &vel) {
-                pos.x += vel.vx * dt;
-                pos.y += vel.vy * dt;
+            if (pos.x < 0 || pos.y < 0)
+                world.events().emit<DestroyEvent>(DestroyEvent{static_cast<size_t>(entity)});
+        };
 
-                if (pos.x < 0 || pos.y < 0)
-                    world.events().emit<DestroyEvent>(DestroyEvent{static_cast<size_t>(entity)});
-            });
+        if (jobs)
+            reg.parallelView<Ecs::Position, Ecs::Velocity>(*jobs, move);
+        else
+            reg.group<Ecs::Position, Ecs::Velocity>().each(move);
     }
 } // namespace Game
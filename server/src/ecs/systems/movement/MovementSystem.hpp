@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include "JobSystem.hpp"
 #include "World.hpp"
 
 namespace Game
@@ -24,8 +25,9 @@ namespace Game
          *
          * @param world The ECS world.
          * @param dt    Time elapsed since last frame (seconds).
+         * @param jobs  Job system splitting the entities into parallel chunks, or nullptr to run serially.
          */
-        static void update(IGameWorld &world, float dt);
+        static void update(IGameWorld &world, float dt, Ecs::JobSystem *jobs = nullptr);
     };
 
 } // namespace Game
@@ -0,0 +1,131 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** ProjectileSystem
+*/
+
+#include "ProjectileSystem.hpp"
+#include <algorithm>
+#include <numeric>
+
+#if defined(__SSE2__)
+    #include <emmintrin.h>
+#endif
+
+namespace
+{
+    constexpr float Size = Game::ProjectilePool::SIZE;
+
+    /**
+     * @brief Collision box of an entity projectiles can hit.
+     */
+    struct Target {
+        size_t id;       ///> Entity id
+        float left;      ///> Left edge
+        float top;       ///> Top edge
+        float right;     ///> Right edge
+        float bottom;    ///> Bottom edge
+        bool hasHealth;  ///> True if the entity can take damage
+        bool damageBack; ///> True if the entity destroys the projectiles hitting it
+    };
+
+    [[nodiscard]] bool misses(const float px, const float py, const Target &t) noexcept
+    {
+        return px > t.right || px + Size < t.left || py > t.bottom || py + Size < t.top;
+    }
+
+    void hit(Game::IGameWorld &world, Game::ProjectilePool &pool, const size_t i, const Target &target)
+    {
+        if (pool.shooter[i] == target.id)
+            return;
+        if (target.hasHealth)
+            world.events().emit(DamageEvent{pool.ids[i], target.id, pool.damage[i]});
+        if (target.damageBack)
+            pool.kill(i);
+    }
+
+    void collideTarget(Game::IGameWorld &world, Game::ProjectilePool &pool, const Target &target)
+    {
+        const size_t count = pool.size();
+        size_t i = 0;
+
+#if defined(__SSE2__)
+        const __m128 left = _mm_set1_ps(target.left);
+        const __m128 top = _mm_set1_ps(target.top);
+        const __m128 right = _mm_set1_ps(target.right);
+        const __m128 bottom = _mm_set1_ps(target.bottom);
+        const __m128 size = _mm_set1_ps(Size);
+
+        for (; i + 4 <= count; i += 4) {
+            const __m128 px = _mm_loadu_ps(&pool.x[i]);
+            const __m128 py = _mm_loadu_ps(&pool.y[i]);
+            const __m128 missX = _mm_or_ps(_mm_cmpgt_ps(px, right), _mm_cmplt_ps(_mm_add_ps(px, size), left));
+            const __m128 missY = _mm_or_ps(_mm_cmpgt_ps(py, bottom), _mm_cmplt_ps(_mm_add_ps(py, size), top));
+            const int hits = ~_mm_movemask_ps(_mm_or_ps(missX, missY)) & 0xF;
+
+            for (size_t lane = 0; hits != 0 && lane < 4; lane++) {
+                if ((hits >> lane) & 1)
+                    hit(world, pool, i + lane, target);
+            }
+        }
+#endif
+        for (; i < count; i++) {
+            if (!misses(pool.x[i], pool.y[i], target))
+                hit(world, pool, i, target);
+        }
+    }
+
+    void collideEntities(Game::IGameWorld &world, Game::ProjectilePool &pool)
+    {
+        auto &reg = world.registry();
+        std::vector<Target> targets;
+
+        reg.view<Ecs::Position, Ecs::Collision>(
+            [&](const Ecs::Entity e, const Ecs::Position &pos, const Ecs::Collision &col) {
+                const auto &dmg = reg.getComponents<Ecs::Damage>().at(static_cast<size_t>(e));
+                targets.push_back(Target{static_cast<size_t>(e), pos.x, pos.y, pos.x + col.width,
+                    pos.y + col.height, reg.hasComponent<Ecs::Health>(e), dmg && dmg->amount > 0});
+            });
+        for (const auto &target : targets)
+            collideTarget(world, pool, target);
+    }
+
+    void collideProjectiles(Game::ProjectilePool &pool)
+    {
+        std::vector<size_t> order(pool.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::ranges::sort(order, [&pool](const size_t a, const size_t b) {
+            return pool.x[a] < pool.x[b] || (pool.x[a] == pool.x[b] && a < b);
+        });
+
+        for (size_t i = 0; i < order.size(); i++) {
+            const size_t a = order[i];
+            for (size_t j = i + 1; j < order.size() && pool.x[order[j]] <= pool.x[a] + Size; j++) {
+                const size_t b = order[j];
+                if (pool.y[a] > pool.y[b] + Size || pool.y[a] + Size < pool.y[b])
+                    continue;
+                if (pool.shooter[a] == pool.shooter[b])
+                    continue;
+                if (pool.damage[a] > 0)
+                    pool.kill(b);
+                if (pool.damage[b] > 0)
+                    pool.kill(a);
+            }
+        }
+    }
+} // namespace
+
+namespace Game
+{
+    void ProjectileSystem::update(IGameWorld &world, const float dt)
+    {
+        auto &pool = world.projectiles();
+        if (pool.size() == 0)
+            return;
+
+        pool.integrate(dt);
+        collideEntities(world, pool);
+        collideProjectiles(pool);
+    }
+} // namespace Game
@@ -0,0 +1,37 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** ProjectileSystem
+*/
+
+#pragma once
+
+#include "World.hpp"
+
+namespace Game
+{
+    /**
+     * @brief System that simulates the projectiles stored in the world ProjectilePool.
+     *
+     * Replaces MovementSystem, CollisionSystem and LifetimeSystem for projectiles:
+     * integrates and expires the whole pool, tests it against every entity with a
+     * Position and a Collision box, and against the other projectiles.
+     * Should be executed after MovementSystem, and the pool compacted once the
+     * step events have been processed.
+     */
+    class ProjectileSystem {
+      public:
+        /**
+         * @brief Move, age and collide every projectile.
+         *
+         * Emits a DamageEvent for every hit on an entity with Health. A projectile is
+         * consumed when it hits an entity that deals damage back, or a projectile of
+         * another shooter.
+         *
+         * @param world The game world containing the projectiles.
+         * @param dt    Time elapsed since last frame (seconds).
+         */
+        static void update(IGameWorld &world, float dt);
+    };
+} // namespace Game
@@ -6,16 +6,27 @@
 */
 
 #include "SnapshotSystem.hpp"
+#include <limits>
 
 namespace Game
 {
     void SnapshotSystem::update(IGameWorld &world, std::vector<SnapshotEntity> &snapshot)
     {
         auto &reg = world.registry();
+        const auto &pool = world.projectiles();
+        size_t next = 0;
         snapshot.clear();
 
+        const auto addProjectilesBefore = [&](const size_t id) {
+            for (; next < pool.size() && pool.ids[next] < id; next++) {
+                if (!pool.dead[next])
+                    snapshot.push_back({pool.ids[next], pool.x[next], pool.y[next], ProjectilePool::SPRITE_ID});
+            }
+        };
+
         reg.view<Ecs::Drawable, Ecs::Position>(
             [&](const Ecs::Entity &entity, const Ecs::Drawable &draw, const Ecs::Position &pos) {
+                addProjectilesBefore(static_cast<size_t>(entity));
                 SnapshotEntity s{};
                 s.id = static_cast<size_t>(entity);
                 s.x = pos.x;
@@ -24,5 +35,6 @@ namespace Game
 
                 snapshot.push_back(s);
             });
+        addProjectilesBefore(std::numeric_limits<size_t>::max());
     }
 } // namespace Game
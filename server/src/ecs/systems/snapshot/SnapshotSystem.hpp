@@ -27,7 +27,8 @@ namespace Game
          * @brief Update the snapshot based on the current game world state.
          *
          * This method iterates over all entities with Position and Drawable
-         * components and collects their data into the provided snapshot vector.
+         * components, and over the live projectiles of the pool, and collects
+         * their data into the provided snapshot vector, ordered by entity id.
          *
          * @param world The game world to snapshot.
          * @param out The vector to populate with snapshot entities.
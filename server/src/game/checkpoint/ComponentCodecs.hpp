@@ -0,0 +1,111 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** ComponentCodecs
+*/
+
+#pragma once
+
+#include "AIBrain.hpp"
+#include "AIShoot.hpp"
+#include "Attack.hpp"
+#include "Codec.hpp"
+#include "Collision.hpp"
+#include "Controllable.hpp"
+#include "Damage.hpp"
+#include "Damageable.hpp"
+#include "Direction.hpp"
+#include "Drawable.hpp"
+#include "Health.hpp"
+#include "InputComponent.hpp"
+#include "KillScore.hpp"
+#include "Lifetime.hpp"
+#include "Position.hpp"
+#include "Projectile.hpp"
+#include "Score.hpp"
+#include "Target.hpp"
+#include "Velocity.hpp"
+
+/**
+ * @brief Codecs of the gameplay components, for Ecs::Serializer.
+ *
+ * IDs name the pools in checkpoints: never reuse or renumber one, append new components instead.
+ */
+namespace Ecs
+{
+    template <>
+    struct Codec<Position> : TrivialCodec<Position, 1> {};
+    template <>
+    struct Codec<Velocity> : TrivialCodec<Velocity, 2> {};
+    template <>
+    struct Codec<Health> : TrivialCodec<Health, 3> {};
+    template <>
+    struct Codec<Drawable> : TrivialCodec<Drawable, 4> {};
+    template <>
+    struct Codec<Collision> : TrivialCodec<Collision, 5> {};
+    template <>
+    struct Codec<Damage> : TrivialCodec<Damage, 6> {};
+    template <>
+    struct Codec<Damageable> : TrivialCodec<Damageable, 7> {};
+    template <>
+    struct Codec<Game::InputComponent> : TrivialCodec<Game::InputComponent, 8> {};
+    template <>
+    struct Codec<Score> : TrivialCodec<Score, 9> {};
+    template <>
+    struct Codec<KillScore> : TrivialCodec<KillScore, 10> {};
+    template <>
+    struct Codec<Lifetime> : TrivialCodec<Lifetime, 11> {};
+    template <>
+    struct Codec<AIBrain> : TrivialCodec<AIBrain, 12> {};
+    template <>
+    struct Codec<Projectile> : TrivialCodec<Projectile, 13> {};
+    template <>
+    struct Codec<Attack> : TrivialCodec<Attack, 14> {};
+    template <>
+    struct Codec<Controllable> : TrivialCodec<Controllable, 15> {};
+    template <>
+    struct Codec<Direction> : TrivialCodec<Direction, 16> {};
+    template <>
+    struct Codec<Target> : TrivialCodec<Target, 17> {};
+
+    /**
+     * @brief Codec of AIShoot, whose firing angles live on the heap.
+     */
+    template <>
+    struct Codec<AIShoot> {
+        static constexpr std::uint32_t ID = 18; ///> Pool identifier of the type
+
+        static void write(ByteWriter &out, const AIShoot &shoot)
+        {
+            out.writeFixed(static_cast<std::uint64_t>(shoot.type), 1);
+            out.writeBytes(&shoot.cooldown, sizeof(float));
+            out.writeBytes(&shoot.timer, sizeof(float));
+            out.writeBytes(&shoot.projectileSpeed, sizeof(float));
+            out.writeBytes(&shoot.damage, sizeof(int));
+            out.writeBytes(&shoot.muzzle.first, sizeof(float));
+            out.writeBytes(&shoot.muzzle.second, sizeof(float));
+            out.writeVarint(shoot.angles.size());
+            out.writeBytes(shoot.angles.data(), shoot.angles.size() * sizeof(float));
+        }
+
+        static AIShoot read(ByteReader &in)
+        {
+            AIShoot shoot{};
+
+            shoot.type = static_cast<AIShoot::Type>(in.readFixed(1));
+            in.readBytes(&shoot.cooldown, sizeof(float));
+            in.readBytes(&shoot.timer, sizeof(float));
+            in.readBytes(&shoot.projectileSpeed, sizeof(float));
+            in.readBytes(&shoot.damage, sizeof(int));
+            in.readBytes(&shoot.muzzle.first, sizeof(float));
+            in.readBytes(&shoot.muzzle.second, sizeof(float));
+            const std::uint64_t count = in.readVarint();
+            if (count > in.remaining() / sizeof(float))
+                throw SerializeError("{Codec<AIShoot>::read} Truncated angles");
+            shoot.angles.resize(count);
+            in.readBytes(shoot.angles.data(), count * sizeof(float));
+            return shoot;
+        }
+    };
+} // namespace Ecs
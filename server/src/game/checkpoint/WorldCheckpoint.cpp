@@ -0,0 +1,104 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** WorldCheckpoint
+*/
+
+#include "WorldCheckpoint.hpp"
+#include "ComponentCodecs.hpp"
+#include "Serializer.hpp"
+
+namespace
+{
+    /**
+     * @brief Gets the serializer knowing every gameplay component.
+     */
+    const Ecs::Serializer &serializer()
+    {
+        static const Ecs::Serializer instance = [] {
+            Ecs::Serializer s;
+            s.add<Ecs::Position>()
+                .add<Ecs::Velocity>()
+                .add<Ecs::Health>()
+                .add<Ecs::Drawable>()
+                .add<Ecs::Collision>()
+                .add<Ecs::Damage>()
+                .add<Ecs::Damageable>()
+                .add<Game::InputComponent>()
+                .add<Ecs::Score>()
+                .add<Ecs::KillScore>()
+                .add<Ecs::Lifetime>()
+                .add<Ecs::AIBrain>()
+                .add<Ecs::Projectile>()
+                .add<Ecs::Attack>()
+                .add<Ecs::Controllable>()
+                .add<Ecs::Direction>()
+                .add<Ecs::Target>()
+                .add<Ecs::AIShoot>();
+            return s;
+        }();
+        return instance;
+    }
+
+    template <typename T>
+    void writeColumn(Ecs::ByteWriter &out, const std::vector<T> &column)
+    {
+        out.writeBytes(column.data(), column.size() * sizeof(T));
+    }
+
+    template <typename T>
+    void readColumn(Ecs::ByteReader &in, std::vector<T> &column, const size_t count)
+    {
+        column.resize(count);
+        in.readBytes(column.data(), count * sizeof(T));
+    }
+} // namespace
+
+namespace Game
+{
+    void WorldCheckpoint::save(IGameWorld &world, std::vector<std::uint8_t> &out)
+    {
+        Ecs::ByteWriter writer(out);
+        const auto &pool = world.projectiles();
+
+        serializer().save(world.registry(), writer);
+        writer.writeVarint(pool.size());
+        writeColumn(writer, pool.ids);
+        writeColumn(writer, pool.x);
+        writeColumn(writer, pool.y);
+        writeColumn(writer, pool.vx);
+        writeColumn(writer, pool.vy);
+        writeColumn(writer, pool.remaining);
+        writeColumn(writer, pool.damage);
+        writeColumn(writer, pool.shooter);
+        writeColumn(writer, pool.dead);
+    }
+
+    void WorldCheckpoint::load(IGameWorld &world, const std::uint8_t *data, const size_t size)
+    {
+        Ecs::ByteReader reader(data, size);
+        auto &pool = world.projectiles();
+
+        pool.clear();
+        serializer().load(world.registry(), reader);
+        try {
+            const std::uint64_t count = reader.readVarint();
+            if (count > reader.remaining())
+                throw Ecs::SerializeError("{WorldCheckpoint::load} Truncated projectile pool");
+            readColumn(reader, pool.ids, count);
+            readColumn(reader, pool.x, count);
+            readColumn(reader, pool.y, count);
+            readColumn(reader, pool.vx, count);
+            readColumn(reader, pool.vy, count);
+            readColumn(reader, pool.remaining, count);
+            readColumn(reader, pool.damage, count);
+            readColumn(reader, pool.shooter, count);
+            readColumn(reader, pool.dead, count);
+        } catch (...) {
+            pool.clear();
+            world.registry().clear();
+            throw;
+        }
+    }
+} // namespace Game
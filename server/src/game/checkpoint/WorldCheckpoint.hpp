@@ -0,0 +1,49 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** WorldCheckpoint
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "IGameWorld.hpp"
+
+namespace Game
+{
+    /**
+     * @brief Saves the simulated state of a world to a binary blob and restores it.
+     *
+     * The blob holds the registry, as written by Ecs::Serializer with the codecs of
+     * ComponentCodecs.hpp, followed by the projectile pool:
+     *   varint slot count | per slot: ids, x, y, vx, vy, remaining, damage, shooter, dead
+     * Take it between two steps, once the events are processed and the registry flushed,
+     * as GameServer::update() leaves the world. The room's random generator, sessions and
+     * level progression are owned by the GameServer and are not part of the blob.
+     */
+    class WorldCheckpoint {
+      public:
+        /**
+         * @brief Appends the state of a world to a buffer.
+         * @param world The world to save.
+         * @param out The buffer to append to.
+         * @throws Ecs::SerializeError if the registry has pending deferred operations.
+         */
+        static void save(IGameWorld &world, std::vector<std::uint8_t> &out);
+
+        /**
+         * @brief Replaces the state of a world with a blob written by save().
+         *
+         * Event subscriptions of the world are kept; its event queue should be empty.
+         *
+         * @param world The world to restore.
+         * @param data The first byte of the blob.
+         * @param size The number of bytes of the blob.
+         * @throws Ecs::SerializeError if the blob is malformed, leaving the world empty.
+         */
+        static void load(IGameWorld &world, const std::uint8_t *data, size_t size);
+    };
+} // namespace Game
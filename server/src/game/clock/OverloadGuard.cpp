@@ -0,0 +1,115 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** OverloadGuard
+*/
+
+#include "OverloadGuard.hpp"
+#include <algorithm>
+
+namespace Game
+{
+    OverloadGuard::OverloadGuard(const double stepDuration) noexcept : OverloadGuard(stepDuration, Config())
+    {
+    }
+
+    OverloadGuard::OverloadGuard(const double stepDuration, const Config &config) noexcept
+        : _stepDuration(stepDuration)
+    {
+        configure(config);
+    }
+
+    void OverloadGuard::configure(const Config &config) noexcept
+    {
+        _config = config;
+        _config.maxSteps = std::max<std::uint32_t>(_config.maxSteps, 1);
+        _config.lowLoad = std::min(_config.lowLoad, _config.highLoad);
+        _config.minTimeScale = std::clamp(_config.minTimeScale, 0.0, 1.0);
+        _config.aiFireRate = std::clamp(_config.aiFireRate, 0.0f, 1.0f);
+        _load.store(0.0, std::memory_order_relaxed);
+        _timeScale.store(1.0, std::memory_order_relaxed);
+        _overloaded.store(false, std::memory_order_relaxed);
+        _overloads.store(0, std::memory_order_relaxed);
+        _droppedMicros.store(0, std::memory_order_relaxed);
+        _dilatedMicros.store(0, std::memory_order_relaxed);
+    }
+
+    const OverloadGuard::Config &OverloadGuard::config() const noexcept
+    {
+        return _config;
+    }
+
+    double OverloadGuard::admit(const double frameTime) noexcept
+    {
+        const double scale = _timeScale.load(std::memory_order_relaxed);
+
+        if (scale >= 1.0)
+            return frameTime;
+        add(_dilatedMicros, frameTime * (1.0 - scale));
+        return frameTime * scale;
+    }
+
+    void OverloadGuard::onSteps(const std::uint32_t steps, const double seconds) noexcept
+    {
+        if (steps == 0)
+            return;
+        const double sample = seconds / (static_cast<double>(steps) * _stepDuration);
+        double load = _load.load(std::memory_order_relaxed);
+        load += SMOOTHING * (sample - load);
+        _load.store(load, std::memory_order_relaxed);
+
+        bool overloaded = _overloaded.load(std::memory_order_relaxed);
+        if (!overloaded && load > _config.highLoad) {
+            overloaded = true;
+            _overloads.fetch_add(1, std::memory_order_relaxed);
+        } else if (overloaded && load < _config.lowLoad) {
+            overloaded = false;
+        }
+        _overloaded.store(overloaded, std::memory_order_relaxed);
+
+        const double scale = overloaded ? std::clamp(_config.highLoad / load, _config.minTimeScale, 1.0) : 1.0;
+        _timeScale.store(scale, std::memory_order_relaxed);
+    }
+
+    void OverloadGuard::onDropped(const double seconds) noexcept
+    {
+        add(_droppedMicros, seconds);
+    }
+
+    bool OverloadGuard::overloaded() const noexcept
+    {
+        return _overloaded.load(std::memory_order_relaxed);
+    }
+
+    double OverloadGuard::load() const noexcept
+    {
+        return _load.load(std::memory_order_relaxed);
+    }
+
+    double OverloadGuard::timeScale() const noexcept
+    {
+        return _timeScale.load(std::memory_order_relaxed);
+    }
+
+    std::uint64_t OverloadGuard::overloads() const noexcept
+    {
+        return _overloads.load(std::memory_order_relaxed);
+    }
+
+    double OverloadGuard::droppedTime() const noexcept
+    {
+        return static_cast<double>(_droppedMicros.load(std::memory_order_relaxed)) / 1e6;
+    }
+
+    double OverloadGuard::dilatedTime() const noexcept
+    {
+        return static_cast<double>(_dilatedMicros.load(std::memory_order_relaxed)) / 1e6;
+    }
+
+    void OverloadGuard::add(std::atomic<std::uint64_t> &counter, const double seconds) noexcept
+    {
+        if (seconds > 0.0)
+            counter.fetch_add(static_cast<std::uint64_t>(seconds * 1e6), std::memory_order_relaxed);
+    }
+} // namespace Game
@@ -0,0 +1,139 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** OverloadGuard
+*/
+
+#pragma once
+#include <atomic>
+#include <cstdint>
+
+namespace Game
+{
+    /**
+     * @class OverloadGuard
+     * @brief Keeps a room that cannot simulate in real time from spiralling.
+     * @details The load is the smoothed wall time a fixed step costs, over the fixed step duration.
+     * - A tick runs at most maxSteps fixed steps; the time left behind beyond one step is dropped.
+     * - Once the load exceeds highLoad the room is overloaded until it falls below lowLoad.
+     * - While overloaded, simulated time is dilated: it runs slower than the wall clock, just enough
+     *   to bring the load back to highLoad, but never below minTimeScale.
+     * - While overloaded, the room may also send fewer snapshots and slow down enemy fire.
+     * Fed by the room's thread; the getters may be called from any thread.
+     */
+    class OverloadGuard {
+      public:
+        /**
+         * @brief Bounds and thresholds of the guard.
+         */
+        struct Config {
+            std::uint32_t maxSteps = 4;         ///> Most fixed steps run by one tick
+            double highLoad = 0.9;              ///> Load above which the room is overloaded
+            double lowLoad = 0.6;               ///> Load below which an overloaded room recovers
+            double minTimeScale = 0.5;          ///> Slowest simulated time may run, relative to the wall clock
+            std::uint32_t snapshotInterval = 6; ///> Fewest steps between snapshots while overloaded, 0 to keep
+            float aiFireRate = 1.0f;            ///> Share of enemy fire rate kept while overloaded, 1 to keep
+        };
+
+        static constexpr double SMOOTHING = 0.2; ///> Weight of a new sample in the load average
+
+        /**
+         * @brief Constructs a guard with the default bounds and thresholds.
+         * @param stepDuration Duration of a fixed step, in seconds.
+         */
+        explicit OverloadGuard(double stepDuration) noexcept;
+
+        /**
+         * @brief Constructs a guard.
+         * @param stepDuration Duration of a fixed step, in seconds.
+         * @param config The bounds and thresholds.
+         */
+        OverloadGuard(double stepDuration, const Config &config) noexcept;
+
+        /**
+         * @brief Replaces the bounds and thresholds, forgetting the load.
+         * @param config The bounds and thresholds.
+         */
+        void configure(const Config &config) noexcept;
+
+        /**
+         * @brief Gets the bounds and thresholds.
+         * @return The configuration.
+         */
+        [[nodiscard]] const Config &config() const noexcept;
+
+        /**
+         * @brief Converts the wall time elapsed since the last tick to time to simulate.
+         * @param frameTime Wall time since the last tick, in seconds.
+         * @return The time to simulate, shorter than frameTime while overloaded.
+         */
+        [[nodiscard]] double admit(double frameTime) noexcept;
+
+        /**
+         * @brief Records the fixed steps a tick ran and how long they took.
+         * @param steps Fixed steps run, zero ones are ignored.
+         * @param seconds Wall time they took.
+         */
+        void onSteps(std::uint32_t steps, double seconds) noexcept;
+
+        /**
+         * @brief Records time left behind because a tick reached maxSteps.
+         * @param seconds Simulated time dropped.
+         */
+        void onDropped(double seconds) noexcept;
+
+        /**
+         * @brief Tells whether the room is overloaded.
+         * @return True between crossing highLoad and falling back below lowLoad.
+         */
+        [[nodiscard]] bool overloaded() const noexcept;
+
+        /**
+         * @brief Gets the smoothed load.
+         * @return Wall time of a fixed step over its duration; above 1 the room cannot keep up.
+         */
+        [[nodiscard]] double load() const noexcept;
+
+        /**
+         * @brief Gets how fast simulated time runs.
+         * @return 1 when not overloaded, down to minTimeScale.
+         */
+        [[nodiscard]] double timeScale() const noexcept;
+
+        /**
+         * @brief Gets the number of times the room became overloaded.
+         * @return The count since the guard was configured.
+         */
+        [[nodiscard]] std::uint64_t overloads() const noexcept;
+
+        /**
+         * @brief Gets the simulated time dropped because ticks reached maxSteps.
+         * @return The dropped time, in seconds.
+         */
+        [[nodiscard]] double droppedTime() const noexcept;
+
+        /**
+         * @brief Gets the wall time not simulated because of time dilation.
+         * @return The dilated time, in seconds.
+         */
+        [[nodiscard]] double dilatedTime() const noexcept;
+
+      private:
+        /**
+         * @brief Adds seconds to a counter kept in microseconds.
+         * @param counter The counter.
+         * @param seconds The time to add.
+         */
+        static void add(std::atomic<std::uint64_t> &counter, double seconds) noexcept;
+
+        double _stepDuration;                          ///> Duration of a fixed step
+        Config _config;                                ///> Bounds and thresholds
+        std::atomic<double> _load = 0.0;               ///> Smoothed load
+        std::atomic<double> _timeScale = 1.0;          ///> Current time scale
+        std::atomic<bool> _overloaded = false;         ///> Current state
+        std::atomic<std::uint64_t> _overloads = 0;     ///> Times the room became overloaded
+        std::atomic<std::uint64_t> _droppedMicros = 0; ///> Dropped time, in microseconds
+        std::atomic<std::uint64_t> _dilatedMicros = 0; ///> Dilated time, in microseconds
+    };
+} // namespace Game
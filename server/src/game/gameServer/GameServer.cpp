@@ -6,9 +6,65 @@
 */
 
 #include "GameServer.hpp"
+#include <algorithm>
+#include <cmath>
+#include <ranges>
+#include "Log.hpp"
+#include "SnapshotCodec.hpp"
 
 namespace
 {
+    /**
+     * @brief Tells whether an entity reaches the clients unchanged, at the precision of the compact snapshot.
+     */
+    bool sameOnWire(const SnapshotEntity &before, const SnapshotEntity &after) noexcept
+    {
+        constexpr float Scale = Net::Snapshot::POSITION_SCALE;
+
+        return before.spriteId == after.spriteId && std::lround(before.x * Scale) == std::lround(after.x * Scale)
+            && std::lround(before.y * Scale) == std::lround(after.y * Scale);
+    }
+
+    /**
+     * @brief Replaces the previous snapshot with a new one.
+     * @param previous The previous snapshot, ordered by id, replaced.
+     * @param snapshot The new snapshot, ordered by id.
+     * @return The number of entities found in only one of the two snapshots, or moved or
+     * redrawn between them.
+     */
+    std::size_t updatePreviousSnapshot(
+        std::vector<SnapshotEntity> &previous, const std::vector<SnapshotEntity> &snapshot)
+    {
+        std::size_t kept = 0;
+        std::size_t unchanged = 0;
+        std::size_t at = 0;
+
+        for (const auto &entity : snapshot) {
+            while (at < previous.size() && previous[at].id < entity.id)
+                at++;
+            if (at < previous.size() && previous[at].id == entity.id) {
+                kept++;
+                if (sameOnWire(previous[at], entity))
+                    unchanged++;
+            }
+        }
+        const std::size_t changed = (previous.size() - kept) + (snapshot.size() - kept) + (kept - unchanged);
+        previous.assign(snapshot.begin(), snapshot.end());
+        return changed;
+    }
+
+    template <typename Function>
+    void runTimed(const bool enabled, double &slot, Function &&fn)
+    {
+        if (!enabled) {
+            fn();
+            return;
+        }
+        const auto start = std::chrono::steady_clock::now();
+        fn();
+        slot = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    }
+
     void registerScoreUpdatePacketDispatch(Game::IGameWorld &world,
         const std::shared_ptr<Net::Server::ISessionManager> &sessions,
         const std::shared_ptr<Net::Factory::UDPPacketFactory> &UDPPacketFactory,
@@ -46,23 +102,26 @@ namespace
 
 namespace Game
 {
+    static_assert(static_cast<std::uint8_t>(GameServer::GameCommand::Type::PlayerInput) == Replay::COMMAND_INPUT,
+        "Replay::COMMAND_INPUT must match GameCommand::Type::PlayerInput");
+
     GameServer::GameServer(std::shared_ptr<Net::Server::ISessionManager> sessions,
         std::shared_ptr<Net::Server::IServer> server, std::shared_ptr<Net::Factory::UDPPacketFactory> udpPacketFactory,
-        const std::string &levelPath)
-        : _worldWrite(std::make_unique<World>()), _worldRead(std::make_unique<World>()),
-          _worldTemp(std::make_unique<World>()), _sessions(std::move(sessions)), _server(std::move(server)),
-          _udpPacketFactory(std::move(udpPacketFactory))
+        const std::string &levelPath, const std::uint64_t seed)
+        : _world(std::make_unique<World>(_arena.longLived(), _arena.frame())), _levelPath(levelPath), _rng(seed),
+          _sessions(std::move(sessions)), _server(std::move(server)), _udpPacketFactory(std::move(udpPacketFactory)),
+          _links(std::dynamic_pointer_cast<Net::Server::ILinkMonitor>(_server)),
+          _flusher(std::dynamic_pointer_cast<Net::Server::IFlushable>(_server))
     {
         if (!levelPath.empty()) {
             if (!_levelManager.loadFromFile(levelPath))
-                std::cerr << "{GameServer::GameServer} Failed to load level file: " << levelPath << "\n";
+                Log::error("GameServer::GameServer", "failed to load level file", {{"path", levelPath}});
             else
-                std::cout << "{GameServer::GameServer} Loaded level: " << _levelManager.getCurrentLevel().name << "\n";
+                Log::info("GameServer::GameServer", "loaded level", {{"name", _levelManager.getCurrentLevel().name}});
             _levelManager.reset();
         }
-        _waitingClock.restart();
 
-        registerScoreUpdatePacketDispatch(*_worldWrite, _sessions, _udpPacketFactory, _entityToSession, _server);
+        registerScoreUpdatePacketDispatch(*_world, _sessions, _udpPacketFactory, _entityToSession, _server);
     }
 
     void GameServer::onPlayerConnect(const int sessionId)
@@ -70,7 +129,8 @@ namespace Game
         GameCommand cmd;
         cmd.type = GameCommand::Type::PlayerConnect;
         cmd.sessionId = sessionId;
-        _commandBuffer.push(cmd);
+        _commandBuffer.forcePush(cmd);
+        notifyCommand(true);
         if (const auto *addr = _sessions->getAddress(sessionId)) {
             _server->sendPacket(*_udpPacketFactory->makeDefault(*addr, Net::Protocol::UDP::ACCEPT));
         }
@@ -81,7 +141,8 @@ namespace Game
         GameCommand cmd;
         cmd.type = GameCommand::Type::PlayerDisconnect;
         cmd.sessionId = sessionId;
-        _commandBuffer.push(cmd);
+        _commandBuffer.forcePush(cmd);
+        notifyCommand(true);
     }
 
     void GameServer::onPlayerInput(const int sessionId, const InputComponent &msg)
@@ -91,6 +152,7 @@ namespace Game
         cmd.sessionId = sessionId;
         cmd.input = msg;
         _commandBuffer.push(cmd);
+        notifyCommand(true);
     }
 
     void GameServer::onPing(const int sessionId)
@@ -99,56 +161,289 @@ namespace Game
         cmd.type = GameCommand::Type::Ping;
         cmd.sessionId = sessionId;
         _commandBuffer.push(cmd);
+        notifyCommand(false);
     }
 
     void GameServer::update(const float dt)
     {
-        if (_waitingClock.elapsed() > 5.0)
-            LevelSystem::update(*_worldWrite, _levelManager, dt, _spawned);
-
-        AIShootSystem::update(*_worldWrite, dt);
+        auto &t = _profile.micros;
 
-        InputSystem::update(*_worldWrite);
-        ShootingSystem::update(*_worldWrite);
+        runTimed(_profiling, t[0], [&] {
+            if (_simTime > WAVES_DELAY)
+                LevelSystem::update(*_world, _levelManager, dt, _spawned, _rng);
+        });
+        runTimed(_profiling, t[1], [&] {
+            AIShootSystem::update(*_world, dt * _aiFireRate);
+        });
+        runTimed(_profiling, t[2], [&] {
+            InputSystem::update(*_world);
+        });
+        runTimed(_profiling, t[3], [&] {
+            ShootingSystem::update(*_world);
+        });
+        runTimed(_profiling, t[4], [&] {
+            MovementSystem::update(*_world, dt, _jobs.get());
+        });
+        runTimed(_profiling, t[5], [&] {
+            ProjectileSystem::update(*_world, dt);
+        });
+        runTimed(_profiling, t[6], [&] {
+            CollisionSystem::update(*_world);
+        });
+        runTimed(_profiling, t[7], [&] {
+            HealthSystem::update(*_world);
+        });
+        runTimed(_profiling, t[8], [&] {
+            LifetimeSystem::update(*_world, dt, _jobs.get());
+        });
+        runTimed(_profiling, t[9], [&] {
+            _world->events().process();
+            _arena.endFrame();
+            _world->registry().flush();
+            _world->projectiles().compact();
+        });
+        _simTime += static_cast<double>(dt);
+    }
 
-        MovementSystem::update(*_worldWrite, dt);
-        CollisionSystem::update(*_worldWrite);
-        HealthSystem::update(*_worldWrite);
-        LifetimeSystem::update(*_worldWrite, dt);
+    void GameServer::tick()
+    {
+        drainCommands();
+        _accumulator += _overload.admit(_clock.restart());
+        const auto start = std::chrono::steady_clock::now();
+        std::uint32_t steps = 0;
+        for (; _accumulator >= FIXED_DT && steps < _overload.config().maxSteps; steps++) {
+            step();
+            _accumulator -= FIXED_DT;
+        }
+        if (_accumulator >= FIXED_DT) {
+            const double dropped = std::floor(_accumulator / FIXED_DT) * FIXED_DT;
+            _overload.onDropped(dropped);
+            _accumulator -= dropped;
+        }
+        const bool overloaded = _overload.overloaded();
+        _overload.onSteps(steps, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+        if (_overload.overloaded() != overloaded)
+            onOverloadChanged();
+        if (_snapshotRate.due(_tick))
+            sendSnapshot();
+        flushClients();
+    }
 
-        _worldWrite->events().process();
+    void GameServer::flushClients() noexcept
+    {
+        if (!_flusher)
+            return;
+        for (const auto &[sessionId, entity] : _sessionToEntity)
+            if (const sockaddr_in *addr = _sessions->getAddress(sessionId))
+                _flusher->flush(*addr);
     }
 
-    void GameServer::tick()
+    void GameServer::drainCommands()
     {
         GameCommand cmd;
-        while (_commandBuffer.pop(cmd))
+        while (_commandBuffer.pop(cmd)) {
+            if (_recorder)
+                _recorder->recordCommand({_tick, static_cast<std::uint8_t>(cmd.type),
+                    static_cast<std::int32_t>(cmd.sessionId), Replay::packInput(cmd.input)});
             applyCommand(cmd);
-        const double frameTime = _clock.restart();
-        _accumulator += frameTime;
-        while (_accumulator >= FIXED_DT) {
-            update(static_cast<float>(FIXED_DT));
-            _worldTemp->copyFrom(*_worldWrite);
-            {
-                std::scoped_lock lock(_snapshotMutex);
-                std::swap(_worldTemp, _worldRead);
+        }
+    }
+
+    void GameServer::step()
+    {
+        update(static_cast<float>(FIXED_DT));
+        _tick++;
+        if (_recorder)
+            _recorder->recordStep(stateHash());
+    }
+
+    void GameServer::sendSnapshot()
+    {
+        buildSnapshot(_snapshot);
+        const std::size_t changed = updatePreviousSnapshot(_previousSnapshot, _snapshot);
+        Net::Server::LinkStats link{};
+        std::size_t bytes = 0;
+        std::shared_ptr<Net::IPacket> legacy = nullptr;
+        std::shared_ptr<Net::IPacket> compact = nullptr;
+
+        for (const int sessionId : _sessionToEntity | std::views::keys) {
+            const sockaddr_in *addr = _sessions->getAddress(sessionId);
+            if (!addr)
+                continue;
+            if (_links) {
+                const auto stats = _links->linkStats(*addr);
+                link.sent += stats.sent;
+                link.resent += stats.resent;
             }
-            _accumulator -= FIXED_DT;
+            if (_snapshot.empty())
+                continue;
+            const bool wantsCompact = _sessions->getVersion(sessionId) >= Net::Snapshot::COMPACT_VERSION;
+            auto &packet = wantsCompact ? compact : legacy;
+            if (!packet)
+                packet = _udpPacketFactory->createSnapshotPacket(
+                    _snapshot, wantsCompact ? Net::Snapshot::COMPACT_VERSION : Net::Snapshot::LEGACY_VERSION);
+            if (!packet)
+                continue;
+            packet->setAddress(*addr);
+            bytes = std::max(bytes, packet->size());
+            _server->sendPacket(*packet);
         }
+        _snapshotRate.onLink(link.sent, link.resent);
+        _snapshotRate.onSnapshot(_tick, _snapshot.size(), changed, bytes);
+    }
+
+    void GameServer::setSnapshotRate(const SnapshotRate::Config &config) noexcept
+    {
+        _snapshotRate.configure(config);
+    }
+
+    const SnapshotRate &GameServer::snapshotRate() const noexcept
+    {
+        return _snapshotRate;
+    }
+
+    void GameServer::setOverloadGuard(const OverloadGuard::Config &config) noexcept
+    {
+        _overload.configure(config);
+        onOverloadChanged();
+    }
+
+    const OverloadGuard &GameServer::overloadGuard() const noexcept
+    {
+        return _overload;
+    }
+
+    void GameServer::onOverloadChanged() noexcept
+    {
+        const auto &config = _overload.config();
+
+        if (!_overload.overloaded()) {
+            _snapshotRate.throttle(0);
+            _aiFireRate = 1.0f;
+            if (_overload.overloads() > 0)
+                Log::info("GameServer::tick", "room recovered from overload",
+                    {{"load", _overload.load()}, {"dropped_s", _overload.droppedTime()},
+                        {"dilated_s", _overload.dilatedTime()}});
+            return;
+        }
+        _snapshotRate.throttle(config.snapshotInterval);
+        _aiFireRate = _recorder ? 1.0f : config.aiFireRate;
+        Log::warn("GameServer::tick", "room overloaded",
+            {{"load", _overload.load()}, {"time_scale", _overload.timeScale()},
+                {"dropped_s", _overload.droppedTime()}, {"overloads", _overload.overloads()}});
+    }
+
+    void GameServer::setJobSystem(std::shared_ptr<Ecs::JobSystem> jobs) noexcept
+    {
+        _jobs = std::move(jobs);
+    }
+
+    std::uint32_t GameServer::activity() const noexcept
+    {
+        return _activity.load(std::memory_order_acquire);
+    }
+
+    std::uint32_t GameServer::wakeups() const noexcept
+    {
+        return _wakeups.load(std::memory_order_acquire);
+    }
+
+    void GameServer::waitForCommand(const std::uint32_t wakeups) const noexcept
+    {
+        _wakeups.wait(wakeups, std::memory_order_acquire);
+    }
+
+    void GameServer::wake() noexcept
+    {
+        notifyCommand(false);
+    }
+
+    void GameServer::hibernate() noexcept
+    {
+        _world->registry().shrink();
+        _world->projectiles().shrink();
+        _snapshot.clear();
+        _snapshot.shrink_to_fit();
+        _previousSnapshot.clear();
+        _previousSnapshot.shrink_to_fit();
+    }
+
+    void GameServer::resume() noexcept
+    {
+        _clock.restart();
+        _accumulator = 0.0;
+    }
+
+    std::size_t GameServer::memoryUsage() const noexcept
+    {
+        return _world->registry().memoryUsage() + _world->projectiles().memoryUsage()
+            + (_snapshot.capacity() + _previousSnapshot.capacity()) * sizeof(SnapshotEntity)
+            + _spawned.capacity() / 8 + COMMAND_CAPACITY * sizeof(GameCommand);
+    }
+
+    std::size_t GameServer::heapUsage() const noexcept
+    {
+        return _arena.heapBytes();
+    }
+
+    void GameServer::notifyCommand(const bool active) noexcept
+    {
+        if (active)
+            _activity.fetch_add(1, std::memory_order_release);
+        _wakeups.fetch_add(1, std::memory_order_release);
+        _wakeups.notify_one();
+    }
+
+    void GameServer::startRecording(const std::string &path)
+    {
+        _recorder = std::make_unique<ReplayRecorder>(path, Replay::Header{_rng.seed(), _levelPath});
+    }
+
+    void GameServer::stopRecording() noexcept
+    {
+        _recorder.reset();
+    }
+
+    void GameServer::setProfiling(const bool enabled) noexcept
+    {
+        _profiling = enabled;
+    }
+
+    const GameServer::StepProfile &GameServer::lastStepProfile() const noexcept
+    {
+        return _profile;
+    }
+
+    std::uint64_t GameServer::tickIndex() const noexcept
+    {
+        return _tick;
+    }
+
+    std::uint64_t GameServer::droppedCommands() const noexcept
+    {
+        return _commandBuffer.dropped();
+    }
+
+    std::uint64_t GameServer::stateHash() const
+    {
+        return WorldHash::compute(*_world);
+    }
+
+    std::uint64_t GameServer::seed() const noexcept
+    {
+        return _rng.seed();
     }
 
     void GameServer::buildSnapshot(std::vector<SnapshotEntity> &out) const
     {
-        out.clear();
-        std::scoped_lock lock(_snapshotMutex);
-        SnapshotSystem::update(*_worldRead, out);
+        SnapshotSystem::update(*_world, out);
     }
 
     void GameServer::applyCommand(const GameCommand &cmd)
     {
         switch (cmd.type) {
             case GameCommand::Type::PlayerConnect: {
-                const Ecs::Entity ent = _worldWrite->createPlayer();
+                const Ecs::Entity ent = _world->createPlayer();
                 _sessionToEntity[cmd.sessionId] = ent;
                 _entityToSession[static_cast<size_t>(ent)] = cmd.sessionId;
                 break;
@@ -162,14 +457,14 @@ namespace Game
                 _entityToSession.erase(static_cast<size_t>(ent));
                 _sessionToEntity.erase(it);
                 _sessions->removeSession(cmd.sessionId);
-                _worldWrite->destroyEntity(ent);
+                _world->destroyEntity(ent);
                 break;
             }
             case GameCommand::Type::PlayerInput: {
                 if (!_sessionToEntity.contains(cmd.sessionId))
                     break;
                 const Ecs::Entity ent = _sessionToEntity[cmd.sessionId];
-                auto &inputs = _worldWrite->registry().getComponents<InputComponent>();
+                auto &inputs = _world->registry().getComponents<InputComponent>();
 
                 if (auto &inputOpt = inputs.at(static_cast<size_t>(ent)); inputOpt.has_value()) {
                     inputOpt->up = cmd.input.up;
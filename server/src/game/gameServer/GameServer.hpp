@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
 #include "AIShootSystem.hpp"
 #include "Collision.hpp"
 #include "CollisionSystem.hpp"
@@ -14,17 +16,27 @@
 #include "Damage.hpp"
 #include "GameClock.hpp"
 #include "HealthSystem.hpp"
+#include "IFlushable.hpp"
+#include "ILinkMonitor.hpp"
 #include "IMessageSink.hpp"
 #include "IServer.hpp"
 #include "InputSystem.hpp"
+#include "JobSystem.hpp"
 #include "LevelManager.hpp"
 #include "LevelSystem.hpp"
 #include "LifetimeSystem.hpp"
 #include "MovementSystem.hpp"
+#include "OverloadGuard.hpp"
+#include "ProjectileSystem.hpp"
+#include "Rand.hpp"
+#include "ReplayRecorder.hpp"
+#include "RoomArena.hpp"
 #include "SessionManager.hpp"
 #include "ShootingSystem.hpp"
+#include "SnapshotRate.hpp"
 #include "SnapshotSystem.hpp"
 #include "UDPPacketFactory.hpp"
+#include "WorldHash.hpp"
 
 namespace Game
 {
@@ -67,6 +79,18 @@ namespace Game
             int sessionId = 0;      ///> Associated session ID
         };
 
+        /**
+         * @brief Wall-clock cost of each system during the last fixed step, in microseconds.
+         *
+         * Only filled while profiling is enabled (see setProfiling()).
+         */
+        struct StepProfile {
+            static constexpr std::array<const char *, 10> NAMES = {"level", "ai_shoot", "input", "shooting",
+                "movement", "projectile", "collision", "health", "lifetime", "events"};
+
+            std::array<double, NAMES.size()> micros{}; ///> Duration of each system, indexed like NAMES
+        };
+
         /**
          * @brief Construct a new GameServer.
          *
@@ -74,11 +98,12 @@ namespace Game
          * @param server   Network backend used to send packets to clients.
          * @param udpPacketFactory Factory to build outgoing packets.
          * @param levelPath Path to the level configuration file.
+         * @param seed     Seed of the server's random generator.
          */
         explicit GameServer(std::shared_ptr<Net::Server::ISessionManager> sessions,
             std::shared_ptr<Net::Server::IServer> server,
             std::shared_ptr<Net::Factory::UDPPacketFactory> udpPacketFactory,
-            const std::string &levelPath = "levels/level1.json");
+            const std::string &levelPath = "levels/level1.json", std::uint64_t seed = Rand::Generator::randomSeed());
 
         /**
          * @brief Called when a new player connects.
@@ -122,10 +147,167 @@ namespace Game
         /**
          * @brief Advances the game simulation based on elapsed time.
          *
-         * Uses a fixed timestep approach to ensure consistent updates.
+         * Uses a fixed timestep approach to ensure consistent updates,
+         * then sends a snapshot if one is due (see SnapshotRate). The number of
+         * steps per call is bounded, and simulated time slows down while the
+         * room is overloaded (see OverloadGuard). Everything sent during the tick
+         * leaves at its end (see flushClients()).
          */
         void tick();
 
+        /**
+         * @brief Applies every pending command, recording them when a recording is active.
+         */
+        void drainCommands();
+
+        /**
+         * @brief Sends what the server holds back for the room's players, one datagram per player.
+         */
+        void flushClients() noexcept;
+
+        /**
+         * @brief Runs exactly one fixed step.
+         *
+         * Used by tick() and by the headless replay runner.
+         */
+        void step();
+
+        /**
+         * @brief Sends a snapshot of the world to every player and adapts the snapshot rate.
+         *
+         * Called by tick() when a snapshot is due; runs on the room's thread like every step.
+         */
+        void sendSnapshot();
+
+        /**
+         * @brief Replaces the bounds and thresholds of the adaptive snapshot rate.
+         * @param config The snapshot rate configuration; call before the room starts.
+         */
+        void setSnapshotRate(const SnapshotRate::Config &config) noexcept;
+
+        /**
+         * @brief Gets the adaptive snapshot rate of the room.
+         * @return The snapshot rate controller.
+         */
+        [[nodiscard]] const SnapshotRate &snapshotRate() const noexcept;
+
+        /**
+         * @brief Replaces the bounds and thresholds of the overload guard.
+         * @param config The overload guard configuration; call before the room starts.
+         */
+        void setOverloadGuard(const OverloadGuard::Config &config) noexcept;
+
+        /**
+         * @brief Gets the overload guard of the room, whose state and counters may be read from any thread.
+         * @return The overload guard.
+         */
+        [[nodiscard]] const OverloadGuard &overloadGuard() const noexcept;
+
+        /**
+         * @brief Sets the job system the systems iterating over many entities split their work on.
+         * @param jobs The job system, possibly shared with other rooms, or nullptr to run serially.
+         */
+        void setJobSystem(std::shared_ptr<Ecs::JobSystem> jobs) noexcept;
+
+        /**
+         * @brief Gets the number of connections, disconnections and inputs received so far.
+         *
+         * Pings are not counted: a room whose players only ping is idle.
+         *
+         * @return The activity counter; only its changes are meaningful.
+         */
+        [[nodiscard]] std::uint32_t activity() const noexcept;
+
+        /**
+         * @brief Gets the number of commands received so far, pings included, and of wake() calls.
+         * @return The wake-up counter, to pass to waitForCommand().
+         */
+        [[nodiscard]] std::uint32_t wakeups() const noexcept;
+
+        /**
+         * @brief Blocks until a command is received or wake() is called.
+         * @param wakeups The value of wakeups() read before the last drainCommands().
+         */
+        void waitForCommand(std::uint32_t wakeups) const noexcept;
+
+        /**
+         * @brief Releases the thread blocked in waitForCommand().
+         */
+        void wake() noexcept;
+
+        /**
+         * @brief Releases the memory the room does not need while it is not ticking.
+         *
+         * Shrinks the component arrays and the projectile pool to their live entities and drops
+         * the snapshot buffer. Runs on the room's thread.
+         */
+        void hibernate() noexcept;
+
+        /**
+         * @brief Restarts the clock after the room stopped ticking, so the pause is not simulated.
+         */
+        void resume() noexcept;
+
+        /**
+         * @brief Gets the memory reserved by the room's world and buffers.
+         * @return The number of bytes allocated, used or not.
+         */
+        [[nodiscard]] std::size_t memoryUsage() const noexcept;
+
+        /**
+         * @brief Gets the memory the room's arena holds from the global heap.
+         * @return The number of bytes, the per-step buffer included.
+         */
+        [[nodiscard]] std::size_t heapUsage() const noexcept;
+
+        /**
+         * @brief Starts recording every applied command and the per-step world hash.
+         * @param path Destination file of the recording.
+         * @throws ReplayError if the file cannot be created.
+         */
+        void startRecording(const std::string &path);
+
+        /**
+         * @brief Stops the current recording, if any, and flushes it to disk.
+         */
+        void stopRecording() noexcept;
+
+        /**
+         * @brief Enables or disables per-system timing of each step.
+         * @param enabled Whether timings should be collected.
+         */
+        void setProfiling(bool enabled) noexcept;
+
+        /**
+         * @brief Gets the per-system timings of the last step.
+         * @return The last step profile.
+         */
+        [[nodiscard]] const StepProfile &lastStepProfile() const noexcept;
+
+        /**
+         * @brief Gets the number of fixed steps simulated so far.
+         * @return The current tick index.
+         */
+        [[nodiscard]] std::uint64_t tickIndex() const noexcept;
+
+        /**
+         * @brief Gets the number of inputs and pings dropped because the command queue was full.
+         * @return The number of dropped commands.
+         */
+        [[nodiscard]] std::uint64_t droppedCommands() const noexcept;
+
+        /**
+         * @brief Computes the hash of the authoritative world state.
+         * @return The world hash.
+         */
+        [[nodiscard]] std::uint64_t stateHash() const;
+
+        /**
+         * @brief Gets the seed of the server's random generator.
+         * @return The seed, enough to reproduce the room with the same commands.
+         */
+        [[nodiscard]] std::uint64_t seed() const noexcept;
+
         /**
          * @brief Applies a single GameCommand to the game world.
          * @param cmd The command to apply.
@@ -139,28 +321,58 @@ namespace Game
         void buildSnapshot(std::vector<SnapshotEntity> &out) const;
 
       private:
-        mutable std::mutex _snapshotMutex;       ///> Mutex for synchronizing snapshot access.
-        std::unique_ptr<IGameWorld> _worldWrite; ///> The authoritative game world
-        std::unique_ptr<IGameWorld> _worldRead;  ///> Read-only snapshot of the game world for serialization.
-        std::unique_ptr<IGameWorld> _worldTemp;  ///> Temporary world for snapshot generation.
+        /**
+         * @brief Counts a received command and releases the thread blocked in waitForCommand().
+         * @param active Whether the command counts as activity (see activity()).
+         */
+        void notifyCommand(bool active) noexcept;
+
+        /**
+         * @brief Degrades or restores the non-critical work after the room became overloaded or recovered.
+         */
+        void onOverloadChanged() noexcept;
+
+        Utils::RoomArena _arena;            ///> Memory of the world, released with the room
+        std::unique_ptr<IGameWorld> _world; ///> The authoritative game world
 
         LevelManager _levelManager; ///> Manages level progression.
+        std::string _levelPath;     ///> Level file loaded by this server.
+        Rand::Generator _rng;       ///> Random generator owned by this room.
 
         std::shared_ptr<Net::Server::ISessionManager> _sessions;           ///> Manages player sessions.
         std::shared_ptr<Net::Server::IServer> _server;                     ///> Sends packets to clients.
         std::shared_ptr<Net::Factory::UDPPacketFactory> _udpPacketFactory; ///> Builds outgoing packets.
+        std::shared_ptr<Net::Server::ILinkMonitor> _links;                 ///> Link counters, if _server has them.
+        std::shared_ptr<Net::Server::IFlushable> _flusher;                 ///> Flushes _server, if it batches.
 
         std::unordered_map<int, Ecs::Entity> _sessionToEntity; ///> Maps sessions to entities.
         std::unordered_map<size_t, int> _entityToSession;      ///> Maps entities to sessions.
 
-        Command::CommandBuffer<GameCommand> _commandBuffer; ///> Buffers incoming game commands.
+        static constexpr std::size_t COMMAND_CAPACITY = 1024;                 ///> Pending commands kept between steps.
+        Command::CommandBuffer<GameCommand> _commandBuffer{COMMAND_CAPACITY}; ///> Buffers incoming game commands.
+        std::atomic<std::uint32_t> _activity{0};                              ///> Connections, disconnections, inputs.
+        std::atomic<std::uint32_t> _wakeups{0};                               ///> Commands received and wake() calls.
 
-        GameClock _waitingClock;                       ///> Clock for player wait time.
         GameClock _clock;                              ///> Tracks elapsed time for fixed timestep.
         double _accumulator = 0.0;                     ///> Accumulates time for fixed updates.
+        double _simTime = 0.0;                         ///> Simulated time, used to delay enemy waves.
+        std::uint64_t _tick = 0;                       ///> Number of fixed steps simulated.
         static constexpr double FIXED_DT = 1.0 / 60.0; ///> Fixed timestep duration.
+        static constexpr double WAVES_DELAY = 5.0;     ///> Simulated seconds before enemy waves start.
+
+        std::unique_ptr<ReplayRecorder> _recorder = nullptr; ///> Active recording, if any.
+        bool _profiling = false;                             ///> Whether steps are timed.
+        StepProfile _profile;                                ///> Timings of the last step.
 
         std::vector<bool> _spawned; ///> Tracks which enemies slots are occupied.
+
+        SnapshotRate _snapshotRate{1.0 / FIXED_DT};    ///> Decides when snapshots are sent.
+        OverloadGuard _overload{FIXED_DT};             ///> Bounds catch-up and dilates time when overloaded.
+        float _aiFireRate = 1.0f;                      ///> Share of enemy fire rate kept, lowered when overloaded.
+        std::vector<SnapshotEntity> _snapshot;         ///> Last snapshot sent, reused between snapshots.
+        std::vector<SnapshotEntity> _previousSnapshot; ///> Copy of the last snapshot, to measure churn.
+
+        std::shared_ptr<Ecs::JobSystem> _jobs = nullptr; ///> Runs parallel views, serial when null.
     };
 
 } // namespace Game
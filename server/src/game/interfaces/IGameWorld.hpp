@@ -9,6 +9,7 @@
 
 #include "Entity.hpp"
 #include "EventsRegistry.hpp"
+#include "ProjectilePool.hpp"
 #include "Registry.hpp"
 
 /**
@@ -45,6 +46,12 @@ namespace Game
          */
         [[nodiscard]] virtual Ecs::EventsRegistry &events() = 0;
 
+        /**
+         * @brief Get the pool holding the projectiles of the world.
+         * @return Reference to the projectile pool.
+         */
+        [[nodiscard]] virtual ProjectilePool &projectiles() = 0;
+
         /**
          * @brief Create a new gameplay entity (e.g., player).
          */
@@ -9,13 +9,15 @@
 
 namespace Game
 {
-    void LevelSystem::update(IGameWorld &world, LevelManager &lvl, const float dt, std::vector<bool> &spawned)
+    void LevelSystem::update(
+        IGameWorld &world, LevelManager &lvl, const float dt, std::vector<bool> &spawned, Rand::Generator &rng)
     {
         lvl.advance(dt);
-        handleWaves(world, lvl, spawned);
+        handleWaves(world, lvl, spawned, rng);
     }
 
-    void LevelSystem::handleWaves(IGameWorld &world, const LevelManager &lvl, std::vector<bool> &spawned)
+    void LevelSystem::handleWaves(
+        IGameWorld &world, const LevelManager &lvl, std::vector<bool> &spawned, Rand::Generator &rng)
     {
         const Level &level = lvl.getCurrentLevel();
 
@@ -29,25 +31,25 @@ namespace Game
             if (!lvl.shouldSpawn(wave.time))
                 continue;
             spawned.at(i) = true;
-            spawnWave(world, level, wave);
+            spawnWave(world, level, wave, rng);
         }
     }
 
-    void LevelSystem::spawnWave(IGameWorld &world, const Level &level, const Wave &wave)
+    void LevelSystem::spawnWave(IGameWorld &world, const Level &level, const Wave &wave, Rand::Generator &rng)
     {
         for (const auto &[type, count] : wave.groups) {
             if (!level.enemyTypes.contains(type))
                 continue;
             const EnemyDefinition &def = level.enemyTypes.at(type);
             for (int k = 0; k < count; k++)
-                spawnSingleEnemy(world, def);
+                spawnSingleEnemy(world, def, rng);
         }
     }
 
-    void LevelSystem::spawnSingleEnemy(IGameWorld &world, const EnemyDefinition &def)
+    void LevelSystem::spawnSingleEnemy(IGameWorld &world, const EnemyDefinition &def, Rand::Generator &rng)
     {
         auto &reg = world.registry();
-        const float y = Rand::enemyY(Rand::rng);
+        const float y = rng.uniform(Rand::EnemyY);
         const Ecs::Entity mob = reg.createEntity();
 
         reg.emplaceComponent<Ecs::Position>(mob, Ecs::Position{900.f, y});
@@ -40,8 +40,10 @@ namespace Game
          * @param lvl The level manager to use for level data.
          * @param dt The delta time since the last update.
          * @param spawned Vector tracking which waves have been spawned.
+         * @param rng The room's random generator.
          */
-        static void update(IGameWorld &world, LevelManager &lvl, float dt, std::vector<bool> &spawned);
+        static void update(
+            IGameWorld &world, LevelManager &lvl, float dt, std::vector<bool> &spawned, Rand::Generator &rng);
 
       private:
         /**
@@ -50,8 +52,10 @@ namespace Game
          * @param world The game world to spawn enemies in.
          * @param lvl The level manager containing level data.
          * @param spawned Vector tracking which waves have been spawned.
+         * @param rng The room's random generator.
          */
-        static void handleWaves(IGameWorld &world, const LevelManager &lvl, std::vector<bool> &spawned);
+        static void handleWaves(
+            IGameWorld &world, const LevelManager &lvl, std::vector<bool> &spawned, Rand::Generator &rng);
 
         /**
          * @brief Spawn all enemy groups in a given wave.
@@ -59,15 +63,17 @@ namespace Game
          * @param world The game world to spawn enemies in.
          * @param level The current level data.
          * @param wave The wave to spawn.
+         * @param rng The room's random generator.
          */
-        static void spawnWave(IGameWorld &world, const Level &level, const Wave &wave);
+        static void spawnWave(IGameWorld &world, const Level &level, const Wave &wave, Rand::Generator &rng);
 
         /**
          * @brief Spawn a single enemy based on the enemy definition.
          *
          * @param world The game world to spawn the enemy in.
          * @param def The enemy definition.
+         * @param rng The room's random generator.
          */
-        static void spawnSingleEnemy(IGameWorld &world, const EnemyDefinition &def);
+        static void spawnSingleEnemy(IGameWorld &world, const EnemyDefinition &def, Rand::Generator &rng);
     };
 } // namespace Game
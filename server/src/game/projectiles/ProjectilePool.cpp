@@ -0,0 +1,149 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** ProjectilePool
+*/
+
+#include "ProjectilePool.hpp"
+#include <algorithm>
+
+#if defined(__SSE2__)
+    #include <emmintrin.h>
+#endif
+
+namespace Game
+{
+    void ProjectilePool::spawn(const size_t id, const ShootEvent &event)
+    {
+        ids.push_back(id);
+        x.push_back(event.x);
+        y.push_back(event.y);
+        vx.push_back(event.vx);
+        vy.push_back(event.vy);
+        remaining.push_back(event.lifetime);
+        damage.push_back(event.damage);
+        shooter.push_back(event.shooter);
+        dead.push_back(0);
+    }
+
+    void ProjectilePool::integrate(const float dt) noexcept
+    {
+        const size_t count = ids.size();
+        size_t i = 0;
+
+#if defined(__SSE2__)
+        const __m128 step = _mm_set1_ps(dt);
+        const __m128 zero = _mm_setzero_ps();
+
+        for (; i + 4 <= count; i += 4) {
+            const __m128 px = _mm_add_ps(_mm_loadu_ps(&x[i]), _mm_mul_ps(_mm_loadu_ps(&vx[i]), step));
+            const __m128 py = _mm_add_ps(_mm_loadu_ps(&y[i]), _mm_mul_ps(_mm_loadu_ps(&vy[i]), step));
+            const __m128 life = _mm_sub_ps(_mm_loadu_ps(&remaining[i]), step);
+            _mm_storeu_ps(&x[i], px);
+            _mm_storeu_ps(&y[i], py);
+            _mm_storeu_ps(&remaining[i], life);
+
+            const __m128 out = _mm_or_ps(_mm_or_ps(_mm_cmplt_ps(px, zero), _mm_cmplt_ps(py, zero)),
+                _mm_cmple_ps(life, zero));
+            const int mask = _mm_movemask_ps(out);
+            for (size_t lane = 0; lane < 4; lane++)
+                dead[i + lane] |= static_cast<std::uint8_t>((mask >> lane) & 1);
+        }
+#endif
+        for (; i < count; i++) {
+            x[i] += vx[i] * dt;
+            y[i] += vy[i] * dt;
+            remaining[i] -= dt;
+            if (x[i] < 0 || y[i] < 0 || remaining[i] <= 0.f)
+                dead[i] = 1;
+        }
+    }
+
+    void ProjectilePool::kill(const size_t index) noexcept
+    {
+        dead[index] = 1;
+    }
+
+    void ProjectilePool::compact() noexcept
+    {
+        size_t out = 0;
+
+        for (size_t i = 0; i < ids.size(); i++) {
+            if (dead[i])
+                continue;
+            if (out != i) {
+                ids[out] = ids[i];
+                x[out] = x[i];
+                y[out] = y[i];
+                vx[out] = vx[i];
+                vy[out] = vy[i];
+                remaining[out] = remaining[i];
+                damage[out] = damage[i];
+                shooter[out] = shooter[i];
+                dead[out] = 0;
+            }
+            out++;
+        }
+        ids.resize(out);
+        x.resize(out);
+        y.resize(out);
+        vx.resize(out);
+        vy.resize(out);
+        remaining.resize(out);
+        damage.resize(out);
+        shooter.resize(out);
+        dead.resize(out);
+    }
+
+    void ProjectilePool::clear() noexcept
+    {
+        ids.clear();
+        x.clear();
+        y.clear();
+        vx.clear();
+        vy.clear();
+        remaining.clear();
+        damage.clear();
+        shooter.clear();
+        dead.clear();
+    }
+
+    void ProjectilePool::shrink() noexcept
+    {
+        compact();
+        try {
+            ids.shrink_to_fit();
+            x.shrink_to_fit();
+            y.shrink_to_fit();
+            vx.shrink_to_fit();
+            vy.shrink_to_fit();
+            remaining.shrink_to_fit();
+            damage.shrink_to_fit();
+            shooter.shrink_to_fit();
+            dead.shrink_to_fit();
+        } catch (...) {
+            return;
+        }
+    }
+
+    size_t ProjectilePool::memoryUsage() const noexcept
+    {
+        return ids.capacity() * sizeof(size_t) + shooter.capacity() * sizeof(size_t)
+            + (x.capacity() + y.capacity() + vx.capacity() + vy.capacity() + remaining.capacity()) * sizeof(float)
+            + damage.capacity() * sizeof(int) + dead.capacity() * sizeof(std::uint8_t);
+    }
+
+    size_t ProjectilePool::size() const noexcept
+    {
+        return ids.size();
+    }
+
+    std::optional<size_t> ProjectilePool::shooterOf(const size_t id) const noexcept
+    {
+        const auto it = std::ranges::lower_bound(ids, id);
+        if (it == ids.end() || *it != id)
+            return std::nullopt;
+        return shooter[static_cast<size_t>(it - ids.begin())];
+    }
+} // namespace Game
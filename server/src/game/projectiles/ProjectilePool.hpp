@@ -0,0 +1,99 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** ProjectilePool
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+#include "Events.hpp"
+
+namespace Game
+{
+    /**
+     * @class ProjectilePool
+     * @brief Structure-of-arrays storage for every live projectile of a world.
+     *
+     * Projectiles are not ECS entities: each one only reserves an entity id from
+     * the registry (so ids keep interleaving with ships exactly as before) and lives
+     * as one slot in the parallel arrays below. Slots stay sorted by id: spawn ids
+     * are increasing and compact() preserves order.
+     *
+     * Slots killed during a step keep their data until compact(), so events emitted
+     * during the step can still resolve the shooter of a projectile.
+     */
+    class ProjectilePool {
+      public:
+        static constexpr unsigned int SPRITE_ID = 6; ///> Sprite sent to clients for every projectile
+        static constexpr float SIZE = 8.f;           ///> Width and height of the collision box
+
+        /**
+         * @brief Add a projectile.
+         * @param id Entity id reserved for the projectile, greater than every id in the pool.
+         * @param event The shot describing the projectile.
+         */
+        void spawn(size_t id, const ShootEvent &event);
+
+        /**
+         * @brief Move every projectile, age it, and kill the ones that left the
+         * screen through the top/left edge or ran out of lifetime.
+         * @param dt Delta time in seconds.
+         */
+        void integrate(float dt) noexcept;
+
+        /**
+         * @brief Mark a slot for removal at the next compact().
+         * @param index The slot index.
+         */
+        void kill(size_t index) noexcept;
+
+        /**
+         * @brief Remove every killed slot, preserving the order of the others.
+         */
+        void compact() noexcept;
+
+        /**
+         * @brief Remove every projectile.
+         */
+        void clear() noexcept;
+
+        /**
+         * @brief Remove every killed slot and release the spare capacity of the arrays.
+         */
+        void shrink() noexcept;
+
+        /**
+         * @brief Get the memory reserved by the arrays.
+         * @return The number of bytes allocated for slots, used or not.
+         */
+        [[nodiscard]] size_t memoryUsage() const noexcept;
+
+        /**
+         * @brief Get the number of slots, including the ones killed since the last compact().
+         * @return The number of slots.
+         */
+        [[nodiscard]] size_t size() const noexcept;
+
+        /**
+         * @brief Find the shooter of a projectile.
+         * @param id The entity id of the projectile.
+         * @return The shooter id, or std::nullopt if id is not a projectile of this pool.
+         */
+        [[nodiscard]] std::optional<size_t> shooterOf(size_t id) const noexcept;
+
+        std::vector<size_t> ids;        ///> Entity id of each slot (ascending)
+        std::vector<float> x;           ///> X position
+        std::vector<float> y;           ///> Y position
+        std::vector<float> vx;          ///> X velocity
+        std::vector<float> vy;          ///> Y velocity
+        std::vector<float> remaining;   ///> Remaining lifetime in seconds
+        std::vector<int> damage;        ///> Damage dealt on hit
+        std::vector<size_t> shooter;    ///> Entity id of the shooter
+        std::vector<std::uint8_t> dead; ///> Non-zero if the slot is removed at the next compact()
+    };
+} // namespace Game
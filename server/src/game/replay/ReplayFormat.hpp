@@ -0,0 +1,74 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** ReplayFormat
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include "InputComponent.hpp"
+
+/**
+ * @brief On-disk layout of a room recording.
+ *
+ * A recording starts with a header:
+ *   magic "RTRP" | u16 version | u64 rng seed | u16 path length | level path bytes
+ * followed by a stream of tagged records:
+ *   RECORD_COMMAND : varint tick delta | u8 command type | varint session id | [u8 input flags]
+ *   RECORD_STEP    : u64 world hash after the step
+ * All fixed-width integers are little-endian. Commands recorded with tick N are
+ * applied before the N-th fixed step runs; input flags are only present for PlayerInput.
+ */
+namespace Game::Replay
+{
+    inline constexpr char MAGIC[4] = {'R', 'T', 'R', 'P'}; ///> File signature
+    inline constexpr std::uint16_t VERSION = 1;            ///> Format version
+
+    inline constexpr std::uint8_t RECORD_COMMAND = 0x01; ///> A drained GameCommand
+    inline constexpr std::uint8_t RECORD_STEP = 0x02;    ///> End of a fixed simulation step
+
+    inline constexpr std::uint8_t COMMAND_INPUT = 3; ///> Value of GameCommand::Type::PlayerInput
+
+    /**
+     * @brief Session-level information stored in the recording header.
+     */
+    struct Header {
+        std::uint64_t seed = 0; ///> Seed of the random generator used by the room
+        std::string levelPath;  ///> Level file loaded by the room
+    };
+
+    /**
+     * @brief A GameCommand as stored in a recording.
+     */
+    struct Command {
+        std::uint64_t tick = 0;      ///> Fixed step index the command was applied at
+        std::uint8_t type = 0;       ///> GameServer::GameCommand::Type as an integer
+        std::int32_t sessionId = 0;  ///> Session that issued the command
+        std::uint8_t inputFlags = 0; ///> Packed input (PlayerInput only)
+    };
+
+    /**
+     * @brief Pack an input component into the UDP INPUT flag layout.
+     * @param input The input to pack.
+     * @return Bit 0 up, 1 down, 2 left, 3 right, 4 shoot.
+     */
+    [[nodiscard]] inline std::uint8_t packInput(const InputComponent &input) noexcept
+    {
+        return static_cast<std::uint8_t>((input.up ? 0x01u : 0u) | (input.down ? 0x02u : 0u)
+            | (input.left ? 0x04u : 0u) | (input.right ? 0x08u : 0u) | (input.shoot ? 0x10u : 0u));
+    }
+
+    /**
+     * @brief Unpack input flags produced by packInput.
+     * @param flags The packed flags.
+     * @return The corresponding input component.
+     */
+    [[nodiscard]] inline InputComponent unpackInput(const std::uint8_t flags) noexcept
+    {
+        return InputComponent{(flags & 0x01u) != 0, (flags & 0x02u) != 0, (flags & 0x04u) != 0,
+            (flags & 0x08u) != 0, (flags & 0x10u) != 0};
+    }
+} // namespace Game::Replay
@@ -0,0 +1,87 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** ReplayReader
+*/
+
+#include "ReplayReader.hpp"
+#include <algorithm>
+
+namespace Game
+{
+    ReplayReader::ReplayReader(const std::string &path) : _file(path, std::ios::binary)
+    {
+        if (!_file.is_open())
+            throw ReplayError("{ReplayReader::ReplayReader} Failed to open recording file: " + path);
+
+        char magic[sizeof(Replay::MAGIC)] = {};
+        _file.read(magic, sizeof(magic));
+        if (!_file || !std::equal(std::begin(magic), std::end(magic), std::begin(Replay::MAGIC)))
+            throw ReplayError("{ReplayReader::ReplayReader} Not a replay file: " + path);
+        if (const auto version = readFixed(2); version != Replay::VERSION)
+            throw ReplayError("{ReplayReader::ReplayReader} Unsupported replay version " + std::to_string(version));
+
+        _header.seed = readFixed(8);
+        _header.levelPath.resize(readFixed(2));
+        _file.read(_header.levelPath.data(), static_cast<std::streamsize>(_header.levelPath.size()));
+        if (!_file)
+            throw ReplayError("{ReplayReader::ReplayReader} Truncated header");
+    }
+
+    const Replay::Header &ReplayReader::header() const noexcept
+    {
+        return _header;
+    }
+
+    bool ReplayReader::next(Record &out)
+    {
+        const int tag = _file.get();
+        if (tag == std::char_traits<char>::eof())
+            return false;
+
+        switch (static_cast<std::uint8_t>(tag)) {
+            case Replay::RECORD_COMMAND:
+                out.kind = Record::Kind::Command;
+                _lastTick += readVarint();
+                out.command.tick = _lastTick;
+                out.command.type = readByte();
+                out.command.sessionId = static_cast<std::int32_t>(readVarint());
+                out.command.inputFlags = out.command.type == Replay::COMMAND_INPUT ? readByte() : 0;
+                return true;
+            case Replay::RECORD_STEP:
+                out.kind = Record::Kind::Step;
+                out.hash = readFixed(8);
+                return true;
+            default: throw ReplayError("{ReplayReader::next} Unknown record tag " + std::to_string(tag));
+        }
+    }
+
+    std::uint8_t ReplayReader::readByte()
+    {
+        const int c = _file.get();
+        if (c == std::char_traits<char>::eof())
+            throw ReplayError("{ReplayReader::readByte} Truncated record");
+        return static_cast<std::uint8_t>(c);
+    }
+
+    std::uint64_t ReplayReader::readVarint()
+    {
+        std::uint64_t value = 0;
+        for (unsigned shift = 0; shift < 64; shift += 7) {
+            const std::uint8_t byte = readByte();
+            value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0)
+                return value;
+        }
+        throw ReplayError("{ReplayReader::readVarint} Malformed varint");
+    }
+
+    std::uint64_t ReplayReader::readFixed(const size_t bytes)
+    {
+        std::uint64_t value = 0;
+        for (size_t i = 0; i < bytes; i++)
+            value |= static_cast<std::uint64_t>(readByte()) << (8 * i);
+        return value;
+    }
+} // namespace Game
@@ -0,0 +1,85 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** ReplayReader
+*/
+
+#pragma once
+
+#include <fstream>
+#include <string>
+#include "ReplayRecorder.hpp"
+
+namespace Game
+{
+    /**
+     * @class ReplayReader
+     * @brief Sequential reader for recordings produced by ReplayRecorder.
+     */
+    class ReplayReader {
+      public:
+        /**
+         * @brief A single record read from a recording.
+         */
+        struct Record {
+            /**
+             * @brief Kind of record.
+             */
+            enum class Kind {
+                Command, ///> A command to apply before the next step
+                Step,    ///> A fixed step and the expected world hash
+            };
+
+            Kind kind = Kind::Command; ///> Record kind
+            Replay::Command command{}; ///> Command data (Kind::Command)
+            std::uint64_t hash = 0;    ///> Expected world hash (Kind::Step)
+        };
+
+        /**
+         * @brief Open a recording and parse its header.
+         * @param path Recording file path.
+         * @throws ReplayError if the file is missing or not a recording.
+         */
+        explicit ReplayReader(const std::string &path);
+
+        /**
+         * @brief Get the recording header.
+         * @return Seed and level path of the recorded room.
+         */
+        [[nodiscard]] const Replay::Header &header() const noexcept;
+
+        /**
+         * @brief Read the next record.
+         * @param out Record to fill.
+         * @return true if a record was read, false at end of file.
+         * @throws ReplayError if the record is truncated or unknown.
+         */
+        bool next(Record &out);
+
+      private:
+        /**
+         * @brief Read one byte.
+         * @return The byte read.
+         * @throws ReplayError at end of file.
+         */
+        std::uint8_t readByte();
+
+        /**
+         * @brief Read an unsigned LEB128 varint.
+         * @return The decoded value.
+         */
+        std::uint64_t readVarint();
+
+        /**
+         * @brief Read a little-endian fixed-width integer.
+         * @param bytes Number of bytes to read.
+         * @return The decoded value.
+         */
+        std::uint64_t readFixed(size_t bytes);
+
+        std::ifstream _file;         ///> Input stream
+        Replay::Header _header;      ///> Parsed header
+        std::uint64_t _lastTick = 0; ///> Tick of the previous command (delta base)
+    };
+} // namespace Game
@@ -0,0 +1,87 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** ReplayRecorder
+*/
+
+#include "ReplayRecorder.hpp"
+#include "Log.hpp"
+
+namespace Game
+{
+    ReplayRecorder::ReplayRecorder(const std::string &path, const Replay::Header &header)
+        : _file(path, std::ios::binary | std::ios::trunc)
+    {
+        if (!_file.is_open())
+            throw ReplayError("{ReplayRecorder::ReplayRecorder} Failed to open recording file: " + path);
+        if (header.levelPath.size() > UINT16_MAX)
+            throw ReplayError("{ReplayRecorder::ReplayRecorder} Level path too long");
+
+        _buffer.reserve(FLUSH_THRESHOLD * 2);
+        _buffer.insert(_buffer.end(), std::begin(Replay::MAGIC), std::end(Replay::MAGIC));
+        writeFixed(Replay::VERSION, 2);
+        writeFixed(header.seed, 8);
+        writeFixed(header.levelPath.size(), 2);
+        _buffer.insert(_buffer.end(), header.levelPath.begin(), header.levelPath.end());
+        flush();
+    }
+
+    ReplayRecorder::~ReplayRecorder()
+    {
+        try {
+            flush();
+        } catch (...) {
+            Log::error("ReplayRecorder::~ReplayRecorder", "failed to flush recording");
+        }
+    }
+
+    void ReplayRecorder::recordCommand(const Replay::Command &cmd)
+    {
+        _buffer.push_back(Replay::RECORD_COMMAND);
+        writeVarint(cmd.tick - _lastTick);
+        _buffer.push_back(cmd.type);
+        writeVarint(static_cast<std::uint32_t>(cmd.sessionId));
+        if (cmd.type == Replay::COMMAND_INPUT)
+            _buffer.push_back(cmd.inputFlags);
+        _lastTick = cmd.tick;
+        if (_buffer.size() >= FLUSH_THRESHOLD)
+            flush();
+    }
+
+    void ReplayRecorder::recordStep(const std::uint64_t worldHash)
+    {
+        _buffer.push_back(Replay::RECORD_STEP);
+        writeFixed(worldHash, 8);
+        if (_buffer.size() >= FLUSH_THRESHOLD)
+            flush();
+    }
+
+    void ReplayRecorder::flush()
+    {
+        if (_buffer.empty())
+            return;
+        _file.write(reinterpret_cast<const char *>(_buffer.data()), static_cast<std::streamsize>(_buffer.size()));
+        _file.flush();
+        _buffer.clear();
+        if (!_file)
+            throw ReplayError("{ReplayRecorder::flush} Failed to write recording");
+    }
+
+    void ReplayRecorder::writeVarint(std::uint64_t value)
+    {
+        while (value >= 0x80) {
+            _buffer.push_back(static_cast<std::uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+        _buffer.push_back(static_cast<std::uint8_t>(value));
+    }
+
+    void ReplayRecorder::writeFixed(std::uint64_t value, const size_t bytes)
+    {
+        for (size_t i = 0; i < bytes; i++) {
+            _buffer.push_back(static_cast<std::uint8_t>(value & 0xFF));
+            value >>= 8;
+        }
+    }
+} // namespace Game
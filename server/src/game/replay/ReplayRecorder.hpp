@@ -0,0 +1,106 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** ReplayRecorder
+*/
+
+#pragma once
+
+#include <fstream>
+#include <string>
+#include <vector>
+#include "ReplayFormat.hpp"
+
+namespace Game
+{
+    /**
+     * @class ReplayError
+     * @brief Exception thrown when a recording cannot be written or read.
+     */
+    class ReplayError : public std::exception {
+      public:
+        /**
+         * @brief Constructor for ReplayError.
+         * @param message The error message.
+         */
+        explicit ReplayError(const std::string &message) : _message("\n\t" + message)
+        {
+        }
+
+        /**
+         * @brief Override of what() method from std::exception.
+         * @return The error message.
+         */
+        const char *what() const noexcept override
+        {
+            return _message.c_str();
+        }
+
+      private:
+        std::string _message; ///> Error message
+    };
+
+    /**
+     * @class ReplayRecorder
+     * @brief Streams the commands applied to a room and the per-step world hash to a binary file.
+     *
+     * The recorder is owned by a GameServer and only used from its tick thread.
+     * Records are staged in memory and flushed in blocks to keep the tick cheap.
+     */
+    class ReplayRecorder {
+      public:
+        /**
+         * @brief Open a recording file and write its header.
+         * @param path Destination file path.
+         * @param header Seed and level path of the recorded room.
+         * @throws ReplayError if the file cannot be opened.
+         */
+        ReplayRecorder(const std::string &path, const Replay::Header &header);
+
+        /**
+         * @brief Flush pending records and close the file.
+         */
+        ~ReplayRecorder();
+
+        ReplayRecorder(const ReplayRecorder &) = delete;
+        ReplayRecorder &operator=(const ReplayRecorder &) = delete;
+
+        /**
+         * @brief Append a drained command.
+         * @param cmd The command with the tick it was applied at.
+         */
+        void recordCommand(const Replay::Command &cmd);
+
+        /**
+         * @brief Append the end of a fixed step.
+         * @param worldHash Hash of the world after the step.
+         */
+        void recordStep(std::uint64_t worldHash);
+
+        /**
+         * @brief Write staged records to disk.
+         */
+        void flush();
+
+      private:
+        /**
+         * @brief Append an unsigned LEB128 varint to the staging buffer.
+         * @param value The value to encode.
+         */
+        void writeVarint(std::uint64_t value);
+
+        /**
+         * @brief Append a little-endian fixed-width integer to the staging buffer.
+         * @param value The value to encode.
+         * @param bytes Number of bytes to write.
+         */
+        void writeFixed(std::uint64_t value, size_t bytes);
+
+        static constexpr size_t FLUSH_THRESHOLD = 4096; ///> Staged bytes before a write
+
+        std::ofstream _file;               ///> Output stream
+        std::vector<std::uint8_t> _buffer; ///> Staged encoded records
+        std::uint64_t _lastTick = 0;       ///> Tick of the previous command (delta base)
+    };
+} // namespace Game
@@ -0,0 +1,87 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** WorldHash
+*/
+
+#include "WorldHash.hpp"
+#include <bit>
+#include "AIShoot.hpp"
+#include "Drawable.hpp"
+#include "Health.hpp"
+#include "Lifetime.hpp"
+#include "Position.hpp"
+#include "Score.hpp"
+#include "Velocity.hpp"
+
+namespace
+{
+    constexpr std::uint64_t FnvOffset = 0xcbf29ce484222325ULL;
+    constexpr std::uint64_t FnvPrime = 0x100000001b3ULL;
+
+    void mix(std::uint64_t &hash, std::uint64_t value)
+    {
+        for (int i = 0; i < 8; i++) {
+            hash ^= value & 0xFF;
+            hash *= FnvPrime;
+            value >>= 8;
+        }
+    }
+
+    void mixFloat(std::uint64_t &hash, const float value)
+    {
+        mix(hash, std::bit_cast<std::uint32_t>(value));
+    }
+} // namespace
+
+namespace Game
+{
+    std::uint64_t WorldHash::compute(IGameWorld &world)
+    {
+        auto &reg = world.registry();
+        std::uint64_t hash = FnvOffset;
+
+        reg.view<Ecs::Position>([&hash](const Ecs::Entity &e, const Ecs::Position &pos) {
+            mix(hash, static_cast<size_t>(e));
+            mixFloat(hash, pos.x);
+            mixFloat(hash, pos.y);
+        });
+        reg.view<Ecs::Velocity>([&hash](const Ecs::Entity &e, const Ecs::Velocity &vel) {
+            mix(hash, static_cast<size_t>(e));
+            mixFloat(hash, vel.vx);
+            mixFloat(hash, vel.vy);
+        });
+        reg.view<Ecs::Health>([&hash](const Ecs::Entity &e, const Ecs::Health &hp) {
+            mix(hash, static_cast<size_t>(e));
+            mix(hash, static_cast<std::uint32_t>(hp.hp));
+        });
+        reg.view<Ecs::Drawable>([&hash](const Ecs::Entity &e, const Ecs::Drawable &draw) {
+            mix(hash, static_cast<size_t>(e));
+            mix(hash, draw.spriteId);
+        });
+        reg.view<Ecs::Score>([&hash](const Ecs::Entity &e, const Ecs::Score &score) {
+            mix(hash, static_cast<size_t>(e));
+            mix(hash, score.score);
+        });
+        reg.view<Ecs::Lifetime>([&hash](const Ecs::Entity &e, const Ecs::Lifetime &life) {
+            mix(hash, static_cast<size_t>(e));
+            mixFloat(hash, life.remaining);
+        });
+        reg.view<Ecs::AIShoot>([&hash](const Ecs::Entity &e, const Ecs::AIShoot &shoot) {
+            mix(hash, static_cast<size_t>(e));
+            mixFloat(hash, shoot.timer);
+        });
+
+        const auto &pool = world.projectiles();
+        for (size_t i = 0; i < pool.size(); i++) {
+            mix(hash, pool.ids[i]);
+            mixFloat(hash, pool.x[i]);
+            mixFloat(hash, pool.y[i]);
+            mixFloat(hash, pool.vx[i]);
+            mixFloat(hash, pool.vy[i]);
+            mixFloat(hash, pool.remaining[i]);
+        }
+        return hash;
+    }
+} // namespace Game
@@ -0,0 +1,31 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** WorldHash
+*/
+
+#pragma once
+
+#include <cstdint>
+#include "IGameWorld.hpp"
+
+namespace Game
+{
+    /**
+     * @brief Computes a stable fingerprint of the simulated state of a world.
+     *
+     * The hash covers every component that influences the simulation outcome
+     * (positions, velocities, health, scores, lifetimes, AI timers). Two worlds
+     * that went through the same commands with the same seed produce the same value.
+     */
+    class WorldHash {
+      public:
+        /**
+         * @brief Hash the current state of the given world.
+         * @param world The world to fingerprint.
+         * @return 64-bit FNV-1a hash of the world state.
+         */
+        [[nodiscard]] static std::uint64_t compute(IGameWorld &world);
+    };
+} // namespace Game
@@ -0,0 +1,101 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** SnapshotRate
+*/
+
+#include "SnapshotRate.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace Game
+{
+    SnapshotRate::SnapshotRate(const double stepRate) noexcept : SnapshotRate(stepRate, Config())
+    {
+    }
+
+    SnapshotRate::SnapshotRate(const double stepRate, const Config &config) noexcept
+        : _stepRate(stepRate), _interval(config.baseInterval)
+    {
+        configure(config);
+    }
+
+    void SnapshotRate::configure(const Config &config) noexcept
+    {
+        _config = config;
+        _config.minInterval = std::max<std::uint32_t>(_config.minInterval, 1);
+        _config.maxInterval = std::max(_config.maxInterval, _config.minInterval);
+        _interval = std::clamp(_config.baseInterval, _config.minInterval, _config.maxInterval);
+        _next = 0;
+        _churn = 0.0;
+        _loss = 0.0;
+        _throttle = 0;
+    }
+
+    bool SnapshotRate::due(const std::uint64_t tick) const noexcept
+    {
+        return tick >= _next;
+    }
+
+    void SnapshotRate::onLink(const std::uint64_t sent, const std::uint64_t resent) noexcept
+    {
+        if (sent >= _sent && resent >= _resent) {
+            if (const std::uint64_t delta = sent - _sent; delta > 0) {
+                const double sample = std::min(1.0, static_cast<double>(resent - _resent) / static_cast<double>(delta));
+                _loss += SMOOTHING * (sample - _loss);
+            } else {
+                _loss -= SMOOTHING * _loss;
+            }
+        }
+        _sent = sent;
+        _resent = resent;
+    }
+
+    void SnapshotRate::onSnapshot(const std::uint64_t tick, const std::size_t entities, const std::size_t changed,
+        const std::size_t bytes) noexcept
+    {
+        const double sample =
+            std::min(1.0, static_cast<double>(changed) / static_cast<double>(std::max<std::size_t>(entities, 1)));
+        _churn += SMOOTHING * (sample - _churn);
+
+        if (_loss > _config.highLoss)
+            _interval = _interval * 2;
+        else if (_churn > _config.highChurn)
+            _interval = _interval - 1;
+        else if (_churn < _config.lowChurn)
+            _interval = _interval + 1;
+        const std::uint32_t floor = std::max({_config.minInterval, bandwidthFloor(bytes), _throttle});
+        const std::uint32_t shortest = std::min(floor, _config.maxInterval);
+        _interval = std::clamp(_interval, shortest, _config.maxInterval);
+        _next = tick + _interval;
+    }
+
+    void SnapshotRate::throttle(const std::uint32_t minInterval) noexcept
+    {
+        _throttle = minInterval;
+    }
+
+    std::uint32_t SnapshotRate::interval() const noexcept
+    {
+        return _interval;
+    }
+
+    double SnapshotRate::churn() const noexcept
+    {
+        return _churn;
+    }
+
+    double SnapshotRate::loss() const noexcept
+    {
+        return _loss;
+    }
+
+    std::uint32_t SnapshotRate::bandwidthFloor(const std::size_t bytes) const noexcept
+    {
+        if (_config.bandwidth == 0)
+            return _config.minInterval;
+        const double steps = std::ceil(static_cast<double>(bytes) * _stepRate / static_cast<double>(_config.bandwidth));
+        return static_cast<std::uint32_t>(std::min(steps, static_cast<double>(_config.maxInterval)));
+    }
+} // namespace Game
@@ -0,0 +1,126 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** SnapshotRate
+*/
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+namespace Game
+{
+    /**
+     * @class SnapshotRate
+     * @brief Decides on which fixed steps a room sends its snapshot.
+     * @details The interval between snapshots, in fixed steps, adapts after every snapshot:
+     * - it shrinks by one step while many entities change between snapshots,
+     * - it grows by one step while the world is quiet,
+     * - it doubles while clients lose packets,
+     * - it never gets so short that a client receives more than the bandwidth budget,
+     * - it never gets shorter than the throttle set while the room is overloaded.
+     * Owned by the room's thread; not thread-safe.
+     */
+    class SnapshotRate {
+      public:
+        /**
+         * @brief Bounds and thresholds of the controller.
+         */
+        struct Config {
+            std::uint32_t minInterval = 1;     ///> Fewest steps between snapshots
+            std::uint32_t maxInterval = 12;    ///> Most steps between snapshots
+            std::uint32_t baseInterval = 3;    ///> Steps between the first snapshots
+            double highChurn = 0.10;           ///> Share of entities changed above which snapshots speed up
+            double lowChurn = 0.02;            ///> Share of entities changed below which snapshots slow down
+            double highLoss = 0.05;            ///> Share of datagrams resent above which snapshots slow down
+            std::size_t bandwidth = 32 * 1024; ///> Snapshot bytes per second allowed per client, 0 for no limit
+        };
+
+        static constexpr double SMOOTHING = 0.25; ///> Weight of a new sample in the churn and loss averages
+
+        /**
+         * @brief Constructs a controller with the default bounds and thresholds.
+         * @param stepRate Fixed steps per second of the room.
+         */
+        explicit SnapshotRate(double stepRate) noexcept;
+
+        /**
+         * @brief Constructs a controller.
+         * @param stepRate Fixed steps per second of the room.
+         * @param config The bounds and thresholds.
+         */
+        SnapshotRate(double stepRate, const Config &config) noexcept;
+
+        /**
+         * @brief Replaces the bounds and thresholds, restarting from the base interval.
+         * @param config The bounds and thresholds.
+         */
+        void configure(const Config &config) noexcept;
+
+        /**
+         * @brief Tells whether a snapshot is due.
+         * @param tick The index of the last fixed step.
+         * @return True if the interval elapsed since the last snapshot.
+         */
+        [[nodiscard]] bool due(std::uint64_t tick) const noexcept;
+
+        /**
+         * @brief Records the link counters summed over the room's clients.
+         * @param sent Datagrams put on the wire so far.
+         * @param resent Datagrams resent so far.
+         */
+        void onLink(std::uint64_t sent, std::uint64_t resent) noexcept;
+
+        /**
+         * @brief Records a snapshot and adapts the interval.
+         * @param tick The index of the fixed step the snapshot was taken at.
+         * @param entities Entities in the snapshot.
+         * @param changed Entities that appeared, disappeared, moved or changed sprite since the previous snapshot.
+         * @param bytes Largest snapshot packet sent to one client.
+         */
+        void onSnapshot(std::uint64_t tick, std::size_t entities, std::size_t changed, std::size_t bytes) noexcept;
+
+        /**
+         * @brief Sets a floor on the interval, applied from the next snapshot.
+         * @param minInterval Fewest steps between snapshots, 0 to lift the throttle.
+         */
+        void throttle(std::uint32_t minInterval) noexcept;
+
+        /**
+         * @brief Gets the current interval.
+         * @return Fixed steps between snapshots.
+         */
+        [[nodiscard]] std::uint32_t interval() const noexcept;
+
+        /**
+         * @brief Gets the average share of entities changed between snapshots.
+         * @return The churn, between 0 and 1.
+         */
+        [[nodiscard]] double churn() const noexcept;
+
+        /**
+         * @brief Gets the average share of datagrams resent.
+         * @return The loss, between 0 and 1.
+         */
+        [[nodiscard]] double loss() const noexcept;
+
+      private:
+        /**
+         * @brief Gets the shortest interval keeping a snapshot of a given size within the bandwidth budget.
+         * @param bytes The size of the snapshot.
+         * @return The interval, in fixed steps.
+         */
+        [[nodiscard]] std::uint32_t bandwidthFloor(std::size_t bytes) const noexcept;
+
+        double _stepRate;            ///> Fixed steps per second
+        Config _config;              ///> Bounds and thresholds
+        std::uint32_t _interval;     ///> Current steps between snapshots
+        std::uint64_t _next = 0;     ///> Step at which the next snapshot is due
+        double _churn = 0.0;         ///> Smoothed churn
+        double _loss = 0.0;          ///> Smoothed loss
+        std::uint64_t _sent = 0;     ///> Transmissions at the previous onLink()
+        std::uint64_t _resent = 0;   ///> Retransmissions at the previous onLink()
+        std::uint32_t _throttle = 0; ///> Floor set by throttle(), 0 when lifted
+    };
+} // namespace Game
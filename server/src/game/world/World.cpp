@@ -6,6 +6,7 @@
 */
 
 #include "World.hpp"
+#include <limits>
 
 namespace
 {
@@ -15,6 +16,8 @@ namespace
 
         world.events().subscribe<CollisionEvent>([w](const CollisionEvent &event) {
             auto &reg = w->registry();
+            if (reg.destroying(Ecs::Entity(event.a)) || reg.destroying(Ecs::Entity(event.b)))
+                return;
 
             auto &hpArr = reg.getComponents<Ecs::Health>();
 
@@ -35,8 +38,9 @@ namespace
         auto *w = &world;
 
         world.events().subscribe<DamageEvent>([w](const DamageEvent &event) {
-            auto &health = w->registry().getComponents<Ecs::Health>().at(event.target);
-            if (!health || health->hp <= 0)
+            auto &reg = w->registry();
+            auto &health = reg.getComponents<Ecs::Health>().at(event.target);
+            if (!health || health->hp <= 0 || reg.destroying(Ecs::Entity(event.target)))
                 return;
             if (health->hp <= event.amount)
                 health->hp = 0;
@@ -45,11 +49,14 @@ namespace
 
             if (health->hp > 0)
                 return;
-            const auto &proj = w->registry().getComponents<Ecs::Projectile>().at(event.source);
-            if (!proj)
+            std::optional<size_t> shooter = w->projectiles().shooterOf(event.source);
+            const auto &proj = reg.getComponents<Ecs::Projectile>().at(event.source);
+            if (proj && !reg.destroying(Ecs::Entity(event.source)))
+                shooter = proj->shooter;
+            if (!shooter)
                 return;
-            if (const auto &ks = w->registry().getComponents<Ecs::KillScore>().at(event.target); ks && ks->score > 0)
-                w->events().emit<UpdateScoreEvent>(UpdateScoreEvent{proj->shooter, ks->score});
+            if (const auto &ks = reg.getComponents<Ecs::KillScore>().at(event.target); ks && ks->score > 0)
+                w->events().emit<UpdateScoreEvent>(UpdateScoreEvent{*shooter, ks->score});
         });
     }
 
@@ -58,16 +65,7 @@ namespace
         auto *w = &world;
 
         world.events().subscribe<ShootEvent>([w](const ShootEvent &event) {
-            const Ecs::Entity proj = w->registry().createEntity();
-            w->registry().emplaceComponent<Ecs::Position>(proj, Ecs::Position{event.x, event.y});
-            w->registry().emplaceComponent<Ecs::Velocity>(proj, Ecs::Velocity{event.vx, event.vy});
-            w->registry().emplaceComponent<Ecs::Damage>(proj, Ecs::Damage{event.damage});
-            w->registry().emplaceComponent<Ecs::Damageable>(proj);
-            w->registry().emplaceComponent<Ecs::Collision>(proj, Ecs::Collision{8.f, 8.f});
-            w->registry().emplaceComponent<Ecs::Drawable>(proj, Ecs::Drawable{6, true});
-            w->registry().emplaceComponent<Ecs::Health>(proj, Ecs::Health{1, 1});
-            w->registry().emplaceComponent<Ecs::Lifetime>(proj, Ecs::Lifetime{event.lifetime});
-            w->registry().emplaceComponent<Ecs::Projectile>(proj, Ecs::Projectile{event.shooter});
+            w->projectiles().spawn(static_cast<size_t>(w->registry().createEntity()), event);
         });
     }
 
@@ -76,7 +74,7 @@ namespace
         auto *w = &world;
 
         world.events().subscribe<DestroyEvent>([w](const DestroyEvent &event) {
-            w->destroyEntity(Ecs::Entity(event.entityId));
+            w->registry().deferDestroy(Ecs::Entity(event.entityId));
         });
     }
 
@@ -87,6 +85,8 @@ namespace
         world.events().subscribe<UpdateScoreEvent>([w](const UpdateScoreEvent &event) {
             auto &reg = w->registry();
             auto &scoreArr = reg.getComponents<Ecs::Score>();
+            if (reg.destroying(Ecs::Entity(event.playerId)))
+                return;
             if (auto &scoreComp = scoreArr.at(event.playerId)) {
                 scoreComp->score += event.scoreDelta;
                 w->events().emit(ScoreUpdatedEvent{event.playerId, scoreComp->score});
@@ -97,7 +97,12 @@ namespace
 
 namespace Game
 {
-    World::World()
+    World::World() : World(std::pmr::get_default_resource(), std::pmr::get_default_resource())
+    {
+    }
+
+    World::World(std::pmr::memory_resource *longLived, std::pmr::memory_resource *frame)
+        : _registry(longLived), _events(frame, longLived)
     {
         registerCollisionDamage(*this);
         registerDamageToScoreEvent(*this);
@@ -116,6 +121,11 @@ namespace Game
         return _events;
     }
 
+    ProjectilePool &World::projectiles()
+    {
+        return _projectiles;
+    }
+
     Ecs::Entity World::createPlayer()
     {
         const Ecs::Entity ent = _registry.createEntity();
@@ -142,20 +152,29 @@ namespace Game
         auto &dst = this->registry();
 
         dst.clear();
-
-        std::unordered_map<size_t, Ecs::Entity> remap;
-        src.view<Ecs::Position, Ecs::Velocity, Ecs::Drawable>(
-            [&](const Ecs::Entity e, const Ecs::Position &, const Ecs::Velocity &, const Ecs::Drawable &) {
+        _projectiles.clear();
+
+        const auto &pool = other.projectiles();
+        size_t next = 0;
+        const auto copyProjectilesBefore = [&](const size_t id) {
+            for (; next < pool.size() && pool.ids[next] < id; next++) {
+                if (pool.dead[next])
+                    continue;
                 const Ecs::Entity newEnt = dst.createEntity();
-                remap[static_cast<size_t>(e)] = newEnt;
-            });
+                dst.emplaceComponent<Ecs::Position>(newEnt, Ecs::Position{pool.x[next], pool.y[next]});
+                dst.emplaceComponent<Ecs::Velocity>(newEnt, Ecs::Velocity{pool.vx[next], pool.vy[next]});
+                dst.emplaceComponent<Ecs::Drawable>(newEnt, Ecs::Drawable{ProjectilePool::SPRITE_ID, true});
+            }
+        };
 
         src.view<Ecs::Position, Ecs::Velocity, Ecs::Drawable>(
             [&](const Ecs::Entity e, const Ecs::Position &p, const Ecs::Velocity &v, const Ecs::Drawable &d) {
-                const Ecs::Entity newEnt = remap[static_cast<size_t>(e)];
+                copyProjectilesBefore(static_cast<size_t>(e));
+                const Ecs::Entity newEnt = dst.createEntity();
                 dst.emplaceComponent<Ecs::Position>(newEnt, p);
                 dst.emplaceComponent<Ecs::Velocity>(newEnt, v);
                 dst.emplaceComponent<Ecs::Drawable>(newEnt, d);
             });
+        copyProjectilesBefore(std::numeric_limits<size_t>::max());
     }
 } // namespace Game
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <iostream>
+#include <memory_resource>
 #include "AIBrain.hpp"
 #include "Collision.hpp"
 #include "Damage.hpp"
@@ -44,6 +45,13 @@ namespace Game
          */
         World();
 
+        /**
+         * @brief Construct a new World allocating from memory resources.
+         * @param longLived Resource of the component arrays and event queues.
+         * @param frame Resource of the events, which may be released after each events().process().
+         */
+        World(std::pmr::memory_resource *longLived, std::pmr::memory_resource *frame);
+
         /**
          * @brief Access the underlying ECS registry.
          * @return Reference to the registry containing all components/entities.
@@ -56,6 +64,12 @@ namespace Game
          */
         [[nodiscard]] Ecs::EventsRegistry &events() override;
 
+        /**
+         * @brief Access the projectiles of the world.
+         * @return Reference to the projectile pool.
+         */
+        [[nodiscard]] ProjectilePool &projectiles() override;
+
         /**
          * @brief Create a new player entity with default components.
          *
@@ -78,6 +92,11 @@ namespace Game
 
         /**
          * @brief Copy the state from another IGameWorld instance.
+         *
+         * Only what clients render is copied: entities with a Position, a Velocity
+         * and a Drawable, and the projectiles of the other world, which become plain
+         * entities of this world. Entities are renumbered in id order.
+         *
          * @param other The other IGameWorld to copy from.
          */
         void copyFrom(IGameWorld &other) override;
@@ -85,5 +104,6 @@ namespace Game
       private:
         Ecs::Registry _registry;     ///> The ECS registry (component storage).
         Ecs::EventsRegistry _events; ///> Event bus for ECS events.
+        ProjectilePool _projectiles; ///> Projectiles, outside of the registry.
     };
 } // namespace Game
@@ -0,0 +1,116 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** ControlChannel
+*/
+
+#include "ControlChannel.hpp"
+#include <cstring>
+
+#ifndef _WIN32
+    #include <fcntl.h>
+    #include <poll.h>
+    #include <sys/socket.h>
+    #include <unistd.h>
+#endif
+
+namespace Gateway
+{
+#ifndef _WIN32
+    ControlChannel::ControlChannel(const int fd) noexcept : _fd(fd)
+    {
+    }
+
+    ControlChannel::~ControlChannel()
+    {
+        if (_fd >= 0)
+            ::close(_fd);
+    }
+
+    std::pair<std::unique_ptr<ControlChannel>, std::unique_ptr<ControlChannel>> ControlChannel::pair()
+    {
+        int fds[2] = {-1, -1};
+
+        if (::socketpair(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0, fds) != 0)
+            throw ControlError(std::string("{ControlChannel::pair} socketpair failed: ") + std::strerror(errno));
+        return {std::make_unique<ControlChannel>(fds[0]), std::make_unique<ControlChannel>(fds[1])};
+    }
+
+    bool ControlChannel::send(const Control::Message &message) noexcept
+    {
+        std::uint8_t buffer[Control::MAX_MESSAGE];
+        const std::size_t size = Control::HEADER_SIZE + message.body.size();
+
+        if (size > sizeof(buffer))
+            return false;
+        buffer[0] = message.type;
+        for (std::size_t i = 0; i < 4; i++)
+            buffer[1 + i] = static_cast<std::uint8_t>(message.request >> (24 - 8 * i));
+        if (!message.body.empty())
+            std::memcpy(buffer + Control::HEADER_SIZE, message.body.data(), message.body.size());
+        return ::send(_fd, buffer, size, MSG_NOSIGNAL) == static_cast<ssize_t>(size);
+    }
+
+    ControlChannel::Status ControlChannel::receive(
+        Control::Message &out, const std::chrono::milliseconds timeout) noexcept
+    {
+        pollfd pfd{_fd, POLLIN, 0};
+        std::uint8_t buffer[Control::MAX_MESSAGE];
+
+        if (const int ready = ::poll(&pfd, 1, static_cast<int>(timeout.count())); ready == 0)
+            return Status::Timeout;
+        else if (ready < 0)
+            return errno == EINTR ? Status::Timeout : Status::Closed;
+        const ssize_t size = ::recv(_fd, buffer, sizeof(buffer), 0);
+        if (size < static_cast<ssize_t>(Control::HEADER_SIZE))
+            return size < 0 && (errno == EINTR || errno == EAGAIN) ? Status::Timeout : Status::Closed;
+
+        out.type = buffer[0];
+        out.request = 0;
+        for (std::size_t i = 0; i < 4; i++)
+            out.request = (out.request << 8) | buffer[1 + i];
+        try {
+            out.body.assign(buffer + Control::HEADER_SIZE, buffer + size);
+        } catch (...) {
+            return Status::Closed;
+        }
+        return Status::Received;
+    }
+
+    int ControlChannel::inheritable()
+    {
+        const int flags = ::fcntl(_fd, F_GETFD);
+
+        if (flags < 0 || ::fcntl(_fd, F_SETFD, flags & ~FD_CLOEXEC) != 0)
+            throw ControlError(std::string("{ControlChannel::inheritable} fcntl failed: ") + std::strerror(errno));
+        return _fd;
+    }
+#else
+    ControlChannel::ControlChannel(const int fd) noexcept : _fd(fd)
+    {
+    }
+
+    ControlChannel::~ControlChannel() = default;
+
+    std::pair<std::unique_ptr<ControlChannel>, std::unique_ptr<ControlChannel>> ControlChannel::pair()
+    {
+        throw ControlError("{ControlChannel::pair} Game workers are not supported on Windows");
+    }
+
+    bool ControlChannel::send(const Control::Message &) noexcept
+    {
+        return false;
+    }
+
+    ControlChannel::Status ControlChannel::receive(Control::Message &, const std::chrono::milliseconds) noexcept
+    {
+        return Status::Closed;
+    }
+
+    int ControlChannel::inheritable()
+    {
+        throw ControlError("{ControlChannel::inheritable} Game workers are not supported on Windows");
+    }
+#endif
+} // namespace Gateway
@@ -0,0 +1,110 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** ControlChannel
+*/
+
+#pragma once
+
+#include <chrono>
+#include <exception>
+#include <memory>
+#include <string>
+#include <utility>
+#include "ControlProtocol.hpp"
+
+namespace Gateway
+{
+    /**
+     * @class ControlError
+     * @brief Exception thrown when a control channel or a worker process cannot be set up.
+     */
+    class ControlError : public std::exception {
+      public:
+        /**
+         * @brief Constructor for ControlError.
+         * @param message The error message.
+         */
+        explicit ControlError(const std::string &message) : _message("\n\t" + message)
+        {
+        }
+
+        /**
+         * @brief Override of what() method from std::exception.
+         * @return The error message.
+         */
+        const char *what() const noexcept override
+        {
+            return _message.c_str();
+        }
+
+      private:
+        std::string _message; ///> Error message
+    };
+
+    /**
+     * @class ControlChannel
+     * @brief One end of the local channel between the gateway and a game worker.
+     * @details A connected AF_UNIX SOCK_SEQPACKET socket: each message is one datagram, and
+     * the peer exiting, even by a crash, closes the channel. Not available on Windows.
+     * One thread sends and receives on a given end.
+     */
+    class ControlChannel {
+      public:
+        /**
+         * @brief Outcome of receive().
+         */
+        enum class Status {
+            Received, ///> A message was read
+            Timeout,  ///> No message came in time
+            Closed    ///> The peer is gone or sent garbage
+        };
+
+        /**
+         * @brief Takes ownership of a connected socket.
+         * @param fd The socket, closed with the channel.
+         */
+        explicit ControlChannel(int fd) noexcept;
+
+        /**
+         * @brief Closes the socket.
+         */
+        ~ControlChannel();
+
+        ControlChannel(const ControlChannel &) = delete;
+        ControlChannel &operator=(const ControlChannel &) = delete;
+
+        /**
+         * @brief Creates the two ends of a channel, both closed on exec.
+         * @return The two ends.
+         * @throws ControlError if the socket pair cannot be created.
+         */
+        [[nodiscard]] static std::pair<std::unique_ptr<ControlChannel>, std::unique_ptr<ControlChannel>> pair();
+
+        /**
+         * @brief Sends a message.
+         * @param message The message; its body must fit in MAX_MESSAGE.
+         * @return False if the peer is gone.
+         */
+        bool send(const Control::Message &message) noexcept;
+
+        /**
+         * @brief Waits for a message.
+         * @param out The message read.
+         * @param timeout Longest wait; zero only checks.
+         * @return Whether a message was read.
+         */
+        [[nodiscard]] Status receive(Control::Message &out, std::chrono::milliseconds timeout) noexcept;
+
+        /**
+         * @brief Keeps the socket open in a program started by exec.
+         * @return The socket, to pass to the program.
+         * @throws ControlError if the flag cannot be changed.
+         */
+        [[nodiscard]] int inheritable();
+
+      private:
+        int _fd; ///> The socket
+    };
+} // namespace Gateway
@@ -0,0 +1,56 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** ControlProtocol
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Messages exchanged between the gateway and its game workers.
+ *
+ * Each message is one datagram of a local SOCK_SEQPACKET channel:
+ *   u8 type | u32 request id | body
+ * Bodies are encoded with Net::TCP::Writer (big-endian). The gateway sends requests and the
+ * worker answers each with a REPLY carrying the same request id; LOAD reports and ROOM_CLOSED
+ * notices are sent by the worker on its own, with request id 0.
+ *
+ *   CREATE_ROOM : str16 name | u8 max players | u8 has seed | [u64 seed]  -> REPLY value = room id
+ *   JOIN_ROOM   : u32 room id | u32 client IPv4 (network order)          -> REPLY value = seat token
+ *   LEAVE_ROOM  : u32 room id | u32 seat token                           -> no reply
+ *   START_ROOM  : u32 room id                                            -> REPLY ok if the room started
+ *   CLOSE_ROOM  : u32 room id                                            -> no reply, removed if empty
+ *   SHUTDOWN    : (empty)                                                -> no reply, the worker exits
+ *   REPLY       : u8 ok | u32 value
+ *   LOAD        : u16 UDP port | u32 rooms | u32 players
+ *   ROOM_CLOSED : u32 room id, gone from the worker since its previous LOAD
+ */
+namespace Gateway::Control
+{
+    inline constexpr std::uint8_t CREATE_ROOM = 0x01; ///> Create a room on the worker
+    inline constexpr std::uint8_t JOIN_ROOM = 0x02;   ///> Hold a seat of a room for a client
+    inline constexpr std::uint8_t LEAVE_ROOM = 0x03;  ///> Release a seat not taken yet
+    inline constexpr std::uint8_t START_ROOM = 0x04;  ///> Start the game of a room
+    inline constexpr std::uint8_t CLOSE_ROOM = 0x05;  ///> Remove a room its lobby members all left
+    inline constexpr std::uint8_t SHUTDOWN = 0x06;    ///> Stop the worker
+
+    inline constexpr std::uint8_t REPLY = 0x10;       ///> Answer to a request
+    inline constexpr std::uint8_t LOAD = 0x11;        ///> Periodic health and load report
+    inline constexpr std::uint8_t ROOM_CLOSED = 0x12; ///> A room the worker removed on its own
+
+    inline constexpr std::size_t HEADER_SIZE = 5;    ///> Type and request id
+    inline constexpr std::size_t MAX_MESSAGE = 1024; ///> Largest message, far above the largest body
+
+    /**
+     * @brief A message of the control channel.
+     */
+    struct Message {
+        std::uint8_t type = 0;          ///> Message type
+        std::uint32_t request = 0;      ///> Request id, echoed by the REPLY
+        std::vector<std::uint8_t> body; ///> Type-specific body
+    };
+} // namespace Gateway::Control
@@ -0,0 +1,395 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** WorkerPool
+*/
+
+#include "WorkerPool.hpp"
+#include <algorithm>
+#include <tuple>
+#include "Log.hpp"
+#include "TCPReader.hpp"
+#include "TCPWriter.hpp"
+
+namespace Gateway
+{
+    WorkerPool::WorkerPool(
+        std::shared_ptr<Net::Server::ISessionManager> sessions, const std::size_t workers, Spawner spawner)
+        : _sessions(std::move(sessions)), _spawner(std::move(spawner)), _workers(workers)
+    {
+        for (std::size_t i = 0; i < _workers.size(); i++) {
+            _workers[i].process = _spawner(i);
+            _workers[i].lastReport = std::chrono::steady_clock::now();
+        }
+    }
+
+    WorkerPool::~WorkerPool()
+    {
+        shutdown();
+    }
+
+    Engine::RoomId WorkerPool::createRoom(
+        const std::string &name, const size_t maxPlayers, const std::optional<std::uint64_t> seed) noexcept
+    {
+        const auto index = pick();
+
+        if (!index) {
+            Log::warn("WorkerPool::createRoom", "no healthy worker to place the room on");
+            return 0;
+        }
+        try {
+            Net::TCP::Writer b;
+            b.str16(name);
+            b.u8(static_cast<std::uint8_t>(maxPlayers));
+            b.u8(seed ? 1 : 0);
+            if (seed)
+                b.u64(*seed);
+            const auto localId = request(*index, Control::CREATE_ROOM, b.bytes());
+            if (!localId)
+                return 0;
+            const Engine::RoomId roomId = _nextRoomId++;
+            const auto &room = _rooms[roomId] = PlacedRoom{*index, *localId, name, maxPlayers, {}};
+            _workers[*index].placed++;
+            publish(roomId, room);
+            return roomId;
+        } catch (...) {
+            return 0;
+        }
+    }
+
+    void WorkerPool::addPlayerToRoom(const Engine::RoomId roomId, const int sessionId) noexcept
+    {
+        const auto it = _rooms.find(roomId);
+        const sockaddr_in *addr = _sessions->getAddress(sessionId);
+
+        if (it == _rooms.end() || !addr || _members.contains(sessionId))
+            return;
+        auto &room = it->second;
+        if (room.members.size() >= room.maxPlayers || _workers[room.worker].closed)
+            return;
+        try {
+            Net::TCP::Writer b;
+            b.u32(room.localId);
+            b.u32(addr->sin_addr.s_addr);
+            const auto seat = request(room.worker, Control::JOIN_ROOM, b.bytes());
+            if (!seat || !_rooms.contains(roomId))
+                return;
+            room.members.push_back(sessionId);
+            _members[sessionId] = Member{roomId, *seat};
+        } catch (...) {
+            return;
+        }
+        publish(roomId, room);
+    }
+
+    Engine::RoomId WorkerPool::removePlayer(const int sessionId) noexcept
+    {
+        const auto member = _members.find(sessionId);
+
+        if (member == _members.end())
+            return 0;
+        const auto [roomId, seat] = member->second;
+        _members.erase(member);
+        const auto it = _rooms.find(roomId);
+        if (it == _rooms.end())
+            return 0;
+        auto &room = it->second;
+        std::erase(room.members, sessionId);
+        try {
+            Net::TCP::Writer b;
+            b.u32(room.localId);
+            b.u32(seat);
+            notify(room.worker, Control::LEAVE_ROOM, b.bytes());
+            if (room.members.empty()) {
+                Net::TCP::Writer close;
+                close.u32(room.localId);
+                notify(room.worker, Control::CLOSE_ROOM, close.bytes());
+                _directory.remove(roomId);
+                _rooms.erase(it);
+                return roomId;
+            }
+        } catch (...) {
+            return roomId;
+        }
+        publish(roomId, room);
+        return roomId;
+    }
+
+    Engine::RoomId WorkerPool::getRoomIdOfPlayer(const int sessionId) const noexcept
+    {
+        const auto it = _members.find(sessionId);
+        return it != _members.end() ? it->second.roomId : 0;
+    }
+
+    bool WorkerPool::start(const Engine::RoomId roomId) noexcept
+    {
+        const auto it = _rooms.find(roomId);
+
+        if (it == _rooms.end())
+            return false;
+        try {
+            Net::TCP::Writer b;
+            b.u32(it->second.localId);
+            return request(it->second.worker, Control::START_ROOM, b.bytes()).has_value();
+        } catch (...) {
+            return false;
+        }
+    }
+
+    std::vector<int> WorkerPool::members(const Engine::RoomId roomId) const
+    {
+        const auto it = _rooms.find(roomId);
+        return it != _rooms.end() ? it->second.members : std::vector<int>{};
+    }
+
+    std::uint16_t WorkerPool::udpPort(const Engine::RoomId roomId) noexcept
+    {
+        if (roomId == 0) {
+            const auto index = pick();
+            return index ? _workers[*index].load.udpPort : 0;
+        }
+        const auto it = _rooms.find(roomId);
+        return it != _rooms.end() ? _workers[it->second.worker].load.udpPort : 0;
+    }
+
+    std::uint32_t WorkerPool::seatToken(const int sessionId) const noexcept
+    {
+        const auto it = _members.find(sessionId);
+        return it != _members.end() ? it->second.seat : 0;
+    }
+
+    Engine::RoomDirectory &WorkerPool::directory() noexcept
+    {
+        return _directory;
+    }
+
+    void WorkerPool::poll() noexcept
+    {
+        const auto now = std::chrono::steady_clock::now();
+
+        collect();
+        for (std::size_t i = 0; i < _workers.size(); i++) {
+            auto &worker = _workers[i];
+            if (!worker.process) {
+                if (now >= worker.respawnAt)
+                    spawn(i);
+                continue;
+            }
+            if (worker.closed || !worker.process->running()) {
+                drop(i);
+                continue;
+            }
+            if (const bool healthy = isHealthy(worker, now); healthy != worker.healthy) {
+                worker.healthy = healthy;
+                if (healthy)
+                    Log::info("WorkerPool::poll", "worker ready", {{"worker", i}, {"port", worker.load.udpPort}});
+                else
+                    Log::warn("WorkerPool::poll", "worker stopped reporting", {{"worker", i}});
+            }
+        }
+    }
+
+    void WorkerPool::shutdown() noexcept
+    {
+        for (std::size_t i = 0; i < _workers.size(); i++)
+            if (_workers[i].process)
+                notify(i, Control::SHUTDOWN, {});
+        for (auto &worker : _workers)
+            worker.process.reset();
+        _rooms.clear();
+        _members.clear();
+    }
+
+    std::size_t WorkerPool::healthyWorkers() const noexcept
+    {
+        const auto now = std::chrono::steady_clock::now();
+
+        return static_cast<std::size_t>(std::ranges::count_if(_workers, [now](const Worker &worker) {
+            return isHealthy(worker, now);
+        }));
+    }
+
+    bool WorkerPool::isHealthy(const Worker &worker, const std::chrono::steady_clock::time_point now) noexcept
+    {
+        return worker.process && !worker.closed && !worker.stalled && worker.reported
+            && now - worker.lastReport < HEALTH_TIMEOUT;
+    }
+
+    void WorkerPool::collect() noexcept
+    {
+        Control::Message message;
+
+        for (std::size_t i = 0; i < _workers.size(); i++) {
+            auto &worker = _workers[i];
+            if (!worker.process || worker.closed)
+                continue;
+            for (;;) {
+                const auto status = worker.process->channel().receive(message, std::chrono::milliseconds(0));
+                if (status == ControlChannel::Status::Timeout)
+                    break;
+                if (status == ControlChannel::Status::Closed) {
+                    worker.closed = true;
+                    break;
+                }
+                onReport(i, message);
+            }
+        }
+    }
+
+    std::optional<std::size_t> WorkerPool::pick() noexcept
+    {
+        const auto now = std::chrono::steady_clock::now();
+        std::optional<std::size_t> best;
+
+        collect();
+        for (std::size_t i = 0; i < _workers.size(); i++) {
+            const auto &worker = _workers[i];
+            if (!isHealthy(worker, now))
+                continue;
+            const auto key = [](const Worker &w) {
+                return std::tuple(w.load.players, w.load.rooms + w.placed);
+            };
+            if (!best || key(worker) < key(_workers[*best]))
+                best = i;
+        }
+        return best;
+    }
+
+    std::optional<std::uint32_t> WorkerPool::request(
+        const std::size_t index, const std::uint8_t type, const std::vector<std::uint8_t> &body) noexcept
+    {
+        auto &worker = _workers[index];
+        const std::uint32_t id = _nextRequest++;
+        const auto deadline = std::chrono::steady_clock::now() + REQUEST_TIMEOUT;
+        Control::Message message;
+
+        if (worker.stalled)
+            collect();
+        if (!worker.process || worker.closed || worker.stalled)
+            return std::nullopt;
+        try {
+            if (!worker.process->channel().send({type, id, body})) {
+                worker.closed = true;
+                return std::nullopt;
+            }
+        } catch (...) {
+            return std::nullopt;
+        }
+        for (auto now = std::chrono::steady_clock::now(); now < deadline; now = std::chrono::steady_clock::now()) {
+            const auto wait = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now);
+            const auto status = worker.process->channel().receive(message, wait + std::chrono::milliseconds(1));
+            if (status == ControlChannel::Status::Closed) {
+                worker.closed = true;
+                return std::nullopt;
+            }
+            if (status == ControlChannel::Status::Timeout)
+                continue;
+            if (message.type != Control::REPLY || message.request != id) {
+                onReport(index, message);
+                continue;
+            }
+            Net::TCP::Reader r(message.body.data(), message.body.size());
+            if (r.remaining() < 5 || r.u8() == 0)
+                return std::nullopt;
+            return r.u32();
+        }
+        worker.stalled = true;
+        Log::warn("WorkerPool::request", "worker did not reply in time, skipped until it reports",
+            {{"worker", index}, {"type", type}});
+        return std::nullopt;
+    }
+
+    void WorkerPool::notify(
+        const std::size_t index, const std::uint8_t type, const std::vector<std::uint8_t> &body) noexcept
+    {
+        auto &worker = _workers[index];
+
+        if (!worker.process || worker.closed)
+            return;
+        try {
+            if (!worker.process->channel().send({type, 0, body}))
+                worker.closed = true;
+        } catch (...) {
+            return;
+        }
+    }
+
+    void WorkerPool::onReport(const std::size_t index, const Control::Message &message) noexcept
+    {
+        auto &worker = _workers[index];
+        Net::TCP::Reader r(message.body.data(), message.body.size());
+
+        if (message.type == Control::ROOM_CLOSED && r.remaining() >= 4) {
+            const Engine::RoomId localId = r.u32();
+            const auto it = std::ranges::find_if(_rooms, [index, localId](const auto &entry) {
+                return entry.second.worker == index && entry.second.localId == localId;
+            });
+            if (it == _rooms.end())
+                return;
+            Log::info("WorkerPool::onReport", "room closed by its worker",
+                {{"worker", index}, {"room", it->first}, {"members", it->second.members.size()}});
+            forget(it);
+            return;
+        }
+        if (message.type != Control::LOAD || r.remaining() < 10)
+            return;
+        worker.load.udpPort = r.u16();
+        worker.load.rooms = r.u32();
+        worker.load.players = r.u32();
+        worker.placed = 0;
+        worker.reported = true;
+        worker.stalled = false;
+        worker.lastReport = std::chrono::steady_clock::now();
+    }
+
+    std::unordered_map<Engine::RoomId, WorkerPool::PlacedRoom>::iterator WorkerPool::forget(
+        const std::unordered_map<Engine::RoomId, PlacedRoom>::iterator it) noexcept
+    {
+        for (const int member : it->second.members)
+            _members.erase(member);
+        _directory.remove(it->first);
+        return _rooms.erase(it);
+    }
+
+    void WorkerPool::drop(const std::size_t index) noexcept
+    {
+        auto &worker = _workers[index];
+        std::size_t lost = 0;
+
+        for (auto it = _rooms.begin(); it != _rooms.end();) {
+            if (it->second.worker != index) {
+                ++it;
+                continue;
+            }
+            it = forget(it);
+            lost++;
+        }
+        Log::error("WorkerPool::drop", "worker died", {{"worker", index}, {"rooms", lost}});
+        worker.process.reset();
+        worker = Worker{};
+        worker.respawnAt = std::chrono::steady_clock::now() + RESPAWN_DELAY;
+    }
+
+    void WorkerPool::spawn(const std::size_t index) noexcept
+    {
+        auto &worker = _workers[index];
+
+        try {
+            worker.process = _spawner(index);
+            worker.lastReport = std::chrono::steady_clock::now();
+        } catch (const std::exception &e) {
+            Log::error("WorkerPool::spawn", "failed to restart worker", {{"worker", index}, {"error", e.what()}});
+            worker.respawnAt = std::chrono::steady_clock::now() + RESPAWN_DELAY;
+        }
+    }
+
+    void WorkerPool::publish(const Engine::RoomId roomId, const PlacedRoom &room) noexcept
+    {
+        try {
+            _directory.upsert(roomId, room.name, room.members.size(), room.maxPlayers);
+        } catch (...) {
+            Log::warn("WorkerPool::publish", "failed to update the room directory", {{"room", roomId}});
+        }
+    }
+} // namespace Gateway
@@ -0,0 +1,269 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** WorkerPool
+*/
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "ILobby.hpp"
+#include "ISessionManager.hpp"
+#include "WorkerProcess.hpp"
+
+namespace Gateway
+{
+    /**
+     * @class WorkerPool
+     * @brief The gateway's lobby: places rooms on game-worker processes and keeps their lobby state.
+     * @details Room IDs handed to clients are the gateway's own; each maps to a worker and the
+     * room's ID there. A new room goes to the least-loaded healthy worker: fewest players, then
+     * fewest rooms, counting rooms placed since its last LOAD report. A worker is healthy once it
+     * has reported and as long as its reports keep coming within HEALTH_TIMEOUT. A worker whose
+     * channel closes is dropped with its rooms, and started again after RESPAWN_DELAY.
+     * Requests to a worker are synchronous, bounded by REQUEST_TIMEOUT. Used from the TCP thread only.
+     */
+    class WorkerPool final : public Engine::ILobby {
+      public:
+        /**
+         * @brief Starts a worker.
+         * @param index Index of the worker in the pool, stable across respawns.
+         * @return The worker.
+         * @throws ControlError if the worker cannot be started.
+         */
+        using Spawner = std::function<std::unique_ptr<WorkerProcess>(std::size_t index)>;
+
+        /**
+         * @brief Last LOAD report of a worker.
+         */
+        struct Load {
+            std::uint16_t udpPort = 0; ///> Port the worker's clients send game packets to
+            std::uint32_t rooms = 0;   ///> Rooms hosted
+            std::uint32_t players = 0; ///> Players connected over UDP
+        };
+
+        /**
+         * @brief Constructs the pool and starts its workers.
+         * @param sessions The gateway's sessions, to get the address of joining clients.
+         * @param workers Number of workers.
+         * @param spawner Starts a worker.
+         * @throws ControlError if a worker cannot be started.
+         */
+        WorkerPool(std::shared_ptr<Net::Server::ISessionManager> sessions, std::size_t workers, Spawner spawner);
+
+        /**
+         * @brief Stops the workers.
+         */
+        ~WorkerPool() override;
+
+        /**
+         * @brief Creates a room on the least-loaded healthy worker
+         * @param name The name of the room
+         * @param maxPlayers The maximum number of players allowed in the room
+         * @param seed Seed of the room's random generator, drawn at random by the worker when not given
+         * @return The gateway ID of the room, or 0 if no worker could create it
+         */
+        [[nodiscard]] Engine::RoomId createRoom(const std::string &name, size_t maxPlayers,
+            std::optional<std::uint64_t> seed = std::nullopt) noexcept override;
+
+        /**
+         * @brief Adds a player to a room, reserving its seat on the hosting worker
+         * @param roomId The gateway ID of the room
+         * @param sessionId The session ID of the player, which must not be in a room
+         */
+        void addPlayerToRoom(Engine::RoomId roomId, int sessionId) noexcept override;
+
+        /**
+         * @brief Removes a player from its room, closing the room once its last member left
+         * @param sessionId The session ID of the player
+         * @return The gateway ID of the room the player left, 0 if it was in none
+         */
+        [[nodiscard]] Engine::RoomId removePlayer(int sessionId) noexcept override;
+
+        /**
+         * @brief Gets the room of a player
+         * @param sessionId The session ID of the player
+         * @return The gateway ID of the room, 0 if the player is in none
+         */
+        [[nodiscard]] Engine::RoomId getRoomIdOfPlayer(int sessionId) const noexcept override;
+
+        /**
+         * @brief Starts the game of a room on its worker
+         * @param roomId The gateway ID of the room
+         * @return true if the worker started the room
+         */
+        [[nodiscard]] bool start(Engine::RoomId roomId) noexcept override;
+
+        /**
+         * @brief Gets the lobby members of a room
+         * @param roomId The gateway ID of the room
+         * @return Their session IDs, empty for an unknown room
+         */
+        [[nodiscard]] std::vector<int> members(Engine::RoomId roomId) const override;
+
+        /**
+         * @brief Gets the UDP port of the worker hosting a room
+         * @param roomId The ID of the room, or 0 for the worker a new room would go to
+         * @return The port, or 0 if the room or a healthy worker is unknown
+         */
+        [[nodiscard]] std::uint16_t udpPort(Engine::RoomId roomId) noexcept override;
+
+        /**
+         * @brief Gets the token of the seat reserved for a player on the worker hosting its room
+         * @param sessionId The session ID of the player
+         * @return The token, or 0 if the player is in no room
+         */
+        [[nodiscard]] std::uint32_t seatToken(int sessionId) const noexcept override;
+
+        /**
+         * @brief Gets the directory of the placed rooms, with their lobby member counts
+         * @return The room directory
+         */
+        [[nodiscard]] Engine::RoomDirectory &directory() noexcept override;
+
+        /**
+         * @brief Reads the workers' reports, then drops the dead workers and respawns the due ones.
+         */
+        void poll() noexcept;
+
+        /**
+         * @brief Asks every worker to stop and waits for them.
+         */
+        void shutdown() noexcept;
+
+        /**
+         * @brief Counts the workers new rooms may go to.
+         * @return The healthy workers.
+         */
+        [[nodiscard]] std::size_t healthyWorkers() const noexcept;
+
+        static constexpr std::chrono::milliseconds HEALTH_TIMEOUT{3000}; ///> Silence after which a worker is skipped
+        static constexpr std::chrono::milliseconds REQUEST_TIMEOUT{500}; ///> Longest wait for a reply
+        static constexpr std::chrono::milliseconds RESPAWN_DELAY{1000};  ///> Wait before restarting a dead worker
+
+      private:
+        /**
+         * @brief A worker slot of the pool.
+         */
+        struct Worker {
+            std::unique_ptr<WorkerProcess> process;             ///> The worker, null while dead
+            Load load;                                          ///> Last report
+            std::size_t placed = 0;                             ///> Rooms created since the last report
+            bool reported = false;                              ///> A report came since the worker started
+            bool closed = false;                                ///> The channel closed, to drop at next poll()
+            bool stalled = false;                               ///> A request timed out, skipped until it reports
+            bool healthy = false;                               ///> Health at the last poll(), for logging
+            std::chrono::steady_clock::time_point lastReport{}; ///> When the last report came
+            std::chrono::steady_clock::time_point respawnAt{};  ///> When to restart the dead worker
+        };
+
+        /**
+         * @brief A room placed on a worker.
+         */
+        struct PlacedRoom {
+            std::size_t worker = 0;     ///> Index of the hosting worker
+            Engine::RoomId localId = 0; ///> ID of the room on the worker
+            std::string name;           ///> Name of the room
+            std::size_t maxPlayers = 0; ///> Lobby members allowed
+            std::vector<int> members;   ///> Lobby members, in join order
+        };
+
+        /**
+         * @brief A lobby member.
+         */
+        struct Member {
+            Engine::RoomId roomId = 0; ///> Room of the member
+            std::uint32_t seat = 0;    ///> Token of its seat on the worker
+        };
+
+        /**
+         * @brief Tells whether new rooms may go to a worker.
+         * @param worker The worker.
+         * @param now The current time.
+         * @return True if it runs, reported recently, and answered its last request in time.
+         */
+        [[nodiscard]] static bool isHealthy(const Worker &worker, std::chrono::steady_clock::time_point now) noexcept;
+
+        /**
+         * @brief Reads the pending messages of every worker.
+         */
+        void collect() noexcept;
+
+        /**
+         * @brief Picks the least-loaded healthy worker.
+         * @return Its index, or nothing if no worker is healthy.
+         */
+        [[nodiscard]] std::optional<std::size_t> pick() noexcept;
+
+        /**
+         * @brief Sends a request to a worker and waits for its reply.
+         * @details A worker that lets a request time out is stalled: it gets no request, and no new
+         * room, until its next report, so it blocks the gateway for one REQUEST_TIMEOUT at most.
+         * @param index The worker.
+         * @param type The request type.
+         * @param body The request body.
+         * @return The reply value, or nothing if the request failed or timed out.
+         */
+        [[nodiscard]] std::optional<std::uint32_t> request(
+            std::size_t index, std::uint8_t type, const std::vector<std::uint8_t> &body) noexcept;
+
+        /**
+         * @brief Sends a message expecting no reply.
+         * @param index The worker.
+         * @param type The message type.
+         * @param body The message body.
+         */
+        void notify(std::size_t index, std::uint8_t type, const std::vector<std::uint8_t> &body) noexcept;
+
+        /**
+         * @brief Records a message a worker sent on its own: a LOAD report or a ROOM_CLOSED notice.
+         * @param index The worker.
+         * @param message The message.
+         */
+        void onReport(std::size_t index, const Control::Message &message) noexcept;
+
+        /**
+         * @brief Forgets a placed room and its lobby members.
+         * @param it The room.
+         * @return The room after it.
+         */
+        std::unordered_map<Engine::RoomId, PlacedRoom>::iterator forget(
+            std::unordered_map<Engine::RoomId, PlacedRoom>::iterator it) noexcept;
+
+        /**
+         * @brief Forgets a dead worker and its rooms, and schedules its restart.
+         * @param index The worker.
+         */
+        void drop(std::size_t index) noexcept;
+
+        /**
+         * @brief Starts a worker in an empty slot.
+         * @param index The worker.
+         */
+        void spawn(std::size_t index) noexcept;
+
+        /**
+         * @brief Updates the directory entry of a room.
+         * @param roomId The ID of the room.
+         * @param room The room.
+         */
+        void publish(Engine::RoomId roomId, const PlacedRoom &room) noexcept;
+
+        std::shared_ptr<Net::Server::ISessionManager> _sessions; ///> The gateway's sessions
+        Spawner _spawner;                                        ///> Starts the workers
+        std::vector<Worker> _workers;                            ///> The worker slots
+        std::unordered_map<Engine::RoomId, PlacedRoom> _rooms;   ///> Placed rooms by gateway ID
+        std::unordered_map<int, Member> _members;                ///> Room of each lobby member
+        Engine::RoomDirectory _directory;                        ///> Serialized room list
+        Engine::RoomId _nextRoomId = 1;                          ///> Next gateway room ID
+        std::uint32_t _nextRequest = 1;                          ///> Next request id
+    };
+} // namespace Gateway
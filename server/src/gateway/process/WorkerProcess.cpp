@@ -0,0 +1,107 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** WorkerProcess
+*/
+
+#include "WorkerProcess.hpp"
+#include <cstring>
+#include <thread>
+
+#ifndef _WIN32
+    #include <csignal>
+    #include <spawn.h>
+    #include <sys/wait.h>
+
+extern char **environ;
+#endif
+
+namespace Gateway
+{
+    WorkerProcess::WorkerProcess(std::shared_ptr<ControlChannel> channel, const int pid) noexcept
+        : _channel(std::move(channel)), _pid(pid)
+    {
+    }
+
+    ControlChannel &WorkerProcess::channel() const noexcept
+    {
+        return *_channel;
+    }
+
+    int WorkerProcess::pid() const noexcept
+    {
+        return _pid;
+    }
+
+#ifndef _WIN32
+    WorkerProcess::~WorkerProcess()
+    {
+        constexpr auto Step = std::chrono::milliseconds(20);
+        const auto deadline = std::chrono::steady_clock::now() + EXIT_TIMEOUT;
+
+        _channel.reset();
+        while (running() && std::chrono::steady_clock::now() < deadline)
+            std::this_thread::sleep_for(Step);
+        if (_pid > 0) {
+            ::kill(_pid, SIGKILL);
+            ::waitpid(_pid, nullptr, 0);
+        }
+    }
+
+    std::unique_ptr<WorkerProcess> WorkerProcess::spawn(
+        const std::string &executable, const std::vector<std::string> &args)
+    {
+        constexpr int WorkerFd = 3;
+        auto [gatewayEnd, workerEnd] = ControlChannel::pair();
+        const int fd = workerEnd->inheritable();
+        std::vector<std::string> strings{executable};
+        std::vector<char *> argv;
+        posix_spawn_file_actions_t actions;
+        pid_t pid = -1;
+
+        strings.insert(strings.end(), args.begin(), args.end());
+        strings.emplace_back("--worker-fd");
+        strings.push_back(std::to_string(WorkerFd));
+        for (auto &string : strings)
+            argv.push_back(string.data());
+        argv.push_back(nullptr);
+
+        ::posix_spawn_file_actions_init(&actions);
+        if (fd != WorkerFd)
+            ::posix_spawn_file_actions_adddup2(&actions, fd, WorkerFd);
+    #if defined(__GLIBC__) && (__GLIBC__ > 2 || __GLIBC_MINOR__ >= 34)
+        ::posix_spawn_file_actions_addclosefrom_np(&actions, WorkerFd + 1);
+    #endif
+        const int error = ::posix_spawn(&pid, executable.c_str(), &actions, nullptr, argv.data(), environ);
+        ::posix_spawn_file_actions_destroy(&actions);
+        if (error != 0)
+            throw ControlError("{WorkerProcess::spawn} posix_spawn failed: " + std::string(std::strerror(error)));
+        return std::make_unique<WorkerProcess>(std::move(gatewayEnd), pid);
+    }
+
+    bool WorkerProcess::running() noexcept
+    {
+        if (_pid == InProcess)
+            return _channel != nullptr;
+        if (_pid == 0)
+            return false;
+        if (::waitpid(_pid, nullptr, WNOHANG) == 0)
+            return true;
+        _pid = 0;
+        return false;
+    }
+#else
+    WorkerProcess::~WorkerProcess() = default;
+
+    std::unique_ptr<WorkerProcess> WorkerProcess::spawn(const std::string &, const std::vector<std::string> &)
+    {
+        throw ControlError("{WorkerProcess::spawn} Game workers are not supported on Windows");
+    }
+
+    bool WorkerProcess::running() noexcept
+    {
+        return _channel != nullptr;
+    }
+#endif
+} // namespace Gateway
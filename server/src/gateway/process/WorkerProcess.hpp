@@ -0,0 +1,77 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** WorkerProcess
+*/
+
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+#include "ControlChannel.hpp"
+
+namespace Gateway
+{
+    /**
+     * @class WorkerProcess
+     * @brief A game worker seen from the gateway: its control channel and, when it runs apart, its process.
+     * @details Destroying it waits for the process to exit, killing it after EXIT_TIMEOUT.
+     */
+    class WorkerProcess {
+      public:
+        /**
+         * @brief Wraps a worker whose channel is already connected.
+         * @param channel The gateway's end of the control channel.
+         * @param pid The worker's process, or -1 for a worker running in this process.
+         */
+        WorkerProcess(std::shared_ptr<ControlChannel> channel, int pid) noexcept;
+
+        /**
+         * @brief Waits for the process to exit, killing it if it takes too long.
+         */
+        ~WorkerProcess();
+
+        WorkerProcess(const WorkerProcess &) = delete;
+        WorkerProcess &operator=(const WorkerProcess &) = delete;
+
+        /**
+         * @brief Starts a worker process.
+         * @details The program is started with args followed by `--worker-fd 3`, descriptor 3
+         * being its end of the control channel; no other descriptor of the gateway is inherited.
+         * @param executable Path of the program.
+         * @param args Arguments of the program, without the program name.
+         * @return The worker.
+         * @throws ControlError if the channel or the process cannot be created.
+         */
+        [[nodiscard]] static std::unique_ptr<WorkerProcess> spawn(
+            const std::string &executable, const std::vector<std::string> &args);
+
+        /**
+         * @brief Gets the gateway's end of the control channel.
+         * @return The channel.
+         */
+        [[nodiscard]] ControlChannel &channel() const noexcept;
+
+        /**
+         * @brief Tells whether the process is still running, reaping it if it exited.
+         * @return True while the process runs; always true for a worker in this process.
+         */
+        [[nodiscard]] bool running() noexcept;
+
+        /**
+         * @brief Gets the process ID.
+         * @return The PID, or -1 for a worker in this process.
+         */
+        [[nodiscard]] int pid() const noexcept;
+
+        static constexpr std::chrono::milliseconds EXIT_TIMEOUT{2000}; ///> Wait before killing on destruction
+        static constexpr int InProcess = -1;                           ///> PID of a worker running in this process
+
+      private:
+        std::shared_ptr<ControlChannel> _channel; ///> The gateway's end of the control channel
+        int _pid;                                 ///> The process, 0 once reaped, InProcess when in this process
+    };
+} // namespace Gateway
@@ -0,0 +1,149 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** WorkerAgent
+*/
+
+#include "WorkerAgent.hpp"
+#include "Log.hpp"
+#include "TCPReader.hpp"
+#include "TCPWriter.hpp"
+
+namespace Gateway
+{
+    WorkerAgent::WorkerAgent(std::shared_ptr<ControlChannel> channel, std::shared_ptr<Engine::RoomManager> rooms,
+        const std::uint16_t udpPort) noexcept
+        : _channel(std::move(channel)), _rooms(std::move(rooms)), _udpPort(udpPort),
+          _nextReport(std::chrono::steady_clock::now())
+    {
+    }
+
+    bool WorkerAgent::poll(const std::chrono::milliseconds timeout) noexcept
+    {
+        Control::Message message;
+        auto wait = std::min(timeout,
+            std::chrono::duration_cast<std::chrono::milliseconds>(_nextReport - std::chrono::steady_clock::now()));
+        bool handled = false;
+
+        for (;; wait = std::chrono::milliseconds(0)) {
+            const auto status = _channel->receive(message, std::max(wait, std::chrono::milliseconds(0)));
+            if (status == ControlChannel::Status::Closed)
+                return false;
+            if (status == ControlChannel::Status::Timeout)
+                break;
+            if (!handle(message))
+                return false;
+            handled = true;
+        }
+        if (handled || std::chrono::steady_clock::now() >= _nextReport)
+            return report();
+        return true;
+    }
+
+    bool WorkerAgent::handle(const Control::Message &message) noexcept
+    {
+        Net::TCP::Reader r(message.body.data(), message.body.size());
+
+        try {
+            switch (message.type) {
+                case Control::CREATE_ROOM: {
+                    if (r.remaining() < 4)
+                        return reply(message.request, false, 0);
+                    const std::string name = r.str16();
+                    if (r.remaining() < 2)
+                        return reply(message.request, false, 0);
+                    const std::uint8_t maxPlayers = r.u8();
+                    std::optional<std::uint64_t> seed;
+                    if (r.u8() != 0) {
+                        if (r.remaining() < sizeof(std::uint64_t))
+                            return reply(message.request, false, 0);
+                        seed = r.u64();
+                    }
+                    const Engine::RoomId roomId = _rooms->createRoom(name, maxPlayers, seed);
+                    return reply(message.request, roomId != 0, roomId);
+                }
+                case Control::JOIN_ROOM: {
+                    if (r.remaining() < 8)
+                        return reply(message.request, false, 0);
+                    const Engine::RoomId roomId = r.u32();
+                    const std::uint32_t ip = r.u32();
+                    const std::uint32_t seat = _rooms->reserveSeat(ip, roomId);
+                    return reply(message.request, seat != 0, seat);
+                }
+                case Control::LEAVE_ROOM:
+                    if (r.remaining() >= 8) {
+                        const Engine::RoomId roomId = r.u32();
+                        _rooms->cancelSeat(r.u32(), roomId);
+                    }
+                    return true;
+                case Control::START_ROOM:
+                    if (r.remaining() < 4)
+                        return reply(message.request, false, 0);
+                    else {
+                        const Engine::RoomId roomId = r.u32();
+                        return reply(message.request, _rooms->start(roomId), roomId);
+                    }
+                case Control::CLOSE_ROOM:
+                    if (r.remaining() >= 4) {
+                        const Engine::RoomId roomId = r.u32();
+                        if (const auto room = _rooms->getRoomById(roomId); room && room->getCurrentPlayers() == 0)
+                            _rooms->removeRoom(roomId);
+                    }
+                    return true;
+                case Control::SHUTDOWN: return false;
+                default:
+                    Log::warn("WorkerAgent::handle", "unknown control message", {{"type", message.type}});
+                    return true;
+            }
+        } catch (const std::exception &e) {
+            Log::error("WorkerAgent::handle", "failed to run a control message",
+                {{"type", message.type}, {"error", e.what()}});
+            return message.request == 0 || reply(message.request, false, 0);
+        }
+    }
+
+    bool WorkerAgent::reply(const std::uint32_t request, const bool ok, const std::uint32_t value) noexcept
+    {
+        try {
+            Net::TCP::Writer b;
+            b.u8(ok ? 1 : 0);
+            b.u32(value);
+            return _channel->send({Control::REPLY, request, std::move(b.bytes())});
+        } catch (...) {
+            return false;
+        }
+    }
+
+    bool WorkerAgent::report() noexcept
+    {
+        std::size_t rooms = 0;
+        std::size_t players = 0;
+
+        _nextReport = std::chrono::steady_clock::now() + REPORT_PERIOD;
+        try {
+            std::unordered_set<Engine::RoomId> current;
+            for (const auto &room : _rooms->listRooms()) {
+                current.insert(room.id);
+                rooms++;
+                players += room.currentPlayers;
+            }
+            for (const Engine::RoomId roomId : _reported) {
+                if (current.contains(roomId))
+                    continue;
+                Net::TCP::Writer closed;
+                closed.u32(roomId);
+                if (!_channel->send({Control::ROOM_CLOSED, 0, std::move(closed.bytes())}))
+                    return false;
+            }
+            _reported = std::move(current);
+            Net::TCP::Writer b;
+            b.u16(_udpPort);
+            b.u32(static_cast<std::uint32_t>(rooms));
+            b.u32(static_cast<std::uint32_t>(players));
+            return _channel->send({Control::LOAD, 0, std::move(b.bytes())});
+        } catch (...) {
+            return false;
+        }
+    }
+} // namespace Gateway
@@ -0,0 +1,77 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** WorkerAgent
+*/
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <unordered_set>
+#include "ControlChannel.hpp"
+#include "RoomManager.hpp"
+
+namespace Gateway
+{
+    /**
+     * @class WorkerAgent
+     * @brief The game worker's side of the control channel: runs the gateway's requests on the worker's rooms.
+     * @details Room IDs in requests and replies are the worker's own. A JOIN_ROOM reserves a seat
+     * for the client's IP address, taken when the client connects over UDP. A LOAD report is sent
+     * every REPORT_PERIOD, and also right after each request, so that placement sees it at once.
+     * Each report is preceded by a ROOM_CLOSED for every room gone since the previous one.
+     * Used from one thread.
+     */
+    class WorkerAgent {
+      public:
+        /**
+         * @brief Constructs the agent.
+         * @param channel The worker's end of the control channel.
+         * @param rooms The rooms of the worker.
+         * @param udpPort The UDP port clients of the worker send their game packets to.
+         */
+        WorkerAgent(std::shared_ptr<ControlChannel> channel, std::shared_ptr<Engine::RoomManager> rooms,
+            std::uint16_t udpPort) noexcept;
+
+        /**
+         * @brief Waits for requests and runs them, reporting the load when it is due.
+         * @param timeout Longest wait for the first request.
+         * @return False once the gateway is gone or asked the worker to stop.
+         */
+        [[nodiscard]] bool poll(std::chrono::milliseconds timeout) noexcept;
+
+        static constexpr std::chrono::milliseconds REPORT_PERIOD{250}; ///> Time between LOAD reports
+
+      private:
+        /**
+         * @brief Runs one request.
+         * @param message The request.
+         * @return False if the worker must stop.
+         */
+        [[nodiscard]] bool handle(const Control::Message &message) noexcept;
+
+        /**
+         * @brief Answers a request.
+         * @param request The request id.
+         * @param ok Whether the request succeeded.
+         * @param value The result of the request.
+         * @return False if the gateway is gone.
+         */
+        bool reply(std::uint32_t request, bool ok, std::uint32_t value) noexcept;
+
+        /**
+         * @brief Sends a ROOM_CLOSED for each room gone since the last report, then a LOAD report.
+         * @return False if the gateway is gone.
+         */
+        bool report() noexcept;
+
+        std::shared_ptr<ControlChannel> _channel;          ///> The worker's end of the channel
+        std::shared_ptr<Engine::RoomManager> _rooms;       ///> The rooms of the worker
+        std::uint16_t _udpPort;                            ///> The game port of the worker
+        std::chrono::steady_clock::time_point _nextReport; ///> When the next LOAD report is due
+        std::unordered_set<Engine::RoomId> _reported;      ///> Rooms of the last report
+    };
+} // namespace Gateway
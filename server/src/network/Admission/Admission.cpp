@@ -0,0 +1,129 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Admission
+*/
+
+#include "Admission.hpp"
+#include <random>
+
+namespace
+{
+    constexpr uint64_t rotl(const uint64_t x, const int b) noexcept
+    {
+        return (x << b) | (x >> (64 - b));
+    }
+
+    void sipRound(uint64_t &v0, uint64_t &v1, uint64_t &v2, uint64_t &v3) noexcept
+    {
+        v0 += v1;
+        v1 = rotl(v1, 13) ^ v0;
+        v0 = rotl(v0, 32);
+        v2 += v3;
+        v3 = rotl(v3, 16) ^ v2;
+        v0 += v3;
+        v3 = rotl(v3, 21) ^ v0;
+        v2 += v1;
+        v1 = rotl(v1, 17) ^ v2;
+        v2 = rotl(v2, 32);
+    }
+
+    /**
+     * @brief SipHash-2-4 of two 64-bit words.
+     */
+    uint64_t sipHash(const std::array<uint64_t, 2> &key, const uint64_t m0, const uint64_t m1) noexcept
+    {
+        uint64_t v0 = key[0] ^ 0x736f6d6570736575ULL;
+        uint64_t v1 = key[1] ^ 0x646f72616e646f6dULL;
+        uint64_t v2 = key[0] ^ 0x6c7967656e657261ULL;
+        uint64_t v3 = key[1] ^ 0x7465646279746573ULL;
+
+        for (const uint64_t m : {m0, m1, uint64_t{16} << 56}) {
+            v3 ^= m;
+            sipRound(v0, v1, v2, v3);
+            sipRound(v0, v1, v2, v3);
+            v0 ^= m;
+        }
+        v2 ^= 0xff;
+        for (int i = 0; i < 4; i++)
+            sipRound(v0, v1, v2, v3);
+        return v0 ^ v1 ^ v2 ^ v3;
+    }
+} // namespace
+
+namespace Net::Server
+{
+    Admission::Admission() : Admission(Limits{})
+    {
+    }
+
+    Admission::Admission(const Limits limits) : _limits(limits)
+    {
+        std::random_device device;
+        for (auto &word : _secret)
+            word = (static_cast<uint64_t>(device()) << 32) ^ device();
+    }
+
+    uint64_t Admission::cookie(const sockaddr_in &addr) const noexcept
+    {
+        return cookieAt(addr, currentWindow());
+    }
+
+    Admission::Verdict Admission::admit(
+        const sockaddr_in &addr, const uint64_t cookie, const ISessionManager &sessions) noexcept
+    {
+        if (cookie == 0) {
+            _challenges.fetch_add(1, std::memory_order_relaxed);
+            return Verdict::Challenge;
+        }
+        const uint64_t window = currentWindow();
+        if (cookie != cookieAt(addr, window) && cookie != cookieAt(addr, window - 1)) {
+            _badCookies.fetch_add(1, std::memory_order_relaxed);
+            return Verdict::BadCookie;
+        }
+        if (sessions.sessionCount() >= _limits.maxSessions) {
+            _sessionLimit.fetch_add(1, std::memory_order_relaxed);
+            return Verdict::SessionLimit;
+        }
+        if (sessions.sessionCountForIp(addr.sin_addr.s_addr) >= _limits.maxSessionsPerIp) {
+            _ipLimit.fetch_add(1, std::memory_order_relaxed);
+            return Verdict::IpLimit;
+        }
+        return Verdict::Admitted;
+    }
+
+    void Admission::countRoomLimit() noexcept
+    {
+        _roomLimit.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    const Admission::Limits &Admission::limits() const noexcept
+    {
+        return _limits;
+    }
+
+    Admission::Stats Admission::stats() const noexcept
+    {
+        Stats stats;
+        stats.challenges = _challenges.load(std::memory_order_relaxed);
+        stats.badCookies = _badCookies.load(std::memory_order_relaxed);
+        stats.sessionLimit = _sessionLimit.load(std::memory_order_relaxed);
+        stats.ipLimit = _ipLimit.load(std::memory_order_relaxed);
+        stats.roomLimit = _roomLimit.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+    uint64_t Admission::cookieAt(const sockaddr_in &addr, const uint64_t window) const noexcept
+    {
+        const uint64_t address = (static_cast<uint64_t>(addr.sin_addr.s_addr) << 16) | addr.sin_port;
+        const uint64_t hash = sipHash(_secret, address, window);
+        return hash == 0 ? 1 : hash;
+    }
+
+    uint64_t Admission::currentWindow() noexcept
+    {
+        const auto elapsed = std::chrono::steady_clock::now().time_since_epoch();
+        return static_cast<uint64_t>(elapsed / COOKIE_WINDOW);
+    }
+} // namespace Net::Server
@@ -0,0 +1,130 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Admission
+*/
+
+#pragma once
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include "ISessionManager.hpp"
+
+namespace Net::Server
+{
+    /**
+     * @class Admission
+     * @brief Decides whether a CONNECT may allocate a session.
+     * @details A client must first prove it receives packets at the address it claims:
+     * its CONNECT is answered with a cookie, a keyed hash (SipHash-2-4) of its address
+     * and of the current time window, and only a CONNECT echoing a valid cookie is
+     * admitted. Nothing is stored until then, so spoofed floods cost one hash each.
+     * Admitted clients are then held to global and per-IP session limits.
+     * Thread-safe.
+     */
+    class Admission {
+      public:
+        /**
+         * @brief Limits enforced on admitted clients.
+         */
+        struct Limits {
+            size_t maxSessions = 1024;   ///> Sessions on the whole server
+            size_t maxSessionsPerIp = 8; ///> Sessions sharing one IP address
+            size_t maxRooms = 256;       ///> Rooms on the whole server
+        };
+
+        /**
+         * @brief Outcome of a connection attempt.
+         */
+        enum class Verdict {
+            Admitted,     ///> The client may get a session
+            Challenge,    ///> The client must echo a cookie first
+            BadCookie,    ///> The cookie is wrong or expired
+            SessionLimit, ///> The server is full
+            IpLimit,      ///> The client's IP address has too many sessions
+        };
+
+        /**
+         * @brief Counters of rejected attempts.
+         */
+        struct Stats {
+            uint64_t challenges = 0;   ///> CONNECTs answered with a cookie
+            uint64_t badCookies = 0;   ///> CONNECTs with a wrong or expired cookie
+            uint64_t sessionLimit = 0; ///> CONNECTs refused because the server is full
+            uint64_t ipLimit = 0;      ///> CONNECTs refused because of the per-IP limit
+            uint64_t roomLimit = 0;    ///> Admitted CONNECTs refused because no room could be created
+        };
+
+        static constexpr std::chrono::seconds COOKIE_WINDOW{10}; ///> A cookie stays valid one to two windows
+
+        /**
+         * @brief Constructs an Admission with a random secret and the default limits.
+         */
+        Admission();
+
+        /**
+         * @brief Constructs an Admission with a random secret.
+         * @param limits The limits to enforce.
+         */
+        explicit Admission(Limits limits);
+
+        /**
+         * @brief Computes the cookie of an address for the current time window.
+         * @param addr The client address.
+         * @return The cookie, never 0.
+         */
+        [[nodiscard]] uint64_t cookie(const sockaddr_in &addr) const noexcept;
+
+        /**
+         * @brief Decides whether a CONNECT may allocate a session, and counts refusals.
+         * @param addr The client address.
+         * @param cookie The cookie sent by the client, in host order.
+         * @param sessions The sessions, used to check the limits.
+         * @return The verdict.
+         */
+        [[nodiscard]] Verdict admit(const sockaddr_in &addr, uint64_t cookie, const ISessionManager &sessions) noexcept;
+
+        /**
+         * @brief Counts an admitted client refused because no room could be created.
+         */
+        void countRoomLimit() noexcept;
+
+        /**
+         * @brief Gets the limits enforced.
+         * @return The limits.
+         */
+        [[nodiscard]] const Limits &limits() const noexcept;
+
+        /**
+         * @brief Gets the counters of rejected attempts.
+         * @return A copy of the counters.
+         */
+        [[nodiscard]] Stats stats() const noexcept;
+
+      private:
+        /**
+         * @brief Computes the cookie of an address for a time window.
+         * @param addr The client address.
+         * @param window The index of the time window.
+         * @return The cookie, never 0.
+         */
+        [[nodiscard]] uint64_t cookieAt(const sockaddr_in &addr, uint64_t window) const noexcept;
+
+        /**
+         * @brief Gets the index of the current time window.
+         * @return The window index.
+         */
+        [[nodiscard]] static uint64_t currentWindow() noexcept;
+
+        Limits _limits;                    ///> Limits enforced
+        std::array<uint64_t, 2> _secret{}; ///> SipHash key, drawn at construction
+
+        std::atomic<uint64_t> _challenges{0};   ///> See Stats::challenges
+        std::atomic<uint64_t> _badCookies{0};   ///> See Stats::badCookies
+        std::atomic<uint64_t> _sessionLimit{0}; ///> See Stats::sessionLimit
+        std::atomic<uint64_t> _ipLimit{0};      ///> See Stats::ipLimit
+        std::atomic<uint64_t> _roomLimit{0};    ///> See Stats::roomLimit
+    };
+} // namespace Net::Server
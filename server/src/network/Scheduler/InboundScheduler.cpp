@@ -0,0 +1,127 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** InboundScheduler
+*/
+
+#include "InboundScheduler.hpp"
+#include <utility>
+
+#ifdef _WIN32
+    #include <winsock2.h>
+#else
+    #include <arpa/inet.h>
+#endif
+
+namespace Net::Server
+{
+    InboundScheduler::InboundScheduler(std::shared_ptr<ISessionManager> sessions)
+        : InboundScheduler(std::move(sessions), Limits{})
+    {
+    }
+
+    InboundScheduler::InboundScheduler(std::shared_ptr<ISessionManager> sessions, const Limits limits)
+        : _sessions(std::move(sessions)), _limits(limits)
+    {
+    }
+
+    bool InboundScheduler::enqueue(const std::shared_ptr<IPacket> &packet, const Clock::time_point now)
+    {
+        if (!packet || !packet->address())
+            return false;
+
+        const int sessionId = _sessions->getSessionId(*packet->address());
+        const int key = sessionId < 0 ? HANDSHAKE_FLOW : sessionId;
+        if (key == HANDSHAKE_FLOW && !takeSourceToken(*packet->address(), now)) {
+            _rateLimited.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        auto it = _flows.find(key);
+        if (it == _flows.end()) {
+            const bool handshake = key == HANDSHAKE_FLOW;
+            TokenBucket bucket(handshake ? _limits.handshakesPerSecond : _limits.packetsPerSecond,
+                handshake ? _limits.handshakeBurst : _limits.burst, now);
+            it = _flows.emplace(key, Flow{bucket, {}}).first;
+        }
+
+        Flow &flow = it->second;
+        if (!flow.bucket.take(now)) {
+            _rateLimited.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        if (flow.queue.size() >= _limits.queueCapacity) {
+            _queueFull.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        if (flow.queue.empty())
+            _ready.push_back(key);
+        flow.queue.push_back(packet);
+        _pending++;
+        return true;
+    }
+
+    bool InboundScheduler::takeSourceToken(const sockaddr_in &addr, const Clock::time_point now)
+    {
+        const std::uint32_t network = ntohl(addr.sin_addr.s_addr) & 0xFFFFFF00u;
+        auto it = _sources.find(network);
+
+        if (it != _sources.end()) {
+            _sourceOrder.splice(_sourceOrder.begin(), _sourceOrder, it->second.entry);
+            return it->second.bucket.take(now);
+        }
+        if (_limits.handshakeSources == 0)
+            return true;
+        if (_sources.size() >= _limits.handshakeSources) {
+            _sources.erase(_sourceOrder.back());
+            _sourceOrder.pop_back();
+        }
+        _sourceOrder.push_front(network);
+        const TokenBucket bucket(_limits.sourceHandshakesPerSecond, _limits.sourceHandshakeBurst, now);
+        it = _sources.emplace(network, Source{bucket, _sourceOrder.begin()}).first;
+        return it->second.bucket.take(now);
+    }
+
+    std::size_t InboundScheduler::drain(const Handler &handler, const std::size_t budget)
+    {
+        std::size_t handled = 0;
+
+        while (handled < budget && !_ready.empty()) {
+            const int key = _ready.front();
+            _ready.pop_front();
+            const auto it = _flows.find(key);
+            if (it == _flows.end() || it->second.queue.empty())
+                continue;
+
+            const std::shared_ptr<IPacket> packet = std::move(it->second.queue.front());
+            it->second.queue.pop_front();
+            _pending--;
+            if (!it->second.queue.empty())
+                _ready.push_back(key);
+            handler(packet);
+            handled++;
+        }
+        return handled;
+    }
+
+    void InboundScheduler::prune()
+    {
+        std::erase_if(_flows, [this](const auto &entry) {
+            const auto &[key, flow] = entry;
+            return key != HANDSHAKE_FLOW && flow.queue.empty() && !_sessions->getAddress(key);
+        });
+    }
+
+    std::size_t InboundScheduler::pending() const noexcept
+    {
+        return _pending;
+    }
+
+    InboundScheduler::Stats InboundScheduler::stats() const noexcept
+    {
+        Stats stats;
+        stats.rateLimited = _rateLimited.load(std::memory_order_relaxed);
+        stats.queueFull = _queueFull.load(std::memory_order_relaxed);
+        return stats;
+    }
+} // namespace Net::Server
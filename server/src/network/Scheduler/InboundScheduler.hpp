@@ -0,0 +1,147 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** InboundScheduler
+*/
+
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include "IPacket.hpp"
+#include "ISessionManager.hpp"
+#include "TokenBucket.hpp"
+
+namespace Net::Server
+{
+    /**
+     * @class InboundScheduler
+     * @brief Rate-limits incoming packets per session and hands them out fairly.
+     * @details Each session has a token bucket, checked when its packets arrive, and a
+     * bounded queue; packets over the rate or over the queue are dropped before routing.
+     * drain() then takes one packet per session in turn, so a flooding client only
+     * delays itself. Packets from addresses without a session (connection attempts)
+     * share a single flow with its own rate, and each /24 network sending them has a
+     * bucket of its own, checked first, so that one flooding network cannot use up the
+     * shared rate. The buckets of the least recently seen networks are forgotten past
+     * Limits::handshakeSources.
+     * Not thread-safe: meant to be owned by the packet processing thread.
+     */
+    class InboundScheduler {
+      public:
+        using Clock = TokenBucket::Clock;
+        using Handler = std::function<void(const std::shared_ptr<IPacket> &)>;
+
+        /**
+         * @brief Limits applied to each flow.
+         */
+        struct Limits {
+            double packetsPerSecond = 150.0;         ///> Sustained rate of one session
+            double burst = 75.0;                     ///> Packets a session may send at once
+            double handshakesPerSecond = 200.0;      ///> Sustained rate of all addresses without a session
+            double handshakeBurst = 100.0;           ///> Burst of all addresses without a session
+            double sourceHandshakesPerSecond = 10.0; ///> Sustained rate of one /24 without a session
+            double sourceHandshakeBurst = 20.0;      ///> Burst of one /24 without a session
+            std::size_t handshakeSources = 4096;     ///> Networks whose handshake rate is remembered
+            std::size_t queueCapacity = 64;          ///> Packets waiting per flow
+        };
+
+        /**
+         * @brief Counters of dropped packets.
+         */
+        struct Stats {
+            std::uint64_t rateLimited = 0; ///> Packets over their flow's rate
+            std::uint64_t queueFull = 0;   ///> Packets over their flow's queue capacity
+        };
+
+        /**
+         * @brief Constructs a scheduler with the default limits.
+         * @param sessions The sessions, used to map packets to their flow.
+         */
+        explicit InboundScheduler(std::shared_ptr<ISessionManager> sessions);
+
+        /**
+         * @brief Constructs a scheduler.
+         * @param sessions The sessions, used to map packets to their flow.
+         * @param limits The limits to apply.
+         */
+        InboundScheduler(std::shared_ptr<ISessionManager> sessions, Limits limits);
+
+        /**
+         * @brief Queues a packet on its sender's flow, unless the flow is over its limits.
+         * @param packet The received packet.
+         * @param now The current time.
+         * @return True if the packet was queued, false if it was dropped.
+         */
+        bool enqueue(const std::shared_ptr<IPacket> &packet, Clock::time_point now);
+
+        /**
+         * @brief Hands out queued packets, one per flow in turn.
+         * @param handler Called for each packet.
+         * @param budget The maximum number of packets to hand out.
+         * @return The number of packets handed out.
+         */
+        std::size_t drain(const Handler &handler, std::size_t budget);
+
+        /**
+         * @brief Forgets the flows of sessions that no longer exist and have nothing queued.
+         */
+        void prune();
+
+        /**
+         * @brief Gets the number of queued packets.
+         * @return The number of packets waiting in every flow.
+         */
+        [[nodiscard]] std::size_t pending() const noexcept;
+
+        /**
+         * @brief Gets the counters of dropped packets.
+         * @return A copy of the counters.
+         */
+        [[nodiscard]] Stats stats() const noexcept;
+
+        static constexpr int HANDSHAKE_FLOW = -1; ///> Flow of the addresses without a session
+
+      private:
+        /**
+         * @brief Rate and queue of one session.
+         */
+        struct Flow {
+            TokenBucket bucket;                         ///> Rate limit of the flow
+            std::deque<std::shared_ptr<IPacket>> queue; ///> Packets waiting to be handled
+        };
+
+        /**
+         * @brief Handshake rate of one /24 network.
+         */
+        struct Source {
+            TokenBucket bucket;                       ///> Rate limit of the network
+            std::list<std::uint32_t>::iterator entry; ///> Position in _sourceOrder
+        };
+
+        /**
+         * @brief Takes a token from the bucket of a sessionless sender's network.
+         * @param addr The sender.
+         * @param now The current time.
+         * @return True if the network is within its rate.
+         */
+        bool takeSourceToken(const sockaddr_in &addr, Clock::time_point now);
+
+        std::shared_ptr<ISessionManager> _sessions;         ///> Maps addresses to sessions
+        Limits _limits;                                     ///> Limits applied to each flow
+        std::unordered_map<int, Flow> _flows;               ///> Flows by session ID
+        std::deque<int> _ready;                             ///> Flows with queued packets, in service order
+        std::size_t _pending = 0;                           ///> Packets queued in every flow
+        std::unordered_map<std::uint32_t, Source> _sources; ///> Handshake rates by /24 network
+        std::list<std::uint32_t> _sourceOrder;              ///> Networks, most recently seen first
+
+        std::atomic<std::uint64_t> _rateLimited{0}; ///> See Stats::rateLimited
+        std::atomic<std::uint64_t> _queueFull{0};   ///> See Stats::queueFull
+    };
+} // namespace Net::Server
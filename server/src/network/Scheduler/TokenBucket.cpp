@@ -0,0 +1,30 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** TokenBucket
+*/
+
+#include "TokenBucket.hpp"
+#include <algorithm>
+
+namespace Net::Server
+{
+    TokenBucket::TokenBucket(const double rate, const double burst, const Clock::time_point now) noexcept
+        : _rate(rate), _burst(burst), _tokens(burst), _last(now)
+    {
+    }
+
+    bool TokenBucket::take(const Clock::time_point now) noexcept
+    {
+        if (now > _last) {
+            const double elapsed = std::chrono::duration<double>(now - _last).count();
+            _tokens = std::min(_burst, _tokens + elapsed * _rate);
+            _last = now;
+        }
+        if (_tokens < 1.0)
+            return false;
+        _tokens -= 1.0;
+        return true;
+    }
+} // namespace Net::Server
@@ -0,0 +1,44 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** TokenBucket
+*/
+
+#pragma once
+#include <chrono>
+
+namespace Net::Server
+{
+    /**
+     * @class TokenBucket
+     * @brief Allows a sustained rate of events with bursts up to a given size.
+     * @details The bucket refills continuously at `rate` tokens per second, up to `burst`
+     * tokens, and each event takes one token. Not thread-safe.
+     */
+    class TokenBucket {
+      public:
+        using Clock = std::chrono::steady_clock;
+
+        /**
+         * @brief Constructs a full bucket.
+         * @param rate Tokens added per second.
+         * @param burst Maximum number of tokens.
+         * @param now The current time.
+         */
+        TokenBucket(double rate, double burst, Clock::time_point now) noexcept;
+
+        /**
+         * @brief Takes a token if one is available.
+         * @param now The current time, used to refill the bucket.
+         * @return True if the event is allowed.
+         */
+        [[nodiscard]] bool take(Clock::time_point now) noexcept;
+
+      private:
+        double _rate;            ///> Tokens added per second
+        double _burst;           ///> Maximum number of tokens
+        double _tokens;          ///> Tokens currently available
+        Clock::time_point _last; ///> Time of the last refill
+    };
+} // namespace Net::Server
@@ -9,6 +9,10 @@
 
 using namespace Net::Server;
 
+SessionManager::SessionManager(const int firstId, const int idStride) noexcept : _nextId(firstId), _idStride(idStride)
+{
+}
+
 int SessionManager::getOrCreateSession(const sockaddr_in &address)
 {
     const AddressKey key{address.sin_addr.s_addr, address.sin_port};
@@ -24,9 +28,11 @@ int SessionManager::getOrCreateSession(const sockaddr_in &address)
     if (const auto it = _addressToId.find(key); it != _addressToId.end())
         return it->second;
 
-    const int newId = _nextId++;
+    const int newId = _nextId;
+    _nextId += _idStride;
     _addressToId[key] = newId;
     _idToAddress[newId] = address;
+    _ipCount[address.sin_addr.s_addr]++;
     return newId;
 }
 
@@ -51,7 +57,10 @@ void SessionManager::removeSession(const int sessionId)
 
     const AddressKey key{it->second.sin_addr.s_addr, it->second.sin_port};
 
+    if (const auto count = _ipCount.find(key.ip); count != _ipCount.end() && --count->second == 0)
+        _ipCount.erase(count);
     _idToAddress.erase(sessionId);
+    _idToVersion.erase(sessionId);
     _addressToId.erase(key);
 }
 
@@ -90,4 +99,37 @@ void SessionManager::forEachSession(const std::function<void(int, const sockaddr
 
     for (auto &[id, addr] : snapshot)
         func(id, addr);
-}
\ No newline at end of file
+}
+void SessionManager::setVersion(const int sessionId, const uint8_t version)
+{
+    std::unique_lock lock(_mutex);
+
+    if (_idToAddress.contains(sessionId))
+        _idToVersion[sessionId] = version;
+}
+
+uint8_t SessionManager::getVersion(const int sessionId) const
+{
+    std::shared_lock lock(_mutex);
+
+    const auto it = _idToVersion.find(sessionId);
+    if (it == _idToVersion.end())
+        return 1;
+    return it->second;
+}
+
+size_t SessionManager::sessionCount() const
+{
+    std::shared_lock lock(_mutex);
+    return _idToAddress.size();
+}
+
+size_t SessionManager::sessionCountForIp(const uint32_t ip) const
+{
+    std::shared_lock lock(_mutex);
+
+    const auto it = _ipCount.find(ip);
+    if (it == _ipCount.end())
+        return 0;
+    return it->second;
+}
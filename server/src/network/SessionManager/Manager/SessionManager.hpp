@@ -31,6 +31,19 @@ namespace Net::Server
      */
     class SessionManager : public ISessionManager {
       public:
+        /**
+         * @brief Construct a SessionManager numbering sessions 1, 2, 3...
+         */
+        SessionManager() = default;
+
+        /**
+         * @brief Construct a SessionManager numbering sessions firstId, firstId + idStride...
+         * @details Lets several managers hand out disjoint IDs (see ShardedSessionManager).
+         * @param firstId The first session ID, at least 1.
+         * @param idStride The gap between two session IDs, at least 1.
+         */
+        SessionManager(int firstId, int idStride) noexcept;
+
         /**
          * @brief Get an existing session ID for the given address or create a new one.
          * @param address The network address.
@@ -70,12 +83,42 @@ namespace Net::Server
          */
         void forEachSession(const std::function<void(int, const sockaddr_in &)> &func) const override;
 
+        /**
+         * @brief Record the protocol version a client announced when connecting.
+         * @param sessionId The session ID.
+         * @param version The announced version.
+         */
+        void setVersion(int sessionId, uint8_t version) override;
+
+        /**
+         * @brief Get the protocol version of a session.
+         * @param sessionId The session ID.
+         * @return The recorded version, or 1 if none was recorded.
+         */
+        uint8_t getVersion(int sessionId) const override;
+
+        /**
+         * @brief Get the number of active sessions.
+         * @return The number of sessions.
+         */
+        size_t sessionCount() const override;
+
+        /**
+         * @brief Get the number of active sessions sharing an IP address.
+         * @param ip The IP address, in network byte order.
+         * @return The number of sessions from that address.
+         */
+        size_t sessionCountForIp(uint32_t ip) const override;
+
       private:
         mutable std::shared_mutex _mutex = {}; ///> Mutex for thread-safe access.
 
         std::unordered_map<AddressKey, int, AddressKeyHash> _addressToId = {}; ///> Map from AddressKey to session ID.
         std::unordered_map<int, sockaddr_in> _idToAddress = {};                ///> Map from session ID to sockaddr_in.
+        std::unordered_map<int, uint8_t> _idToVersion = {};                    ///> Map from session ID to version.
+        std::unordered_map<uint32_t, size_t> _ipCount = {};                    ///> Number of sessions per IP address.
 
-        int _nextId = 1; ///> Next available session ID.
+        int _nextId = 1;   ///> Next available session ID.
+        int _idStride = 1; ///> Gap between two session IDs.
     };
 } // namespace Net::Server
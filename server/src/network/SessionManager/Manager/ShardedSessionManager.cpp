@@ -0,0 +1,109 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** ShardedSessionManager
+*/
+
+#include "ShardedSessionManager.hpp"
+#include <algorithm>
+
+using namespace Net::Server;
+
+ShardedSessionManager::ShardedSessionManager(const std::size_t shards)
+{
+    const int count = static_cast<int>(std::max<std::size_t>(shards, 1));
+
+    _shards.reserve(static_cast<std::size_t>(count));
+    for (int i = 0; i < count; i++)
+        _shards.push_back(std::make_unique<SessionManager>(i + 1, count));
+}
+
+int ShardedSessionManager::getOrCreateSession(const sockaddr_in &address)
+{
+    return shardOf(address).getOrCreateSession(address);
+}
+
+int ShardedSessionManager::getSessionId(const sockaddr_in &address) const
+{
+    return shardOf(address).getSessionId(address);
+}
+
+void ShardedSessionManager::removeSession(const int sessionId)
+{
+    if (SessionManager *shard = shardOf(sessionId))
+        shard->removeSession(sessionId);
+}
+
+const sockaddr_in *ShardedSessionManager::getAddress(const int sessionId) const
+{
+    const SessionManager *shard = shardOf(sessionId);
+    return shard ? shard->getAddress(sessionId) : nullptr;
+}
+
+std::vector<std::pair<int, sockaddr_in>> ShardedSessionManager::getAllSessions() const
+{
+    std::vector<std::pair<int, sockaddr_in>> list;
+
+    for (const auto &shard : _shards) {
+        auto sessions = shard->getAllSessions();
+        list.insert(list.end(), sessions.begin(), sessions.end());
+    }
+    return list;
+}
+
+void ShardedSessionManager::forEachSession(const std::function<void(int, const sockaddr_in &)> &func) const
+{
+    for (const auto &shard : _shards)
+        shard->forEachSession(func);
+}
+
+void ShardedSessionManager::setVersion(const int sessionId, const uint8_t version)
+{
+    if (SessionManager *shard = shardOf(sessionId))
+        shard->setVersion(sessionId, version);
+}
+
+uint8_t ShardedSessionManager::getVersion(const int sessionId) const
+{
+    const SessionManager *shard = shardOf(sessionId);
+    return shard ? shard->getVersion(sessionId) : 1;
+}
+
+size_t ShardedSessionManager::sessionCount() const
+{
+    size_t count = 0;
+
+    for (const auto &shard : _shards)
+        count += shard->sessionCount();
+    return count;
+}
+
+size_t ShardedSessionManager::sessionCountForIp(const uint32_t ip) const
+{
+    size_t count = 0;
+
+    for (const auto &shard : _shards)
+        count += shard->sessionCountForIp(ip);
+    return count;
+}
+
+std::size_t ShardedSessionManager::shardCount() const noexcept
+{
+    return _shards.size();
+}
+
+SessionManager &ShardedSessionManager::shardOf(const sockaddr_in &address) const noexcept
+{
+    const std::size_t hash = AddressKeyHash{}(AddressKey{address.sin_addr.s_addr, address.sin_port});
+    const uint64_t mixed = (static_cast<uint64_t>(hash) * 0x9E3779B97F4A7C15ULL) >> 32;
+
+    return *_shards[mixed % _shards.size()];
+}
+
+SessionManager *ShardedSessionManager::shardOf(const int sessionId) const noexcept
+{
+    if (sessionId < 1)
+        return nullptr;
+    return _shards[static_cast<std::size_t>(sessionId - 1) % _shards.size()].get();
+}
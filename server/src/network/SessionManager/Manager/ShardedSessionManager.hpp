@@ -0,0 +1,76 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** ShardedSessionManager
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include "SessionManager.hpp"
+
+namespace Net::Server
+{
+    /**
+     * @class ShardedSessionManager
+     * @brief Splits sessions between several SessionManagers, each with its own lock.
+     * @details An address always belongs to the shard picked by its hash, and session IDs
+     * are interleaved between shards (shard i hands out i + 1, i + 1 + N...), so both kinds
+     * of lookup touch a single shard. Threads routing different clients thus rarely contend.
+     * Only the counts and the iterations visit every shard.
+     */
+    class ShardedSessionManager : public ISessionManager {
+      public:
+        /**
+         * @brief Construct a ShardedSessionManager.
+         * @param shards The number of shards, at least 1.
+         */
+        explicit ShardedSessionManager(std::size_t shards);
+
+        int getOrCreateSession(const sockaddr_in &address) override;
+
+        int getSessionId(const sockaddr_in &address) const override;
+
+        void removeSession(int sessionId) override;
+
+        const sockaddr_in *getAddress(int sessionId) const override;
+
+        std::vector<std::pair<int, sockaddr_in>> getAllSessions() const override;
+
+        void forEachSession(const std::function<void(int, const sockaddr_in &)> &func) const override;
+
+        void setVersion(int sessionId, uint8_t version) override;
+
+        uint8_t getVersion(int sessionId) const override;
+
+        size_t sessionCount() const override;
+
+        size_t sessionCountForIp(uint32_t ip) const override;
+
+        /**
+         * @brief Get the number of shards.
+         * @return The number of shards.
+         */
+        [[nodiscard]] std::size_t shardCount() const noexcept;
+
+      private:
+        /**
+         * @brief Get the shard owning an address.
+         * @param address The network address.
+         * @return The shard.
+         */
+        [[nodiscard]] SessionManager &shardOf(const sockaddr_in &address) const noexcept;
+
+        /**
+         * @brief Get the shard that handed out a session ID.
+         * @param sessionId The session ID.
+         * @return The shard, or nullptr if the ID cannot exist.
+         */
+        [[nodiscard]] SessionManager *shardOf(int sessionId) const noexcept;
+
+        std::vector<std::unique_ptr<SessionManager>> _shards; ///> Shards, each with its own lock.
+    };
+} // namespace Net::Server
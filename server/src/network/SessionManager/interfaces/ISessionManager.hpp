@@ -6,6 +6,7 @@
 */
 
 #pragma once
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -73,5 +74,32 @@ namespace Net::Server
          * @param func The function to apply, taking session ID and address as parameters.
          */
         virtual void forEachSession(const std::function<void(int, const sockaddr_in &)> &func) const = 0;
+
+        /**
+         * @brief Record the protocol version a client announced when connecting.
+         * @param sessionId The ID of the session.
+         * @param version The version from the client's CONNECT header.
+         */
+        virtual void setVersion(int sessionId, uint8_t version) = 0;
+
+        /**
+         * @brief Get the protocol version of a session.
+         * @param sessionId The ID of the session.
+         * @return The recorded version, or 1 if none was recorded.
+         */
+        virtual uint8_t getVersion(int sessionId) const = 0;
+
+        /**
+         * @brief Get the number of active sessions.
+         * @return The number of sessions.
+         */
+        virtual size_t sessionCount() const = 0;
+
+        /**
+         * @brief Get the number of active sessions sharing an IP address.
+         * @param ip The IP address, in network byte order.
+         * @return The number of sessions from that address.
+         */
+        virtual size_t sessionCountForIp(uint32_t ip) const = 0;
     };
 } // namespace Net::Server
@@ -6,6 +6,7 @@
 */
 
 #include "UDPPacketFactory.hpp"
+#include "Log.hpp"
 
 namespace Net::Factory
 {
@@ -36,7 +37,7 @@ namespace Net::Factory
             auto packet = makePacket<DefaultData>(addr, defaultPacket);
             return packet;
         } catch (const FactoryError &e) {
-            std::cerr << "{UDPPacketFactory::makeDefault} " << e.what() << std::endl;
+            Log::error("UDPPacketFactory::makeDefault", "failed to create packet", {{"error", e.what()}});
             return nullptr;
         }
     }
@@ -53,34 +54,55 @@ namespace Net::Factory
             auto packet = makePacket<DamageData>(addr, damageData);
             return packet;
         } catch (const FactoryError &e) {
-            std::cerr << "{UDPPacketFactory::makeDamage} " << e.what() << std::endl;
+            Log::error("UDPPacketFactory::makeDamage", "failed to create packet", {{"error", e.what()}});
+            return nullptr;
+        }
+    }
+
+    std::shared_ptr<IPacket> UDPPacketFactory::makeChallenge(
+        const sockaddr_in &addr, const uint64_t cookie) const noexcept
+    {
+        ConnectData challenge{};
+        challenge.header = makeHeader(Protocol::UDP::CHALLENGE, VERSION, sizeof(ConnectData));
+        challenge.cookie = htonll(cookie);
+
+        try {
+            return makePacket<ConnectData>(addr, challenge);
+        } catch (const FactoryError &e) {
+            Log::error("UDPPacketFactory::makeChallenge", "failed to create packet", {{"error", e.what()}});
             return nullptr;
         }
     }
 
     std::shared_ptr<IPacket> UDPPacketFactory::createSnapshotPacket(
-        const std::vector<SnapshotEntity> &entities) const noexcept
+        const std::vector<SnapshotEntity> &entities, const uint8_t version) const noexcept
     {
         try {
-            SnapshotBatchHeader header{};
-            if (entities.size()
-                > (std::numeric_limits<size_t>::max() - sizeof(SnapshotBatchHeader)) / sizeof(SnapshotEntityData)) {
-                std::cerr << "{UDPPacketFactory::createSnapshotPacket} Too many entities in snapshot" << std::endl;
+            if (entities.size() > std::numeric_limits<uint16_t>::max()) {
+                Log::error("UDPPacketFactory::createSnapshotPacket", "too many entities in snapshot");
                 return nullptr;
             }
 
-            const auto totalSize = sizeof(SnapshotBatchHeader) + entities.size() * sizeof(SnapshotEntityData);
+            const bool compact = version == Snapshot::COMPACT_VERSION;
+            std::vector<uint8_t> body;
+            if (compact)
+                Snapshot::encodeCompact(entities, body);
+
+            const auto totalSize = sizeof(SnapshotBatchHeader)
+                + (compact ? body.size() : entities.size() * sizeof(SnapshotEntityData));
             if (totalSize > std::numeric_limits<uint16_t>::max()) {
-                std::cerr << "{UDPPacketFactory::createSnapshotPacket} Snapshot packet size exceeds limit" << std::endl;
+                Log::error("UDPPacketFactory::createSnapshotPacket", "snapshot packet size exceeds limit");
                 return nullptr;
             }
 
-            header.header = makeHeader(Protocol::UDP::SNAPSHOT, VERSION, static_cast<uint16_t>(totalSize));
+            SnapshotBatchHeader header{};
+            header.header = makeHeader(
+                Protocol::UDP::SNAPSHOT, compact ? version : VERSION, static_cast<uint16_t>(totalSize));
             header.count = htons(static_cast<uint16_t>(entities.size()));
 
             auto packet = _packet->newPacket();
             if (!packet) {
-                std::cerr << "{UDPPacketFactory::createSnapshotPacket} Failed to create new packet" << std::endl;
+                Log::error("UDPPacketFactory::createSnapshotPacket", "failed to create new packet");
                 return nullptr;
             }
 
@@ -92,21 +114,25 @@ namespace Net::Factory
             std::memcpy(buf, &header, sizeof(header));
             size_t offset = sizeof(header);
 
-            for (const auto &[id, x, y, spriteId] : entities) {
-                SnapshotEntityData packed{};
-                packed.id = htonll(id);
-                packed.x = htonf(x);
-                packed.y = htonf(y);
-                packed.spriteId = htonl(spriteId);
-
-                std::memcpy(buf + offset, &packed, sizeof(packed));
-                offset += sizeof(packed);
+            if (compact) {
+                std::memcpy(buf + offset, body.data(), body.size());
+            } else {
+                for (const auto &[id, x, y, spriteId] : entities) {
+                    SnapshotEntityData packed{};
+                    packed.id = htonll(id);
+                    packed.x = htonf(x);
+                    packed.y = htonf(y);
+                    packed.spriteId = htonl(spriteId);
+
+                    std::memcpy(buf + offset, &packed, sizeof(packed));
+                    offset += sizeof(packed);
+                }
             }
 
             packet->setSize(totalSize);
             return packet;
-        } catch (const FactoryError &e) {
-            std::cerr << "{UDPPacketFactory::createSnapshotPacket} " << e.what() << std::endl;
+        } catch (const std::exception &e) {
+            Log::error("UDPPacketFactory::createSnapshotPacket", "failed to create packet", {{"error", e.what()}});
             return nullptr;
         }
     }
@@ -120,7 +146,7 @@ namespace Net::Factory
             auto packet = makePacket<ScoreData>(addr, scoreData);
             return packet;
         } catch (const FactoryError &e) {
-            std::cerr << "{UDPPacketFactory::createScorePacket} " << e.what() << std::endl;
+            Log::error("UDPPacketFactory::createScorePacket", "failed to create packet", {{"error", e.what()}});
             return nullptr;
         }
     }
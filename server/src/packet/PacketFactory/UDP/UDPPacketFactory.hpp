@@ -13,6 +13,7 @@
 #include <memory>
 #include <utility>
 #include <vector>
+#include "ConnectData.hpp"
 #include "DamageData.hpp"
 #include "DefaultData.hpp"
 #include "Endian.hpp"
@@ -20,6 +21,7 @@
 #include "InputData.hpp"
 #include "ScoreData.hpp"
 #include "SnapEntityData.hpp"
+#include "SnapshotCodec.hpp"
 #include "UDPTypesData.hpp"
 
 /**
@@ -92,13 +94,22 @@ namespace Net::Factory
         [[nodiscard]] std::shared_ptr<IPacket> makeDamage(
             const sockaddr_in &addr, uint32_t id, uint16_t amount) const noexcept;
 
+        /**
+         * @brief Creates a CHALLENGE carrying the cookie a client must echo in its next CONNECT.
+         * @param addr The address to which the packet will be sent.
+         * @param cookie The cookie, in host order.
+         * @return A shared pointer to the created IPacket.
+         */
+        [[nodiscard]] std::shared_ptr<IPacket> makeChallenge(const sockaddr_in &addr, uint64_t cookie) const noexcept;
+
         /**
          * @brief Creates a snapshot packet from the given SnapshotEntity.
          * @param entities The SnapshotEntity containing the snapshot data.
+         * @param version Snapshot format: Snapshot::LEGACY_VERSION or Snapshot::COMPACT_VERSION.
          * @return A shared pointer to the created IPacket.
          */
         [[nodiscard]] std::shared_ptr<IPacket> createSnapshotPacket(
-            const std::vector<SnapshotEntity> &entities) const noexcept;
+            const std::vector<SnapshotEntity> &entities, uint8_t version = VERSION) const noexcept;
 
         /**
          * @brief Creates a score packet with the specified address and score.
@@ -21,14 +21,25 @@ namespace
 namespace Net
 {
     TCPPacketRouter::TCPPacketRouter(std::shared_ptr<Server::ISessionManager> sessions,
-        std::shared_ptr<Engine::RoomManager> rooms, std::shared_ptr<Server::IServer> tcpServer,
+        std::shared_ptr<Engine::ILobby> rooms, std::shared_ptr<Server::IServer> tcpServer,
         std::shared_ptr<Factory::TCPPacketFactory> packetFactory)
         : _sessions(std::move(sessions)), _rooms(std::move(rooms)), _tcp(std::move(tcpServer)),
           _packetFactory(std::move(packetFactory))
     {
     }
 
-    void TCPPacketRouter::handle(const std::shared_ptr<IPacket> &pkt) const
+    void TCPPacketRouter::setUdpPort(const uint16_t port) noexcept
+    {
+        _serverUdpPort = port;
+    }
+
+    uint16_t TCPPacketRouter::udpPortOf(const Engine::RoomId roomId) const noexcept
+    {
+        const uint16_t port = _rooms->udpPort(roomId);
+        return port != 0 ? port : _serverUdpPort;
+    }
+
+    void TCPPacketRouter::handle(const std::shared_ptr<IPacket> &pkt)
     {
         const auto addr = pkt->address();
         if (!addr)
@@ -55,7 +66,7 @@ namespace Net
 
         switch (h.type) {
             case Protocol::TCP::HELLO: onHello(*addr, sessionId, h.requestId, r); break;
-            case Protocol::TCP::LIST_ROOMS: onListRooms(*addr, h.requestId); break;
+            case Protocol::TCP::LIST_ROOMS: onListRooms(*addr, h.requestId, r); break;
             case Protocol::TCP::CREATE_ROOM: onCreateRoom(*addr, h.requestId, r); break;
             case Protocol::TCP::JOIN_ROOM: onJoinRoom(*addr, sessionId, h.requestId, r); break;
             case Protocol::TCP::LEAVE_ROOM: onLeaveRoom(*addr, sessionId, h.requestId); break;
@@ -93,39 +104,94 @@ namespace Net
         TCP::Writer b;
         b.u16(ver);
         b.u32(static_cast<uint32_t>(sessionId));
-        b.u16(_serverUdpPort);
+        b.u16(udpPortOf(0));
         const auto payload = TCP::buildPayload(Protocol::TCP::WELCOME, req, b.bytes());
         _tcp->sendPacket(*_packetFactory->make(addr, payload));
     }
 
-    void TCPPacketRouter::onListRooms(const sockaddr_in &addr, const uint32_t req) const
+    void TCPPacketRouter::onListRooms(const sockaddr_in &addr, const uint32_t req, TCP::Reader &r)
     {
-        TCP::Writer b;
-        const auto rooms = _rooms->listRooms();
-
-        if (rooms.size() > 0xFFFFu)
-            return sendError(addr, req, 16, "LIST_ROOMS: too many rooms to fit in u16");
+        auto &directory = _rooms->directory();
+
+        if (r.remaining() == 0) {
+            const auto listing = directory.listing();
+            if (listing->entries.size() > 0xFFFFu)
+                return sendError(addr, req, 16, "LIST_ROOMS: too many rooms to fit in u16");
+            const auto payload = TCP::buildPayload(Protocol::TCP::ROOMS_LIST, req, listing->body);
+            const auto packet = _packetFactory->make(addr, payload);
+            if (!packet)
+                return sendError(addr, req, 16, "LIST_ROOMS: too many rooms for one packet, request pages");
+            _tcp->sendPacket(*packet);
+            return;
+        }
 
-        b.u16(static_cast<uint16_t>(rooms.size()));
-        for (const auto &[id, name, currentPlayers, maxPlayers] : rooms) {
-            b.u32(id);
-            b.str16(name);
-            b.u8(static_cast<uint8_t>(currentPlayers));
-            b.u8(static_cast<uint8_t>(maxPlayers));
+        Engine::RoomDirectory::Query query;
+        uint8_t flags = 0;
+        try {
+            query.offset = r.u16();
+            query.limit = r.u16();
+            flags = r.u8();
+            query.nameFilter = r.str16();
+        } catch (...) {
+            return sendError(addr, req, 17,
+                "LIST_ROOMS: malformed payload (expected offset(u16) + limit(u16) + flags(u8) + name(str16))");
         }
+        if (r.remaining() != 0)
+            return sendError(addr, req, 7, "LIST_ROOMS: unexpected trailing bytes");
+        query.joinableOnly = (flags & LIST_JOINABLE_ONLY) != 0;
+
+        if ((flags & LIST_SUBSCRIBE) != 0)
+            _roomSubscribers.insert_or_assign(AddressKey{addr.sin_addr.s_addr, addr.sin_port}, addr);
+        else
+            _roomSubscribers.erase(AddressKey{addr.sin_addr.s_addr, addr.sin_port});
 
-        const auto payload = TCP::buildPayload(Protocol::TCP::ROOMS_LIST, req, b.bytes());
+        const auto payload = TCP::buildPayload(Protocol::TCP::ROOMS_LIST, req, directory.page(query));
         _tcp->sendPacket(*_packetFactory->make(addr, payload));
     }
 
+    void TCPPacketRouter::publishRoomUpdates()
+    {
+        uint64_t version = 0;
+        const auto changes = _rooms->directory().drainChanges(version);
+
+        if (changes.empty() || _roomSubscribers.empty())
+            return;
+        for (std::size_t first = 0; first < changes.size(); first += MAX_UPDATE_CHANGES) {
+            const std::size_t count = std::min(MAX_UPDATE_CHANGES, changes.size() - first);
+            TCP::Writer b;
+            b.u64(version);
+            b.u16(static_cast<uint16_t>(count));
+            for (std::size_t i = first; i < first + count; i++) {
+                const auto &[id, entry] = changes[i];
+                b.u8(entry ? 0 : 1);
+                if (entry)
+                    b.bytes().insert(b.bytes().end(), entry->bytes.begin(), entry->bytes.end());
+                else
+                    b.u32(id);
+            }
+
+            const auto payload = TCP::buildPayload(Protocol::TCP::ROOM_UPDATE, 0, b.bytes());
+            for (auto it = _roomSubscribers.begin(); it != _roomSubscribers.end();) {
+                const auto packet = _packetFactory->make(it->second, payload);
+                if (packet && _tcp->sendPacket(*packet))
+                    ++it;
+                else
+                    it = _roomSubscribers.erase(it);
+            }
+        }
+    }
+
     void TCPPacketRouter::onCreateRoom(const sockaddr_in &addr, const uint32_t req, TCP::Reader &r) const
     {
         std::string roomName;
         uint8_t maxPlayers = 0;
+        std::optional<uint64_t> seed;
 
         try {
             roomName = r.str16();
             maxPlayers = r.u8();
+            if (r.remaining() == sizeof(uint64_t))
+                seed = r.u64();
         } catch (...) {
             return sendError(addr, req, 4, "CREATE_ROOM: malformed payload (expected name(str16) + maxPlayers(u8))");
         }
@@ -141,7 +207,7 @@ namespace Net
 
         uint32_t roomId = 0;
         try {
-            roomId = _rooms->createRoom(roomName, maxPlayers);
+            roomId = _rooms->createRoom(roomName, maxPlayers, seed);
         } catch (const std::exception &e) {
             return sendError(addr, req, 8, e.what());
         }
@@ -174,9 +240,13 @@ namespace Net
         } catch (const std::exception &e) {
             return sendError(addr, req, 12, e.what());
         }
+        if (_rooms->getRoomIdOfPlayer(sessionId) != roomId)
+            return sendError(addr, req, 12, "JOIN_ROOM: room is full or does not exist");
 
         TCP::Writer b;
         b.u32(roomId);
+        b.u16(udpPortOf(roomId));
+        b.u32(_rooms->seatToken(sessionId));
         const auto payload = TCP::buildPayload(Protocol::TCP::ROOM_JOINED, req, b.bytes());
         _tcp->sendPacket(*_packetFactory->make(addr, payload));
     }
@@ -214,10 +284,7 @@ namespace Net
 
         const auto payload = TCP::buildPayload(Protocol::TCP::GAME_START, 0, b.bytes());
 
-        const auto &room = _rooms->getRoomById(roomId);
-        if (!room)
-            return;
-        for (const auto &session : room->sessions()) {
+        for (const int session : _rooms->members(roomId)) {
             if (const auto memberAddr = _sessions->getAddress(session))
                 _tcp->sendPacket(*_packetFactory->make(*memberAddr, payload));
         }
@@ -7,7 +7,10 @@
 
 #pragma once
 #include <memory>
-#include "RoomManager.hpp"
+#include <unordered_map>
+#include "ILobby.hpp"
+#include "ISessionManager.hpp"
+#include "IServer.hpp"
 #include "TCPPacketFactory.hpp"
 #include "TCPTypesData.hpp"
 
@@ -22,18 +25,36 @@ namespace Net
         /**
          * @brief Constructor for TCPPacketRouter
          * @param sessions The session manager
-         * @param rooms The room manager
+         * @param rooms The rooms: the RoomManager of this process, or the WorkerPool of a gateway
          * @param tcpServer The TCP server
          * @param packetFactory The TCP packet factory for outgoing packets
          */
-        TCPPacketRouter(std::shared_ptr<Server::ISessionManager> sessions, std::shared_ptr<Engine::RoomManager> rooms,
+        TCPPacketRouter(std::shared_ptr<Server::ISessionManager> sessions, std::shared_ptr<Engine::ILobby> rooms,
             std::shared_ptr<Server::IServer> tcpServer, std::shared_ptr<Factory::TCPPacketFactory> packetFactory);
 
+        /**
+         * @brief Sets the UDP port announced in WELCOME and ROOM_JOINED when the rooms do not name one
+         * @param port The game port of this process
+         */
+        void setUdpPort(uint16_t port) noexcept;
+
         /**
          * @brief Handles an incoming TCP packet
          * @param pkt The incoming packet to handle
          */
-        void handle(const std::shared_ptr<IPacket> &pkt) const;
+        void handle(const std::shared_ptr<IPacket> &pkt);
+
+        /**
+         * @brief Pushes the rooms changed since the last call to the clients subscribed to them
+         * @details Sends ROOM_UPDATE packets of at most MAX_UPDATE_CHANGES changes each,
+         * and forgets the subscribers that can no longer be reached.
+         */
+        void publishRoomUpdates();
+
+        static constexpr std::size_t MAX_UPDATE_CHANGES = 256; ///> Changes per ROOM_UPDATE packet
+
+        static constexpr uint8_t LIST_JOINABLE_ONLY = 0x01; ///> LIST_ROOMS flag: skip full rooms
+        static constexpr uint8_t LIST_SUBSCRIBE = 0x02;     ///> LIST_ROOMS flag: receive ROOM_UPDATE afterwards
 
       private:
         /**
@@ -56,10 +77,13 @@ namespace Net
 
         /**
          * @brief Handles the LIST_ROOMS packet from a client
+         * @details An empty body asks for every room; otherwise the body selects a page
+         * (offset u16, limit u16, flags u8, name filter str16) and (un)subscribes to ROOM_UPDATE.
          * @param addr The address of the client
          * @param req The request ID
+         * @param r The TCP reader for the packet body
          */
-        void onListRooms(const sockaddr_in &addr, uint32_t req) const;
+        void onListRooms(const sockaddr_in &addr, uint32_t req, TCP::Reader &r);
 
         /**
          * @brief Handles the CREATE_ROOM packet from a client
@@ -94,10 +118,20 @@ namespace Net
         void onStartGame(const sockaddr_in &addr, int sessionId) const;
 
         std::shared_ptr<Server::ISessionManager> _sessions = nullptr;        ///> Session manager
-        std::shared_ptr<Engine::RoomManager> _rooms = nullptr;               ///> Room manager
+        std::shared_ptr<Engine::ILobby> _rooms = nullptr;                    ///> Rooms offered by the lobby
         std::shared_ptr<Server::IServer> _tcp = nullptr;                     ///> TCP server
         std::shared_ptr<Factory::TCPPacketFactory> _packetFactory = nullptr; ///> TCP packet factory
 
+        /**
+         * @brief Gets the UDP port clients of a room send their game packets to
+         * @param roomId The ID of the room, or 0 for a client not in a room yet
+         * @return The port named by the rooms, or _serverUdpPort
+         */
+        [[nodiscard]] uint16_t udpPortOf(Engine::RoomId roomId) const noexcept;
+
         uint16_t _serverUdpPort = 0; ///> UDP port to send to clients
+
+        std::unordered_map<AddressKey, sockaddr_in, AddressKeyHash>
+            _roomSubscribers; ///> Clients receiving ROOM_UPDATE, by address
     };
 } // namespace Net
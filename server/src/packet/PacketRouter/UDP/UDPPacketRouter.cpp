@@ -6,30 +6,35 @@
 */
 
 #include "UDPPacketRouter.hpp"
+#include "Log.hpp"
 using namespace Net;
 
-UDPPacketRouter::UDPPacketRouter(
-    const std::shared_ptr<Server::ISessionManager> &sessions, const std::shared_ptr<Engine::RoomManager> &roomManager)
-    : _sessions(sessions), _roomManager(roomManager)
+UDPPacketRouter::UDPPacketRouter(const std::shared_ptr<Server::ISessionManager> &sessions,
+    const std::shared_ptr<Engine::RoomManager> &roomManager, const std::shared_ptr<Server::ReliableServer> &reliable,
+    const std::shared_ptr<Server::Admission> &admission, const std::shared_ptr<Factory::UDPPacketFactory> &factory)
+    : _sessions(sessions), _roomManager(roomManager), _reliable(reliable), _admission(admission), _factory(factory)
 {
 }
 
 bool UDPPacketRouter::validateHeader(const IPacket &pkt, const HeaderData &header)
 {
     if (pkt.size() < sizeof(HeaderData)) {
-        std::cerr << "{UDPPacketRouter::validateHeader} Dropped: packet too small)" << std::endl;
+        static Log::RateLimit limit;
+        limit.warn("UDPPacketRouter::validateHeader", "dropped: packet too small", {{"size", pkt.size()}});
         return false;
     }
 
-    if (header.version != PROTOCOL_VERSION) {
-        std::cerr << "{UDPPacketRouter} Dropped: wrong protocol version " << static_cast<int>(header.version)
-                  << " (expected " << static_cast<int>(PROTOCOL_VERSION) << ")" << std::endl;
+    if (header.version < MIN_PROTOCOL_VERSION || header.version > PROTOCOL_VERSION) {
+        static Log::RateLimit limit;
+        limit.warn("UDPPacketRouter::validateHeader", "dropped: wrong protocol version",
+            {{"version", header.version}, {"min", MIN_PROTOCOL_VERSION}, {"max", PROTOCOL_VERSION}});
         return false;
     }
 
     if (const std::uint16_t declaredSize = ntohs(header.size); declaredSize != pkt.size()) {
-        std::cerr << "{UDPPacketRouter} Dropped: size mismatch "
-                  << "(header=" << declaredSize << ", actual=" << pkt.size() << ")" << std::endl;
+        static Log::RateLimit limit;
+        limit.warn("UDPPacketRouter::validateHeader", "dropped: size mismatch",
+            {{"header", declaredSize}, {"actual", pkt.size()}});
         return false;
     }
 
@@ -42,7 +47,8 @@ bool UDPPacketRouter::isPacketValid(const std::shared_ptr<IPacket> &packet) noex
         return false;
 
     if (packet->size() < sizeof(HeaderData)) {
-        std::cerr << "{UDPPacketRouter} Dropped: packet too small\n";
+        static Log::RateLimit limit;
+        limit.warn("UDPPacketRouter::isPacketValid", "dropped: packet too small", {{"size", packet->size()}});
         return false;
     }
     return true;
@@ -61,21 +67,30 @@ int UDPPacketRouter::resolveSession(const IPacket &packet) const
 {
     const sockaddr_in *addr = packet.address();
     if (!addr) {
-        std::cerr << "{UDPPacketRouter} Dropped: null address in packet\n";
+        static Log::RateLimit limit;
+        limit.warn("UDPPacketRouter::resolveSession", "dropped: null address in packet");
         return -1;
     }
-    return _sessions->getOrCreateSession(*addr);
+    return _sessions->getSessionId(*addr);
 }
 
 void UDPPacketRouter::dispatchPacket(
     const int sessionId, const HeaderData &header, const uint8_t *payload, std::size_t payloadSize) const
 {
     switch (header.type) {
-        case Protocol::UDP::CONNECT: handleConnect(sessionId); break;
         case Protocol::UDP::INPUT: handleInput(sessionId, payload, payloadSize); break;
         case Protocol::UDP::PING: handlePing(sessionId); break;
+        case Protocol::UDP::ACK:
+            if (payloadSize >= sizeof(AckFields))
+                handleAck(sessionId, payload);
+            break;
         case Protocol::UDP::DISCONNECT: handleDisconnect(sessionId); break;
-        default: std::cerr << "{UDPPacketRouter} Unknown packet type: " << static_cast<int>(header.type) << '\n'; break;
+        default: {
+            static Log::RateLimit limit;
+            limit.warn("UDPPacketRouter::dispatchPacket", "unknown packet type",
+                {{"type", header.type}, {"session", sessionId}});
+            break;
+        }
     }
 }
 
@@ -88,38 +103,144 @@ void UDPPacketRouter::handlePacket(const std::shared_ptr<IPacket> &packet) const
     if (!extractHeader(*packet, header))
         return;
 
-    const int sessionId = resolveSession(*packet);
-    if (sessionId < 0)
-        return;
-
     const std::uint8_t *raw = packet->buffer();
     const std::size_t total = packet->size();
     const std::size_t payloadSize = total - sizeof(HeaderData);
     const std::uint8_t *payload = raw + sizeof(HeaderData);
 
+    if (header.type == Protocol::UDP::CONNECT) {
+        if (const sockaddr_in *addr = packet->address())
+            handleConnect(*addr, header.version, payload, payloadSize);
+        return;
+    }
+
+    if (header.type == Protocol::UDP::INPUT && routeInput(*packet, payload, payloadSize))
+        return;
+
+    const int sessionId = resolveSession(*packet);
+    if (sessionId < 0)
+        return;
+
     dispatchPacket(sessionId, header, payload, payloadSize);
 }
 
-void UDPPacketRouter::handleConnect(const int sessionId) const
+void UDPPacketRouter::handleConnect(const sockaddr_in &addr, const std::uint8_t version, const std::uint8_t *payload,
+    const std::size_t payloadSize) const
+{
+    int sessionId = _sessions->getSessionId(addr);
+    if (sessionId < 0) {
+        if (!admit(addr, payload, payloadSize))
+            return;
+        sessionId = _sessions->getOrCreateSession(addr);
+    }
+
+    constexpr std::size_t SeatOffset = offsetof(ConnectData, seat) - sizeof(HeaderData);
+    uint32_t seat = 0;
+    if (payloadSize >= SeatOffset + sizeof(seat)) {
+        std::memcpy(&seat, payload + SeatOffset, sizeof(seat));
+        seat = ntohl(seat);
+    }
+    _sessions->setVersion(sessionId, version);
+    if (_roomManager->onPlayerConnect(sessionId, seat))
+        return;
+
+    if (_admission)
+        _admission->countRoomLimit();
+    if (_factory)
+        reply(_factory->makeDefault(addr, Protocol::UDP::REJECT));
+    _sessions->removeSession(sessionId);
+}
+
+bool UDPPacketRouter::admit(const sockaddr_in &addr, const std::uint8_t *payload, const std::size_t payloadSize) const
+{
+    if (!_admission)
+        return true;
+    // A CONNECT smaller than a CHALLENGE is not answered: replying would amplify it. Clients
+    // older than the cookies send such CONNECTs, so they time out rather than get a REJECT.
+    if (payloadSize < sizeof(ConnectData) - sizeof(HeaderData)) {
+        static Log::RateLimit limit;
+        limit.warn("UDPPacketRouter::admit", "dropped: CONNECT too short for a cookie, client too old?",
+            {{"size", payloadSize}});
+        return false;
+    }
+
+    uint64_t cookie = 0;
+    std::memcpy(&cookie, payload, sizeof(cookie));
+    switch (_admission->admit(addr, ntohll(cookie), *_sessions)) {
+        case Server::Admission::Verdict::Admitted: return true;
+        case Server::Admission::Verdict::Challenge:
+            if (_factory)
+                reply(_factory->makeChallenge(addr, _admission->cookie(addr)));
+            return false;
+        case Server::Admission::Verdict::SessionLimit:
+        case Server::Admission::Verdict::IpLimit:
+            if (_factory)
+                reply(_factory->makeDefault(addr, Protocol::UDP::REJECT));
+            return false;
+        case Server::Admission::Verdict::BadCookie: return false;
+    }
+    return false;
+}
+
+void UDPPacketRouter::reply(const std::shared_ptr<IPacket> &packet) const
 {
-    _roomManager->onPlayerConnect(sessionId);
+    if (packet && _reliable)
+        (void) _reliable->sendPacket(*packet);
 }
 
 void UDPPacketRouter::handleInput(const int sessionId, const std::uint8_t *payload, const std::size_t payloadSize) const
 {
     if (!payload || payloadSize < sizeof(uint8_t)) {
-        std::cerr << "{UDPPacketRouter::handleInput} Dropped INPUT: missing payload" << std::endl;
+        static Log::RateLimit limit;
+        limit.warn("UDPPacketRouter::handleInput", "dropped INPUT: missing payload", {{"session", sessionId}});
         return;
     }
 
-    const std::uint8_t flags = payload[0];
+    if (payloadSize >= sizeof(uint8_t) + sizeof(AckFields))
+        handleAck(sessionId, payload + sizeof(uint8_t));
+
+    _roomManager->onPlayerInput(sessionId, decodeInput(payload[0]));
+}
+
+bool UDPPacketRouter::routeInput(
+    const IPacket &packet, const std::uint8_t *payload, const std::size_t payloadSize) const
+{
+    const sockaddr_in *addr = packet.address();
+    if (!addr || payloadSize < sizeof(uint8_t))
+        return false;
+    if (!_roomManager->onPlayerInput(*addr, decodeInput(payload[0])))
+        return false;
+
+    if (payloadSize >= sizeof(uint8_t) + sizeof(AckFields) && _reliable) {
+        AckFields ack{};
+        std::memcpy(&ack, payload + sizeof(uint8_t), sizeof(ack));
+        _reliable->onAck(*addr, ack);
+    }
+    return true;
+}
+
+Game::InputComponent UDPPacketRouter::decodeInput(const std::uint8_t flags) noexcept
+{
     const bool up = (flags & 0x01u) != 0;
     const bool down = (flags & 0x02u) != 0;
     const bool left = (flags & 0x04u) != 0;
     const bool right = (flags & 0x08u) != 0;
     const bool shoot = (flags & 0x10u) != 0;
 
-    _roomManager->onPlayerInput(sessionId, Game::InputComponent{up, down, left, right, shoot});
+    return Game::InputComponent{up, down, left, right, shoot};
+}
+
+void UDPPacketRouter::handleAck(const int sessionId, const std::uint8_t *fields) const
+{
+    if (!_reliable)
+        return;
+    const sockaddr_in *addr = _sessions->getAddress(sessionId);
+    if (!addr)
+        return;
+
+    AckFields ack{};
+    std::memcpy(&ack, fields, sizeof(ack));
+    _reliable->onAck(*addr, ack);
 }
 
 void UDPPacketRouter::handlePing(const int sessionId) const
@@ -130,5 +251,7 @@ void UDPPacketRouter::handlePing(const int sessionId) const
 void UDPPacketRouter::handleDisconnect(const int sessionId) const
 {
     _roomManager->onPlayerDisconnect(sessionId);
+    if (const sockaddr_in *addr = _sessions->getAddress(sessionId); addr && _reliable)
+        _reliable->removePeer(*addr);
     _sessions->removeSession(sessionId);
 }
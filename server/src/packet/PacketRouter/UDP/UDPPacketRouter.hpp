@@ -12,8 +12,11 @@
 #include <memory>
 
 #include <iostream>
+#include "Admission.hpp"
+#include "ConnectData.hpp"
 #include "IPacket.hpp"
 #include "InputData.hpp"
+#include "ReliableServer.hpp"
 #include "RoomManager.hpp"
 #include "SessionManager.hpp"
 #include "UDPPacketFactory.hpp"
@@ -43,9 +46,15 @@ namespace Net
          * @brief Constructs a UDPPacketRouter with the given SessionManager and IMessageSink.
          * @param sessions Shared pointer to the SessionManager for managing player sessions.
          * @param roomManager Shared pointer to the RoomManager for managing game rooms.
+         * @param reliable Reliable channels acknowledged by clients (optional).
+         * @param admission Cookie check and limits applied to new clients (optional, admits everyone if null).
+         * @param factory Factory of the CHALLENGE and REJECT replies, sent through `reliable` (optional).
          */
         UDPPacketRouter(const std::shared_ptr<Server::ISessionManager> &sessions,
-            const std::shared_ptr<Engine::RoomManager> &roomManager);
+            const std::shared_ptr<Engine::RoomManager> &roomManager,
+            const std::shared_ptr<Server::ReliableServer> &reliable = nullptr,
+            const std::shared_ptr<Server::Admission> &admission = nullptr,
+            const std::shared_ptr<Factory::UDPPacketFactory> &factory = nullptr);
 
         /**
          * @brief Handles an incoming packet by routing it to the appropriate handler.
@@ -64,9 +73,30 @@ namespace Net
 
         /**
          * @brief Handler for player connection packets.
-         * @param sessionId The ID of the connected player.
+         * @details A CONNECT from an unknown address allocates a session only once Admission
+         * accepts its cookie; it is otherwise answered with a CHALLENGE or a REJECT, or dropped.
+         * @param addr The address of the client.
+         * @param version The protocol version announced by the client, which selects its snapshot format.
+         * @param payload Pointer to the payload data of the connect packet.
+         * @param payloadSize Size of the payload data.
+         */
+        void handleConnect(
+            const sockaddr_in &addr, std::uint8_t version, const std::uint8_t *payload, std::size_t payloadSize) const;
+
+        /**
+         * @brief Runs the admission check for a CONNECT from an unknown address, replying if needed.
+         * @param addr The address of the client.
+         * @param payload Pointer to the payload data of the connect packet.
+         * @param payloadSize Size of the payload data.
+         * @return True if a session may be allocated.
          */
-        void handleConnect(int sessionId) const;
+        [[nodiscard]] bool admit(const sockaddr_in &addr, const std::uint8_t *payload, std::size_t payloadSize) const;
+
+        /**
+         * @brief Sends a reply to a client that has no session.
+         * @param packet The reply, ignored if null.
+         */
+        void reply(const std::shared_ptr<IPacket> &packet) const;
 
         /**
          * @brief Handler for player input packets.
@@ -76,6 +106,30 @@ namespace Net
          */
         void handleInput(int sessionId, const std::uint8_t *payload, std::size_t payloadSize) const;
 
+        /**
+         * @brief Delivers an INPUT through the room route of its sender, without any session lookup.
+         * @param packet The incoming INPUT packet.
+         * @param payload Pointer to the payload data of the input packet.
+         * @param payloadSize Size of the payload data.
+         * @return False if the sender has no route yet, in which case nothing was handled.
+         */
+        [[nodiscard]] bool routeInput(
+            const IPacket &packet, const std::uint8_t *payload, std::size_t payloadSize) const;
+
+        /**
+         * @brief Decodes the flags byte of an INPUT.
+         * @param flags The flags byte.
+         * @return The decoded input.
+         */
+        [[nodiscard]] static Game::InputComponent decodeInput(std::uint8_t flags) noexcept;
+
+        /**
+         * @brief Handler for acknowledgements of reliable messages.
+         * @param sessionId The ID of the player.
+         * @param fields Pointer to the AckFields, in network byte order.
+         */
+        void handleAck(int sessionId, const std::uint8_t *fields) const;
+
         /**
          * @brief Handler for player ping packets.
          * @param sessionId The ID of the player.
@@ -104,9 +158,9 @@ namespace Net
         static bool extractHeader(const IPacket &packet, HeaderData &outHeader) noexcept;
 
         /**
-         * @brief Resolves the session ID for the incoming packet.
+         * @brief Resolves the session ID for the incoming packet, without creating one.
          * @param packet The incoming IPacket to resolve the session for.
-         * @return The session ID associated with the packet, or -1 if resolution fails.
+         * @return The session ID associated with the packet, or -1 if the sender has no session.
          */
         [[nodiscard]] int resolveSession(const IPacket &packet) const;
 
@@ -122,8 +176,12 @@ namespace Net
 
         std::shared_ptr<Server::ISessionManager>
             _sessions; ///> Pointer to the SessionManager for managing player sessions.
-        std::shared_ptr<Engine::RoomManager> _roomManager; ///> Pointer to the RoomManager for managing game rooms.
+        std::shared_ptr<Engine::RoomManager> _roomManager;   ///> Pointer to the RoomManager for managing game rooms.
+        std::shared_ptr<Server::ReliableServer> _reliable;   ///> Reliable channels, notified of acknowledgements.
+        std::shared_ptr<Server::Admission> _admission;       ///> Cookie check and limits for new clients.
+        std::shared_ptr<Factory::UDPPacketFactory> _factory; ///> Builds the CHALLENGE and REJECT replies.
 
-        static constexpr std::uint8_t PROTOCOL_VERSION = 1; ///> Expected protocol version for incoming packets.
+        static constexpr std::uint8_t MIN_PROTOCOL_VERSION = 1; ///> Oldest protocol version still accepted.
+        static constexpr std::uint8_t PROTOCOL_VERSION = 2;     ///> Newest protocol version understood.
     };
 } // namespace Net
\ No newline at end of file
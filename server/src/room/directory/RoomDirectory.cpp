@@ -0,0 +1,136 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** RoomDirectory
+*/
+
+#include "RoomDirectory.hpp"
+#include <algorithm>
+#include <limits>
+#include <ranges>
+#include "TCPWriter.hpp"
+
+namespace Engine
+{
+    bool RoomDirectory::Entry::joinable() const noexcept
+    {
+        return currentPlayers < maxPlayers;
+    }
+
+    void RoomDirectory::upsert(
+        const std::uint32_t id, const std::string &name, const std::size_t currentPlayers, const std::size_t maxPlayers)
+    {
+        constexpr std::size_t Max = std::numeric_limits<std::uint8_t>::max();
+
+        Entry entry;
+        entry.id = id;
+        entry.name = name;
+        entry.currentPlayers = static_cast<std::uint8_t>(std::min(currentPlayers, Max));
+        entry.maxPlayers = static_cast<std::uint8_t>(std::min(maxPlayers, Max));
+        entry.bytes = serialize(entry);
+
+        std::scoped_lock lock(_mutex);
+        _entries.insert_or_assign(id, std::move(entry));
+        _changed.insert(id);
+        _version++;
+    }
+
+    void RoomDirectory::remove(const std::uint32_t id)
+    {
+        std::scoped_lock lock(_mutex);
+        if (_entries.erase(id) == 0)
+            return;
+        _changed.insert(id);
+        _version++;
+    }
+
+    std::uint64_t RoomDirectory::version() const noexcept
+    {
+        std::scoped_lock lock(_mutex);
+        return _version;
+    }
+
+    std::shared_ptr<const RoomDirectory::Listing> RoomDirectory::listing() const
+    {
+        std::scoped_lock lock(_mutex);
+        if (_listing && _listing->version == _version)
+            return _listing;
+
+        auto listing = std::make_shared<Listing>();
+        listing->version = _version;
+        listing->entries.reserve(_entries.size());
+        Net::TCP::Writer body;
+        body.u16(static_cast<std::uint16_t>(std::min<std::size_t>(_entries.size(), 0xFFFFu)));
+        for (const auto &entry : _entries | std::views::values) {
+            listing->entries.push_back(entry);
+            body.bytes().insert(body.bytes().end(), entry.bytes.begin(), entry.bytes.end());
+        }
+        listing->body = std::move(body.bytes());
+        _listing = std::move(listing);
+        return _listing;
+    }
+
+    std::vector<std::uint8_t> RoomDirectory::page(const Query &query) const
+    {
+        const auto snapshot = listing();
+        const std::size_t limit = std::min(query.limit, MAX_PAGE);
+        std::vector<const Entry *> selected;
+        std::size_t matching = 0;
+
+        if (!query.joinableOnly && query.nameFilter.empty()) {
+            matching = snapshot->entries.size();
+            const std::size_t first = std::min<std::size_t>(query.offset, matching);
+            const std::size_t last = std::min(first + limit, matching);
+            for (std::size_t i = first; i < last; i++)
+                selected.push_back(&snapshot->entries[i]);
+        } else {
+            for (const auto &entry : snapshot->entries) {
+                if (query.joinableOnly && !entry.joinable())
+                    continue;
+                if (!query.nameFilter.empty() && entry.name.find(query.nameFilter) == std::string::npos)
+                    continue;
+                if (matching >= query.offset && selected.size() < limit)
+                    selected.push_back(&entry);
+                matching++;
+            }
+        }
+
+        Net::TCP::Writer body;
+        body.u64(snapshot->version);
+        body.u16(static_cast<std::uint16_t>(std::min<std::size_t>(matching, 0xFFFFu)));
+        body.u16(static_cast<std::uint16_t>(selected.size()));
+        for (const Entry *entry : selected)
+            body.bytes().insert(body.bytes().end(), entry->bytes.begin(), entry->bytes.end());
+        return std::move(body.bytes());
+    }
+
+    std::vector<RoomDirectory::Change> RoomDirectory::drainChanges(std::uint64_t &version)
+    {
+        std::scoped_lock lock(_mutex);
+        std::vector<Change> changes;
+
+        version = _version;
+        changes.reserve(_changed.size());
+        for (const std::uint32_t id : _changed) {
+            Change change;
+            change.id = id;
+            if (const auto it = _entries.find(id); it != _entries.end())
+                change.entry = it->second;
+            changes.push_back(std::move(change));
+        }
+        _changed.clear();
+        std::ranges::sort(changes, {}, &Change::id);
+        return changes;
+    }
+
+    std::vector<std::uint8_t> RoomDirectory::serialize(const Entry &entry)
+    {
+        Net::TCP::Writer writer;
+        writer.u32(entry.id);
+        writer.str16(entry.name);
+        writer.u8(entry.currentPlayers);
+        writer.u8(entry.maxPlayers);
+        return std::move(writer.bytes());
+    }
+} // namespace Engine
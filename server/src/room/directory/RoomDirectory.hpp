@@ -0,0 +1,135 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** RoomDirectory
+*/
+
+#pragma once
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace Engine
+{
+    /**
+     * @class RoomDirectory
+     * @brief Pre-serialized, versioned list of the rooms, served to lobby clients.
+     * @details Every entry is serialized once, when its room is created, joined or left,
+     * in the ROOMS_LIST layout (id u32, name str16, currentPlayers u8, maxPlayers u8).
+     * Listing the rooms then only concatenates those bytes: the full list is rebuilt
+     * at most once per version, and pages are cut from the sorted snapshot.
+     * Changes are also collected until drainChanges(), to be pushed as ROOM_UPDATE.
+     * Thread-safe.
+     */
+    class RoomDirectory {
+      public:
+        /**
+         * @brief A room as listed to clients.
+         */
+        struct Entry {
+            std::uint32_t id = 0;            ///> Room id
+            std::string name;                ///> Room name
+            std::uint8_t currentPlayers = 0; ///> Players in the room
+            std::uint8_t maxPlayers = 0;     ///> Seats in the room
+            std::vector<std::uint8_t> bytes; ///> The entry in the ROOMS_LIST layout
+
+            /**
+             * @brief Tells whether a player may still join the room.
+             * @return True if a seat is free.
+             */
+            [[nodiscard]] bool joinable() const noexcept;
+        };
+
+        /**
+         * @brief Immutable state of the directory at one version.
+         */
+        struct Listing {
+            std::uint64_t version = 0;      ///> Version of the directory
+            std::vector<Entry> entries;     ///> Entries sorted by room id
+            std::vector<std::uint8_t> body; ///> The whole ROOMS_LIST body (u16 count + entries)
+        };
+
+        /**
+         * @brief Selection of a page of rooms.
+         */
+        struct Query {
+            std::uint16_t offset = 0;  ///> Matching rooms to skip
+            std::uint16_t limit = 0;   ///> Maximum number of rooms returned, clamped to MAX_PAGE
+            bool joinableOnly = false; ///> Skip full rooms
+            std::string nameFilter;    ///> Keep rooms whose name contains it, if not empty
+        };
+
+        /**
+         * @brief A room that changed since the last drainChanges().
+         */
+        struct Change {
+            std::uint32_t id = 0;       ///> Room id
+            std::optional<Entry> entry; ///> The room's new entry, empty if it was removed
+        };
+
+        static constexpr std::uint16_t MAX_PAGE = 256; ///> Largest page, keeps a reply well under a TCP packet
+
+        /**
+         * @brief Adds or updates a room.
+         * @param id The room id.
+         * @param name The room name.
+         * @param currentPlayers The players in the room.
+         * @param maxPlayers The seats in the room.
+         */
+        void upsert(std::uint32_t id, const std::string &name, std::size_t currentPlayers, std::size_t maxPlayers);
+
+        /**
+         * @brief Removes a room.
+         * @param id The room id, ignored if unknown.
+         */
+        void remove(std::uint32_t id);
+
+        /**
+         * @brief Gets the current version, bumped by every change.
+         * @return The version.
+         */
+        [[nodiscard]] std::uint64_t version() const noexcept;
+
+        /**
+         * @brief Gets the directory at its current version, rebuilding it if it changed.
+         * @return The listing, which stays valid and unchanged while it is held.
+         */
+        [[nodiscard]] std::shared_ptr<const Listing> listing() const;
+
+        /**
+         * @brief Serializes a page of rooms.
+         * @details Layout: version u64, matching rooms u16, returned rooms u16, entries.
+         * @param query The page to serialize.
+         * @return The ROOMS_LIST body.
+         */
+        [[nodiscard]] std::vector<std::uint8_t> page(const Query &query) const;
+
+        /**
+         * @brief Takes the rooms changed since the previous call.
+         * @details Meant for a single consumer, the one pushing ROOM_UPDATE.
+         * @param version Receives the version the changes lead to.
+         * @return The changes, sorted by room id.
+         */
+        [[nodiscard]] std::vector<Change> drainChanges(std::uint64_t &version);
+
+        /**
+         * @brief Serializes an entry in the ROOMS_LIST layout.
+         * @param entry The entry, whose bytes are ignored.
+         * @return The serialized entry.
+         */
+        [[nodiscard]] static std::vector<std::uint8_t> serialize(const Entry &entry);
+
+      private:
+        mutable std::mutex _mutex;                       ///> Guards every member below
+        std::map<std::uint32_t, Entry> _entries;         ///> Rooms by id
+        std::uint64_t _version = 0;                      ///> Bumped by every change
+        std::unordered_set<std::uint32_t> _changed;      ///> Rooms changed since drainChanges()
+        mutable std::shared_ptr<const Listing> _listing; ///> Last listing built, may be stale
+    };
+} // namespace Engine
@@ -0,0 +1,95 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** ILobby
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+#include "RoomDirectory.hpp"
+
+namespace Engine
+{
+    using RoomId = std::uint32_t;
+
+    /**
+     * @class ILobby
+     * @brief Room operations the TCP lobby offers its clients.
+     * @details Implemented by the RoomManager hosting the rooms itself, and by the gateway's
+     * WorkerPool placing them on game-worker processes.
+     */
+    class ILobby {
+      public:
+        virtual ~ILobby() = default;
+
+        /**
+         * @brief Creates a new game room
+         * @param name The name of the room
+         * @param maxPlayers The maximum number of players allowed in the room
+         * @param seed Seed of the room's random generator, drawn at random when not given
+         * @return The ID of the newly created room, or 0 if no room could be created
+         */
+        [[nodiscard]] virtual RoomId createRoom(
+            const std::string &name, size_t maxPlayers, std::optional<std::uint64_t> seed = std::nullopt) noexcept = 0;
+
+        /**
+         * @brief Adds a player to a room; check getRoomIdOfPlayer() to know if it succeeded
+         * @param roomId The ID of the room
+         * @param sessionId The session ID of the player
+         */
+        virtual void addPlayerToRoom(RoomId roomId, int sessionId) noexcept = 0;
+
+        /**
+         * @brief Removes a player from its room
+         * @param sessionId The session ID of the player
+         * @return The ID of the room the player left, 0 if it was in none
+         */
+        [[nodiscard]] virtual RoomId removePlayer(int sessionId) noexcept = 0;
+
+        /**
+         * @brief Gets the room of a player
+         * @param sessionId The session ID of the player
+         * @return The ID of the room, 0 if the player is in none
+         */
+        [[nodiscard]] virtual RoomId getRoomIdOfPlayer(int sessionId) const noexcept = 0;
+
+        /**
+         * @brief Starts the game of a room
+         * @param roomId The ID of the room
+         * @return true if the room started
+         */
+        [[nodiscard]] virtual bool start(RoomId roomId) noexcept = 0;
+
+        /**
+         * @brief Gets the players of a room
+         * @param roomId The ID of the room
+         * @return Their session IDs, empty for an unknown room
+         */
+        [[nodiscard]] virtual std::vector<int> members(RoomId roomId) const = 0;
+
+        /**
+         * @brief Gets the UDP port clients of a room send their game packets to
+         * @param roomId The ID of the room, or 0 for the port where a room created by a UDP CONNECT would go
+         * @return The port, or 0 if it is the lobby's own game port
+         */
+        [[nodiscard]] virtual std::uint16_t udpPort(RoomId roomId) noexcept = 0;
+
+        /**
+         * @brief Gets the token a player echoes in its UDP CONNECT to take its seat, sent in ROOM_JOINED
+         * @param sessionId The session ID of the player
+         * @return The token, or 0 if the player needs none
+         */
+        [[nodiscard]] virtual std::uint32_t seatToken(int sessionId) const noexcept = 0;
+
+        /**
+         * @brief Gets the directory listing the rooms
+         * @return The directory
+         */
+        [[nodiscard]] virtual RoomDirectory &directory() noexcept = 0;
+    };
+} // namespace Engine
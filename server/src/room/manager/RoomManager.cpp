@@ -6,59 +6,128 @@
 */
 
 #include "RoomManager.hpp"
+#include <algorithm>
+#include "Log.hpp"
 
 namespace Engine
 {
     RoomManager::RoomManager(std::shared_ptr<Net::Server::ISessionManager> sessions,
         std::shared_ptr<Net::Server::IServer> server, std::shared_ptr<Net::Factory::UDPPacketFactory> udpPacketFactory,
-        std::string levelPath)
+        std::string levelPath, std::string recordDir)
         : _sessions(std::move(sessions)), _server(std::move(server)), _udpPacketFactory(std::move(udpPacketFactory)),
-          _levelPath(std::move(levelPath))
+          _levelPath(std::move(levelPath)), _recordDir(std::move(recordDir))
     {
     }
 
-    RoomId RoomManager::createRoom(const std::string &name, size_t maxPlayers) noexcept
+    RoomId RoomManager::createRoom(
+        const std::string &name, size_t maxPlayers, const std::optional<std::uint64_t> seed) noexcept
     {
+        if (!reserveRoom())
+            return InvalidRoomId;
         try {
-            auto room = std::make_shared<Room>(_sessions, _server, _udpPacketFactory, _levelPath, name, maxPlayers);
-            std::scoped_lock lock(_mutex);
-            auto id = _nextRoomId++;
-            _rooms.emplace(id, room);
+            const std::uint64_t roomSeed = seed.value_or(Rand::Generator::randomSeed());
+            auto room = std::make_shared<Room>(
+                _sessions, _server, _udpPacketFactory, _levelPath, name, maxPlayers, roomSeed);
+            room->gameServer().setSnapshotRate(_snapshotRate);
+            room->gameServer().setOverloadGuard(_overloadGuard);
+            room->setIdleTimeout(_idleTimeout);
+            room->gameServer().setJobSystem(_jobs);
+            const RoomId id = _nextRoomId.fetch_add(1);
+            room->setPlacement(_placement, id);
+            if (!_recordDir.empty())
+                startRecording(*room, id);
+
+            auto &shard = roomShard(id);
+            std::scoped_lock lock(shard.mutex);
+            shard.rooms.emplace(id, RoomSlot{room, {}});
+            publish(id, *room);
             return id;
         } catch (...) {
+            _roomCount.fetch_sub(1);
             return InvalidRoomId;
         }
     }
 
+    void RoomManager::setMaxRooms(const size_t maxRooms) noexcept
+    {
+        _maxRooms.store(maxRooms);
+    }
+
+    void RoomManager::setSnapshotRate(const Game::SnapshotRate::Config &config) noexcept
+    {
+        _snapshotRate = config;
+    }
+
+    void RoomManager::setOverloadGuard(const Game::OverloadGuard::Config &config) noexcept
+    {
+        _overloadGuard = config;
+    }
+
+    void RoomManager::setIdleTimeout(const std::chrono::milliseconds timeout) noexcept
+    {
+        _idleTimeout = timeout;
+    }
+
+    void RoomManager::setJobSystem(std::shared_ptr<Ecs::JobSystem> jobs) noexcept
+    {
+        _jobs = std::move(jobs);
+    }
+
+    void RoomManager::setPlacement(std::shared_ptr<const Utils::ThreadPlacement> placement) noexcept
+    {
+        _placement = std::move(placement);
+    }
+
+    void RoomManager::setSeatsOnly(const bool enabled) noexcept
+    {
+        _seatsOnly = enabled;
+    }
+
     void RoomManager::removeRoom(const RoomId roomId) noexcept
     {
-        std::shared_ptr<Room> room;
+        RoomSlot slot;
 
         {
-            std::scoped_lock lock(_mutex);
-            const auto it = _rooms.find(roomId);
-            if (it == _rooms.end())
+            auto &shard = roomShard(roomId);
+            std::scoped_lock lock(shard.mutex);
+            const auto it = shard.rooms.find(roomId);
+            if (it == shard.rooms.end())
                 return;
+            slot = std::move(it->second);
+            shard.rooms.erase(it);
+            _directory.remove(roomId);
+        }
+        _roomCount.fetch_sub(1);
 
-            for (auto pit = _playerToRoom.begin(); pit != _playerToRoom.end();) {
-                if (pit->second == roomId)
-                    pit = _playerToRoom.erase(pit);
-                else
-                    ++pit;
-            }
-
-            room = it->second;
-            _rooms.erase(it);
+        for (const int sessionId : slot.members) {
+            auto &players = playerShard(sessionId);
+            std::scoped_lock lock(players.mutex);
+            if (const auto it = players.rooms.find(sessionId); it != players.rooms.end() && it->second == roomId)
+                players.rooms.erase(it);
         }
+        _routes.removeSink(&slot.room->gameServer());
 
         try {
-            room->stop();
+            slot.room->stop();
         } catch (...) {
-            std::cerr << "{RoomManager::removeRoom} failed to stop room " << roomId << std::endl;
+            Log::error("RoomManager::removeRoom", "failed to stop room", {{"room", roomId}});
+        }
+    }
+
+    void RoomManager::startRecording(Room &room, const RoomId roomId) const noexcept
+    {
+        const std::string path = _recordDir + "/room_" + std::to_string(roomId) + ".rtrp";
+
+        try {
+            room.gameServer().startRecording(path);
+            Log::info("RoomManager::startRecording", "recording room",
+                {{"room", roomId}, {"seed", room.gameServer().seed()}, {"path", path}});
+        } catch (const std::exception &e) {
+            Log::error("RoomManager::startRecording", "failed to record room", {{"room", roomId}, {"error", e.what()}});
         }
     }
 
-    bool RoomManager::start(const RoomId roomId) const noexcept
+    bool RoomManager::start(const RoomId roomId) noexcept
     {
         const auto room = getRoomById(roomId);
         if (!room || room->getCurrentPlayers() == room->getMaxPlayers())
@@ -66,7 +135,7 @@ namespace Engine
         try {
             room->start();
         } catch (...) {
-            std::cerr << "{RoomManager::start} failed to start room " << roomId << std::endl;
+            Log::error("RoomManager::start", "failed to start room", {{"room", roomId}});
             return false;
         }
         return true;
@@ -74,75 +143,174 @@ namespace Engine
 
     void RoomManager::addPlayerToRoom(const RoomId roomId, const int sessionId) noexcept
     {
-        const auto room = getRoomById(roomId);
-        if (!room)
+        auto &shard = roomShard(roomId);
+        std::scoped_lock lock(shard.mutex);
+        const auto it = shard.rooms.find(roomId);
+
+        if (it == shard.rooms.end())
             return;
         try {
-            room->join(sessionId);
+            it->second.room->join(sessionId);
+            it->second.members.insert(sessionId);
         } catch (...) {
             return;
         }
-        std::scoped_lock lock(_mutex);
-        _playerToRoom[sessionId] = roomId;
+        {
+            auto &players = playerShard(sessionId);
+            std::scoped_lock playersLock(players.mutex);
+            players.rooms[sessionId] = roomId;
+        }
+        publish(roomId, *it->second.room);
+        // Routed under the shard lock: removeRoom() unlinks the room first, then drops its routes.
+        if (const sockaddr_in *addr = _sessions->getAddress(sessionId))
+            _routes.set(*addr, {sessionId, &it->second.room->gameServer()});
     }
 
     RoomId RoomManager::removePlayer(const int sessionId) noexcept
     {
-        const auto room = getRoomOfPlayer(sessionId);
-        auto roomId = InvalidRoomId;
+        _routes.removeSession(sessionId);
+        const RoomId roomId = getRoomIdOfPlayer(sessionId);
+        bool empty = false;
+
+        if (roomId == InvalidRoomId)
+            return InvalidRoomId;
+        {
+            auto &shard = roomShard(roomId);
+            std::scoped_lock lock(shard.mutex);
+            const auto it = shard.rooms.find(roomId);
+            if (it == shard.rooms.end())
+                return InvalidRoomId;
+            try {
+                it->second.room->leave(sessionId);
+            } catch (...) {
+                return InvalidRoomId;
+            }
+            it->second.members.erase(sessionId);
+            empty = it->second.room->empty();
+            if (!empty)
+                publish(roomId, *it->second.room);
+        }
+        {
+            auto &players = playerShard(sessionId);
+            std::scoped_lock lock(players.mutex);
+            if (const auto it = players.rooms.find(sessionId); it != players.rooms.end() && it->second == roomId)
+                players.rooms.erase(it);
+        }
+        if (empty)
+            removeRoom(roomId);
+        return roomId;
+    }
 
-        if (!room)
-            return roomId;
+    std::uint32_t RoomManager::reserveSeat(const std::uint32_t ip, const RoomId roomId) noexcept
+    {
+        if (!getRoomById(roomId))
+            return 0;
         try {
-            roomId = getRoomIdOfPlayer(sessionId);
-            room->leave(sessionId);
-            if (room->empty())
-                removeRoom(roomId);
+            std::scoped_lock lock(_seatsMutex);
+            std::uint32_t token = 0;
+            while (token == 0 || std::ranges::find(_seats, token, &Seat::token) != _seats.end())
+                token = static_cast<std::uint32_t>(_seatTokens());
+            _seats.push_back(Seat{ip, token, roomId, std::chrono::steady_clock::now() + SEAT_TIMEOUT});
+            return token;
         } catch (...) {
-            return InvalidRoomId;
+            return 0;
         }
-        std::scoped_lock lock(_mutex);
-        _playerToRoom.erase(sessionId);
+    }
+
+    void RoomManager::cancelSeat(const std::uint32_t token, const RoomId roomId) noexcept
+    {
+        std::scoped_lock lock(_seatsMutex);
+        const auto it = std::ranges::find_if(_seats, [token, roomId](const Seat &seat) {
+            return seat.token == token && seat.roomId == roomId;
+        });
+        if (it != _seats.end())
+            _seats.erase(it);
+    }
+
+    RoomId RoomManager::takeSeat(const std::uint32_t ip, const std::uint32_t token) noexcept
+    {
+        const auto now = std::chrono::steady_clock::now();
+        std::scoped_lock lock(_seatsMutex);
+
+        std::erase_if(_seats, [now](const Seat &seat) {
+            return seat.expiry <= now;
+        });
+        const auto it = std::ranges::find(_seats, token, &Seat::token);
+        if (token == 0 || it == _seats.end() || it->ip != ip)
+            return InvalidRoomId;
+        const RoomId roomId = it->roomId;
+        _seats.erase(it);
         return roomId;
     }
 
     RoomId RoomManager::getRoomIdOfPlayer(const int sessionId) const noexcept
     {
-        std::scoped_lock lock(_mutex);
-        if (const auto it = _playerToRoom.find(sessionId); it != _playerToRoom.end())
+        auto &players = playerShard(sessionId);
+        std::shared_lock lock(players.mutex);
+        if (const auto it = players.rooms.find(sessionId); it != players.rooms.end())
             return it->second;
         return InvalidRoomId;
     }
 
     std::shared_ptr<Room> RoomManager::getRoomById(const RoomId roomId) const noexcept
     {
-        std::scoped_lock lock(_mutex);
-        if (const auto it = _rooms.find(roomId); it != _rooms.end())
-            return it->second;
+        auto &shard = roomShard(roomId);
+        std::shared_lock lock(shard.mutex);
+        if (const auto it = shard.rooms.find(roomId); it != shard.rooms.end())
+            return it->second.room;
         return nullptr;
     }
 
+    std::vector<int> RoomManager::members(const RoomId roomId) const
+    {
+        auto &shard = roomShard(roomId);
+        std::shared_lock lock(shard.mutex);
+        if (const auto it = shard.rooms.find(roomId); it != shard.rooms.end())
+            return {it->second.members.begin(), it->second.members.end()};
+        return {};
+    }
+
+    std::uint16_t RoomManager::udpPort(const RoomId) noexcept
+    {
+        return 0;
+    }
+
+    std::uint32_t RoomManager::seatToken(const int) const noexcept
+    {
+        return 0;
+    }
+
     std::shared_ptr<Room> RoomManager::getRoomOfPlayer(const int sessionId) const noexcept
     {
-        const auto roomId = getRoomIdOfPlayer(sessionId);
+        const RoomId roomId = getRoomIdOfPlayer(sessionId);
         if (roomId == InvalidRoomId)
             return nullptr;
         return getRoomById(roomId);
     }
 
-    void RoomManager::onPlayerConnect(const int sessionId) noexcept
+    bool RoomManager::onPlayerConnect(const int sessionId, const std::uint32_t seat) noexcept
     {
         if (const auto room = getRoomOfPlayer(sessionId)) {
             room->gameServer().onPlayerConnect(sessionId);
-            return;
+            return true;
         }
+        if (const sockaddr_in *addr = _sessions->getAddress(sessionId)) {
+            if (const RoomId roomId = takeSeat(addr->sin_addr.s_addr, seat); roomId != InvalidRoomId) {
+                addPlayerToRoom(roomId, sessionId);
+                if (getRoomIdOfPlayer(sessionId) == roomId)
+                    return true;
+            }
+        }
+        if (_seatsOnly)
+            return false;
         const auto id = createRoom("basic", 4);
         if (id == InvalidRoomId)
-            return;
+            return false;
         addPlayerToRoom(id, sessionId);
         if (const auto room = getRoomById(id)) {
             room->start();
         }
+        return true;
     }
 
     void RoomManager::onPlayerDisconnect(const int sessionId) noexcept
@@ -158,6 +326,13 @@ namespace Engine
             room->gameServer().onPlayerInput(sessionId, input);
     }
 
+    bool RoomManager::onPlayerInput(const sockaddr_in &addr, const Game::InputComponent &input) const noexcept
+    {
+        return _routes.visit(addr, [&input](const SessionRoutes::Route &route) {
+            route.sink->onPlayerInput(route.sessionId, input);
+        });
+    }
+
     void RoomManager::onPing(const int sessionId) const noexcept
     {
         if (const auto room = getRoomOfPlayer(sessionId))
@@ -167,16 +342,49 @@ namespace Engine
     std::vector<RoomManager::RoomEntry> RoomManager::listRooms() const noexcept
     {
         std::vector<RoomEntry> roomsList;
-        std::scoped_lock lock(_mutex);
 
-        for (const auto &[id, room] : _rooms) {
-            RoomEntry entry;
-            entry.id = id;
-            entry.name = room->getName();
-            entry.currentPlayers = room->getCurrentPlayers();
-            entry.maxPlayers = room->getMaxPlayers();
-            roomsList.push_back(entry);
+        try {
+            const auto listing = _directory.listing();
+            roomsList.reserve(listing->entries.size());
+            for (const auto &entry : listing->entries)
+                roomsList.push_back({entry.id, entry.name, entry.currentPlayers, entry.maxPlayers});
+        } catch (...) {
+            roomsList.clear();
         }
         return roomsList;
     }
-} // namespace Engine
\ No newline at end of file
+
+    RoomDirectory &RoomManager::directory() noexcept
+    {
+        return _directory;
+    }
+
+    RoomManager::RoomShard &RoomManager::roomShard(const RoomId roomId) const noexcept
+    {
+        return _roomShards[roomId % SHARD_COUNT];
+    }
+
+    RoomManager::PlayerShard &RoomManager::playerShard(const int sessionId) const noexcept
+    {
+        return _playerShards[static_cast<std::size_t>(sessionId) % SHARD_COUNT];
+    }
+
+    bool RoomManager::reserveRoom() noexcept
+    {
+        size_t count = _roomCount.load();
+        do {
+            if (count >= _maxRooms.load())
+                return false;
+        } while (!_roomCount.compare_exchange_weak(count, count + 1));
+        return true;
+    }
+
+    void RoomManager::publish(const RoomId roomId, const Room &room) noexcept
+    {
+        try {
+            _directory.upsert(roomId, room.getName(), room.getCurrentPlayers(), room.getMaxPlayers());
+        } catch (...) {
+            Log::error("RoomManager::publish", "failed to publish room", {{"room", roomId}});
+        }
+    }
+} // namespace Engine
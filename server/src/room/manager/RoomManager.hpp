@@ -7,20 +7,35 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <limits>
 #include <memory>
 #include <mutex>
+#include <optional>
+#include <random>
+#include <shared_mutex>
 #include <utility>
 #include <unordered_map>
+#include <unordered_set>
 
+#include "ILobby.hpp"
 #include "Room.hpp"
+#include "RoomDirectory.hpp"
+#include "SessionRoutes.hpp"
 
 namespace Engine
 {
     /**
      * @class RoomManager
      * @brief Manages game rooms and player assignments
+     * @details Rooms are split into SHARD_COUNT shards by ID, and room assignments into
+     * as many shards by session, each with its own lock: operations on different rooms
+     * rarely contend, and lookups only share a lock. Each room also indexes its members,
+     * so that removing it only touches their assignments.
      */
-    class RoomManager {
+    class RoomManager final : public ILobby {
       public:
         /**
          * @struct RoomEntry
@@ -39,16 +54,67 @@ namespace Engine
          * @param server shared pointer to the server
          * @param udpPacketFactory shared pointer to the packet factory
          * @param levelPath path to the game level data
+         * @param recordDir directory where each room records its commands (empty to disable)
          */
         RoomManager(std::shared_ptr<Net::Server::ISessionManager> sessions,
             std::shared_ptr<Net::Server::IServer> server,
-            std::shared_ptr<Net::Factory::UDPPacketFactory> udpPacketFactory, std::string levelPath);
+            std::shared_ptr<Net::Factory::UDPPacketFactory> udpPacketFactory, std::string levelPath,
+            std::string recordDir = "");
 
         /**
          * @brief Creates a new game room
-         * @return The ID of the newly created room
+         * @param name The name of the room
+         * @param maxPlayers The maximum number of players allowed in the room
+         * @param seed Seed of the room's random generator, drawn at random when not given
+         * @return The ID of the newly created room, or an invalid ID if the room limit is reached
          */
-        [[nodiscard]] RoomId createRoom(const std::string &name, size_t maxPlayers) noexcept;
+        [[nodiscard]] RoomId createRoom(const std::string &name, size_t maxPlayers,
+            std::optional<std::uint64_t> seed = std::nullopt) noexcept override;
+
+        /**
+         * @brief Sets the maximum number of rooms that may exist at once
+         * @param maxRooms The room limit
+         */
+        void setMaxRooms(size_t maxRooms) noexcept;
+
+        /**
+         * @brief Sets the adaptive snapshot rate of the rooms created from now on
+         * @param config The snapshot rate configuration; call before rooms are created
+         */
+        void setSnapshotRate(const Game::SnapshotRate::Config &config) noexcept;
+
+        /**
+         * @brief Sets the overload handling of the rooms created from now on
+         * @param config The overload guard configuration; call before rooms are created
+         */
+        void setOverloadGuard(const Game::OverloadGuard::Config &config) noexcept;
+
+        /**
+         * @brief Sets how long the rooms created from now on tick without inputs before they hibernate
+         * @param timeout The idle period, or zero to never hibernate
+         */
+        void setIdleTimeout(std::chrono::milliseconds timeout) noexcept;
+
+        /**
+         * @brief Sets the job system shared by the rooms created from now on
+         * @param jobs The job system, or nullptr for rooms to run their systems serially
+         */
+        void setJobSystem(std::shared_ptr<Ecs::JobSystem> jobs) noexcept;
+
+        /**
+         * @brief Sets the CPUs the threads of the rooms created from now on run on
+         * @param placement The placement rules, applied to each room as `room.<id>`, or nullptr to leave
+         * the threads unnamed and floating
+         */
+        void setPlacement(std::shared_ptr<const Utils::ThreadPlacement> placement) noexcept;
+
+        /**
+         * @brief Makes players connecting over UDP without a reserved seat be refused
+         * @details Set by game workers: their lobby runs in the gateway, so a client that did not
+         * join a room there has no business on the worker.
+         * @param enabled True to refuse unseated players instead of giving them a room of their own
+         */
+        void setSeatsOnly(bool enabled) noexcept;
 
         /**
          * @brief Removes a game room
@@ -60,20 +126,38 @@ namespace Engine
          * @brief Starts a game room
          * @param roomId The ID of the room to be started
          */
-        [[nodiscard]] bool start(RoomId roomId) const noexcept;
+        [[nodiscard]] bool start(RoomId roomId) noexcept override;
 
         /**
          * @brief Adds a player to a specified room
          * @param roomId The ID of the room
          * @param sessionId The session ID of the player to be added
          */
-        void addPlayerToRoom(RoomId roomId, int sessionId) noexcept;
+        void addPlayerToRoom(RoomId roomId, int sessionId) noexcept override;
 
         /**
          * @brief Removes a player from their assigned room
          * @param sessionId The session ID of the player to be removed
          */
-        [[nodiscard]] RoomId removePlayer(int sessionId) noexcept;
+        [[nodiscard]] RoomId removePlayer(int sessionId) noexcept override;
+
+        /**
+         * @brief Holds a seat of a room for a client connecting over UDP from an IP address
+         * @details Used by game workers, whose lobby runs in the gateway: the client joins over TCP
+         * there, gets the seat's token in ROOM_JOINED, then echoes it in its CONNECT to the worker,
+         * which has no other way to know its room. Seats expire after SEAT_TIMEOUT.
+         * @param ip The IPv4 address of the client, in network order
+         * @param roomId The ID of the room
+         * @return The seat's token, never 0, or 0 if the room does not exist
+         */
+        [[nodiscard]] std::uint32_t reserveSeat(std::uint32_t ip, RoomId roomId) noexcept;
+
+        /**
+         * @brief Releases a seat reserved and not taken yet
+         * @param token The token of the seat
+         * @param roomId The ID of the room
+         */
+        void cancelSeat(std::uint32_t token, RoomId roomId) noexcept;
 
         /**
          * @brief Executes a function for each room managed by the RoomManager
@@ -85,9 +169,13 @@ namespace Engine
 
         /**
          * @brief Handles player connection
+         * @details A player without a room takes the seat its token names, if it was reserved for
+         * its IP address, or gets a new room of its own unless seats are required.
          * @param sessionId The session ID of the connected player
+         * @param seat The seat token echoed in the CONNECT, 0 if none
+         * @return False if the player has no room and none could be created
          */
-        void onPlayerConnect(int sessionId) noexcept;
+        [[nodiscard]] bool onPlayerConnect(int sessionId, std::uint32_t seat = 0) noexcept;
 
         /**
          * @brief Handles player disconnection
@@ -102,6 +190,15 @@ namespace Engine
          */
         void onPlayerInput(int sessionId, const Game::InputComponent &input) const noexcept;
 
+        /**
+         * @brief Handles player input through the route resolved when the player joined
+         * @details Takes no lock and copies no shared_ptr; meant for the packet hot path.
+         * @param addr The address of the player
+         * @param input The input component from the player
+         * @return False if the address has no route, in which case nothing was delivered
+         */
+        [[nodiscard]] bool onPlayerInput(const sockaddr_in &addr, const Game::InputComponent &input) const noexcept;
+
         /**
          * @brief Handles ping from a player
          * @param sessionId The session ID of the player
@@ -114,12 +211,39 @@ namespace Engine
          */
         [[nodiscard]] std::vector<RoomEntry> listRooms() const noexcept;
 
+        /**
+         * @brief Gets the directory of the rooms, kept up to date on create, join, leave and remove
+         * @return The room directory
+         */
+        [[nodiscard]] RoomDirectory &directory() noexcept override;
+
         /**
          * @brief Gets the room ID of the room a player is assigned to
          * @param sessionId The session ID of the player
          * @return The ID of the room the player is assigned to
          */
-        [[nodiscard]] RoomId getRoomIdOfPlayer(int sessionId) const noexcept;
+        [[nodiscard]] RoomId getRoomIdOfPlayer(int sessionId) const noexcept override;
+
+        /**
+         * @brief Gets the players of a room
+         * @param roomId The ID of the room
+         * @return Their session IDs, empty for an unknown room
+         */
+        [[nodiscard]] std::vector<int> members(RoomId roomId) const override;
+
+        /**
+         * @brief Gets the UDP port of a room, always the port of this process
+         * @param roomId The ID of the room
+         * @return 0: clients use the port announced by the lobby
+         */
+        [[nodiscard]] std::uint16_t udpPort(RoomId roomId) noexcept override;
+
+        /**
+         * @brief Gets the seat token of a player, always 0 in this process
+         * @param sessionId The session ID of the player
+         * @return 0: the player's UDP session joins the room it joined over TCP
+         */
+        [[nodiscard]] std::uint32_t seatToken(int sessionId) const noexcept override;
 
         /**
          * @brief Gets a reference to a room by its ID
@@ -128,7 +252,68 @@ namespace Engine
          */
         [[nodiscard]] std::shared_ptr<Room> getRoomById(RoomId roomId) const noexcept;
 
+        static constexpr std::size_t SHARD_COUNT = 16;          ///> Number of room and player shards
+        static constexpr std::chrono::seconds SEAT_TIMEOUT{30}; ///> Time a reserved seat is held
+
       private:
+        /**
+         * @struct RoomSlot
+         * @brief A room and the sessions assigned to it
+         */
+        struct RoomSlot {
+            std::shared_ptr<Room> room;      ///> The room
+            std::unordered_set<int> members; ///> Sessions mapped to this room, cleared with it
+        };
+
+        /**
+         * @struct RoomShard
+         * @brief Rooms whose ID falls in one shard, with their own lock
+         */
+        struct alignas(64) RoomShard {
+            std::shared_mutex mutex;                    ///> Guards rooms
+            std::unordered_map<RoomId, RoomSlot> rooms; ///> Rooms of the shard by ID
+        };
+
+        /**
+         * @struct PlayerShard
+         * @brief Room assignments of the sessions falling in one shard, with their own lock
+         */
+        struct alignas(64) PlayerShard {
+            std::shared_mutex mutex;               ///> Guards rooms
+            std::unordered_map<int, RoomId> rooms; ///> Room ID of each session of the shard
+        };
+
+        /**
+         * @struct Seat
+         * @brief A seat reserved by reserveSeat()
+         */
+        struct Seat {
+            std::uint32_t ip = 0;                           ///> Address of the expected client
+            std::uint32_t token = 0;                        ///> Token the client echoes in its CONNECT
+            RoomId roomId = 0;                              ///> Room the client goes to
+            std::chrono::steady_clock::time_point expiry{}; ///> When the seat is dropped
+        };
+
+        /**
+         * @brief Gets the shard holding a room
+         * @param roomId The ID of the room
+         * @return The shard
+         */
+        [[nodiscard]] RoomShard &roomShard(RoomId roomId) const noexcept;
+
+        /**
+         * @brief Gets the shard holding the room assignment of a session
+         * @param sessionId The session ID
+         * @return The shard
+         */
+        [[nodiscard]] PlayerShard &playerShard(int sessionId) const noexcept;
+
+        /**
+         * @brief Counts one more room if the room limit allows it
+         * @return False if the room limit is reached
+         */
+        [[nodiscard]] bool reserveRoom() noexcept;
+
         /**
          * @brief Gets a reference to the room a player is assigned to
          * @param sessionId The session ID of the player
@@ -136,21 +321,57 @@ namespace Engine
          */
         [[nodiscard]] std::shared_ptr<Room> getRoomOfPlayer(int sessionId) const noexcept;
 
-        std::unordered_map<RoomId, std::shared_ptr<Room>>
-            _rooms;                                    ///>  Maps room IDs to their corresponding Room instances
-        std::unordered_map<int, RoomId> _playerToRoom; ///> Maps session IDs to their corresponding room IDs
+        /**
+         * @brief Takes a seat, dropping the expired ones
+         * @param ip The IPv4 address of the client, in network order
+         * @param token The token the client echoed
+         * @return The ID of the room, or an invalid ID if no such seat is reserved for this address
+         */
+        [[nodiscard]] RoomId takeSeat(std::uint32_t ip, std::uint32_t token) noexcept;
 
-        RoomId _nextRoomId = 1;                    ///> Counter for generating unique room IDs
-        static constexpr RoomId InvalidRoomId = 0; ///> Constant representing an invalid room ID
+        /**
+         * @brief Starts recording a freshly created room into the record directory
+         * @param room The room to record
+         * @param roomId The ID of the room, used to name the recording
+         */
+        void startRecording(Room &room, RoomId roomId) const noexcept;
+
+        /**
+         * @brief Updates the directory entry of a room; called with the room's shard locked
+         * @param roomId The ID of the room
+         * @param room The room
+         */
+        void publish(RoomId roomId, const Room &room) noexcept;
+
+        mutable std::array<RoomShard, SHARD_COUNT> _roomShards;     ///> Rooms, sharded by ID
+        mutable std::array<PlayerShard, SHARD_COUNT> _playerShards; ///> Room of each session, sharded by session
+
+        std::atomic<RoomId> _nextRoomId = 1;                                ///> Counter for generating unique room IDs
+        static constexpr RoomId InvalidRoomId = 0;                          ///> Constant representing an invalid room
+        std::atomic<size_t> _roomCount = 0;                                 ///> Rooms existing or being created
+        std::atomic<size_t> _maxRooms = std::numeric_limits<size_t>::max(); ///> Maximum number of rooms at once
 
         std::shared_ptr<Net::Server::ISessionManager> _sessions; ///> Session manager for handling player sessions
         std::shared_ptr<Net::Server::IServer> _server;           ///> Server instance for network communication
         std::shared_ptr<Net::Factory::UDPPacketFactory>
-            _udpPacketFactory;  ///> Packet factory for creating network packets
-        std::string _levelPath; ///> Path to the game level data
+            _udpPacketFactory;                      ///> Packet factory for creating network packets
+        std::string _levelPath;                     ///> Path to the game level data
+        std::string _recordDir;                     ///> Directory for room recordings, empty when disabled
+        Game::SnapshotRate::Config _snapshotRate;   ///> Snapshot rate of new rooms
+        Game::OverloadGuard::Config _overloadGuard; ///> Overload handling of new rooms
+
+        std::chrono::milliseconds _idleTimeout = Room::DEFAULT_IDLE_TIMEOUT; ///> Idle time before new rooms hibernate
+        std::shared_ptr<Ecs::JobSystem> _jobs = nullptr;                     ///> Job system shared by new rooms
+        std::shared_ptr<const Utils::ThreadPlacement> _placement = nullptr;  ///> CPUs of new rooms' threads
+
+        SessionRoutes _routes;    ///> Lock-free address to room routes, updated on join and leave
+        RoomDirectory _directory; ///> Serialized room list, updated on create, join, leave and remove
 
-        mutable std::mutex _mutex; ///> Mutex for synchronizing access to shared resources
+        std::mutex _seatsMutex;                           ///> Guards _seats and _seatTokens
+        std::vector<Seat> _seats;                         ///> Reserved seats, oldest first
+        std::mt19937 _seatTokens{std::random_device{}()}; ///> Draws the seat tokens
+        bool _seatsOnly = false;                          ///> Whether unseated players are refused
     };
 } // namespace Engine
 
-#include "RoomManager.tpp"
\ No newline at end of file
+#include "RoomManager.tpp"
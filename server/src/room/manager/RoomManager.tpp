@@ -14,11 +14,10 @@ namespace Engine
     {
         std::vector<std::shared_ptr<Room>> rooms;
 
-        {
-            std::scoped_lock lock(_mutex);
-            rooms.reserve(_rooms.size());
-            for (auto &room : _rooms | std::views::values)
-                rooms.push_back(room);
+        for (auto &shard : _roomShards) {
+            std::shared_lock lock(shard.mutex);
+            for (const auto &slot : shard.rooms | std::views::values)
+                rooms.push_back(slot.room);
         }
 
         for (auto &room : rooms)
@@ -6,16 +6,17 @@
 */
 
 #include "Room.hpp"
+#include "Log.hpp"
 
 namespace Engine
 {
     Room::Room(const std::shared_ptr<Net::Server::ISessionManager> &sessions,
         const std::shared_ptr<Net::Server::IServer> &server,
         const std::shared_ptr<Net::Factory::UDPPacketFactory> &udpPacketFactory, const std::string &levelPath,
-        std::string name, const size_t maxPlayers)
+        std::string name, const size_t maxPlayers, const std::uint64_t seed)
         : _maxPlayers(maxPlayers), _name(std::move(name))
     {
-        _gameServer = std::make_unique<Game::GameServer>(sessions, server, udpPacketFactory, levelPath);
+        _gameServer = std::make_unique<Game::GameServer>(sessions, server, udpPacketFactory, levelPath, seed);
     }
 
     Room::~Room()
@@ -32,10 +33,27 @@ namespace Engine
     void Room::stop()
     {
         _running = false;
+        _gameServer->wake();
         if (_thread.joinable())
             _thread.join();
     }
 
+    void Room::setIdleTimeout(const std::chrono::milliseconds timeout) noexcept
+    {
+        _idleTimeout = timeout;
+    }
+
+    void Room::setPlacement(std::shared_ptr<const Utils::ThreadPlacement> placement, const std::size_t index) noexcept
+    {
+        _placement = std::move(placement);
+        _placementIndex = index;
+    }
+
+    bool Room::hibernating() const noexcept
+    {
+        return _hibernating.load();
+    }
+
     void Room::join(const int sessionId)
     {
         _sessions.insert(sessionId);
@@ -78,18 +96,61 @@ namespace Engine
         return _name;
     }
 
-    void Room::run() const
+    void Room::run()
     {
         constexpr auto Tick = std::chrono::milliseconds(16);
         auto next = std::chrono::steady_clock::now();
+        auto lastActive = next;
+        std::uint32_t activity = _gameServer->activity();
 
+        if (_placement)
+            _placement->apply("room", _placementIndex);
         while (_running) {
+            const auto now = std::chrono::steady_clock::now();
+            if (const std::uint32_t current = _gameServer->activity(); current != activity) {
+                activity = current;
+                lastActive = now;
+            } else if (_idleTimeout.count() > 0 && now - lastActive >= _idleTimeout) {
+                hibernate();
+                activity = _gameServer->activity();
+                lastActive = std::chrono::steady_clock::now();
+                next = lastActive;
+                continue;
+            }
+
             next += Tick;
             _gameServer->tick();
             std::this_thread::sleep_until(next);
 
-            if (auto now = std::chrono::steady_clock::now(); now > next + 5 * Tick)
-                next = now;
+            if (auto after = std::chrono::steady_clock::now(); after > next + Tick)
+                next = after;
         }
     }
+
+    void Room::hibernate()
+    {
+        const std::size_t before = _gameServer->memoryUsage();
+        const std::size_t heapBefore = _gameServer->heapUsage();
+        _gameServer->hibernate();
+        const std::size_t after = _gameServer->memoryUsage();
+        Log::info("Room::hibernate", "room hibernating",
+            {{"room", _name}, {"bytes_before", before}, {"bytes_after", after}, {"heap_before", heapBefore},
+                {"heap_after", _gameServer->heapUsage()}});
+        _hibernating = true;
+
+        const std::uint32_t activity = _gameServer->activity();
+        while (_running && _gameServer->activity() == activity) {
+            const std::uint32_t wakeups = _gameServer->wakeups();
+            _gameServer->drainCommands();
+            _gameServer->flushClients();
+            if (!_running || _gameServer->activity() != activity)
+                break;
+            _gameServer->waitForCommand(wakeups);
+        }
+
+        _gameServer->resume();
+        _hibernating = false;
+        if (_running)
+            Log::info("Room::hibernate", "room resumed", {{"room", _name}, {"bytes", _gameServer->memoryUsage()}});
+    }
 } // namespace Engine
\ No newline at end of file
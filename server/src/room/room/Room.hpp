@@ -8,12 +8,14 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <memory>
 #include <thread>
 #include <utility>
 #include <unordered_set>
 
 #include "GameServer.hpp"
+#include "ThreadPlacement.hpp"
 
 namespace Engine
 {
@@ -28,6 +30,8 @@ namespace Engine
      */
     class Room {
       public:
+        static constexpr std::chrono::milliseconds DEFAULT_IDLE_TIMEOUT{30000}; ///> Idle time before hibernating
+
         /**
          * @brief Constructor for Room
          * @param sessions shared pointer to the session manager
@@ -36,11 +40,12 @@ namespace Engine
          * @param levelPath path to the game level data
          * @param name name of the room
          * @param maxPlayers maximum number of players allowed in the room
+         * @param seed seed of the room's random generator
          */
         explicit Room(const std::shared_ptr<Net::Server::ISessionManager> &sessions,
             const std::shared_ptr<Net::Server::IServer> &server,
             const std::shared_ptr<Net::Factory::UDPPacketFactory> &udpPacketFactory, const std::string &levelPath,
-            std::string name = "room", size_t maxPlayers = 4);
+            std::string name = "room", size_t maxPlayers = 4, std::uint64_t seed = Rand::Generator::randomSeed());
 
         /**
          * @brief Destructor for Room
@@ -57,6 +62,29 @@ namespace Engine
          */
         void stop();
 
+        /**
+         * @brief Sets how long the room ticks without receiving inputs before it hibernates
+         * @param timeout The idle period, or zero to never hibernate; call before start()
+         */
+        void setIdleTimeout(std::chrono::milliseconds timeout) noexcept;
+
+        /**
+         * @brief Sets the CPUs the room's thread runs on, and names it `room-<index>`
+         * @param placement The placement rules, or nullptr to leave the thread unnamed and floating
+         * @param index The index of the room among the `room` threads, its ID
+         */
+        void setPlacement(std::shared_ptr<const Utils::ThreadPlacement> placement, std::size_t index) noexcept;
+
+        /**
+         * @brief Checks if the room is hibernating
+         *
+         * A hibernating room does not tick nor send snapshots: its thread sleeps until a command comes in,
+         * answers pings, and resumes ticking on the next connection, disconnection or input.
+         *
+         * @return true if the room's thread is asleep, false otherwise
+         */
+        [[nodiscard]] bool hibernating() const noexcept;
+
         /**
          * @brief Adds a player session to the room
          * @param sessionId The session ID of the player to be added
@@ -109,7 +137,12 @@ namespace Engine
         /**
          * @brief Main loop for the room's game server
          */
-        void run() const;
+        void run();
+
+        /**
+         * @brief Shrinks the room's memory and sleeps until it receives activity or is stopped
+         */
+        void hibernate();
 
         std::unordered_set<int> _sessions; ///> Set of player session IDs in the room
 
@@ -119,5 +152,11 @@ namespace Engine
         std::thread _thread;               ///> Thread for the room's game server loop
         size_t _maxPlayers = 0;            ///> Maximum number of players allowed in the room
         std::string _name = "";            ///> Name of the room
+
+        std::atomic<bool> _hibernating{false};                         ///> Whether the room's thread is asleep
+        std::chrono::milliseconds _idleTimeout = DEFAULT_IDLE_TIMEOUT; ///> Idle time before hibernating
+
+        std::shared_ptr<const Utils::ThreadPlacement> _placement = nullptr; ///> CPUs of the room's thread
+        std::size_t _placementIndex = 0;                                    ///> Index of the room's thread
     };
 } // namespace Engine
\ No newline at end of file
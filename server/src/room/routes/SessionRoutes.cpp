@@ -0,0 +1,75 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** SessionRoutes
+*/
+
+#include "SessionRoutes.hpp"
+#include <algorithm>
+
+namespace Engine
+{
+    SessionRoutes::SessionRoutes() : _table(new Table())
+    {
+    }
+
+    SessionRoutes::~SessionRoutes()
+    {
+        delete _table.load();
+    }
+
+    void SessionRoutes::set(const sockaddr_in &addr, const Route route)
+    {
+        std::scoped_lock lock(_writeMutex);
+        auto table = std::make_unique<Table>(*_table.load());
+
+        std::erase_if(*table, [&route](const auto &entry) {
+            return entry.second.sessionId == route.sessionId;
+        });
+        (*table)[AddressKey{addr.sin_addr.s_addr, addr.sin_port}] = route;
+        publish(std::move(table));
+    }
+
+    void SessionRoutes::removeSession(const int sessionId)
+    {
+        const auto matches = [sessionId](const auto &entry) {
+            return entry.second.sessionId == sessionId;
+        };
+        std::scoped_lock lock(_writeMutex);
+        if (std::ranges::none_of(*_table.load(), matches))
+            return;
+
+        auto table = std::make_unique<Table>(*_table.load());
+        std::erase_if(*table, matches);
+        publish(std::move(table));
+    }
+
+    void SessionRoutes::removeSink(const Net::IMessageSink *sink)
+    {
+        const auto matches = [sink](const auto &entry) {
+            return entry.second.sink == sink;
+        };
+        std::scoped_lock lock(_writeMutex);
+        if (std::ranges::none_of(*_table.load(), matches))
+            return;
+
+        auto table = std::make_unique<Table>(*_table.load());
+        std::erase_if(*table, matches);
+        publish(std::move(table));
+    }
+
+    std::size_t SessionRoutes::size() const
+    {
+        Utils::EpochDomain::Guard guard(_epoch);
+        return _table.load(std::memory_order_seq_cst)->size();
+    }
+
+    void SessionRoutes::publish(std::unique_ptr<Table> table)
+    {
+        const Table *old = _table.exchange(table.release(), std::memory_order_seq_cst);
+
+        _epoch.synchronize();
+        delete old;
+    }
+} // namespace Engine
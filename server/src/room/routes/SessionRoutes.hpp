@@ -0,0 +1,100 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** SessionRoutes
+*/
+
+#pragma once
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include "Endian.hpp"
+#include "EpochDomain.hpp"
+#include "IMessageSink.hpp"
+
+#ifdef _WIN32
+    #include <winsock2.h>
+#else
+    #include <netinet/in.h>
+#endif
+
+namespace Engine
+{
+    /**
+     * @class SessionRoutes
+     * @brief Maps client addresses straight to the room that handles their messages.
+     * @details A route is resolved once, when a player joins a room, and read without any
+     * lock afterwards: the table is immutable, replaced as a whole on each join or leave,
+     * and the old one is freed once no reader can still see it (see Utils::EpochDomain).
+     * A route's sink stays valid for the duration of visit(), as long as it is removed
+     * before its room is destroyed.
+     */
+    class SessionRoutes {
+      public:
+        /**
+         * @brief Destination of a client's messages.
+         */
+        struct Route {
+            int sessionId = -1;                ///> Session of the client
+            Net::IMessageSink *sink = nullptr; ///> Game server of the client's room
+        };
+
+        SessionRoutes();
+        ~SessionRoutes();
+
+        SessionRoutes(const SessionRoutes &) = delete;
+        SessionRoutes &operator=(const SessionRoutes &) = delete;
+
+        /**
+         * @brief Adds or replaces the route of an address.
+         * @param addr The client address.
+         * @param route The route.
+         */
+        void set(const sockaddr_in &addr, Route route);
+
+        /**
+         * @brief Removes the route of a session.
+         * @param sessionId The session.
+         */
+        void removeSession(int sessionId);
+
+        /**
+         * @brief Removes every route to a sink, which may be destroyed once this returns.
+         * @param sink The sink.
+         */
+        void removeSink(const Net::IMessageSink *sink);
+
+        /**
+         * @brief Calls a function with the route of an address, without taking any lock.
+         * @param addr The client address.
+         * @param func Called with the Route if there is one.
+         * @return True if the address has a route.
+         */
+        template <typename Func>
+        bool visit(const sockaddr_in &addr, Func &&func) const;
+
+        /**
+         * @brief Gets the number of routes.
+         * @return The number of routes.
+         */
+        [[nodiscard]] std::size_t size() const;
+
+      private:
+        using Table = std::unordered_map<AddressKey, Route, AddressKeyHash>;
+
+        /**
+         * @brief Replaces the table and frees the old one after the grace period.
+         * @param table The new table.
+         * @note Must be called with _writeMutex held.
+         */
+        void publish(std::unique_ptr<Table> table);
+
+        std::atomic<const Table *> _table; ///> Current table, read without locks
+        mutable Utils::EpochDomain _epoch; ///> Protects readers of _table
+        mutable std::mutex _writeMutex;    ///> Serializes writers
+    };
+} // namespace Engine
+
+#include "SessionRoutes.tpp"
@@ -0,0 +1,24 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** SessionRoutes
+*/
+
+#pragma once
+
+namespace Engine
+{
+    template <typename Func>
+    bool SessionRoutes::visit(const sockaddr_in &addr, Func &&func) const
+    {
+        Utils::EpochDomain::Guard guard(_epoch);
+        const Table *table = _table.load(std::memory_order_seq_cst);
+
+        const auto it = table->find(AddressKey{addr.sin_addr.s_addr, addr.sin_port});
+        if (it == table->end())
+            return false;
+        func(it->second);
+        return true;
+    }
+} // namespace Engine
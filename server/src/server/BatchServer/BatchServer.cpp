@@ -0,0 +1,204 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** BatchServer
+*/
+
+#include "BatchServer.hpp"
+#include <cstring>
+#include "HeaderData.hpp"
+#include "Log.hpp"
+#include "UDPTypesData.hpp"
+
+namespace Net::Server
+{
+    BatchServer::BatchServer(std::shared_ptr<IServer> server, std::shared_ptr<IPacket> packet)
+        : _server(std::move(server)), _packet(std::move(packet))
+    {
+        if (!_server || !_packet)
+            throw ServerError("{BatchServer::BatchServer} Invalid server or packet pointer");
+    }
+
+    void BatchServer::configure(const std::string &ip, const int32_t port)
+    {
+        _server->configure(ip, port);
+    }
+
+    void BatchServer::start()
+    {
+        _server->start();
+    }
+
+    void BatchServer::stop() noexcept
+    {
+        _server->stop();
+    }
+
+    void BatchServer::setNonBlocking(const bool nonBlocking)
+    {
+        _server->setNonBlocking(nonBlocking);
+    }
+
+    bool BatchServer::isRunning() const noexcept
+    {
+        return _server->isRunning();
+    }
+
+    void BatchServer::setRunning(const bool running) noexcept
+    {
+        _server->setRunning(running);
+    }
+
+    void BatchServer::readPackets() noexcept
+    {
+        _server->readPackets();
+    }
+
+    bool BatchServer::isStoredIpCorrect() const noexcept
+    {
+        return _server->isStoredIpCorrect();
+    }
+
+    bool BatchServer::isStoredPortCorrect() const noexcept
+    {
+        return _server->isStoredPortCorrect();
+    }
+
+    bool BatchServer::popPacket(std::shared_ptr<IPacket> &pkt) noexcept
+    {
+        return _server->popPacket(pkt);
+    }
+
+    bool BatchServer::sendPacket(const IPacket &pkt) noexcept
+    {
+        const sockaddr_in *addr = pkt.address();
+        if (!addr || pkt.size() < sizeof(HeaderData))
+            return _server->sendPacket(pkt);
+
+        try {
+            const bool alone = sizeof(HeaderData) + pkt.size() > MAX_DATAGRAM;
+            Batch full;
+            {
+                std::scoped_lock lock(_mutex);
+                auto &batch = _batches[AddressKey{addr->sin_addr.s_addr, addr->sin_port}];
+                batch.address = *addr;
+                if (batch.data.size() + pkt.size() > MAX_DATAGRAM)
+                    full = take(batch);
+                if (!alone) {
+                    if (batch.data.empty()) {
+                        batch.data.reserve(MAX_DATAGRAM);
+                        batch.data.resize(sizeof(HeaderData));
+                    }
+                    batch.data.insert(batch.data.end(), pkt.buffer(), pkt.buffer() + pkt.size());
+                    batch.count++;
+                }
+            }
+            send(full);
+            if (!alone)
+                return true;
+            _packets++;
+            return sendRaw(*addr, pkt.buffer(), pkt.size());
+        } catch (const std::exception &e) {
+            Log::error("BatchServer::sendPacket", "failed to batch packet", {{"error", e.what()}});
+            return false;
+        }
+    }
+
+    void BatchServer::flush() noexcept
+    {
+        std::vector<Batch> ready;
+
+        try {
+            {
+                std::scoped_lock lock(_mutex);
+                ready.reserve(_batches.size());
+                for (auto it = _batches.begin(); it != _batches.end();) {
+                    if (it->second.count == 0) {
+                        it = _batches.erase(it);
+                        continue;
+                    }
+                    ready.push_back(take(it->second));
+                    ++it;
+                }
+            }
+            for (auto &batch : ready)
+                send(batch);
+        } catch (const std::exception &e) {
+            Log::error("BatchServer::flush", "failed to flush batches", {{"error", e.what()}});
+        }
+    }
+
+    void BatchServer::flush(const sockaddr_in &addr) noexcept
+    {
+        Batch batch;
+
+        {
+            std::scoped_lock lock(_mutex);
+            const auto it = _batches.find(AddressKey{addr.sin_addr.s_addr, addr.sin_port});
+            if (it == _batches.end() || it->second.count == 0)
+                return;
+            batch = take(it->second);
+        }
+        try {
+            send(batch);
+        } catch (const std::exception &e) {
+            Log::error("BatchServer::flush", "failed to flush batch", {{"error", e.what()}});
+        }
+    }
+
+    size_t BatchServer::datagramsSent() const noexcept
+    {
+        return _datagrams.load(std::memory_order_relaxed);
+    }
+
+    size_t BatchServer::packetsSent() const noexcept
+    {
+        return _packets.load(std::memory_order_relaxed);
+    }
+
+    BatchServer::Batch BatchServer::take(Batch &batch) noexcept
+    {
+        Batch taken{batch.address, std::move(batch.data), batch.count};
+
+        batch.data.clear();
+        batch.count = 0;
+        return taken;
+    }
+
+    void BatchServer::send(Batch &batch)
+    {
+        if (batch.count == 0)
+            return;
+        _packets += batch.count;
+        if (batch.count == 1) {
+            sendRaw(batch.address, batch.data.data() + sizeof(HeaderData), batch.data.size() - sizeof(HeaderData));
+        } else {
+            HeaderData header{};
+            header.type = Protocol::UDP::BATCH;
+            header.version = batch.data[sizeof(HeaderData) + 1];
+            header.size = htons(static_cast<uint16_t>(batch.data.size()));
+            std::memcpy(batch.data.data(), &header, sizeof(header));
+            sendRaw(batch.address, batch.data.data(), batch.data.size());
+        }
+        batch.data.clear();
+        batch.count = 0;
+    }
+
+    bool BatchServer::sendRaw(const sockaddr_in &address, const uint8_t *data, const size_t size)
+    {
+        const auto out = _packet->newPacket();
+        if (!out || size > out->capacity())
+            return false;
+        std::memcpy(out->buffer(), data, size);
+        out->setSize(size);
+        out->setAddress(address);
+        _datagrams++;
+        if (!_server->sendPacket(*out)) {
+            static Log::RateLimit limit;
+            limit.warn("BatchServer::sendRaw", "failed to send datagram");
+            return false;
+        }
+        return true;
+    }
+} // namespace Net::Server
@@ -0,0 +1,128 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** BatchServer
+*/
+
+#pragma once
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include "Endian.hpp"
+#include "IFlushable.hpp"
+#include "IServer.hpp"
+
+namespace Net::Server
+{
+    /**
+     * @class BatchServer
+     * @brief IServer decorator coalescing the packets sent to a client into one datagram per flush.
+     * @details sendPacket() only queues the packet behind the others of the same client.
+     * flush() then sends a single datagram per client: the packet itself when it is
+     * alone, or a BATCH packet whose payload is the queued packets back to back (each
+     * keeps its own HeaderData, whose size delimits it). A batch never exceeds
+     * MAX_DATAGRAM; packets too large to share a datagram are sent right away.
+     * Rooms flush their own clients at the end of each tick; flush() catches the rest.
+     * Datagrams are sent with the lock released. Every other IServer call is forwarded
+     * as is. Thread-safe.
+     */
+    class BatchServer final : public IServer, public IFlushable {
+      public:
+        static constexpr size_t MAX_DATAGRAM = 1200; ///> Largest batch, below the usual path MTU
+
+        /**
+         * @brief Constructs a new BatchServer.
+         * @param server The server actually sending the datagrams.
+         * @param packet Template packet used to build outgoing datagrams.
+         */
+        BatchServer(std::shared_ptr<IServer> server, std::shared_ptr<IPacket> packet);
+
+        /**
+         * @brief IServer calls forwarded to the wrapped server.
+         */
+        void configure(const std::string &ip, int32_t port) override;
+        void start() override;
+        void stop() noexcept override;
+        void setNonBlocking(bool nonBlocking) override;
+        [[nodiscard]] bool isRunning() const noexcept override;
+        void setRunning(bool running) noexcept override;
+        void readPackets() noexcept override;
+        [[nodiscard]] bool isStoredIpCorrect() const noexcept override;
+        [[nodiscard]] bool isStoredPortCorrect() const noexcept override;
+        [[nodiscard]] bool popPacket(std::shared_ptr<IPacket> &pkt) noexcept override;
+
+        /**
+         * @brief Queues a packet until the next flush().
+         * @param pkt The packet to send; its address selects the batch.
+         * @return False if the packet could not be queued or sent.
+         */
+        bool sendPacket(const IPacket &pkt) noexcept override;
+
+        /**
+         * @brief Sends one datagram per client with everything queued since the last flush.
+         */
+        void flush() noexcept;
+
+        /**
+         * @brief Sends one datagram with everything queued for a client since the last flush.
+         * @param addr The address of the client.
+         */
+        void flush(const sockaddr_in &addr) noexcept override;
+
+        /**
+         * @brief Gets the number of datagrams handed to the wrapped server.
+         * @return The number of datagrams sent.
+         */
+        [[nodiscard]] size_t datagramsSent() const noexcept;
+
+        /**
+         * @brief Gets the number of packets sent, batched or not.
+         * @return The number of packets sent.
+         */
+        [[nodiscard]] size_t packetsSent() const noexcept;
+
+      private:
+        /**
+         * @brief Packets queued for a client.
+         */
+        struct Batch {
+            sockaddr_in address{};     ///> Client address
+            std::vector<uint8_t> data; ///> BATCH header followed by the queued packets
+            size_t count = 0;          ///> Number of queued packets
+        };
+
+        /**
+         * @brief Takes a client's queued packets out of its batch. Caller holds _mutex.
+         * @param batch The batch to empty.
+         * @return The packets, to send once _mutex is released.
+         */
+        [[nodiscard]] static Batch take(Batch &batch) noexcept;
+
+        /**
+         * @brief Sends a client's queued packets, if any. Caller does not hold _mutex.
+         * @param batch The batch to send.
+         */
+        void send(Batch &batch);
+
+        /**
+         * @brief Hands one datagram to the wrapped server.
+         * @param address The destination.
+         * @param data The datagram.
+         * @param size The size of the datagram.
+         * @return False if the datagram could not be sent.
+         */
+        bool sendRaw(const sockaddr_in &address, const uint8_t *data, size_t size);
+
+        std::shared_ptr<IServer> _server; ///> Wrapped server
+        std::shared_ptr<IPacket> _packet; ///> Template of outgoing packets
+
+        std::mutex _mutex;                                              ///> Protects _batches
+        std::unordered_map<AddressKey, Batch, AddressKeyHash> _batches; ///> Queued packets of each client
+
+        std::atomic<size_t> _datagrams{0}; ///> Datagrams sent
+        std::atomic<size_t> _packets{0};   ///> Packets sent
+    };
+} // namespace Net::Server
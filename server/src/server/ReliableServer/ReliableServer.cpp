@@ -0,0 +1,184 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** ReliableServer
+*/
+
+#include "ReliableServer.hpp"
+#include <cstring>
+#include "Log.hpp"
+
+namespace Net::Server
+{
+    ReliableServer::ReliableServer(std::shared_ptr<IServer> server, std::shared_ptr<IPacket> packet)
+        : _server(std::move(server)), _packet(std::move(packet)),
+          _flushable(std::dynamic_pointer_cast<IFlushable>(_server))
+    {
+        if (!_server || !_packet)
+            throw ServerError("{ReliableServer::ReliableServer} Invalid server or packet pointer");
+    }
+
+    void ReliableServer::configure(const std::string &ip, const int32_t port)
+    {
+        _server->configure(ip, port);
+    }
+
+    void ReliableServer::start()
+    {
+        _server->start();
+    }
+
+    void ReliableServer::stop() noexcept
+    {
+        _server->stop();
+    }
+
+    void ReliableServer::setNonBlocking(const bool nonBlocking)
+    {
+        _server->setNonBlocking(nonBlocking);
+    }
+
+    bool ReliableServer::isRunning() const noexcept
+    {
+        return _server->isRunning();
+    }
+
+    void ReliableServer::setRunning(const bool running) noexcept
+    {
+        _server->setRunning(running);
+    }
+
+    void ReliableServer::readPackets() noexcept
+    {
+        _server->readPackets();
+    }
+
+    bool ReliableServer::isStoredIpCorrect() const noexcept
+    {
+        return _server->isStoredIpCorrect();
+    }
+
+    bool ReliableServer::isStoredPortCorrect() const noexcept
+    {
+        return _server->isStoredPortCorrect();
+    }
+
+    bool ReliableServer::popPacket(std::shared_ptr<IPacket> &pkt) noexcept
+    {
+        return _server->popPacket(pkt);
+    }
+
+    bool ReliableServer::sendPacket(const IPacket &pkt) noexcept
+    {
+        const sockaddr_in *addr = pkt.address();
+        if (pkt.size() < sizeof(HeaderData) || !addr || !Protocol::UDP::isReliable(pkt.buffer()[0]))
+            return _server->sendPacket(pkt);
+
+        try {
+            std::scoped_lock lock(_mutex);
+            auto &peer = _peers[AddressKey{addr->sin_addr.s_addr, addr->sin_port}];
+            peer.address = *addr;
+            if (!peer.sender.push(pkt.buffer(), pkt.size())) {
+                static Log::RateLimit limit;
+                limit.warn("ReliableServer::sendPacket", "dropped: too many unacknowledged messages");
+                return false;
+            }
+            flush(peer, Reliable::Clock::now());
+            return true;
+        } catch (const std::exception &e) {
+            Log::error("ReliableServer::sendPacket", "failed to queue message", {{"error", e.what()}});
+            return false;
+        }
+    }
+
+    void ReliableServer::onAck(const sockaddr_in &addr, const AckFields &fields)
+    {
+        const auto now = Reliable::Clock::now();
+
+        std::scoped_lock lock(_mutex);
+        const auto it = _peers.find(AddressKey{addr.sin_addr.s_addr, addr.sin_port});
+        if (it == _peers.end())
+            return;
+        it->second.sender.onAck(Reliable::swapAck(fields), now);
+        flush(it->second, now);
+    }
+
+    void ReliableServer::resendExpired()
+    {
+        resendExpired(Reliable::Clock::now());
+    }
+
+    void ReliableServer::resendExpired(const Reliable::Clock::time_point now)
+    {
+        std::scoped_lock lock(_mutex);
+
+        for (auto it = _peers.begin(); it != _peers.end();) {
+            flush(it->second, now);
+            if (it->second.sender.timeouts() < Reliable::MAX_TIMEOUTS) {
+                ++it;
+                continue;
+            }
+            Log::info("ReliableServer::resendExpired", "client stopped acknowledging, channel dropped",
+                {{"port", ntohs(it->second.address.sin_port)}, {"pending", it->second.sender.pending()}});
+            it = _peers.erase(it);
+        }
+    }
+
+    void ReliableServer::removePeer(const sockaddr_in &addr)
+    {
+        std::scoped_lock lock(_mutex);
+        _peers.erase(AddressKey{addr.sin_addr.s_addr, addr.sin_port});
+    }
+
+    std::size_t ReliableServer::prunePeers(const std::function<bool(const sockaddr_in &)> &stale)
+    {
+        std::vector<sockaddr_in> addresses;
+        std::size_t dropped = 0;
+
+        {
+            std::scoped_lock lock(_mutex);
+            addresses.reserve(_peers.size());
+            for (const auto &[key, peer] : _peers)
+                addresses.push_back(peer.address);
+        }
+        for (const auto &addr : addresses) {
+            if (!stale(addr))
+                continue;
+            std::scoped_lock lock(_mutex);
+            dropped += _peers.erase(AddressKey{addr.sin_addr.s_addr, addr.sin_port});
+        }
+        return dropped;
+    }
+
+    void ReliableServer::flush(const sockaddr_in &addr) noexcept
+    {
+        if (_flushable)
+            _flushable->flush(addr);
+    }
+
+    LinkStats ReliableServer::linkStats(const sockaddr_in &addr)
+    {
+        std::scoped_lock lock(_mutex);
+        const auto it = _peers.find(AddressKey{addr.sin_addr.s_addr, addr.sin_port});
+        if (it == _peers.end())
+            return {};
+        return {it->second.sender.transmissions(), it->second.sender.retransmissions()};
+    }
+
+    void ReliableServer::flush(Peer &peer, const Reliable::Clock::time_point now)
+    {
+        peer.sender.poll(now, [this, &peer](const std::vector<uint8_t> &datagram) {
+            const auto out = _packet->newPacket();
+            if (!out || datagram.size() > out->capacity())
+                return;
+            std::memcpy(out->buffer(), datagram.data(), datagram.size());
+            out->setSize(datagram.size());
+            out->setAddress(peer.address);
+            if (!_server->sendPacket(*out)) {
+                static Log::RateLimit limit;
+                limit.warn("ReliableServer::flush", "failed to send reliable message");
+            }
+        });
+    }
+} // namespace Net::Server
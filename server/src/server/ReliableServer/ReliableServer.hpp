@@ -0,0 +1,130 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** ReliableServer
+*/
+
+#pragma once
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include "Endian.hpp"
+#include "IFlushable.hpp"
+#include "ILinkMonitor.hpp"
+#include "IServer.hpp"
+#include "ReliableChannel.hpp"
+
+namespace Net::Server
+{
+    /**
+     * @class ReliableServer
+     * @brief IServer decorator adding a reliable, ordered channel per client.
+     * @details Packets of the reliable message class (see Protocol::UDP::isReliable)
+     * are wrapped in RELIABLE packets and resent until the client acknowledges them;
+     * every other packet (snapshots, pongs...) goes straight to the wrapped server.
+     * Every other IServer call is forwarded as is. Thread-safe.
+     * Its retransmissions tell how lossy each client's link is (see ILinkMonitor), and
+     * flushes go through to the wrapped server when it holds packets back (see IFlushable).
+     */
+    class ReliableServer final : public IServer, public ILinkMonitor, public IFlushable {
+      public:
+        /**
+         * @brief Constructs a new ReliableServer.
+         * @param server The server actually sending the datagrams.
+         * @param packet Template packet used to build outgoing datagrams.
+         */
+        ReliableServer(std::shared_ptr<IServer> server, std::shared_ptr<IPacket> packet);
+
+        /**
+         * @brief IServer calls forwarded to the wrapped server.
+         */
+        void configure(const std::string &ip, int32_t port) override;
+        void start() override;
+        void stop() noexcept override;
+        void setNonBlocking(bool nonBlocking) override;
+        [[nodiscard]] bool isRunning() const noexcept override;
+        void setRunning(bool running) noexcept override;
+        void readPackets() noexcept override;
+        [[nodiscard]] bool isStoredIpCorrect() const noexcept override;
+        [[nodiscard]] bool isStoredPortCorrect() const noexcept override;
+        [[nodiscard]] bool popPacket(std::shared_ptr<IPacket> &pkt) noexcept override;
+
+        /**
+         * @brief Sends a packet, reliably if its type belongs to the reliable class.
+         * @param pkt The packet to send; its address selects the channel.
+         * @return False if the packet could not be sent or queued.
+         */
+        [[nodiscard]] bool sendPacket(const IPacket &pkt) noexcept override;
+
+        /**
+         * @brief Processes an acknowledgement received from a client.
+         * @param addr The address of the client.
+         * @param fields The acknowledgement, in network byte order.
+         */
+        void onAck(const sockaddr_in &addr, const AckFields &fields);
+
+        /**
+         * @brief Resends the reliable messages whose retransmission timeout expired.
+         * @details A client that timed out Reliable::MAX_TIMEOUTS times in a row without
+         * acknowledging anything is deemed gone, and its channel dropped.
+         */
+        void resendExpired();
+
+        /**
+         * @brief Resends the reliable messages whose retransmission timeout expired at a given time.
+         * @param now The current time.
+         */
+        void resendExpired(Reliable::Clock::time_point now);
+
+        /**
+         * @brief Drops the channel of a client, discarding its pending messages.
+         * @param addr The address of the client.
+         */
+        void removePeer(const sockaddr_in &addr);
+
+        /**
+         * @brief Drops the channels of the clients that are no longer served, like those without a session.
+         * @param stale Tells whether a client is no longer served; called without the lock held.
+         * @return The number of channels dropped.
+         */
+        std::size_t prunePeers(const std::function<bool(const sockaddr_in &)> &stale);
+
+        /**
+         * @brief Gets the transmissions and retransmissions of a client's reliable channel.
+         * @param addr The address of the client.
+         * @return The counters, all zero if the client has no channel.
+         */
+        [[nodiscard]] LinkStats linkStats(const sockaddr_in &addr) override;
+
+        /**
+         * @brief Sends what the wrapped server holds back for a client, if it holds packets back.
+         * @param addr The address of the client.
+         */
+        void flush(const sockaddr_in &addr) noexcept override;
+
+      private:
+        /**
+         * @brief Sending side of a client's reliable channel.
+         */
+        struct Peer {
+            sockaddr_in address{};   ///> Client address
+            Reliable::Sender sender; ///> Pending messages and RTT state
+        };
+
+        /**
+         * @brief Sends the datagrams a peer's sender has ready. Caller holds _mutex.
+         * @param peer The peer to flush.
+         * @param now The current time.
+         */
+        void flush(Peer &peer, Reliable::Clock::time_point now);
+
+        std::shared_ptr<IServer> _server;       ///> Wrapped server
+        std::shared_ptr<IPacket> _packet;       ///> Template of outgoing packets
+        std::shared_ptr<IFlushable> _flushable; ///> The wrapped server, if it holds packets back
+
+        std::mutex _mutex;                                           ///> Protects _peers
+        std::unordered_map<AddressKey, Peer, AddressKeyHash> _peers; ///> Channel of each client
+    };
+} // namespace Net::Server
@@ -6,6 +6,7 @@
 */
 
 #include "TCPServer.hpp"
+#include "Log.hpp"
 
 namespace
 {
@@ -80,7 +81,7 @@ namespace Net::Server
             throw;
         }
         AServer::setRunning(true);
-        std::cout << "{TCPServer::start} Server started on " << _ip << ":" << _port << std::endl;
+        Log::info("TCPServer::start", "server started", {{"ip", _ip}, {"port", _port}});
     }
 
     void TCPServer::stop() noexcept
@@ -104,7 +105,7 @@ namespace Net::Server
 
             (void) _netWrapper->cleanupNetwork();
         } catch (...) {
-            std::cerr << "{TCPServer::stop} Exception during stop()" << std::endl;
+            Log::error("TCPServer::stop", "exception during stop");
         }
     }
 
@@ -130,7 +131,8 @@ namespace Net::Server
             if (clientFd == kInvalidSocket) {
                 if (wouldBlock())
                     break;
-                std::cerr << "{TCPServer::acceptLoop} accept socket connection failed" << std::endl;
+                static Log::RateLimit limit;
+                limit.warn("TCPServer::acceptLoop", "accept failed");
                 break;
             }
 
@@ -6,6 +6,7 @@
 */
 
 #include "UDPServer.hpp"
+#include "Log.hpp"
 
 using namespace Net::Server;
 
@@ -21,7 +22,7 @@ UDPServer::~UDPServer()
     try {
         UDPServer::stop();
     } catch (...) {
-        std::cerr << "{UDPServer::~UDPServer} Exception caught during server stop\n";
+        Log::error("UDPServer::~UDPServer", "exception during stop");
     }
 }
 
@@ -34,6 +35,8 @@ void UDPServer::start()
         constexpr SocketConfig socketParams = {AF_INET, SOCK_DGRAM, IPPROTO_UDP};
         constexpr SocketOptions socketOptions = {SOL_SOCKET, SO_REUSEADDR, 1};
         setupSocket(socketParams, socketOptions);
+        if (_reusePort)
+            enableReusePort();
         bindSocket(socketParams.family);
         setNonBlocking(true);
     } catch (const ServerError &e) {
@@ -43,7 +46,7 @@ void UDPServer::start()
         throw ServerError(std::string("{UDPServer::start}") + e.what());
     }
     setRunning(true);
-    std::cout << "{UDPServer::start} UDP Server started on " << _ip << ":" << _port << std::endl;
+    Log::info("UDPServer::start", "server started", {{"ip", _ip}, {"port", _port}});
 }
 
 void UDPServer::stop() noexcept
@@ -52,10 +55,10 @@ void UDPServer::stop() noexcept
     if (_socketFd != kInvalidSocket) {
         _netWrapper.closeSocket(_socketFd);
         _socketFd = kInvalidSocket;
-        std::cout << "{UDPServer::stop} UDP Server stopped." << std::endl;
+        Log::info("UDPServer::stop", "server stopped", {{"port", _port}});
     }
     if (const auto result = _netWrapper.cleanupNetwork(); result != 0)
-        std::cerr << "{UDPServer::stop} Failed to cleanup network" << std::endl;
+        Log::error("UDPServer::stop", "failed to cleanup network", {{"result", result}});
 }
 
 void UDPServer::setNonBlocking(const bool nonBlocking)
@@ -82,9 +85,11 @@ void UDPServer::readPackets() noexcept
 
     {
         std::scoped_lock lock(_rxMutex);
-        if (!_rxBuffer.push(pkt))
-            std::cerr << "{UDPServer::readPackets} Warning: RX buffer overflow, packet dropped\n";
+        if (_rxBuffer.push(pkt))
+            return;
     }
+    static Log::RateLimit limit;
+    limit.warn("UDPServer::readPackets", "RX buffer overflow, packet dropped", {{"port", _port}});
 }
 
 bool UDPServer::sendPacket(const Net::IPacket &pkt) noexcept
@@ -101,6 +106,11 @@ bool UDPServer::popPacket(std::shared_ptr<Net::IPacket> &pkt) noexcept
     return _rxBuffer.pop(pkt);
 }
 
+void UDPServer::setReusePort(const bool reusePort) noexcept
+{
+    _reusePort = reusePort;
+}
+
 void UDPServer::setupSocket(const Net::SocketConfig &params, const Net::SocketOptions &optParams)
 {
     if (!isStoredIpCorrect() || !isStoredPortCorrect())
@@ -121,6 +131,18 @@ void UDPServer::setupSocket(const Net::SocketConfig &params, const Net::SocketOp
     _socketFd = sockFd;
 }
 
+void UDPServer::enableReusePort() const
+{
+#ifdef SO_REUSEPORT
+    int opt = 1;
+    if (_netWrapper.setSocketOpt(_socketFd, SOL_SOCKET, SO_REUSEPORT, reinterpret_cast<const char *>(&opt), sizeof(opt))
+        < 0)
+        throw ServerError("{UDPServer::enableReusePort} Failed to set SO_REUSEPORT");
+#else
+    throw ServerError("{UDPServer::enableReusePort} SO_REUSEPORT is not supported on this platform");
+#endif
+}
+
 void UDPServer::bindSocket(family_t family) const
 {
     if (_socketFd == kInvalidSocket)
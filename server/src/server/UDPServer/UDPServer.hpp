@@ -77,14 +77,24 @@ namespace Net::Server
          */
         [[nodiscard]] bool popPacket(std::shared_ptr<IPacket> &pkt) noexcept override;
 
+        /**
+         * @brief Lets several UDPServers bind the same address with SO_REUSEPORT.
+         * @details The kernel then spreads clients between their sockets by address hash.
+         * Must be called before start().
+         * @param reusePort True to set SO_REUSEPORT on the socket.
+         */
+        void setReusePort(bool reusePort) noexcept;
+
       private:
         void setupSocket(const SocketConfig &params,
             const SocketOptions &optParams);    ///> Sets up the UDP socket with specified parameters
         void bindSocket(family_t family) const; ///> Binds the UDP socket to an address
+        void enableReusePort() const;           ///> Sets SO_REUSEPORT on the UDP socket
 
         Buffer::RingBuffer<std::shared_ptr<IPacket>> _rxBuffer; ///> Ring buffer to store received packets
 
-        NetWrapper _netWrapper; ///> Network wrapper for socket operations
-        std::mutex _rxMutex;    ///> Mutex for synchronizing access to the reception buffer
+        NetWrapper _netWrapper;  ///> Network wrapper for socket operations
+        std::mutex _rxMutex;     ///> Mutex for synchronizing access to the reception buffer
+        bool _reusePort = false; ///> Whether the socket shares its port with other UDPServers
     };
 } // namespace Net::Server
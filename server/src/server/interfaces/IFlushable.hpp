@@ -0,0 +1,27 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** IFlushable
+*/
+
+#pragma once
+#include "IPacket.hpp"
+
+namespace Net::Server
+{
+    /**
+     * @class IFlushable
+     * @brief Interface of the servers holding packets back until they are told to send them.
+     */
+    class IFlushable {
+      public:
+        virtual ~IFlushable() = default;
+
+        /**
+         * @brief Sends everything held back for a client.
+         * @param addr The address of the client.
+         */
+        virtual void flush(const sockaddr_in &addr) noexcept = 0;
+    };
+} // namespace Net::Server
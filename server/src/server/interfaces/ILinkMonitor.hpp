@@ -0,0 +1,37 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** ILinkMonitor
+*/
+
+#pragma once
+#include <cstdint>
+#include "IPacket.hpp"
+
+namespace Net::Server
+{
+    /**
+     * @brief Transmission counters of the link to one client, since it was first used.
+     */
+    struct LinkStats {
+        std::uint64_t sent = 0;   ///> Datagrams put on the wire, retransmissions included
+        std::uint64_t resent = 0; ///> Datagrams resent because no acknowledgement came back in time
+    };
+
+    /**
+     * @class ILinkMonitor
+     * @brief Interface of the servers able to tell how well each client receives.
+     */
+    class ILinkMonitor {
+      public:
+        virtual ~ILinkMonitor() = default;
+
+        /**
+         * @brief Gets the counters of the link to a client.
+         * @param addr The address of the client.
+         * @return The counters, all zero for an unknown client.
+         */
+        [[nodiscard]] virtual LinkStats linkStats(const sockaddr_in &addr) = 0;
+    };
+} // namespace Net::Server
@@ -0,0 +1,91 @@
+/*
+** EPITECH PROJECT, 2025
+** RType
+** File description:
+** GatewayRuntime.cpp
+*/
+
+#include "GatewayRuntime.hpp"
+#include "Log.hpp"
+#include "ServerRuntime.hpp"
+#include "TCPPacket.hpp"
+
+using namespace Net::Thread;
+
+GatewayRuntime::GatewayRuntime(const std::shared_ptr<Server::IServer> &tcpServer, const std::size_t workers,
+    Gateway::WorkerPool::Spawner spawner)
+    : _tcpServer(tcpServer)
+{
+    if (!_tcpServer)
+        throw ThreadError("{GatewayRuntime::GatewayRuntime} Invalid TCP server pointer");
+    _sessionManager = std::make_shared<Server::SessionManager>();
+    _pool = std::make_shared<Gateway::WorkerPool>(_sessionManager, workers, std::move(spawner));
+    _tcpPacketFactory = std::make_shared<Factory::TCPPacketFactory>(std::make_shared<TCPPacket>());
+    _tcpPacketRouter = std::make_shared<TCPPacketRouter>(_sessionManager, _pool, _tcpServer, _tcpPacketFactory);
+}
+
+GatewayRuntime::~GatewayRuntime()
+{
+    try {
+        if (!_stopRequested.load())
+            stop();
+    } catch (...) {
+        Log::error("GatewayRuntime::~GatewayRuntime", "exception during destruction");
+    }
+}
+
+void GatewayRuntime::wait()
+{
+    std::unique_lock lock(_mutex);
+    _cv.wait(lock, [this]() {
+        return _stopRequested.load();
+    });
+}
+
+void GatewayRuntime::start()
+{
+    try {
+        _tcpServer->start();
+    } catch (std::exception &e) {
+        throw ThreadError(std::string("{GatewayRuntime::start} Failed to start server: ") + e.what());
+    }
+    _tcpThread = std::thread(&GatewayRuntime::runTcp, this);
+}
+
+void GatewayRuntime::stop()
+{
+    {
+        std::scoped_lock lock(_mutex);
+        _stopRequested.store(true);
+    }
+    _cv.notify_all();
+
+    _tcpServer->setRunning(false);
+    if (_tcpThread.joinable())
+        _tcpThread.join();
+    _pool->shutdown();
+    _tcpServer->stop();
+}
+
+void GatewayRuntime::setPlacement(std::shared_ptr<const Utils::ThreadPlacement> placement)
+{
+    _placement = placement ? std::move(placement) : std::make_shared<const Utils::ThreadPlacement>();
+}
+
+void GatewayRuntime::runTcp() const
+{
+    constexpr auto HousekeepingPeriod = std::chrono::milliseconds(100);
+    auto nextHousekeeping = std::chrono::steady_clock::now();
+
+    _placement->apply("tcp", 0);
+    while (_tcpServer->isRunning()) {
+        _tcpServer->readPackets();
+        if (std::shared_ptr<IPacket> pkt = nullptr; _tcpServer->popPacket(pkt))
+            _tcpPacketRouter->handle(pkt);
+        if (const auto now = std::chrono::steady_clock::now(); now >= nextHousekeeping) {
+            _pool->poll();
+            _tcpPacketRouter->publishRoomUpdates();
+            nextHousekeeping = now + HousekeepingPeriod;
+        }
+    }
+}
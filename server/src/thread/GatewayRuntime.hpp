@@ -0,0 +1,85 @@
+/*
+** EPITECH PROJECT, 2025
+** RType
+** File description:
+** GatewayRuntime.hpp
+*/
+
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include "IServer.hpp"
+#include "SessionManager.hpp"
+#include "TCPPacketFactory.hpp"
+#include "TCPPacketRouter.hpp"
+#include "ThreadPlacement.hpp"
+#include "WorkerPool.hpp"
+
+namespace Net::Thread
+{
+    /**
+     * @brief The GatewayRuntime class runs the TCP lobby of a gateway, whose rooms live in game-worker processes.
+     * @details One thread serves the lobby and watches the workers; clients play over UDP on the
+     * port of the worker hosting their room, announced in WELCOME and ROOM_JOINED.
+     */
+    class GatewayRuntime {
+      public:
+        /**
+         * @brief Construct a Gateway Runtime and start its workers
+         * @param tcpServer A shared pointer to the TCP server instance
+         * @param workers Number of game workers
+         * @param spawner Starts a game worker
+         * @throws Gateway::ControlError if a worker cannot be started
+         */
+        GatewayRuntime(const std::shared_ptr<Server::IServer> &tcpServer, std::size_t workers,
+            Gateway::WorkerPool::Spawner spawner);
+
+        /**
+         * @brief Destroy the Gateway Runtime object, stopping the workers
+         */
+        ~GatewayRuntime();
+
+        /**
+         * @brief Wait for the gateway to stop
+         */
+        void wait();
+
+        /**
+         * @brief Start the gateway runtime
+         */
+        void start();
+
+        /**
+         * @brief Stop the gateway runtime and its workers
+         */
+        void stop();
+
+        /**
+         * @brief Set the CPUs the lobby's thread runs on, named tcp-0 either way; call before start()
+         * @param placement The placement rules, or nullptr for the thread to float
+         */
+        void setPlacement(std::shared_ptr<const Utils::ThreadPlacement> placement);
+
+      private:
+        /**
+         * @brief Thread function to handle TCP packets and watch the workers
+         */
+        void runTcp() const;
+
+        std::shared_ptr<Server::IServer> _tcpServer;                  ///> The TCP server instance
+        std::shared_ptr<Server::ISessionManager> _sessionManager;     ///> Lobby sessions
+        std::shared_ptr<Gateway::WorkerPool> _pool;                   ///> The game workers and their rooms
+        std::shared_ptr<Factory::TCPPacketFactory> _tcpPacketFactory; ///> Builds outgoing TCP packets
+        std::shared_ptr<TCPPacketRouter> _tcpPacketRouter;            ///> Routes incoming TCP packets
+        std::thread _tcpThread;                                       ///> Thread for handling TCP packets
+        std::shared_ptr<const Utils::ThreadPlacement> _placement =
+            std::make_shared<const Utils::ThreadPlacement>(); ///> CPUs of the lobby's thread, floating by default
+
+        std::mutex _mutex;                       ///> Mutex for synchronizing access
+        std::condition_variable _cv;             ///> Condition variable for signaling
+        std::atomic<bool> _stopRequested{false}; ///> Flag to indicate if a stop has been requested
+    };
+} // namespace Net::Thread
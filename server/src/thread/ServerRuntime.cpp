@@ -6,26 +6,44 @@
 */
 
 #include "ServerRuntime.hpp"
+#include <algorithm>
+#include "Log.hpp"
 
 using namespace Net::Thread;
 
-ServerRuntime::ServerRuntime(
-    const std::shared_ptr<Server::IServer> &udpServer, const std::shared_ptr<Server::IServer> &tcpServer)
-    : _udpServer(udpServer), _tcpServer(tcpServer)
+ServerRuntime::ServerRuntime(const std::shared_ptr<Server::IServer> &udpServer,
+    const std::shared_ptr<Server::IServer> &tcpServer, const std::string &recordDir)
+    : ServerRuntime(std::vector{udpServer}, tcpServer, recordDir)
 {
-    if (!_udpServer)
+}
+
+ServerRuntime::ServerRuntime(const std::vector<std::shared_ptr<Server::IServer>> &udpServers,
+    const std::shared_ptr<Server::IServer> &tcpServer, const std::string &recordDir)
+    : _udpServers(udpServers), _tcpServer(tcpServer)
+{
+    if (_udpServers.empty() || std::ranges::find(_udpServers, nullptr) != _udpServers.end())
         throw ThreadError("{ServerRuntime::ServerRuntime} Invalid UDP server pointer");
-    if (!_tcpServer)
-        throw ThreadError("{ServerRuntime::ServerRuntime} Invalid TCP server pointer");
+    _udpServer = _udpServers.front();
     _udpPacketFactory = std::make_shared<Factory::UDPPacketFactory>(std::make_shared<UDPPacket>());
-    _sessionManager = std::make_shared<Server::SessionManager>();
-    _roomManager =
-        std::make_shared<Engine::RoomManager>(_sessionManager, _udpServer, _udpPacketFactory, "levels/level1.json");
-
-    _udpPacketRouter = std::make_shared<UDPPacketRouter>(_sessionManager, _roomManager);
-
-    _tcpPacketFactory = std::make_shared<Factory::TCPPacketFactory>(std::make_shared<TCPPacket>());
-    _tcpPacketRouter = std::make_shared<TCPPacketRouter>(_sessionManager, _roomManager, _tcpServer, _tcpPacketFactory);
+    _batchServer = std::make_shared<Server::BatchServer>(_udpServer, std::make_shared<UDPPacket>());
+    _reliableServer = std::make_shared<Server::ReliableServer>(_batchServer, std::make_shared<UDPPacket>());
+    _sessionManager = std::make_shared<Server::ShardedSessionManager>(_udpServers.size());
+    _admission = std::make_shared<Server::Admission>();
+    for (std::size_t i = 0; i < _udpServers.size(); i++)
+        _inboundSchedulers.push_back(std::make_shared<Server::InboundScheduler>(_sessionManager));
+    _roomManager = std::make_shared<Engine::RoomManager>(
+        _sessionManager, _reliableServer, _udpPacketFactory, "levels/level1.json", recordDir);
+    _roomManager->setMaxRooms(_admission->limits().maxRooms);
+    _roomManager->setPlacement(_placement);
+
+    _udpPacketRouter = std::make_shared<UDPPacketRouter>(
+        _sessionManager, _roomManager, _reliableServer, _admission, _udpPacketFactory);
+
+    if (_tcpServer) {
+        _tcpPacketFactory = std::make_shared<Factory::TCPPacketFactory>(std::make_shared<TCPPacket>());
+        _tcpPacketRouter =
+            std::make_shared<TCPPacketRouter>(_sessionManager, _roomManager, _tcpServer, _tcpPacketFactory);
+    }
     _stopRequested.store(false);
 }
 
@@ -35,31 +53,60 @@ ServerRuntime::~ServerRuntime()
         if (!_stopRequested.load())
             stop();
     } catch (...) {
-        std::cerr << "{ServerRuntime::~ServerRuntime} Exception during destruction" << std::endl;
+        Log::error("ServerRuntime::~ServerRuntime", "exception during destruction");
     }
 }
 
+void ServerRuntime::setJobThreads(const std::size_t threads)
+{
+    _roomManager->setJobSystem(threads > 1 ? std::make_shared<Ecs::JobSystem>(threads) : nullptr);
+}
+
+void ServerRuntime::setUdpPort(const std::uint16_t port) const noexcept
+{
+    if (_tcpPacketRouter)
+        _tcpPacketRouter->setUdpPort(port);
+}
+
+void ServerRuntime::setControlChannel(std::shared_ptr<Gateway::ControlChannel> channel, const std::uint16_t udpPort)
+{
+    _roomManager->setSeatsOnly(true);
+    _agent = std::make_unique<Gateway::WorkerAgent>(std::move(channel), _roomManager, udpPort);
+}
+
+void ServerRuntime::setPlacement(std::shared_ptr<const Utils::ThreadPlacement> placement)
+{
+    _placement = placement ? std::move(placement) : std::make_shared<const Utils::ThreadPlacement>();
+    _roomManager->setPlacement(_placement);
+}
+
 void ServerRuntime::wait()
 {
     std::unique_lock lock(_mutex);
     _cv.wait(lock, [this]() {
-        return _stopRequested.load();
+        return _stopRequested.load() || _orphaned.load();
     });
 }
 
 void ServerRuntime::start()
 {
     try {
-        _udpServer->start();
-        _tcpServer->start();
+        for (const auto &udpServer : _udpServers)
+            udpServer->start();
+        if (_tcpServer)
+            _tcpServer->start();
     } catch (std::exception &e) {
         throw ThreadError(std::string("{ServerRuntime::start} Failed to start server: ") + e.what());
     }
     _running = true;
-    _receiverThread = std::thread(&ServerRuntime::runReceiver, this);
-    _processorThread = std::thread(&ServerRuntime::runProcessor, this);
-    _snapshotThread = std::thread(&ServerRuntime::runSnapshot, this);
-    _tcpThread = std::thread(&ServerRuntime::runTcp, this);
+    for (std::size_t i = 0; i < _udpServers.size(); i++) {
+        _receiverThreads.emplace_back(&ServerRuntime::runReceiver, this, i);
+        _processorThreads.emplace_back(&ServerRuntime::runProcessor, this, i);
+    }
+    if (_tcpServer)
+        _tcpThread = std::thread(&ServerRuntime::runTcp, this);
+    if (_agent)
+        _controlThread = std::thread(&ServerRuntime::runControl, this);
 }
 
 void ServerRuntime::stop()
@@ -71,77 +118,121 @@ void ServerRuntime::stop()
     }
     _cv.notify_all();
 
-    _udpServer->setRunning(false);
-    _tcpServer->setRunning(false);
+    for (const auto &udpServer : _udpServers)
+        udpServer->setRunning(false);
+    if (_tcpServer)
+        _tcpServer->setRunning(false);
     _roomManager->forEachRoom([](Engine::Room &room) {
         room.stop();
     });
-    if (_snapshotThread.joinable())
-        _snapshotThread.join();
-    if (_receiverThread.joinable())
-        _receiverThread.join();
-    if (_processorThread.joinable())
-        _processorThread.join();
+    for (auto &thread : _receiverThreads)
+        if (thread.joinable())
+            thread.join();
+    for (auto &thread : _processorThreads)
+        if (thread.joinable())
+            thread.join();
     if (_tcpThread.joinable())
         _tcpThread.join();
-    _tcpServer->stop();
-    _udpServer->stop();
+    if (_controlThread.joinable())
+        _controlThread.join();
+    if (_tcpServer)
+        _tcpServer->stop();
+    for (const auto &udpServer : _udpServers)
+        udpServer->stop();
 }
 
-void ServerRuntime::runReceiver() const
+void ServerRuntime::runReceiver(const std::size_t shard) const
 {
-    while (_udpServer->isRunning()) {
-        _udpServer->readPackets();
-    }
-}
+    const auto &udpServer = _udpServers[shard];
 
-void ServerRuntime::runProcessor() const
-{
-    while (_udpServer->isRunning()) {
-        if (std::shared_ptr<IPacket> pkt = nullptr; _udpServer->popPacket(pkt)) {
-            _udpPacketRouter->handlePacket(pkt);
-        }
+    _placement->apply("receiver", shard);
+    while (udpServer->isRunning()) {
+        udpServer->readPackets();
     }
 }
 
-void ServerRuntime::runSnapshot() const
+void ServerRuntime::runProcessor(const std::size_t shard) const
 {
-    using clock = std::chrono::steady_clock;
-    constexpr auto Tick = std::chrono::milliseconds(50);
-    auto nextTick = clock::now();
-    std::vector<SnapshotEntity> entities;
-
-    while (_running) {
-        std::this_thread::sleep_until(nextTick);
-        nextTick += Tick;
-
-        _roomManager->forEachRoom([&](const Engine::Room &room) {
-            entities.clear();
-            room.gameServer().buildSnapshot(entities);
-
-            if (entities.empty())
-                return;
-
-            if (const auto basePacket = _udpPacketFactory->createSnapshotPacket(entities)) {
-                for (const int sessionId : room.sessions()) {
-                    if (const sockaddr_in *addr = _sessionManager->getAddress(sessionId)) {
-                        basePacket->setAddress(*addr);
-                        _udpServer->sendPacket(*basePacket);
-                    }
-                }
-            }
-        });
-
-        if (auto now = clock::now(); now > nextTick + Tick)
-            nextTick = now;
+    const auto &udpServer = _udpServers[shard];
+    const auto &scheduler = _inboundSchedulers[shard];
+    const bool housekeeping = shard == 0;
+    constexpr auto ResendPeriod = std::chrono::milliseconds(5);
+    constexpr auto FlushPeriod = std::chrono::milliseconds(16);
+    constexpr auto PrunePeriod = std::chrono::seconds(1);
+    constexpr std::size_t ReadBudget = 256;
+    constexpr std::size_t DrainBudget = 256;
+    auto nextResend = std::chrono::steady_clock::now();
+    auto nextFlush = nextResend;
+    auto nextPrune = nextResend;
+    auto nextPeerPrune = nextResend;
+    const auto route = [this](const std::shared_ptr<IPacket> &pkt) {
+        _udpPacketRouter->handlePacket(pkt);
+    };
+    const auto unserved = [this](const sockaddr_in &addr) {
+        const int sessionId = _sessionManager->getSessionId(addr);
+        return sessionId < 0 || _roomManager->getRoomIdOfPlayer(sessionId) == 0;
+    };
+
+    _placement->apply("processor", shard);
+    while (udpServer->isRunning()) {
+        const auto received = std::chrono::steady_clock::now();
+        std::shared_ptr<IPacket> pkt = nullptr;
+        for (std::size_t i = 0; i < ReadBudget && udpServer->popPacket(pkt); i++)
+            scheduler->enqueue(pkt, received);
+        scheduler->drain(route, DrainBudget);
+
+        if (const auto now = std::chrono::steady_clock::now(); now >= nextPrune) {
+            scheduler->prune();
+            nextPrune = now + PrunePeriod;
+        }
+        if (!housekeeping)
+            continue;
+        if (const auto now = std::chrono::steady_clock::now(); now >= nextResend) {
+            _reliableServer->resendExpired();
+            nextResend = now + ResendPeriod;
+        }
+        if (const auto now = std::chrono::steady_clock::now(); now >= nextFlush) {
+            _batchServer->flush();
+            nextFlush = now + FlushPeriod;
+        }
+        if (const auto now = std::chrono::steady_clock::now(); now >= nextPeerPrune) {
+            _reliableServer->prunePeers(unserved);
+            nextPeerPrune = now + PrunePeriod;
+        }
     }
 }
 
 void ServerRuntime::runTcp() const
 {
+    constexpr auto RoomUpdatePeriod = std::chrono::milliseconds(100);
+    auto nextRoomUpdate = std::chrono::steady_clock::now();
+
+    _placement->apply("tcp", 0);
     while (_tcpServer->isRunning()) {
         _tcpServer->readPackets();
         if (std::shared_ptr<IPacket> pkt = nullptr; _tcpServer->popPacket(pkt))
             _tcpPacketRouter->handle(pkt);
+        if (const auto now = std::chrono::steady_clock::now(); now >= nextRoomUpdate) {
+            _tcpPacketRouter->publishRoomUpdates();
+            nextRoomUpdate = now + RoomUpdatePeriod;
+        }
+    }
+}
+
+void ServerRuntime::runControl()
+{
+    constexpr auto PollPeriod = std::chrono::milliseconds(50);
+
+    _placement->apply("control", 0);
+    while (_running.load()) {
+        if (_agent->poll(PollPeriod))
+            continue;
+        Log::info("ServerRuntime::runControl", "gateway gone or asked to stop");
+        {
+            std::scoped_lock lock(_mutex);
+            _orphaned.store(true);
+        }
+        _cv.notify_all();
+        return;
     }
 }
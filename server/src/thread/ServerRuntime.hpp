@@ -10,18 +10,25 @@
 #include <iostream>
 #include <memory>
 #include <thread>
+#include "Admission.hpp"
+#include "BatchServer.hpp"
 #include "GameServer.hpp"
 #include "IServer.hpp"
+#include "InboundScheduler.hpp"
+#include "ReliableServer.hpp"
 #include "RoomManager.hpp"
 #include "SessionManager.hpp"
-#include "SnapshotSystem.hpp"
+#include "ShardedSessionManager.hpp"
 #include "TCPPacket.hpp"
 #include "TCPPacketFactory.hpp"
 #include "TCPPacketRouter.hpp"
+#include "ThreadPlacement.hpp"
 #include "UDPPacket.hpp"
 #include "UDPPacketFactory.hpp"
 #include "UDPPacketRouter.hpp"
+#include "WorkerAgent.hpp"
 #include <condition_variable>
+#include <vector>
 
 namespace Net::Thread
 {
@@ -61,10 +68,24 @@ namespace Net::Thread
         /**
          * @brief Construct a new Server Runtime object
          * @param udpServer A shared pointer to the UDP server instance
-         * @param tcpServer A shared pointer to the TCP server instance
+         * @param tcpServer A shared pointer to the TCP server instance, or nullptr for a game worker
+         * @param recordDir Directory where rooms record their commands (empty to disable)
          */
-        explicit ServerRuntime(
-            const std::shared_ptr<Server::IServer> &udpServer, const std::shared_ptr<Server::IServer> &tcpServer);
+        explicit ServerRuntime(const std::shared_ptr<Server::IServer> &udpServer,
+            const std::shared_ptr<Server::IServer> &tcpServer, const std::string &recordDir = "");
+
+        /**
+         * @brief Construct a Server Runtime receiving on several UDP sockets bound to the same port
+         * @details Each socket gets its own receive and processing threads and its own
+         * InboundScheduler; sessions are sharded the same number of ways. Outgoing packets
+         * all leave through the first socket.
+         * @param udpServers The UDP servers, at least one, configured with SO_REUSEPORT if more than one
+         * @param tcpServer A shared pointer to the TCP server instance, or nullptr for a game worker
+         * whose lobby runs in the gateway
+         * @param recordDir Directory where rooms record their commands (empty to disable)
+         */
+        ServerRuntime(const std::vector<std::shared_ptr<Server::IServer>> &udpServers,
+            const std::shared_ptr<Server::IServer> &tcpServer, const std::string &recordDir = "");
 
         /**
          * @brief Destroy the Server Runtime object
@@ -88,46 +109,88 @@ namespace Net::Thread
          */
         void stop();
 
+        /**
+         * @brief Share a pool of threads between the rooms to run their systems in parallel chunks
+         * @param threads Threads of the pool, the room's own included; 1 or less keeps the systems serial
+         */
+        void setJobThreads(std::size_t threads);
+
+        /**
+         * @brief Set the UDP port the TCP lobby announces to its clients
+         * @param port The game port of this process
+         */
+        void setUdpPort(std::uint16_t port) const noexcept;
+
+        /**
+         * @brief Take the rooms' orders from a gateway; call before start()
+         * @details wait() also returns once the gateway is gone or asks the worker to stop.
+         * @param channel The worker's end of the control channel
+         * @param udpPort The game port of this process, reported to the gateway
+         */
+        void setControlChannel(std::shared_ptr<Gateway::ControlChannel> channel, std::uint16_t udpPort);
+
+        /**
+         * @brief Set the CPUs the server's threads and rooms run on; call before start()
+         * @details Threads are named after their role either way: receiver-<shard>, processor-<shard>,
+         * tcp-0, control-0 and room-<id>.
+         * @param placement The placement rules, or nullptr for every thread to float
+         */
+        void setPlacement(std::shared_ptr<const Utils::ThreadPlacement> placement);
+
       private:
         /**
          * @brief Thread function to handle receiving packets
+         * @param shard Index of the UDP server to read from
          */
-        void runReceiver() const;
+        void runReceiver(std::size_t shard) const;
 
         /**
          * @brief Thread function to handle processing packets
+         * @details The first shard's thread also resends reliable messages and flushes batches.
+         * @param shard Index of the UDP server whose packets are processed
          */
-        void runProcessor() const;
+        void runProcessor(std::size_t shard) const;
 
         /**
-         * @brief Thread function to handle taking snapshots of the game state
+         * @brief Thread function to handle TCP connections and packets
          */
-        void runSnapshot() const;
+        void runTcp() const;
 
         /**
-         * @brief Thread function to handle TCP connections and packets
+         * @brief Thread function running the gateway's requests
          */
-        void runTcp() const;
+        void runControl();
 
-        std::shared_ptr<Server::IServer> _udpServer;       ///> The server instance
-        std::shared_ptr<UDPPacketRouter> _udpPacketRouter; ///> Routes incoming packets to appropriate handlers
+        std::vector<std::shared_ptr<Server::IServer>> _udpServers;    ///> Sockets sharing the game port
+        std::shared_ptr<Server::IServer> _udpServer;                  ///> The first UDP server, which also sends
+        std::shared_ptr<Server::BatchServer> _batchServer;            ///> Coalesces each client's packets per tick
+        std::shared_ptr<Server::ReliableServer> _reliableServer;      ///> Reliable channels on top of _batchServer
+        std::shared_ptr<UDPPacketRouter> _udpPacketRouter;            ///> Routes incoming packets to appropriate handlers
         std::shared_ptr<Factory::UDPPacketFactory> _udpPacketFactory; ///> Builds outgoing packets.
 
-        std::shared_ptr<Server::IServer> _tcpServer;       ///> The TCP server instance
-        std::shared_ptr<TCPPacketRouter> _tcpPacketRouter; ///> Routes incoming TCP packets to appropriate handlers
+        std::shared_ptr<Server::IServer> _tcpServer;                  ///> The TCP server instance
+        std::shared_ptr<TCPPacketRouter> _tcpPacketRouter;            ///> Routes incoming TCP packets to appropriate handlers
         std::shared_ptr<Factory::TCPPacketFactory> _tcpPacketFactory; ///> Builds outgoing TCP packets.
 
         std::shared_ptr<Server::ISessionManager> _sessionManager; ///> Manages client sessions
         std::shared_ptr<Engine::RoomManager> _roomManager;        ///> Manages game rooms
+        std::shared_ptr<Server::Admission> _admission;            ///> Cookie check and limits for new clients
+        std::vector<std::shared_ptr<Server::InboundScheduler>>
+            _inboundSchedulers; ///> Rate limits and fair routing order, one per UDP server
+
+        std::vector<std::thread> _receiverThreads;  ///> Threads receiving packets, one per UDP server
+        std::vector<std::thread> _processorThreads; ///> Threads processing packets, one per UDP server
+        std::thread _tcpThread;                     ///> Thread for handling TCP packets
+        std::thread _controlThread;                 ///> Thread running the gateway's requests
 
-        std::thread _receiverThread;  ///> Thread for receiving packets
-        std::thread _processorThread; ///> Thread for processing packets
-        std::thread _snapshotThread;  ///> Thread for handling snapshots
-        std::thread _tcpThread;       ///> Thread for handling TCP packets
+        std::unique_ptr<Gateway::WorkerAgent> _agent = nullptr; ///> Runs the gateway's requests, null unless a worker
+        std::shared_ptr<const Utils::ThreadPlacement> _placement =
+            std::make_shared<const Utils::ThreadPlacement>(); ///> CPUs of the threads, floating by default
 
         std::mutex _mutex;                       ///> Mutex for synchronizing access
         std::condition_variable _cv;             ///> Condition variable for signaling
         std::atomic<bool> _stopRequested{false}; ///> Flag to indicate if a stop has been requested
         std::atomic<bool> _running{false};       ///> Atomic flag to indicate if the server is running
+        std::atomic<bool> _orphaned{false};      ///> The gateway is gone or asked the worker to stop
     };
 } // namespace Net::Thread
\ No newline at end of file
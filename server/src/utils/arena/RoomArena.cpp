@@ -0,0 +1,66 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** RoomArena
+*/
+
+#include "RoomArena.hpp"
+
+namespace Utils
+{
+    RoomArena::RoomArena()
+        : _frameBuffer(std::make_unique<std::byte[]>(FRAME_BYTES)), _pool(&_heap),
+          _frame(_frameBuffer.get(), FRAME_BYTES, &_heap)
+    {
+        _heap.bytes.fetch_add(FRAME_BYTES, std::memory_order_relaxed);
+        _heap.peak.store(_heap.bytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+
+    std::pmr::memory_resource *RoomArena::longLived() noexcept
+    {
+        return &_pool;
+    }
+
+    std::pmr::memory_resource *RoomArena::frame() noexcept
+    {
+        return &_frame;
+    }
+
+    void RoomArena::endFrame() noexcept
+    {
+        _frame.release();
+    }
+
+    std::size_t RoomArena::heapBytes() const noexcept
+    {
+        return _heap.bytes.load(std::memory_order_relaxed);
+    }
+
+    std::size_t RoomArena::peakHeapBytes() const noexcept
+    {
+        return _heap.peak.load(std::memory_order_relaxed);
+    }
+
+    void *RoomArena::CountingResource::do_allocate(const std::size_t size, const std::size_t alignment)
+    {
+        void *ptr = std::pmr::new_delete_resource()->allocate(size, alignment);
+        const std::size_t now = bytes.fetch_add(size, std::memory_order_relaxed) + size;
+        std::size_t high = peak.load(std::memory_order_relaxed);
+
+        while (now > high && !peak.compare_exchange_weak(high, now, std::memory_order_relaxed))
+            continue;
+        return ptr;
+    }
+
+    void RoomArena::CountingResource::do_deallocate(void *ptr, const std::size_t size, const std::size_t alignment)
+    {
+        std::pmr::new_delete_resource()->deallocate(ptr, size, alignment);
+        bytes.fetch_sub(size, std::memory_order_relaxed);
+    }
+
+    bool RoomArena::CountingResource::do_is_equal(const std::pmr::memory_resource &other) const noexcept
+    {
+        return this == &other;
+    }
+} // namespace Utils
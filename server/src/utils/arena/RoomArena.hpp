@@ -0,0 +1,88 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** RoomArena
+*/
+
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+
+namespace Utils
+{
+    /**
+     * @class RoomArena
+     * @brief Memory resources owned by one room, so that rooms do not contend in the global heap.
+     * @details Two resources share a counting upstream on the global heap:
+     * - longLived(), a pool for the room's world: component arrays, event queues;
+     * - frame(), a monotonic arena for what lives one step, like events, emptied by endFrame().
+     * Everything goes back to the heap at once when the arena is destroyed, after the world.
+     * Owned by the room's thread; only the counters may be read from other threads.
+     */
+    class RoomArena {
+      public:
+        static constexpr std::size_t FRAME_BYTES = 64 * 1024; ///> Frame buffer reused every step
+
+        /**
+         * @brief Allocates the frame buffer.
+         */
+        RoomArena();
+
+        RoomArena(const RoomArena &) = delete;
+        RoomArena &operator=(const RoomArena &) = delete;
+
+        /**
+         * @brief Gets the pool holding the room's long-lived allocations.
+         * @return The pool resource, valid as long as the arena.
+         */
+        [[nodiscard]] std::pmr::memory_resource *longLived() noexcept;
+
+        /**
+         * @brief Gets the arena holding the allocations of the current step.
+         * @return The monotonic resource, valid as long as the arena.
+         */
+        [[nodiscard]] std::pmr::memory_resource *frame() noexcept;
+
+        /**
+         * @brief Frees every allocation of the current step at once, keeping the frame buffer.
+         * Call only once nothing allocated from frame() is alive.
+         */
+        void endFrame() noexcept;
+
+        /**
+         * @brief Gets the memory the room currently holds from the global heap.
+         * @return Bytes allocated from the heap and not yet given back.
+         */
+        [[nodiscard]] std::size_t heapBytes() const noexcept;
+
+        /**
+         * @brief Gets the most memory the room ever held from the global heap.
+         * @return Bytes at the high-water mark.
+         */
+        [[nodiscard]] std::size_t peakHeapBytes() const noexcept;
+
+      private:
+        /**
+         * @class CountingResource
+         * @brief Forwards to the global heap and counts the bytes it holds.
+         */
+        class CountingResource final : public std::pmr::memory_resource {
+          public:
+            std::atomic<std::size_t> bytes{0}; ///> Bytes currently allocated
+            std::atomic<std::size_t> peak{0};  ///> Highest value of bytes
+
+          private:
+            void *do_allocate(std::size_t size, std::size_t alignment) override;
+            void do_deallocate(void *ptr, std::size_t size, std::size_t alignment) override;
+            [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override;
+        };
+
+        CountingResource _heap;                       ///> Upstream of both resources
+        std::unique_ptr<std::byte[]> _frameBuffer;    ///> Initial buffer of _frame, kept across steps
+        std::pmr::unsynchronized_pool_resource _pool; ///> Long-lived allocations
+        std::pmr::monotonic_buffer_resource _frame;   ///> Allocations of the current step
+    };
+} // namespace Utils
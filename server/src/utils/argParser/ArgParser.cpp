@@ -6,6 +6,7 @@
 */
 
 #include "ArgParser.hpp"
+#include "Log.hpp"
 
 using namespace Utils;
 
@@ -35,7 +36,54 @@ ArgParseResult ArgParser::parse() noexcept
             continue;
         }
 
-        std::cerr << "{ArgParser}: Unknown argument: " << arg << std::endl;
+        if (arg == "--record") {
+            if (i + 1 >= _argc || !parseRecordDir(_argv[++i]))
+                return ArgParseResult::Error;
+            continue;
+        }
+
+        if (arg == "--udp-shards") {
+            if (i + 1 >= _argc || !parseUdpShards(_argv[++i]))
+                return ArgParseResult::Error;
+            continue;
+        }
+
+        if (arg == "--jobs") {
+            if (i + 1 >= _argc || !parseJobThreads(_argv[++i]))
+                return ArgParseResult::Error;
+            continue;
+        }
+
+        if (arg == "--workers") {
+            if (i + 1 >= _argc || !parseWorkers(_argv[++i]))
+                return ArgParseResult::Error;
+            continue;
+        }
+
+        if (arg == "--worker-fd") {
+            if (i + 1 >= _argc || !parseWorkerFd(_argv[++i]))
+                return ArgParseResult::Error;
+            continue;
+        }
+
+        if (arg == "--pin") {
+            if (i + 1 >= _argc || !parsePin(_argv[++i]))
+                return ArgParseResult::Error;
+            continue;
+        }
+
+        if (arg == "--placement") {
+            if (i + 1 >= _argc || !parsePlacement(_argv[++i]))
+                return ArgParseResult::Error;
+            continue;
+        }
+
+        if (arg == "--numa") {
+            _placement.setNuma(true);
+            continue;
+        }
+
+        Log::error("ArgParser::parse", "unknown argument", {{"arg", arg}});
         return ArgParseResult::Error;
     }
     return ArgParseResult::Success;
@@ -51,13 +99,52 @@ const std::string &ArgParser::getHost() const noexcept
     return _host;
 }
 
+const std::string &ArgParser::getRecordDir() const noexcept
+{
+    return _recordDir;
+}
+
+std::size_t ArgParser::getUdpShards() const noexcept
+{
+    return _udpShards;
+}
+
+std::size_t ArgParser::getJobThreads() const noexcept
+{
+    return _jobThreads;
+}
+
+std::size_t ArgParser::getWorkers() const noexcept
+{
+    return _workers;
+}
+
+int ArgParser::getWorkerFd() const noexcept
+{
+    return _workerFd;
+}
+
+const ThreadPlacement &ArgParser::getPlacement() const noexcept
+{
+    return _placement;
+}
+
 void ArgParser::displayHelp() const noexcept
 {
     std::cout << "[USAGE]: " << _argv[0] << "\n\n"
               << "Options:\n"
-              << "  --host <ip>     Server IP address (default: 127.0.0.1)\n"
-              << "  --port <port>   Server port (default: 8080)\n"
-              << "  -h, --help      Display this help message\n";
+              << "  --host <ip>      Server IP address (default: 127.0.0.1)\n"
+              << "  --port <port>    Server port (default: 8080)\n"
+              << "  --record <dir>   Record every room's commands into <dir> for replay\n"
+              << "  --udp-shards <n> Receive on <n> UDP sockets sharing the port (SO_REUSEPORT, default: 1)\n"
+              << "  --jobs <n>       Run the systems of every room on a pool of <n> threads (default: 1)\n"
+              << "  --workers <n>    Serve the lobby only and host the rooms in <n> game-worker processes,\n"
+              << "                   worker i playing on UDP port <port> + 1 + i (default: 0, rooms hosted here)\n"
+              << "  --pin <rule>     Pin threads to CPUs, as <role>[.<index>]=<cpus> with role receiver, processor,\n"
+              << "                   tcp, control or room, like room=4-7 or receiver.1=2 (repeatable)\n"
+              << "  --placement <f>  Read --pin rules from file <f>, one per line, and numa = on|off\n"
+              << "  --numa           Have pinned threads allocate from the memory node of their first CPU\n"
+              << "  -h, --help       Display this help message\n";
 }
 
 bool ArgParser::parsePort(const std::string &value) noexcept
@@ -66,13 +153,124 @@ bool ArgParser::parsePort(const std::string &value) noexcept
         const int port = std::stoi(value);
 
         if (port <= 0 || port > 65535) {
-            std::cerr << "{ArgParser}: Port number must be between 1 and 65535." << std::endl;
+            Log::error("ArgParser::parsePort", "port number must be between 1 and 65535", {{"port", port}});
             return false;
         }
         _port = port;
         return true;
     } catch (...) {
-        std::cerr << "{ArgParser}: Invalid port number." << std::endl;
+        Log::error("ArgParser::parsePort", "invalid port number", {{"value", value}});
+        return false;
+    }
+}
+
+bool ArgParser::parseRecordDir(const std::string &value) noexcept
+{
+    std::error_code ec;
+
+    if (value.empty() || !std::filesystem::is_directory(value, ec)) {
+        Log::error("ArgParser::parseRecordDir", "record directory does not exist", {{"path", value}});
+        return false;
+    }
+    _recordDir = value;
+    return true;
+}
+
+bool ArgParser::parseUdpShards(const std::string &value) noexcept
+{
+    try {
+        const int shards = std::stoi(value);
+
+        if (shards < 1 || shards > MAX_UDP_SHARDS) {
+            Log::error("ArgParser::parseUdpShards", "invalid number of UDP shards",
+                {{"shards", shards}, {"max", MAX_UDP_SHARDS}});
+            return false;
+        }
+        _udpShards = static_cast<std::size_t>(shards);
+        return true;
+    } catch (...) {
+        Log::error("ArgParser::parseUdpShards", "invalid number of UDP shards", {{"value", value}});
+        return false;
+    }
+}
+
+bool ArgParser::parseJobThreads(const std::string &value) noexcept
+{
+    try {
+        const int threads = std::stoi(value);
+
+        if (threads < 1 || threads > MAX_JOB_THREADS) {
+            Log::error("ArgParser::parseJobThreads", "invalid number of job threads",
+                {{"threads", threads}, {"max", MAX_JOB_THREADS}});
+            return false;
+        }
+        _jobThreads = static_cast<std::size_t>(threads);
+        return true;
+    } catch (...) {
+        Log::error("ArgParser::parseJobThreads", "invalid number of job threads", {{"value", value}});
+        return false;
+    }
+}
+
+bool ArgParser::parseWorkers(const std::string &value) noexcept
+{
+    try {
+        const int workers = std::stoi(value);
+
+        if (workers < 1 || workers > MAX_WORKERS) {
+            Log::error(
+                "ArgParser::parseWorkers", "invalid number of workers", {{"workers", workers}, {"max", MAX_WORKERS}});
+            return false;
+        }
+        _workers = static_cast<std::size_t>(workers);
+        return true;
+    } catch (...) {
+        Log::error("ArgParser::parseWorkers", "invalid number of workers", {{"value", value}});
+        return false;
+    }
+}
+
+bool ArgParser::parseWorkerFd(const std::string &value) noexcept
+{
+    try {
+        const int fd = std::stoi(value);
+
+        if (fd < 0) {
+            Log::error("ArgParser::parseWorkerFd", "invalid control channel", {{"fd", fd}});
+            return false;
+        }
+        _workerFd = fd;
+        return true;
+    } catch (...) {
+        Log::error("ArgParser::parseWorkerFd", "invalid control channel", {{"value", value}});
+        return false;
+    }
+}
+
+bool ArgParser::parsePin(const std::string &value) noexcept
+{
+    try {
+        _placement.pin(value);
+        return true;
+    } catch (const PlacementError &e) {
+        Log::error("ArgParser::parsePin", "invalid placement rule", {{"rule", value}, {"error", e.what()}});
+        return false;
+    } catch (...) {
+        Log::error("ArgParser::parsePin", "invalid placement rule", {{"rule", value}});
+        return false;
+    }
+}
+
+bool ArgParser::parsePlacement(const std::string &value) noexcept
+{
+    try {
+        _placement.load(value);
+        return true;
+    } catch (const PlacementError &e) {
+        Log::error("ArgParser::parsePlacement", "invalid placement file", {{"path", value}, {"error", e.what()}});
+        return false;
+    } catch (...) {
+        Log::error("ArgParser::parsePlacement", "invalid placement file", {{"path", value}});
         return false;
     }
 }
@@ -80,7 +278,7 @@ bool ArgParser::parsePort(const std::string &value) noexcept
 bool ArgParser::parseHost(const std::string &value) noexcept
 {
     if (value.empty()) {
-        std::cerr << "{ArgParser}: Invalid host value." << std::endl;
+        Log::error("ArgParser::parseHost", "invalid host value");
         return false;
     }
     _host = value;
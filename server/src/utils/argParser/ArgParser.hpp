@@ -1,7 +1,9 @@
 #pragma once
 
+#include <filesystem>
 #include <iostream>
 #include <string>
+#include "ThreadPlacement.hpp"
 
 namespace Utils
 {
@@ -74,6 +76,42 @@ namespace Utils
          */
         [[nodiscard]] const std::string &getHost() const noexcept;
 
+        /**
+         * @brief Gets the directory where room recordings are written.
+         * @return The record directory, empty when recording is disabled.
+         */
+        [[nodiscard]] const std::string &getRecordDir() const noexcept;
+
+        /**
+         * @brief Gets the number of UDP sockets sharing the game port.
+         * @return The number of UDP shards, 1 by default.
+         */
+        [[nodiscard]] std::size_t getUdpShards() const noexcept;
+
+        /**
+         * @brief Gets the number of threads the rooms run their systems on.
+         * @return The number of job threads, 1 by default.
+         */
+        [[nodiscard]] std::size_t getJobThreads() const noexcept;
+
+        /**
+         * @brief Gets the number of game-worker processes the rooms are spread over.
+         * @return The number of workers, 0 by default for rooms hosted by this process.
+         */
+        [[nodiscard]] std::size_t getWorkers() const noexcept;
+
+        /**
+         * @brief Gets the control channel a gateway gave this process when it started it as a worker.
+         * @return The descriptor, -1 when not a worker.
+         */
+        [[nodiscard]] int getWorkerFd() const noexcept;
+
+        /**
+         * @brief Gets the CPUs the server threads are pinned to.
+         * @return The placement rules, empty by default for threads floating over every CPU.
+         */
+        [[nodiscard]] const ThreadPlacement &getPlacement() const noexcept;
+
       private:
         /**
          * @brief Displays the help message.
@@ -94,10 +132,69 @@ namespace Utils
          */
         [[nodiscard]] bool parseHost(const std::string &value) noexcept;
 
+        /**
+         * @brief Parses the recording directory from a string.
+         * @param value The string representing an existing directory.
+         * @return True if parsing was successful, false otherwise.
+         */
+        [[nodiscard]] bool parseRecordDir(const std::string &value) noexcept;
+
+        /**
+         * @brief Parses the number of UDP shards from a string.
+         * @param value The string representing a number between 1 and MAX_UDP_SHARDS.
+         * @return True if parsing was successful, false otherwise.
+         */
+        [[nodiscard]] bool parseUdpShards(const std::string &value) noexcept;
+
+        /**
+         * @brief Parses the number of job threads from a string.
+         * @param value The string representing a number between 1 and MAX_JOB_THREADS.
+         * @return True if parsing was successful, false otherwise.
+         */
+        [[nodiscard]] bool parseJobThreads(const std::string &value) noexcept;
+
+        /**
+         * @brief Parses the number of game workers from a string.
+         * @param value The string representing a number between 1 and MAX_WORKERS.
+         * @return True if parsing was successful, false otherwise.
+         */
+        [[nodiscard]] bool parseWorkers(const std::string &value) noexcept;
+
+        /**
+         * @brief Parses the control channel descriptor from a string.
+         * @param value The string representing a descriptor.
+         * @return True if parsing was successful, false otherwise.
+         */
+        [[nodiscard]] bool parseWorkerFd(const std::string &value) noexcept;
+
+        /**
+         * @brief Parses a thread placement rule from a string.
+         * @param value The string representing a rule, like `room=4-7`.
+         * @return True if parsing was successful, false otherwise.
+         */
+        [[nodiscard]] bool parsePin(const std::string &value) noexcept;
+
+        /**
+         * @brief Reads the thread placement rules of a file.
+         * @param value The path of the file.
+         * @return True if parsing was successful, false otherwise.
+         */
+        [[nodiscard]] bool parsePlacement(const std::string &value) noexcept;
+
         int _argc;    ///> Number of command-line arguments
         char **_argv; ///> Array of command-line arguments
 
         std::string _host = "127.0.0.1"; ///> Default host address
         int _port = 8080;                ///> Default port number
+        std::string _recordDir;          ///> Recording directory, empty when disabled
+        std::size_t _udpShards = 1;      ///> Number of UDP sockets sharing the game port
+        std::size_t _jobThreads = 1;     ///> Number of threads running the rooms' systems
+        std::size_t _workers = 0;        ///> Number of game-worker processes, 0 to host the rooms
+        int _workerFd = -1;              ///> Control channel from the gateway, -1 when not a worker
+        ThreadPlacement _placement;      ///> CPUs the server threads are pinned to
+
+        static constexpr int MAX_UDP_SHARDS = 64;  ///> Upper bound of --udp-shards
+        static constexpr int MAX_JOB_THREADS = 64; ///> Upper bound of --jobs
+        static constexpr int MAX_WORKERS = 32;     ///> Upper bound of --workers
     };
 } // namespace Utils
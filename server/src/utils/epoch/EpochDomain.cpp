@@ -0,0 +1,51 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** EpochDomain
+*/
+
+#include "EpochDomain.hpp"
+#include <thread>
+
+namespace Utils
+{
+    EpochDomain::Guard::Guard(EpochDomain &domain) noexcept : _domain(domain), _slot(threadSlot())
+    {
+        if (_slot == MAX_THREADS) {
+            _domain._overflowReaders.fetch_add(1, std::memory_order_seq_cst);
+            return;
+        }
+        _domain._slots[_slot].epoch.store(_domain._epoch.load(std::memory_order_relaxed), std::memory_order_seq_cst);
+    }
+
+    EpochDomain::Guard::~Guard()
+    {
+        if (_slot == MAX_THREADS) {
+            _domain._overflowReaders.fetch_sub(1, std::memory_order_release);
+            return;
+        }
+        _domain._slots[_slot].epoch.store(0, std::memory_order_release);
+    }
+
+    void EpochDomain::synchronize() noexcept
+    {
+        const std::uint64_t target = _epoch.fetch_add(1, std::memory_order_seq_cst) + 1;
+
+        for (const auto &slot : _slots) {
+            for (std::uint64_t epoch = slot.epoch.load(std::memory_order_seq_cst); epoch != 0 && epoch < target;
+                epoch = slot.epoch.load(std::memory_order_seq_cst))
+                std::this_thread::yield();
+        }
+        while (_overflowReaders.load(std::memory_order_seq_cst) != 0)
+            std::this_thread::yield();
+    }
+
+    std::size_t EpochDomain::threadSlot() noexcept
+    {
+        static std::atomic<std::size_t> nextSlot{0};
+        thread_local const std::size_t slot = nextSlot.fetch_add(1, std::memory_order_relaxed);
+
+        return slot < MAX_THREADS ? slot : MAX_THREADS;
+    }
+} // namespace Utils
@@ -0,0 +1,77 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** EpochDomain
+*/
+
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace Utils
+{
+    /**
+     * @class EpochDomain
+     * @brief Epoch-based protection of data read without locks.
+     * @details Readers wrap each access in a Guard, which only publishes the current epoch in
+     * a per-thread slot. A writer that unlinked an object calls synchronize(), which starts a
+     * new epoch and waits until no reader is still in an older one; the object can then be
+     * freed. Reads are thus wait-free and writes pay for the grace period.
+     * Guards do not nest, and a thread must not call synchronize() while holding a Guard.
+     */
+    class EpochDomain {
+      public:
+        static constexpr std::size_t MAX_THREADS = 256; ///> Threads with their own slot, others share a counter
+
+        /**
+         * @class Guard
+         * @brief Marks the calling thread as reading until destroyed.
+         */
+        class Guard {
+          public:
+            /**
+             * @brief Enters a read-side critical section.
+             * @param domain The domain protecting the data about to be read.
+             */
+            explicit Guard(EpochDomain &domain) noexcept;
+
+            /**
+             * @brief Leaves the read-side critical section.
+             */
+            ~Guard();
+
+            Guard(const Guard &) = delete;
+            Guard &operator=(const Guard &) = delete;
+
+          private:
+            EpochDomain &_domain; ///> Domain entered
+            std::size_t _slot;    ///> Slot of the calling thread, MAX_THREADS for the shared counter
+        };
+
+        /**
+         * @brief Waits until every Guard created before the call is destroyed.
+         */
+        void synchronize() noexcept;
+
+      private:
+        /**
+         * @brief Epoch published by one thread, cache-line aligned to avoid false sharing.
+         */
+        struct alignas(64) Slot {
+            std::atomic<std::uint64_t> epoch{0}; ///> Epoch the thread reads in, 0 when idle
+        };
+
+        /**
+         * @brief Gets the slot index of the calling thread, assigned on first use.
+         * @return The index, or MAX_THREADS if every slot is taken.
+         */
+        [[nodiscard]] static std::size_t threadSlot() noexcept;
+
+        std::atomic<std::uint64_t> _epoch{1};           ///> Current epoch
+        std::array<Slot, MAX_THREADS> _slots{};         ///> Per-thread published epochs
+        std::atomic<std::uint64_t> _overflowReaders{0}; ///> Readers without a slot
+    };
+} // namespace Utils
@@ -0,0 +1,217 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** ThreadPlacement
+*/
+
+#include "ThreadPlacement.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <filesystem>
+#include <fstream>
+#include "Log.hpp"
+
+#ifdef __linux__
+    #include <linux/mempolicy.h>
+    #include <pthread.h>
+    #include <sched.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
+namespace
+{
+    /**
+     * @brief Removes the leading and trailing blanks of a string.
+     */
+    std::string_view trim(std::string_view text) noexcept
+    {
+        const auto first = text.find_first_not_of(" \t\r");
+
+        if (first == std::string_view::npos)
+            return {};
+        return text.substr(first, text.find_last_not_of(" \t\r") - first + 1);
+    }
+
+    /**
+     * @brief Parses a CPU number, throwing if the text is not one.
+     */
+    int parseCpu(const std::string_view text)
+    {
+        int cpu = -1;
+        const auto [ptr, ec] = std::from_chars(text.data(), text.data() + text.size(), cpu);
+
+        if (ec != std::errc() || ptr != text.data() + text.size() || cpu < 0
+            || cpu >= Utils::ThreadPlacement::MAX_CPUS)
+            throw Utils::PlacementError("{ThreadPlacement::parseCpuList} invalid CPU '" + std::string(text) + "'");
+        return cpu;
+    }
+
+#ifdef __linux__
+    /**
+     * @brief Finds the memory node of a CPU from sysfs.
+     * @return The node, or -1 if the kernel does not tell.
+     */
+    int nodeOf(const int cpu) noexcept
+    {
+        std::error_code ec;
+        const std::filesystem::path dir = "/sys/devices/system/cpu/cpu" + std::to_string(cpu);
+
+        for (const auto &entry : std::filesystem::directory_iterator(dir, ec)) {
+            const std::string name = entry.path().filename().string();
+            int node = -1;
+            if (name.size() <= 4 || name.compare(0, 4, "node") != 0)
+                continue;
+            if (const auto [ptr, err] = std::from_chars(name.data() + 4, name.data() + name.size(), node);
+                err == std::errc() && ptr == name.data() + name.size())
+                return node;
+        }
+        return -1;
+    }
+#endif
+} // namespace
+
+namespace Utils
+{
+    void ThreadPlacement::pin(const std::string &rule)
+    {
+        const auto equal = rule.find('=');
+
+        if (equal == std::string::npos)
+            throw PlacementError("{ThreadPlacement::pin} expected role=cpus, got '" + rule + "'");
+        const std::string_view target = trim(std::string_view(rule).substr(0, equal));
+        const std::string_view role = target.substr(0, target.find('.'));
+
+        if (std::ranges::find(ROLES, role) == ROLES.end())
+            throw PlacementError("{ThreadPlacement::pin} unknown thread role '" + std::string(role) + "'");
+        if (role.size() != target.size()) {
+            const std::string_view index = target.substr(role.size() + 1);
+            std::size_t value = 0;
+            const auto [ptr, ec] = std::from_chars(index.data(), index.data() + index.size(), value);
+            if (index.empty() || ec != std::errc() || ptr != index.data() + index.size())
+                throw PlacementError("{ThreadPlacement::pin} invalid thread index in '" + std::string(target) + "'");
+        }
+        _rules.insert_or_assign(std::string(target), parseCpuList(std::string_view(rule).substr(equal + 1)));
+    }
+
+    void ThreadPlacement::load(const std::string &path)
+    {
+        std::ifstream file(path);
+        std::string line;
+        std::size_t number = 0;
+
+        if (!file)
+            throw PlacementError("{ThreadPlacement::load} cannot read '" + path + "'");
+        while (std::getline(file, line)) {
+            number++;
+            const std::string rule(trim(std::string_view(line).substr(0, line.find('#'))));
+            if (rule.empty())
+                continue;
+            try {
+                const auto equal = rule.find('=');
+                if (equal != std::string::npos && trim(std::string_view(rule).substr(0, equal)) == "numa") {
+                    const std::string_view value = trim(std::string_view(rule).substr(equal + 1));
+                    if (value != "on" && value != "off")
+                        throw PlacementError("{ThreadPlacement::load} numa must be on or off");
+                    _numa = value == "on";
+                    continue;
+                }
+                pin(rule);
+            } catch (const PlacementError &e) {
+                throw PlacementError(
+                    "{ThreadPlacement::load} " + path + ":" + std::to_string(number) + ": " + e.what());
+            }
+        }
+    }
+
+    void ThreadPlacement::setNuma(const bool enabled) noexcept
+    {
+        _numa = enabled;
+    }
+
+    bool ThreadPlacement::numa() const noexcept
+    {
+        return _numa;
+    }
+
+    bool ThreadPlacement::empty() const noexcept
+    {
+        return _rules.empty();
+    }
+
+    std::vector<int> ThreadPlacement::cpus(const std::string_view role, const std::size_t index) const
+    {
+        if (const auto it = _rules.find(std::string(role) + "." + std::to_string(index)); it != _rules.end())
+            return it->second;
+        if (const auto it = _rules.find(role); it != _rules.end())
+            return it->second;
+        return {};
+    }
+
+    void ThreadPlacement::apply(const std::string_view role, const std::size_t index) const noexcept
+    {
+#ifdef __linux__
+        try {
+            const std::string name = (std::string(role) + "-" + std::to_string(index)).substr(0, MAX_NAME);
+            pthread_setname_np(pthread_self(), name.c_str());
+
+            const std::vector<int> set = cpus(role, index);
+            if (set.empty())
+                return;
+            cpu_set_t mask;
+            CPU_ZERO(&mask);
+            for (const int cpu : set)
+                CPU_SET(static_cast<std::size_t>(cpu), &mask);
+            if (sched_setaffinity(0, sizeof(mask), &mask) != 0) {
+                Log::warn("ThreadPlacement::apply", "cannot pin thread, left floating",
+                    {{"thread", name}, {"errno", errno}});
+                return;
+            }
+            if (!_numa)
+                return;
+            const int node = nodeOf(set.front());
+            constexpr int NodeBits = static_cast<int>(sizeof(unsigned long) * 8);
+            if (node < 0 || node >= NodeBits) {
+                Log::warn("ThreadPlacement::apply", "unknown memory node", {{"thread", name}, {"cpu", set.front()}});
+                return;
+            }
+            const unsigned long nodes = 1UL << node;
+            if (syscall(SYS_set_mempolicy, MPOL_PREFERRED, &nodes, NodeBits + 1) != 0)
+                Log::warn("ThreadPlacement::apply", "cannot prefer memory node",
+                    {{"thread", name}, {"node", node}, {"errno", errno}});
+        } catch (...) {
+            return;
+        }
+#else
+        (void) role;
+        (void) index;
+#endif
+    }
+
+    std::vector<int> ThreadPlacement::parseCpuList(const std::string_view list)
+    {
+        std::vector<int> cpus;
+        std::string_view rest = trim(list);
+
+        if (rest.empty())
+            throw PlacementError("{ThreadPlacement::parseCpuList} empty CPU list");
+        while (!rest.empty()) {
+            const auto comma = rest.find(',');
+            const std::string_view item = trim(rest.substr(0, comma));
+            rest = comma == std::string_view::npos ? std::string_view() : rest.substr(comma + 1);
+
+            const auto dash = item.find('-');
+            const int first = parseCpu(trim(item.substr(0, dash)));
+            const int last = dash == std::string_view::npos ? first : parseCpu(trim(item.substr(dash + 1)));
+            if (last < first)
+                throw PlacementError("{ThreadPlacement::parseCpuList} reversed range '" + std::string(item) + "'");
+            for (int cpu = first; cpu <= last; cpu++)
+                cpus.push_back(cpu);
+        }
+        std::ranges::sort(cpus);
+        cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+        return cpus;
+    }
+} // namespace Utils
@@ -0,0 +1,125 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** ThreadPlacement
+*/
+
+#pragma once
+#include <array>
+#include <cstddef>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Utils
+{
+    /**
+     * @class PlacementError
+     * @brief Exception class for invalid placement rules.
+     */
+    class PlacementError : public std::exception {
+      public:
+        /**
+         * @brief Constructor for PlacementError.
+         * @param message The error message.
+         */
+        explicit PlacementError(const std::string &message) : _message("\n\t" + message)
+        {
+        }
+
+        /**
+         * @brief Override of what() method from std::exception.
+         * @return The error message.
+         */
+        const char *what() const noexcept override
+        {
+            return _message.c_str();
+        }
+
+      private:
+        std::string _message; ///> Error message
+    };
+
+    /**
+     * @class ThreadPlacement
+     * @brief Tells each server thread which CPUs it may run on, and names it for profilers.
+     * @details Rules map a role to a CPU list such as `0-3,6`: `room=4-7` pins every room thread,
+     * and `receiver.1=2` only the receiver of the second UDP shard, taking precedence over the
+     * role's rule. Threads without a rule float over every CPU, as before.
+     * With NUMA enabled, a pinned thread also prefers the memory node of its first CPU for the
+     * pages it touches from then on, so that a room's world grows next to the cores ticking it.
+     * Configured once before the threads start, then only read.
+     */
+    class ThreadPlacement {
+      public:
+        static constexpr std::array<std::string_view, 5> ROLES = {
+            "receiver", "processor", "tcp", "control", "room"}; ///> Threads a rule may target
+        static constexpr int MAX_CPUS = 1024;                   ///> CPUs a rule may name, those of a cpu_set_t
+        static constexpr std::size_t MAX_NAME = 15;             ///> Longest thread name the kernel keeps
+
+        /**
+         * @brief Adds a rule.
+         * @param rule `role=cpus` or `role.index=cpus`, replacing an earlier rule for the same threads.
+         * @throws PlacementError If the role is unknown or the CPU list is malformed.
+         */
+        void pin(const std::string &rule);
+
+        /**
+         * @brief Adds the rules of a file.
+         * @details One rule per line, spaces ignored; `numa = on` enables NUMA-local memory, and
+         * everything after a `#` is a comment.
+         * @param path The file to read.
+         * @throws PlacementError If the file cannot be read or a line is invalid.
+         */
+        void load(const std::string &path);
+
+        /**
+         * @brief Enables or disables NUMA-local memory for the pinned threads.
+         * @param enabled True to prefer the node of each thread's first CPU.
+         */
+        void setNuma(bool enabled) noexcept;
+
+        /**
+         * @brief Tells whether pinned threads prefer their node's memory.
+         * @return True if NUMA-local memory is enabled.
+         */
+        [[nodiscard]] bool numa() const noexcept;
+
+        /**
+         * @brief Tells whether any rule was given.
+         * @return True if every thread floats.
+         */
+        [[nodiscard]] bool empty() const noexcept;
+
+        /**
+         * @brief Gets the CPUs a thread is pinned to.
+         * @param role The role of the thread.
+         * @param index The thread's index within its role, like its UDP shard or room ID.
+         * @return The CPUs in ascending order, empty if the thread floats.
+         */
+        [[nodiscard]] std::vector<int> cpus(std::string_view role, std::size_t index) const;
+
+        /**
+         * @brief Names the calling thread `<role>-<index>` and applies its rule.
+         * @details Failures are logged and leave the thread floating; on platforms without
+         * affinity support, this does nothing.
+         * @param role The role of the thread.
+         * @param index The thread's index within its role.
+         */
+        void apply(std::string_view role, std::size_t index) const noexcept;
+
+        /**
+         * @brief Parses a CPU list.
+         * @param list Comma-separated CPUs and ranges, like `0-3,6`.
+         * @return The CPUs in ascending order, without duplicates.
+         * @throws PlacementError If the list is empty, malformed or names a CPU past MAX_CPUS.
+         */
+        [[nodiscard]] static std::vector<int> parseCpuList(std::string_view list);
+
+      private:
+        std::map<std::string, std::vector<int>, std::less<>> _rules; ///> CPUs by `role` or `role.index`
+        bool _numa = false;                                          ///> Whether pinned threads prefer their node
+    };
+} // namespace Utils
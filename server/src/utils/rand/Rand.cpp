@@ -6,12 +6,40 @@
 */
 
 #include "Rand.hpp"
+#include <random>
 
 namespace Rand
 {
-    std::mt19937 rng{std::random_device{}()};
+    Generator::Generator(const std::uint64_t seed) noexcept : _seed(seed)
+    {
+        (*this)();
+        _state += seed;
+        (*this)();
+    }
 
-    std::uniform_real_distribution<float> patrolVelX(-10.f, 10.f);
-    std::uniform_real_distribution<float> patrolVelY(-25.f, 25.f);
-    std::uniform_real_distribution<float> enemyY(50.f, 450.f);
+    std::uint64_t Generator::randomSeed()
+    {
+        std::random_device rd;
+        return (static_cast<std::uint64_t>(rd()) << 32) | rd();
+    }
+
+    std::uint64_t Generator::seed() const noexcept
+    {
+        return _seed;
+    }
+
+    Generator::result_type Generator::operator()() noexcept
+    {
+        const std::uint64_t old = _state;
+        _state = old * MULTIPLIER + INCREMENT;
+        const auto xorShifted = static_cast<std::uint32_t>(((old >> 18u) ^ old) >> 27u);
+        const auto rot = static_cast<std::uint32_t>(old >> 59u);
+        return (xorShifted >> rot) | (xorShifted << ((~rot + 1u) & 31u));
+    }
+
+    float Generator::uniform(const Range &range) noexcept
+    {
+        const float unit = static_cast<float>((*this)() >> 8) * 0x1.0p-24f;
+        return range.min + (range.max - range.min) * unit;
+    }
 } // namespace Rand
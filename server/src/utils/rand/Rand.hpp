@@ -6,7 +6,8 @@
 */
 
 #pragma once
-#include <random>
+#include <cstdint>
+#include <limits>
 
 /**
  * @namespace Rand
@@ -15,22 +16,82 @@
 namespace Rand
 {
     /**
-     * @brief Mersenne Twister random number generator.
+     * @brief Closed range of a uniform float distribution.
      */
-    extern std::mt19937 rng;
+    struct Range {
+        float min; ///> Lower bound
+        float max; ///> Upper bound
+    };
 
-    /**
-     * @brief Uniform distribution for patrol velocity in the X direction.
-     */
-    extern std::uniform_real_distribution<float> patrolVelX;
+    inline constexpr Range PatrolVelX{-10.f, 10.f}; ///> Patrol velocity in the X direction
+    inline constexpr Range PatrolVelY{-25.f, 25.f}; ///> Patrol velocity in the Y direction
+    inline constexpr Range EnemyY{50.f, 450.f};     ///> Enemy spawn Y position
 
     /**
-     * @brief Uniform distribution for patrol velocity in the Y direction.
+     * @class Generator
+     * @brief Small, fast and seedable PCG32 (XSH-RR) random generator.
+     *
+     * Each room owns its own Generator, so rooms never share generator state
+     * across threads and a room can be reproduced from its seed. Satisfies
+     * UniformRandomBitGenerator, so it also works with <random> distributions,
+     * but uniform() is preferred: its output does not depend on the standard library.
      */
-    extern std::uniform_real_distribution<float> patrolVelY;
+    class Generator {
+      public:
+        using result_type = std::uint32_t; ///> Type of the generated values
 
-    /**
-     * @brief Uniform distribution for enemy Y position.
-     */
-    extern std::uniform_real_distribution<float> enemyY;
+        /**
+         * @brief Construct a generator from a seed.
+         * @param seed The seed; the same seed always yields the same sequence.
+         */
+        explicit Generator(std::uint64_t seed) noexcept;
+
+        /**
+         * @brief Draw a seed from the system entropy source.
+         * @return A non-deterministic seed.
+         */
+        [[nodiscard]] static std::uint64_t randomSeed();
+
+        /**
+         * @brief Get the seed this generator was constructed with.
+         * @return The seed.
+         */
+        [[nodiscard]] std::uint64_t seed() const noexcept;
+
+        /**
+         * @brief Generate the next 32-bit value.
+         * @return A uniformly distributed 32-bit value.
+         */
+        result_type operator()() noexcept;
+
+        /**
+         * @brief Generate a float uniformly distributed in [range.min, range.max).
+         * @param range The bounds of the distribution.
+         * @return The generated value.
+         */
+        [[nodiscard]] float uniform(const Range &range) noexcept;
+
+        /**
+         * @brief Smallest value returned by operator().
+         */
+        static constexpr result_type min() noexcept
+        {
+            return 0;
+        }
+
+        /**
+         * @brief Largest value returned by operator().
+         */
+        static constexpr result_type max() noexcept
+        {
+            return std::numeric_limits<result_type>::max();
+        }
+
+      private:
+        static constexpr std::uint64_t MULTIPLIER = 6364136223846793005ULL; ///> LCG multiplier
+        static constexpr std::uint64_t INCREMENT = 1442695040888963407ULL;  ///> LCG increment (odd)
+
+        std::uint64_t _seed;      ///> Seed used at construction
+        std::uint64_t _state = 0; ///> LCG state
+    };
 } // namespace Rand
@@ -0,0 +1,99 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** testWorldCheckpoint
+*/
+
+#include <gtest/gtest.h>
+#include "AIShoot.hpp"
+#include "Events.hpp"
+#include "Lifetime.hpp"
+#include "Serializer.hpp"
+#include "World.hpp"
+#include "WorldCheckpoint.hpp"
+#include "WorldHash.hpp"
+
+namespace
+{
+    void populate(Game::World &world)
+    {
+        auto &reg = world.registry();
+        const auto player = world.createPlayer();
+        const auto enemy = reg.createEntity();
+
+        reg.emplaceComponent<Ecs::Position>(enemy, Ecs::Position{500.f, 120.f});
+        reg.emplaceComponent<Ecs::Velocity>(enemy, Ecs::Velocity{-80.f, 0.f});
+        reg.emplaceComponent<Ecs::Health>(enemy, Ecs::Health{30, 30});
+        reg.emplaceComponent<Ecs::Lifetime>(enemy, Ecs::Lifetime{4.5f});
+        reg.emplaceComponent<Ecs::AIShoot>(enemy,
+            Ecs::AIShoot{Ecs::AIShoot::Type::Spread, 1.5f, 0.25f, 200.f, 5, {-10.f, 0.f}, {-15.f, 0.f, 15.f}});
+        reg.destroyEntity(reg.createEntity());
+        world.events().emit(ShootEvent{100.f, 100.f, 300.f, 0.f, 10, static_cast<size_t>(player), {8.f, 8.f}, 2.f});
+        world.events().process();
+        reg.flush();
+    }
+} // namespace
+
+TEST(WorldCheckpoint, round_trip_restores_the_simulated_state)
+{
+    Game::World source;
+    Game::World target;
+    std::vector<std::uint8_t> blob;
+
+    populate(source);
+    (void) target.createPlayer();
+    Game::WorldCheckpoint::save(source, blob);
+    Game::WorldCheckpoint::load(target, blob.data(), blob.size());
+
+    EXPECT_EQ(Game::WorldHash::compute(target), Game::WorldHash::compute(source));
+    EXPECT_EQ(target.projectiles().ids, source.projectiles().ids);
+    EXPECT_EQ(target.projectiles().shooter, source.projectiles().shooter);
+    const auto &shoot = target.registry().getComponents<Ecs::AIShoot>().at(1);
+    ASSERT_TRUE(shoot.has_value());
+    EXPECT_EQ(shoot->type, Ecs::AIShoot::Type::Spread);
+    EXPECT_EQ(shoot->angles, (std::vector<float>{-15.f, 0.f, 15.f}));
+    EXPECT_FALSE(target.registry().hasComponent<Ecs::Position>(Ecs::Entity(2)));
+    EXPECT_EQ(static_cast<size_t>(target.registry().createEntity()),
+        static_cast<size_t>(source.registry().createEntity()));
+}
+
+TEST(WorldCheckpoint, restored_world_keeps_its_event_handlers)
+{
+    Game::World source;
+    Game::World target;
+    std::vector<std::uint8_t> blob;
+
+    populate(source);
+    Game::WorldCheckpoint::save(source, blob);
+    Game::WorldCheckpoint::load(target, blob.data(), blob.size());
+
+    target.events().emit(DestroyEvent{1});
+    target.events().process();
+    target.registry().flush();
+    EXPECT_FALSE(target.registry().hasComponent<Ecs::AIShoot>(Ecs::Entity(1)));
+}
+
+TEST(WorldCheckpoint, truncated_blob_throws_and_leaves_the_world_empty)
+{
+    Game::World source;
+    Game::World target;
+    std::vector<std::uint8_t> blob;
+
+    populate(source);
+    Game::WorldCheckpoint::save(source, blob);
+    (void) target.createPlayer();
+
+    EXPECT_THROW(Game::WorldCheckpoint::load(target, blob.data(), blob.size() - 3), Ecs::SerializeError);
+    EXPECT_FALSE(target.registry().hasComponent<Ecs::Position>(Ecs::Entity(0)));
+    EXPECT_EQ(target.projectiles().size(), 0u);
+}
+
+TEST(WorldCheckpoint, save_refuses_pending_destructions)
+{
+    Game::World world;
+    std::vector<std::uint8_t> blob;
+
+    world.registry().deferDestroy(world.createPlayer());
+    EXPECT_THROW(Game::WorldCheckpoint::save(world, blob), Ecs::SerializeError);
+}
@@ -0,0 +1,76 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** testOverloadGuard
+*/
+
+#include <gtest/gtest.h>
+#include "OverloadGuard.hpp"
+
+namespace
+{
+    constexpr double Step = 1.0 / 60.0;
+
+    void run(Game::OverloadGuard &guard, const int ticks, const double stepCost)
+    {
+        for (int i = 0; i < ticks; i++)
+            guard.onSteps(1, stepCost);
+    }
+} // namespace
+
+TEST(OverloadGuard, fast_steps_keep_real_time)
+{
+    Game::OverloadGuard guard(Step);
+
+    run(guard, 50, Step * 0.2);
+    EXPECT_FALSE(guard.overloaded());
+    EXPECT_DOUBLE_EQ(guard.timeScale(), 1.0);
+    EXPECT_DOUBLE_EQ(guard.admit(0.1), 0.1);
+    EXPECT_EQ(guard.dilatedTime(), 0.0);
+}
+
+TEST(OverloadGuard, slow_steps_dilate_time_down_to_the_floor)
+{
+    Game::OverloadGuard guard(Step);
+
+    run(guard, 50, Step * 1.2);
+    EXPECT_TRUE(guard.overloaded());
+    EXPECT_EQ(guard.overloads(), 1u);
+    EXPECT_NEAR(guard.timeScale(), 0.9 / 1.2, 0.01);
+    EXPECT_NEAR(guard.admit(1.0), 0.75, 0.01);
+    EXPECT_NEAR(guard.dilatedTime(), 0.25, 0.01);
+
+    run(guard, 50, Step * 4.0);
+    EXPECT_DOUBLE_EQ(guard.timeScale(), 0.5);
+}
+
+TEST(OverloadGuard, recovers_below_the_low_threshold_only)
+{
+    Game::OverloadGuard guard(Step);
+
+    run(guard, 50, Step * 1.2);
+    run(guard, 50, Step * 0.8);
+    EXPECT_TRUE(guard.overloaded());
+    EXPECT_DOUBLE_EQ(guard.timeScale(), 1.0);
+    run(guard, 50, Step * 0.3);
+    EXPECT_FALSE(guard.overloaded());
+    run(guard, 50, Step * 1.2);
+    EXPECT_EQ(guard.overloads(), 2u);
+}
+
+TEST(OverloadGuard, counts_dropped_time_and_resets_on_configure)
+{
+    Game::OverloadGuard guard(Step);
+
+    guard.onDropped(0.5);
+    guard.onSteps(0, 1.0);
+    EXPECT_NEAR(guard.droppedTime(), 0.5, 1e-6);
+    EXPECT_EQ(guard.load(), 0.0);
+
+    Game::OverloadGuard::Config config;
+    config.maxSteps = 0;
+    guard.configure(config);
+    EXPECT_EQ(guard.config().maxSteps, 1u);
+    EXPECT_EQ(guard.droppedTime(), 0.0);
+}
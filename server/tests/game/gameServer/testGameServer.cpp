@@ -6,6 +6,8 @@
 */
 
 #include <gtest/gtest.h>
+#include <thread>
+#include "BatchServer.hpp"
 #include "GameServer.hpp"
 #include "MockServer.hpp"
 #include "MockSessionManager.hpp"
@@ -45,3 +47,122 @@ TEST(GameServer, destroys_player_on_disconnect)
     EXPECT_NO_THROW(gs.onPlayerInput(1, input));
     EXPECT_NO_THROW(gs.update(1.0f));
 }
+
+TEST(GameServer, sends_snapshots_to_players_and_adapts_the_rate)
+{
+    auto sessions = std::make_shared<MockSessionManager>();
+    auto server = std::make_shared<MockServer>();
+    auto factory = std::make_shared<Net::Factory::UDPPacketFactory>(std::make_shared<Net::UDPPacket>());
+
+    Game::GameServer gs(sessions, server, factory, "");
+
+    gs.onPlayerConnect(7);
+    gs.drainCommands();
+    server->sent = false;
+    ASSERT_TRUE(gs.snapshotRate().due(gs.tickIndex()));
+    gs.sendSnapshot();
+
+    EXPECT_TRUE(server->sent);
+    EXPECT_FALSE(gs.snapshotRate().due(gs.tickIndex()));
+    EXPECT_GT(gs.snapshotRate().churn(), 0.0);
+}
+
+TEST(GameServer, moving_entities_count_as_churn)
+{
+    auto sessions = std::make_shared<MockSessionManager>();
+    auto server = std::make_shared<MockServer>();
+    auto factory = std::make_shared<Net::Factory::UDPPacketFactory>(std::make_shared<Net::UDPPacket>());
+    Game::InputComponent input{};
+    input.down = true;
+    input.right = true;
+
+    Game::GameServer gs(sessions, server, factory, "");
+
+    gs.onPlayerConnect(7);
+    gs.drainCommands();
+    gs.sendSnapshot();
+    const double appeared = gs.snapshotRate().churn();
+    gs.onPlayerInput(7, input);
+    gs.drainCommands();
+    for (int i = 0; i < 3; i++)
+        gs.step();
+    gs.sendSnapshot();
+    EXPECT_GT(gs.snapshotRate().churn(), appeared) << "The same entities, moved, are still churn";
+}
+
+TEST(GameServer, tick_sends_what_it_batched_before_returning)
+{
+    auto sessions = std::make_shared<MockSessionManager>();
+    auto server = std::make_shared<MockServer>();
+    auto batches = std::make_shared<Net::Server::BatchServer>(server, std::make_shared<Net::UDPPacket>());
+    auto factory = std::make_shared<Net::Factory::UDPPacketFactory>(std::make_shared<Net::UDPPacket>());
+
+    Game::GameServer gs(sessions, batches, factory, "");
+
+    gs.onPlayerConnect(7);
+    EXPECT_FALSE(server->sent) << "ACCEPT waits for the end of the tick";
+    gs.tick();
+    EXPECT_TRUE(server->sent);
+    EXPECT_GE(batches->packetsSent(), 2u);
+}
+
+TEST(GameServer, hibernate_releases_the_memory_of_departed_players)
+{
+    auto sessions = std::make_shared<MockSessionManager>();
+    auto server = std::make_shared<MockServer>();
+    auto factory = std::make_shared<Net::Factory::UDPPacketFactory>(std::make_shared<Net::UDPPacket>());
+
+    Game::GameServer gs(sessions, server, factory, "");
+
+    for (int session = 1; session <= 64; session++)
+        gs.onPlayerConnect(session);
+    gs.drainCommands();
+    gs.sendSnapshot();
+    for (int session = 2; session <= 64; session++)
+        gs.onPlayerDisconnect(session);
+    gs.drainCommands();
+    const std::size_t before = gs.memoryUsage();
+
+    gs.hibernate();
+
+    EXPECT_LT(gs.memoryUsage(), before);
+    EXPECT_GT(gs.heapUsage(), Utils::RoomArena::FRAME_BYTES);
+    std::vector<SnapshotEntity> snapshot;
+    gs.buildSnapshot(snapshot);
+    EXPECT_EQ(snapshot.size(), 1u);
+}
+
+TEST(GameServer, counts_inputs_but_not_pings_as_activity)
+{
+    auto sessions = std::make_shared<MockSessionManager>();
+    auto server = std::make_shared<MockServer>();
+    auto factory = std::make_shared<Net::Factory::UDPPacketFactory>(std::make_shared<Net::UDPPacket>());
+
+    Game::GameServer gs(sessions, server, factory, "");
+    const std::uint32_t activity = gs.activity();
+    const std::uint32_t wakeups = gs.wakeups();
+
+    gs.onPing(1);
+    EXPECT_EQ(gs.activity(), activity);
+    EXPECT_NE(gs.wakeups(), wakeups);
+    gs.onPlayerInput(1, Game::InputComponent{});
+    EXPECT_NE(gs.activity(), activity);
+}
+
+TEST(GameServer, tick_bounds_catch_up_and_counts_the_dropped_time)
+{
+    auto sessions = std::make_shared<MockSessionManager>();
+    auto server = std::make_shared<MockServer>();
+    auto factory = std::make_shared<Net::Factory::UDPPacketFactory>(std::make_shared<Net::UDPPacket>());
+
+    Game::GameServer gs(sessions, server, factory, "");
+    Game::OverloadGuard::Config config;
+    config.maxSteps = 3;
+    gs.setOverloadGuard(config);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    gs.tick();
+
+    EXPECT_EQ(gs.tickIndex(), 3u);
+    EXPECT_GT(gs.overloadGuard().droppedTime(), 0.1);
+}
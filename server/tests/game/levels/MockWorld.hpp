@@ -39,6 +39,11 @@ class MockWorld final : public Game::IGameWorld {
         return _world.events();
     }
 
+    Game::ProjectilePool &projectiles() override
+    {
+        return _world.projectiles();
+    }
+
   private:
     Game::World _world;
 };
@@ -14,6 +14,7 @@ TEST(LevelSystem, SpawnOneWave)
 {
     MockWorld world;
     Game::LevelManager mgr;
+    Rand::Generator rng(1);
 
     const std::string json = R"(
     {
@@ -37,8 +38,8 @@ TEST(LevelSystem, SpawnOneWave)
     EXPECT_EQ(world.registry().getComponents<Ecs::Position>().size(), 0u);
 
     std::vector<bool> spawned;
-    Game::LevelSystem::update(world, mgr, 0.3f, spawned);
-    Game::LevelSystem::update(world, mgr, 0.3f, spawned);
+    Game::LevelSystem::update(world, mgr, 0.3f, spawned, rng);
+    Game::LevelSystem::update(world, mgr, 0.3f, spawned, rng);
 
     auto &posArr = world.registry().getComponents<Ecs::Position>();
 
@@ -68,6 +69,7 @@ TEST(LevelSystem, WaveTriggersOnlyOnce)
 {
     MockWorld world;
     Game::LevelManager mgr;
+    Rand::Generator rng(1);
 
     const std::string json = R"(
     {
@@ -89,7 +91,7 @@ TEST(LevelSystem, WaveTriggersOnlyOnce)
     ASSERT_TRUE(mgr.load(json));
 
     std::vector<bool> spawned;
-    Game::LevelSystem::update(world, mgr, 1.2f, spawned);
+    Game::LevelSystem::update(world, mgr, 1.2f, spawned, rng);
 
     auto &posArr = world.registry().getComponents<Ecs::Position>();
     int firstSpawnCount = 0;
@@ -97,7 +99,7 @@ TEST(LevelSystem, WaveTriggersOnlyOnce)
         if (posArr.at(i).has_value())
             firstSpawnCount++;
 
-    Game::LevelSystem::update(world, mgr, 5.f, spawned);
+    Game::LevelSystem::update(world, mgr, 5.f, spawned, rng);
 
     int secondSpawnCount = 0;
     for (size_t i = 0; i < posArr.size(); ++i)
@@ -106,3 +108,42 @@ TEST(LevelSystem, WaveTriggersOnlyOnce)
 
     EXPECT_EQ(firstSpawnCount, secondSpawnCount);
 }
+
+TEST(LevelSystem, SameSeedSpawnsSameEnemies)
+{
+    const std::string json = R"(
+    {
+      "name": "L1",
+      "duration": 20,
+      "enemies": {
+        "small": { "hp": 10, "speed": -100, "size": { "w": 8, "h": 8 }, "sprite": "enemy.png" }
+      },
+      "waves": [
+        { "time": 0.1, "enemies": { "small": 4 } }
+      ]
+    })";
+
+    auto spawnYs = [&json](const std::uint64_t seed) {
+        MockWorld world;
+        Game::LevelManager mgr;
+        Rand::Generator rng(seed);
+        std::vector<bool> spawned;
+        std::vector<float> ys;
+
+        EXPECT_TRUE(mgr.load(json));
+        Game::LevelSystem::update(world, mgr, 0.5f, spawned, rng);
+        world.registry().view<Ecs::Position>([&ys](const Ecs::Entity &, const Ecs::Position &pos) {
+            ys.push_back(pos.y);
+        });
+        return ys;
+    };
+
+    const auto first = spawnYs(7);
+    ASSERT_EQ(first.size(), 4u);
+    EXPECT_EQ(first, spawnYs(7));
+    EXPECT_NE(first, spawnYs(8));
+    for (const float y : first) {
+        EXPECT_GE(y, Rand::EnemyY.min);
+        EXPECT_LT(y, Rand::EnemyY.max);
+    }
+}
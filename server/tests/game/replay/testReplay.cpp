@@ -0,0 +1,124 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** testReplay
+*/
+
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include "GameServer.hpp"
+#include "../gameServer/MockServer.hpp"
+#include "../gameServer/MockSessionManager.hpp"
+#include "ReplayReader.hpp"
+#include "UDPPacket.hpp"
+
+namespace
+{
+    std::string tempPath(const std::string &name)
+    {
+        return (std::filesystem::temp_directory_path() / name).string();
+    }
+
+    std::string writeLevel()
+    {
+        const std::string path = tempPath("rtype_replay_level.json");
+        std::ofstream(path) << R"({
+          "name": "Replay",
+          "duration": 20,
+          "enemies": {
+            "small": { "hp": 10, "speed": -100, "size": { "w": 8, "h": 8 }, "sprite": "enemy.png" }
+          },
+          "waves": [ { "time": 0.1, "enemies": { "small": 3 } } ]
+        })";
+        return path;
+    }
+
+    std::unique_ptr<Game::GameServer> makeServer(const std::string &levelPath, const std::uint64_t seed)
+    {
+        return std::make_unique<Game::GameServer>(std::make_shared<MockSessionManager>(),
+            std::make_shared<MockServer>(),
+            std::make_shared<Net::Factory::UDPPacketFactory>(std::make_shared<Net::UDPPacket>()), levelPath, seed);
+    }
+} // namespace
+
+TEST(Replay, recorder_and_reader_round_trip)
+{
+    const std::string path = tempPath("rtype_replay_roundtrip.rtrp");
+    {
+        Game::ReplayRecorder recorder(path, {1234, "levels/level1.json"});
+        recorder.recordCommand({0, 1, 7, 0});
+        recorder.recordStep(0xDEADBEEFCAFEULL);
+        recorder.recordCommand({300, Game::Replay::COMMAND_INPUT, 7, 0x11});
+    }
+
+    Game::ReplayReader reader(path);
+    EXPECT_EQ(reader.header().seed, 1234u);
+    EXPECT_EQ(reader.header().levelPath, "levels/level1.json");
+
+    Game::ReplayReader::Record rec;
+    ASSERT_TRUE(reader.next(rec));
+    EXPECT_EQ(rec.kind, Game::ReplayReader::Record::Kind::Command);
+    EXPECT_EQ(rec.command.tick, 0u);
+    EXPECT_EQ(rec.command.sessionId, 7);
+    ASSERT_TRUE(reader.next(rec));
+    EXPECT_EQ(rec.kind, Game::ReplayReader::Record::Kind::Step);
+    EXPECT_EQ(rec.hash, 0xDEADBEEFCAFEULL);
+    ASSERT_TRUE(reader.next(rec));
+    EXPECT_EQ(rec.command.tick, 300u);
+    EXPECT_EQ(rec.command.inputFlags, 0x11);
+    EXPECT_FALSE(reader.next(rec));
+    std::filesystem::remove(path);
+}
+
+TEST(Replay, rejects_non_replay_file)
+{
+    const std::string path = tempPath("rtype_replay_garbage.rtrp");
+    std::ofstream(path) << "not a replay";
+
+    EXPECT_THROW(Game::ReplayReader reader(path), Game::ReplayError);
+    std::filesystem::remove(path);
+}
+
+TEST(Replay, replaying_a_recording_reproduces_every_tick)
+{
+    const std::string level = writeLevel();
+    const std::string path = tempPath("rtype_replay_session.rtrp");
+
+    {
+        auto live = makeServer(level, 42);
+        live->startRecording(path);
+        live->onPlayerConnect(1);
+        for (int i = 0; i < 400; i++) {
+            if (i == 320)
+                live->onPlayerInput(1, Game::InputComponent{false, true, false, true, true});
+            live->drainCommands();
+            live->step();
+        }
+    }
+
+    Game::ReplayReader reader(path);
+    EXPECT_EQ(reader.header().seed, 42u);
+    auto replayed = makeServer(reader.header().levelPath, reader.header().seed);
+
+    Game::ReplayReader::Record rec;
+    size_t steps = 0;
+    while (reader.next(rec)) {
+        if (rec.kind == Game::ReplayReader::Record::Kind::Command) {
+            ASSERT_EQ(rec.command.tick, replayed->tickIndex());
+            Game::GameServer::GameCommand cmd;
+            cmd.type = static_cast<Game::GameServer::GameCommand::Type>(rec.command.type);
+            cmd.sessionId = rec.command.sessionId;
+            cmd.input = Game::Replay::unpackInput(rec.command.inputFlags);
+            replayed->applyCommand(cmd);
+            continue;
+        }
+        replayed->step();
+        ASSERT_EQ(replayed->stateHash(), rec.hash) << "diverged at tick " << replayed->tickIndex();
+        steps++;
+    }
+    EXPECT_EQ(steps, 400u);
+    std::filesystem::remove(path);
+    std::filesystem::remove(level);
+}
@@ -0,0 +1,93 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** testSnapshotRate
+*/
+
+#include <gtest/gtest.h>
+#include "SnapshotRate.hpp"
+
+namespace
+{
+    constexpr double StepRate = 60.0;
+
+    void snapshots(Game::SnapshotRate &rate, const int count, const std::size_t changed, const std::size_t bytes = 100)
+    {
+        std::uint64_t tick = 0;
+
+        for (int i = 0; i < count; i++) {
+            rate.onSnapshot(tick, 100, changed, bytes);
+            tick += rate.interval();
+        }
+    }
+} // namespace
+
+TEST(SnapshotRate, first_snapshot_is_due_immediately_then_every_interval)
+{
+    Game::SnapshotRate rate(StepRate);
+
+    EXPECT_TRUE(rate.due(0));
+    rate.onSnapshot(0, 100, 0, 100);
+    EXPECT_FALSE(rate.due(rate.interval() - 1));
+    EXPECT_TRUE(rate.due(rate.interval()));
+}
+
+TEST(SnapshotRate, churn_speeds_up_and_quiet_slows_down)
+{
+    Game::SnapshotRate rate(StepRate);
+
+    snapshots(rate, 10, 50);
+    EXPECT_EQ(rate.interval(), 1u);
+    snapshots(rate, 40, 0);
+    EXPECT_EQ(rate.interval(), 12u);
+}
+
+TEST(SnapshotRate, loss_doubles_the_interval)
+{
+    Game::SnapshotRate rate(StepRate);
+
+    rate.onLink(100, 0);
+    rate.onLink(200, 50);
+    EXPECT_GT(rate.loss(), 0.05);
+    rate.onSnapshot(0, 100, 5, 100);
+    EXPECT_EQ(rate.interval(), 6u);
+}
+
+TEST(SnapshotRate, bandwidth_budget_bounds_the_rate)
+{
+    Game::SnapshotRate::Config config;
+    config.bandwidth = 32 * 1024;
+    Game::SnapshotRate rate(StepRate, config);
+
+    snapshots(rate, 10, 50, 2048);
+    EXPECT_EQ(rate.interval(), 4u);
+
+    config.bandwidth = 0;
+    rate.configure(config);
+    snapshots(rate, 10, 50, 2048);
+    EXPECT_EQ(rate.interval(), 1u);
+}
+
+TEST(SnapshotRate, departed_clients_do_not_count_as_loss)
+{
+    Game::SnapshotRate rate(StepRate);
+
+    rate.onLink(1000, 10);
+    rate.onLink(10, 0);
+    rate.onLink(20, 0);
+    EXPECT_LT(rate.loss(), 0.05);
+}
+
+TEST(SnapshotRate, throttle_bounds_the_rate_until_lifted)
+{
+    Game::SnapshotRate rate(StepRate);
+
+    rate.throttle(6);
+    snapshots(rate, 10, 50);
+    EXPECT_EQ(rate.interval(), 6u);
+
+    rate.throttle(0);
+    snapshots(rate, 10, 50);
+    EXPECT_EQ(rate.interval(), 1u);
+}
@@ -22,6 +22,11 @@ namespace Test
             return _events;
         }
 
+        Game::ProjectilePool &projectiles() override
+        {
+            return _projectiles;
+        }
+
         Ecs::Entity createPlayer() override
         {
             return Ecs::Entity{};
@@ -38,5 +43,6 @@ namespace Test
       private:
         Ecs::Registry _reg;
         Ecs::EventsRegistry _events;
+        Game::ProjectilePool _projectiles;
     };
 } // namespace Test
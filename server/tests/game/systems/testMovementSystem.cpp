@@ -6,10 +6,12 @@
 */
 
 #include <gtest/gtest.h>
+#include <vector>
 #include "MovementSystem.hpp"
 #include "Position.hpp"
 #include "Velocity.hpp"
 #include "World.hpp"
+#include "mockTestsWorld.hpp"
 
 TEST(MovementSystem, moves_entities_correctly)
 {
@@ -56,3 +58,37 @@ TEST(MovementSystem, dt_affects_speed)
     EXPECT_FLOAT_EQ(pos->x, 100.f + 100.f * 0.5f);
     EXPECT_FLOAT_EQ(pos->y, 100.f);
 }
+
+TEST(MovementSystem, parallel_chunks_emit_events_in_serial_order)
+{
+    constexpr size_t Count = 20000;
+    ::Test::TestWorld serial;
+    ::Test::TestWorld parallel;
+    Ecs::JobSystem jobs(4);
+    std::vector<size_t> serialOrder;
+    std::vector<size_t> parallelOrder;
+
+    for (auto *world : {&serial, &parallel}) {
+        auto &reg = world->registry();
+        for (size_t i = 0; i < Count; i++) {
+            const auto e = reg.createEntity();
+            reg.emplaceComponent<Ecs::Position>(e, 0.5f, 1.f);
+            reg.emplaceComponent<Ecs::Velocity>(e, i % 7 == 0 ? -1.f : 1.f, 0.f);
+        }
+    }
+    serial.events().subscribe<DestroyEvent>([&serialOrder](const DestroyEvent &event) {
+        serialOrder.push_back(event.entityId);
+    });
+    parallel.events().subscribe<DestroyEvent>([&parallelOrder](const DestroyEvent &event) {
+        parallelOrder.push_back(event.entityId);
+    });
+
+    Game::MovementSystem::update(serial, 1.f);
+    Game::MovementSystem::update(parallel, 1.f, &jobs);
+    serial.events().process();
+    parallel.events().process();
+
+    ASSERT_EQ(serialOrder.size(), (Count + 6) / 7);
+    ASSERT_EQ(parallelOrder, serialOrder);
+    EXPECT_FLOAT_EQ(parallel.registry().getComponents<Ecs::Position>().at(Count - 2)->x, 1.5f);
+}
@@ -0,0 +1,204 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** test_ProjectileSystem
+*/
+
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "Events.hpp"
+#include "ProjectilePool.hpp"
+#include "ProjectileSystem.hpp"
+#include "SnapshotSystem.hpp"
+#include "World.hpp"
+
+#include "mockTestsWorld.hpp"
+
+namespace
+{
+    ShootEvent shot(const float x, const float y, const size_t shooter, const float vx = 0.f, const float life = 5.f)
+    {
+        return ShootEvent{x, y, vx, 0.f, 20, shooter, {8.f, 8.f}, life};
+    }
+
+    Ecs::Entity addShip(Test::TestWorld &world, const float x, const float y, const int damage)
+    {
+        auto &reg = world.registry();
+        const Ecs::Entity e = reg.createEntity();
+        reg.emplaceComponent<Ecs::Position>(e, Ecs::Position{x, y});
+        reg.emplaceComponent<Ecs::Collision>(e, Ecs::Collision{30.f, 30.f});
+        reg.emplaceComponent<Ecs::Health>(e, Ecs::Health{100, 100});
+        if (damage > 0)
+            reg.emplaceComponent<Ecs::Damage>(e, Ecs::Damage{damage});
+        return e;
+    }
+} // namespace
+
+class ProjectileSystemTests : public ::testing::Test {
+  protected:
+    ::Test::TestWorld world;
+    std::vector<DamageEvent> damages;
+
+    void SetUp() override
+    {
+        world.events().subscribe<DamageEvent>([this](const DamageEvent &ev) {
+            damages.push_back(ev);
+        });
+    }
+
+    void spawn(const ShootEvent &event)
+    {
+        world.projectiles().spawn(static_cast<size_t>(world.registry().createEntity()), event);
+    }
+
+    void run(const float dt)
+    {
+        Game::ProjectileSystem::update(world, dt);
+        world.events().process();
+    }
+};
+
+TEST(ProjectilePool, integrate_moves_and_expires_every_slot)
+{
+    Game::ProjectilePool pool;
+
+    for (size_t i = 0; i < 7; i++)
+        pool.spawn(i, ShootEvent{10.f, 10.f, 100.f, -50.f, 1, 0, {8.f, 8.f}, i == 5 ? 0.05f : 5.f});
+    pool.integrate(0.1f);
+
+    for (size_t i = 0; i < 7; i++) {
+        EXPECT_FLOAT_EQ(pool.x[i], 20.f);
+        EXPECT_FLOAT_EQ(pool.y[i], 5.f);
+        EXPECT_EQ(pool.dead[i], i == 5 ? 1 : 0);
+    }
+    pool.integrate(0.2f);
+    for (size_t i = 0; i < 7; i++)
+        EXPECT_EQ(pool.dead[i], 1);
+}
+
+TEST(ProjectilePool, compact_keeps_order_and_shooters)
+{
+    Game::ProjectilePool pool;
+
+    for (size_t i = 0; i < 6; i++)
+        pool.spawn(i * 2, ShootEvent{0.f, 0.f, 0.f, 0.f, 1, 100 + i, {8.f, 8.f}, 1.f});
+    pool.kill(0);
+    pool.kill(3);
+    pool.compact();
+
+    ASSERT_EQ(pool.size(), 4u);
+    EXPECT_EQ(pool.ids, (std::vector<size_t>{2, 4, 8, 10}));
+    EXPECT_EQ(pool.shooterOf(8), 104u);
+    EXPECT_FALSE(pool.shooterOf(6).has_value());
+    EXPECT_FALSE(pool.shooterOf(3).has_value());
+}
+
+TEST_F(ProjectileSystemTests, damages_ship_but_not_its_shooter)
+{
+    const Ecs::Entity shooter = addShip(world, 0.f, 0.f, 0);
+    const Ecs::Entity enemy = addShip(world, 100.f, 0.f, 0);
+
+    spawn(shot(10.f, 10.f, static_cast<size_t>(shooter)));
+    spawn(shot(110.f, 10.f, static_cast<size_t>(shooter)));
+    run(0.f);
+
+    ASSERT_EQ(damages.size(), 1u);
+    EXPECT_EQ(damages[0].source, world.projectiles().ids[1]);
+    EXPECT_EQ(damages[0].target, static_cast<size_t>(enemy));
+    EXPECT_EQ(damages[0].amount, 20);
+}
+
+TEST_F(ProjectileSystemTests, consumed_only_by_ships_dealing_damage)
+{
+    addShip(world, 0.f, 0.f, 0);
+    addShip(world, 100.f, 0.f, 200);
+
+    for (int i = 0; i < 5; i++) {
+        spawn(shot(10.f, 10.f, 99));
+        spawn(shot(110.f, 10.f, 99));
+    }
+    run(0.f);
+    world.projectiles().compact();
+
+    EXPECT_EQ(damages.size(), 10u);
+    ASSERT_EQ(world.projectiles().size(), 5u);
+    for (const float x : world.projectiles().x)
+        EXPECT_FLOAT_EQ(x, 10.f);
+}
+
+TEST_F(ProjectileSystemTests, projectiles_of_different_shooters_cancel)
+{
+    spawn(shot(50.f, 50.f, 1));
+    spawn(shot(54.f, 52.f, 1));
+    spawn(shot(300.f, 50.f, 1));
+    spawn(shot(305.f, 50.f, 2));
+    run(0.f);
+    world.projectiles().compact();
+
+    EXPECT_EQ(world.projectiles().ids, (std::vector<size_t>{0, 1}));
+}
+
+TEST(ProjectileWorld, snapshot_matches_projectile_entities)
+{
+    Game::World world;
+    const Ecs::Entity player = world.createPlayer();
+    world.events().emit(shot(130.f, 100.f, static_cast<size_t>(player), 100.f));
+    world.events().process();
+    const Ecs::Entity other = world.createPlayer();
+    world.registry().getComponents<Ecs::Position>().at(static_cast<size_t>(other))->y = 300.f;
+
+    Game::World read;
+    read.copyFrom(world);
+    std::vector<SnapshotEntity> snapshot;
+    Game::SnapshotSystem::update(read, snapshot);
+
+    ASSERT_EQ(snapshot.size(), 3u);
+    EXPECT_EQ(snapshot[0].spriteId, 7u);
+    EXPECT_EQ(snapshot[1].id, 1u);
+    EXPECT_FLOAT_EQ(snapshot[1].x, 130.f);
+    EXPECT_FLOAT_EQ(snapshot[1].y, 100.f);
+    EXPECT_EQ(snapshot[1].spriteId, Game::ProjectilePool::SPRITE_ID);
+    EXPECT_EQ(snapshot[2].id, 2u);
+    EXPECT_FLOAT_EQ(snapshot[2].y, 300.f);
+}
+
+TEST(ProjectileWorld, snapshot_reads_the_pool_of_the_authoritative_world)
+{
+    Game::World world;
+    const Ecs::Entity player = world.createPlayer();
+    world.events().emit(shot(130.f, 100.f, static_cast<size_t>(player), 100.f));
+    world.events().process();
+    const Ecs::Entity other = world.createPlayer();
+
+    std::vector<SnapshotEntity> snapshot;
+    Game::SnapshotSystem::update(world, snapshot);
+
+    ASSERT_EQ(snapshot.size(), 3u);
+    EXPECT_EQ(snapshot[0].id, static_cast<size_t>(player));
+    EXPECT_EQ(snapshot[1].id, world.projectiles().ids[0]);
+    EXPECT_FLOAT_EQ(snapshot[1].x, 130.f);
+    EXPECT_EQ(snapshot[1].spriteId, Game::ProjectilePool::SPRITE_ID);
+    EXPECT_EQ(snapshot[2].id, static_cast<size_t>(other));
+}
+
+TEST(ProjectileWorld, kill_by_projectile_scores_the_shooter)
+{
+    Game::World world;
+    const Ecs::Entity player = world.createPlayer();
+    const Ecs::Entity enemy = world.registry().createEntity();
+    auto &reg = world.registry();
+    reg.emplaceComponent<Ecs::Position>(enemy, Ecs::Position{300.f, 100.f});
+    reg.emplaceComponent<Ecs::Collision>(enemy, Ecs::Collision{30.f, 30.f});
+    reg.emplaceComponent<Ecs::Health>(enemy, Ecs::Health{20, 20});
+    reg.emplaceComponent<Ecs::KillScore>(enemy, Ecs::KillScore{50});
+
+    world.events().emit(shot(305.f, 105.f, static_cast<size_t>(player)));
+    world.events().process();
+    Game::ProjectileSystem::update(world, 0.f);
+    world.events().process();
+
+    EXPECT_EQ(reg.getComponents<Ecs::Health>().at(static_cast<size_t>(enemy))->hp, 0);
+    EXPECT_EQ(reg.getComponents<Ecs::Score>().at(static_cast<size_t>(player))->score, 50u);
+}
@@ -6,6 +6,8 @@
 */
 
 #include <gtest/gtest.h>
+#include "Damage.hpp"
+#include "Events.hpp"
 #include "Health.hpp"
 #include "InputComponent.hpp"
 #include "Position.hpp"
@@ -40,3 +42,23 @@ TEST(World, destroy_player_removes_components)
     world.destroyEntity(e);
     ASSERT_FALSE(reg.hasComponent<Ecs::Health>(e));
 }
+
+TEST(World, destroy_events_apply_once_on_flush)
+{
+    Game::World world;
+    auto player = world.createPlayer();
+    auto other = world.createPlayer();
+    auto &reg = world.registry();
+    reg.emplaceComponent<Ecs::Damage>(player, Ecs::Damage{10});
+
+    world.events().emit(DestroyEvent{static_cast<size_t>(player)});
+    world.events().emit(DestroyEvent{static_cast<size_t>(player)});
+    world.events().emit(CollisionEvent{static_cast<size_t>(player), static_cast<size_t>(other)});
+    world.events().process();
+    ASSERT_TRUE(reg.hasComponent<Ecs::Health>(player));
+    ASSERT_TRUE(reg.destroying(player));
+
+    reg.flush();
+    ASSERT_FALSE(reg.hasComponent<Ecs::Health>(player));
+    ASSERT_EQ(reg.getComponents<Ecs::Health>().at(static_cast<size_t>(other))->hp, 100);
+}
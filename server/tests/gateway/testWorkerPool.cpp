@@ -0,0 +1,267 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** testWorkerPool
+*/
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "../game/gameServer/MockServer.hpp"
+#include "SessionManager.hpp"
+#include "TCPReader.hpp"
+#include "TCPWriter.hpp"
+#include "UDPPacket.hpp"
+#include "UDPPacketFactory.hpp"
+#include "WorkerAgent.hpp"
+#include "WorkerPool.hpp"
+
+namespace
+{
+    constexpr std::uint16_t BasePort = 9001;
+
+    sockaddr_in address(const std::uint32_t ip, const std::uint16_t port)
+    {
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(ip);
+        addr.sin_port = htons(port);
+        return addr;
+    }
+
+    /**
+     * @brief Game workers running in threads of the test, each with its own rooms, sessions and agent.
+     */
+    class Workers {
+      public:
+        struct Worker {
+            std::shared_ptr<Net::Server::SessionManager> sessions;
+            std::shared_ptr<Engine::RoomManager> rooms;
+            std::atomic<bool> crash = false;
+            std::atomic<bool> stall = false;
+            std::thread thread;
+        };
+
+        ~Workers()
+        {
+            for (const auto &worker : _workers) {
+                worker->crash = true;
+                worker->thread.join();
+            }
+        }
+
+        Gateway::WorkerPool::Spawner spawner()
+        {
+            return [this](const std::size_t index) {
+                auto [gatewayEnd, workerEnd] = Gateway::ControlChannel::pair();
+                auto &worker = *_workers.emplace_back(std::make_unique<Worker>());
+                worker.sessions = std::make_shared<Net::Server::SessionManager>();
+                worker.rooms = std::make_shared<Engine::RoomManager>(worker.sessions, std::make_shared<MockServer>(),
+                    std::make_shared<Net::Factory::UDPPacketFactory>(std::make_shared<Net::UDPPacket>()), "");
+                worker.thread = std::thread([&worker, index, channel = std::shared_ptr(std::move(workerEnd))]() {
+                    Gateway::WorkerAgent agent(channel, worker.rooms, static_cast<std::uint16_t>(BasePort + index));
+                    while (!worker.crash) {
+                        if (worker.stall) {
+                            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+                            continue;
+                        }
+                        if (!agent.poll(std::chrono::milliseconds(5)))
+                            break;
+                    }
+                });
+                return std::make_unique<Gateway::WorkerProcess>(
+                    std::move(gatewayEnd), Gateway::WorkerProcess::InProcess);
+            };
+        }
+
+        Worker &operator[](const std::size_t spawned)
+        {
+            return *_workers[spawned];
+        }
+
+        std::size_t spawned() const
+        {
+            return _workers.size();
+        }
+
+      private:
+        std::vector<std::unique_ptr<Worker>> _workers;
+    };
+
+    bool waitFor(Gateway::WorkerPool &pool, const std::function<bool()> &done)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(3);
+
+        while (!done()) {
+            if (std::chrono::steady_clock::now() > deadline)
+                return false;
+            pool.poll();
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        return true;
+    }
+
+    void waitHealthy(Gateway::WorkerPool &pool, const std::size_t count)
+    {
+        ASSERT_TRUE(waitFor(pool, [&]() {
+            return pool.healthyWorkers() == count;
+        }));
+    }
+} // namespace
+
+TEST(WorkerPoolTests, PlacesRoomsOnTheLeastLoadedWorker)
+{
+    Workers workers;
+    Gateway::WorkerPool pool(std::make_shared<Net::Server::SessionManager>(), 2, workers.spawner());
+
+    waitHealthy(pool, 2);
+    const Engine::RoomId first = pool.createRoom("first", 4);
+    const Engine::RoomId second = pool.createRoom("second", 4);
+    ASSERT_NE(first, 0u);
+    ASSERT_NE(second, 0u);
+    EXPECT_NE(pool.udpPort(first), pool.udpPort(second));
+    EXPECT_EQ(workers[0].rooms->listRooms().size(), 1u);
+    EXPECT_EQ(workers[1].rooms->listRooms().size(), 1u);
+    EXPECT_EQ(pool.directory().listing()->entries.size(), 2u);
+}
+
+TEST(WorkerPoolTests, JoinReservesASeatOnTheHostingWorker)
+{
+    Workers workers;
+    const auto sessions = std::make_shared<Net::Server::SessionManager>();
+    Gateway::WorkerPool pool(sessions, 1, workers.spawner());
+    const int alice = sessions->getOrCreateSession(address(0x0A000007, 40000));
+    const int bob = sessions->getOrCreateSession(address(0x0A000008, 40000));
+
+    waitHealthy(pool, 1);
+    const Engine::RoomId room = pool.createRoom("duo", 1);
+    pool.addPlayerToRoom(room, alice);
+    pool.addPlayerToRoom(room, bob);
+    EXPECT_EQ(pool.getRoomIdOfPlayer(alice), room);
+    EXPECT_EQ(pool.getRoomIdOfPlayer(bob), 0u);
+    EXPECT_EQ(pool.members(room), std::vector<int>{alice});
+    EXPECT_EQ(pool.udpPort(room), BasePort);
+
+    const auto &worker = workers[0];
+    const int udpSession = worker.sessions->getOrCreateSession(address(0x0A000007, 50000));
+    ASSERT_NE(pool.seatToken(alice), 0u);
+    EXPECT_EQ(pool.seatToken(bob), 0u);
+    ASSERT_TRUE(worker.rooms->onPlayerConnect(udpSession, pool.seatToken(alice)));
+    EXPECT_EQ(worker.rooms->getRoomIdOfPlayer(udpSession), worker.rooms->listRooms().front().id);
+    EXPECT_EQ(worker.rooms->listRooms().size(), 1u);
+}
+
+TEST(WorkerPoolTests, LastMemberLeavingClosesTheRoom)
+{
+    Workers workers;
+    const auto sessions = std::make_shared<Net::Server::SessionManager>();
+    Gateway::WorkerPool pool(sessions, 1, workers.spawner());
+    const int alice = sessions->getOrCreateSession(address(0x0A000007, 40000));
+
+    waitHealthy(pool, 1);
+    const Engine::RoomId room = pool.createRoom("solo", 4);
+    pool.addPlayerToRoom(room, alice);
+    EXPECT_EQ(pool.removePlayer(alice), room);
+    EXPECT_TRUE(pool.members(room).empty());
+    EXPECT_EQ(pool.directory().listing()->entries.size(), 0u);
+    EXPECT_TRUE(waitFor(pool, [&]() {
+        return workers[0].rooms->listRooms().empty();
+    }));
+}
+
+TEST(WorkerPoolTests, RoomClosedByItsWorkerLeavesTheGateway)
+{
+    Workers workers;
+    const auto sessions = std::make_shared<Net::Server::SessionManager>();
+    Gateway::WorkerPool pool(sessions, 1, workers.spawner());
+    const int alice = sessions->getOrCreateSession(address(0x0A000007, 40000));
+
+    waitHealthy(pool, 1);
+    const Engine::RoomId room = pool.createRoom("brief", 4);
+    const Engine::RoomId kept = pool.createRoom("kept", 4);
+    pool.addPlayerToRoom(room, alice);
+    ASSERT_EQ(pool.getRoomIdOfPlayer(alice), room);
+
+    const auto &worker = workers[0];
+    const int udpSession = worker.sessions->getOrCreateSession(address(0x0A000007, 50000));
+    ASSERT_TRUE(worker.rooms->onPlayerConnect(udpSession, pool.seatToken(alice)));
+    EXPECT_NE(worker.rooms->removePlayer(udpSession), 0u);
+    ASSERT_EQ(worker.rooms->listRooms().size(), 1u);
+    EXPECT_TRUE(waitFor(pool, [&]() {
+        return pool.getRoomIdOfPlayer(alice) == 0;
+    }));
+    EXPECT_TRUE(pool.members(room).empty());
+    EXPECT_EQ(pool.udpPort(room), 0u);
+    EXPECT_EQ(pool.udpPort(kept), BasePort);
+    EXPECT_EQ(pool.directory().listing()->entries.size(), 1u);
+}
+
+TEST(WorkerPoolTests, WorkerMissingAReplyIsSkippedUntilItReports)
+{
+    Workers workers;
+    Gateway::WorkerPool pool(std::make_shared<Net::Server::SessionManager>(), 2, workers.spawner());
+
+    waitHealthy(pool, 2);
+    workers[0].stall = true;
+    std::this_thread::sleep_for(std::chrono::milliseconds(50)); // lets the worker finish its last poll
+    EXPECT_EQ(pool.createRoom("lost", 4), 0u);
+    EXPECT_EQ(pool.healthyWorkers(), 1u);
+
+    const auto before = std::chrono::steady_clock::now();
+    const Engine::RoomId room = pool.createRoom("moved", 4);
+    EXPECT_LT(std::chrono::steady_clock::now() - before, Gateway::WorkerPool::REQUEST_TIMEOUT);
+    EXPECT_EQ(pool.udpPort(room), BasePort + 1);
+
+    workers[0].stall = false;
+    waitHealthy(pool, 2);
+}
+
+TEST(WorkerPoolTests, DeadWorkerIsDroppedWithItsRoomsThenRespawned)
+{
+    Workers workers;
+    const auto sessions = std::make_shared<Net::Server::SessionManager>();
+    Gateway::WorkerPool pool(sessions, 2, workers.spawner());
+    const int alice = sessions->getOrCreateSession(address(0x0A000007, 40000));
+
+    waitHealthy(pool, 2);
+    const Engine::RoomId lost = pool.createRoom("lost", 4);
+    const Engine::RoomId kept = pool.createRoom("kept", 4);
+    pool.addPlayerToRoom(lost, alice);
+    ASSERT_EQ(pool.udpPort(lost), BasePort);
+
+    workers[0].crash = true;
+    waitHealthy(pool, 1);
+    EXPECT_EQ(pool.getRoomIdOfPlayer(alice), 0u);
+    EXPECT_TRUE(pool.members(lost).empty());
+    EXPECT_EQ(pool.directory().listing()->entries.size(), 1u);
+    EXPECT_EQ(pool.udpPort(kept), BasePort + 1);
+    EXPECT_EQ(pool.udpPort(pool.createRoom("moved", 4)), BasePort + 1);
+
+    waitHealthy(pool, 2);
+    EXPECT_EQ(workers.spawned(), 3u);
+}
+
+TEST(WorkerAgentTests, TruncatedRequestIsAnsweredWithAFailure)
+{
+    auto [gatewayEnd, workerEnd] = Gateway::ControlChannel::pair();
+    const auto rooms = std::make_shared<Engine::RoomManager>(std::make_shared<Net::Server::SessionManager>(),
+        std::make_shared<MockServer>(),
+        std::make_shared<Net::Factory::UDPPacketFactory>(std::make_shared<Net::UDPPacket>()), "");
+    Gateway::WorkerAgent agent(std::move(workerEnd), rooms, BasePort);
+    Net::TCP::Writer b;
+    Gateway::Control::Message reply;
+
+    b.str16("cut");
+    b.u8(4);
+    b.u8(1);
+    ASSERT_TRUE(gatewayEnd->send({Gateway::Control::CREATE_ROOM, 7, b.bytes()}));
+    ASSERT_TRUE(agent.poll(std::chrono::milliseconds(100)));
+    ASSERT_EQ(gatewayEnd->receive(reply, std::chrono::milliseconds(100)), Gateway::ControlChannel::Status::Received);
+    EXPECT_EQ(reply.type, Gateway::Control::REPLY);
+    EXPECT_EQ(reply.request, 7u);
+    Net::TCP::Reader r(reply.body.data(), reply.body.size());
+    EXPECT_EQ(r.u8(), 0u);
+    EXPECT_TRUE(rooms->listRooms().empty());
+}
@@ -0,0 +1,107 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** testAdmission
+*/
+
+#include <gtest/gtest.h>
+#ifdef _WIN32
+    #include <winsock2.h>
+#else
+    #include <netinet/in.h>
+#endif
+
+#include "Admission.hpp"
+#include "SessionManager.hpp"
+
+using namespace Net::Server;
+
+static sockaddr_in makeAddr(uint32_t ip, uint16_t port)
+{
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = ip;
+    addr.sin_port = port;
+    return addr;
+}
+
+TEST(AdmissionTests, FirstConnectIsChallenged)
+{
+    Admission admission;
+    SessionManager sessions;
+    const sockaddr_in addr = makeAddr(0x01020304, 4000);
+
+    EXPECT_EQ(admission.admit(addr, 0, sessions), Admission::Verdict::Challenge);
+    EXPECT_EQ(admission.stats().challenges, 1u);
+    EXPECT_EQ(sessions.sessionCount(), 0u);
+}
+
+TEST(AdmissionTests, ValidCookieIsAdmitted)
+{
+    Admission admission;
+    SessionManager sessions;
+    const sockaddr_in addr = makeAddr(0x01020304, 4000);
+    const uint64_t cookie = admission.cookie(addr);
+
+    EXPECT_NE(cookie, 0u);
+    EXPECT_EQ(admission.admit(addr, cookie, sessions), Admission::Verdict::Admitted);
+}
+
+TEST(AdmissionTests, CookieIsBoundToAddress)
+{
+    Admission admission;
+    SessionManager sessions;
+    const sockaddr_in addr = makeAddr(0x01020304, 4000);
+    const sockaddr_in otherPort = makeAddr(0x01020304, 4001);
+    const sockaddr_in otherIp = makeAddr(0x01020305, 4000);
+    const uint64_t cookie = admission.cookie(addr);
+
+    EXPECT_EQ(admission.admit(otherPort, cookie, sessions), Admission::Verdict::BadCookie);
+    EXPECT_EQ(admission.admit(otherIp, cookie, sessions), Admission::Verdict::BadCookie);
+    EXPECT_EQ(admission.admit(addr, cookie + 1, sessions), Admission::Verdict::BadCookie);
+    EXPECT_EQ(admission.stats().badCookies, 3u);
+}
+
+TEST(AdmissionTests, CookiesDifferBetweenServers)
+{
+    Admission first;
+    Admission second;
+    const sockaddr_in addr = makeAddr(0x01020304, 4000);
+
+    EXPECT_NE(first.cookie(addr), second.cookie(addr));
+}
+
+TEST(AdmissionTests, EnforcesGlobalSessionLimit)
+{
+    Admission admission({2, 8, 256});
+    SessionManager sessions;
+    sessions.getOrCreateSession(makeAddr(0x0A000001, 1));
+    sessions.getOrCreateSession(makeAddr(0x0A000002, 1));
+    const sockaddr_in addr = makeAddr(0x0A000003, 1);
+
+    EXPECT_EQ(admission.admit(addr, admission.cookie(addr), sessions), Admission::Verdict::SessionLimit);
+    EXPECT_EQ(admission.stats().sessionLimit, 1u);
+}
+
+TEST(AdmissionTests, EnforcesPerIpSessionLimit)
+{
+    Admission admission({16, 2, 256});
+    SessionManager sessions;
+    sessions.getOrCreateSession(makeAddr(0x0A000001, 1));
+    sessions.getOrCreateSession(makeAddr(0x0A000001, 2));
+    const sockaddr_in sameIp = makeAddr(0x0A000001, 3);
+    const sockaddr_in otherIp = makeAddr(0x0A000002, 3);
+
+    EXPECT_EQ(admission.admit(sameIp, admission.cookie(sameIp), sessions), Admission::Verdict::IpLimit);
+    EXPECT_EQ(admission.admit(otherIp, admission.cookie(otherIp), sessions), Admission::Verdict::Admitted);
+    EXPECT_EQ(admission.stats().ipLimit, 1u);
+}
+
+TEST(AdmissionTests, CountsRoomLimit)
+{
+    Admission admission;
+
+    admission.countRoomLimit();
+    EXPECT_EQ(admission.stats().roomLimit, 1u);
+}
@@ -0,0 +1,180 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** testInboundScheduler
+*/
+
+#include <gtest/gtest.h>
+#ifdef _WIN32
+    #include <winsock2.h>
+#else
+    #include <netinet/in.h>
+#endif
+
+#include <memory>
+#include <vector>
+#include "InboundScheduler.hpp"
+#include "SessionManager.hpp"
+#include "TokenBucket.hpp"
+#include "UDPPacket.hpp"
+
+using namespace Net::Server;
+
+namespace
+{
+    sockaddr_in makeAddr(const uint16_t port)
+    {
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = 0x0100007F;
+        addr.sin_port = port;
+        return addr;
+    }
+
+    std::shared_ptr<Net::IPacket> makePacket(const uint16_t port)
+    {
+        auto pkt = std::make_shared<Net::UDPPacket>();
+        pkt->setAddress(makeAddr(port));
+        pkt->setSize(4);
+        return pkt;
+    }
+
+    std::vector<uint16_t> drainPorts(InboundScheduler &scheduler, const std::size_t budget)
+    {
+        std::vector<uint16_t> ports;
+        scheduler.drain(
+            [&](const std::shared_ptr<Net::IPacket> &pkt) {
+                ports.push_back(pkt->address()->sin_port);
+            },
+            budget);
+        return ports;
+    }
+} // namespace
+
+TEST(TokenBucketTests, AllowsBurstThenRefills)
+{
+    const auto start = TokenBucket::Clock::now();
+    TokenBucket bucket(10.0, 2.0, start);
+
+    EXPECT_TRUE(bucket.take(start));
+    EXPECT_TRUE(bucket.take(start));
+    EXPECT_FALSE(bucket.take(start));
+    EXPECT_TRUE(bucket.take(start + std::chrono::milliseconds(100)));
+    EXPECT_FALSE(bucket.take(start + std::chrono::milliseconds(100)));
+    EXPECT_TRUE(bucket.take(start + std::chrono::seconds(10)));
+    EXPECT_TRUE(bucket.take(start + std::chrono::seconds(10)));
+    EXPECT_FALSE(bucket.take(start + std::chrono::seconds(10)));
+}
+
+TEST(InboundSchedulerTests, DrainsSessionsRoundRobin)
+{
+    auto sessions = std::make_shared<SessionManager>();
+    sessions->getOrCreateSession(makeAddr(1));
+    sessions->getOrCreateSession(makeAddr(2));
+    InboundScheduler scheduler(sessions);
+    const auto now = InboundScheduler::Clock::now();
+
+    for (int i = 0; i < 5; i++)
+        EXPECT_TRUE(scheduler.enqueue(makePacket(1), now));
+    EXPECT_TRUE(scheduler.enqueue(makePacket(2), now));
+    EXPECT_EQ(scheduler.pending(), 6u);
+
+    const auto ports = drainPorts(scheduler, 3);
+    EXPECT_EQ(ports, (std::vector<uint16_t>{1, 2, 1}));
+    EXPECT_EQ(drainPorts(scheduler, 100).size(), 3u);
+    EXPECT_EQ(scheduler.pending(), 0u);
+}
+
+TEST(InboundSchedulerTests, RateLimitsEachSessionSeparately)
+{
+    auto sessions = std::make_shared<SessionManager>();
+    sessions->getOrCreateSession(makeAddr(1));
+    sessions->getOrCreateSession(makeAddr(2));
+    InboundScheduler::Limits limits;
+    limits.packetsPerSecond = 1.0;
+    limits.burst = 3.0;
+    InboundScheduler scheduler(sessions, limits);
+    const auto now = InboundScheduler::Clock::now();
+
+    for (int i = 0; i < 10; i++)
+        (void) scheduler.enqueue(makePacket(1), now);
+    EXPECT_TRUE(scheduler.enqueue(makePacket(2), now));
+    EXPECT_EQ(scheduler.stats().rateLimited, 7u);
+    EXPECT_EQ(scheduler.pending(), 4u);
+}
+
+TEST(InboundSchedulerTests, BoundsEachQueue)
+{
+    auto sessions = std::make_shared<SessionManager>();
+    sessions->getOrCreateSession(makeAddr(1));
+    InboundScheduler::Limits limits;
+    limits.queueCapacity = 2;
+    InboundScheduler scheduler(sessions, limits);
+    const auto now = InboundScheduler::Clock::now();
+
+    EXPECT_TRUE(scheduler.enqueue(makePacket(1), now));
+    EXPECT_TRUE(scheduler.enqueue(makePacket(1), now));
+    EXPECT_FALSE(scheduler.enqueue(makePacket(1), now));
+    EXPECT_EQ(scheduler.stats().queueFull, 1u);
+}
+
+TEST(InboundSchedulerTests, AddressesWithoutSessionShareOneFlow)
+{
+    auto sessions = std::make_shared<SessionManager>();
+    InboundScheduler::Limits limits;
+    limits.handshakesPerSecond = 1.0;
+    limits.handshakeBurst = 2.0;
+    InboundScheduler scheduler(sessions, limits);
+    const auto now = InboundScheduler::Clock::now();
+
+    EXPECT_TRUE(scheduler.enqueue(makePacket(10), now));
+    EXPECT_TRUE(scheduler.enqueue(makePacket(11), now));
+    EXPECT_FALSE(scheduler.enqueue(makePacket(12), now));
+    EXPECT_EQ(scheduler.stats().rateLimited, 1u);
+}
+
+TEST(InboundSchedulerTests, PruneForgetsRemovedSessions)
+{
+    auto sessions = std::make_shared<SessionManager>();
+    const int id = sessions->getOrCreateSession(makeAddr(1));
+    InboundScheduler::Limits limits;
+    limits.packetsPerSecond = 1.0;
+    limits.burst = 1.0;
+    InboundScheduler scheduler(sessions, limits);
+    const auto now = InboundScheduler::Clock::now();
+
+    EXPECT_TRUE(scheduler.enqueue(makePacket(1), now));
+    EXPECT_EQ(drainPorts(scheduler, 10).size(), 1u);
+    sessions->removeSession(id);
+    scheduler.prune();
+    sessions->getOrCreateSession(makeAddr(1));
+    EXPECT_TRUE(scheduler.enqueue(makePacket(1), now));
+}
+
+TEST(InboundSchedulerTests, HandshakesAreRateLimitedPerNetwork)
+{
+    auto sessions = std::make_shared<SessionManager>();
+    InboundScheduler::Limits limits;
+    limits.sourceHandshakesPerSecond = 1.0;
+    limits.sourceHandshakeBurst = 2.0;
+    limits.handshakeSources = 2;
+    InboundScheduler scheduler(sessions, limits);
+    const auto now = InboundScheduler::Clock::now();
+    const auto from = [](const uint32_t ip, const uint16_t port) {
+        auto pkt = makePacket(port);
+        sockaddr_in addr = *pkt->address();
+        addr.sin_addr.s_addr = htonl(ip);
+        pkt->setAddress(addr);
+        return pkt;
+    };
+
+    EXPECT_TRUE(scheduler.enqueue(from(0x0A000001, 1), now));
+    EXPECT_TRUE(scheduler.enqueue(from(0x0A0000FE, 2), now));
+    EXPECT_FALSE(scheduler.enqueue(from(0x0A000002, 3), now)) << "Same /24, over its burst";
+    EXPECT_TRUE(scheduler.enqueue(from(0x0A000101, 4), now)) << "Another /24 keeps its own rate";
+    EXPECT_EQ(scheduler.stats().rateLimited, 1u);
+
+    EXPECT_TRUE(scheduler.enqueue(from(0x0A000201, 5), now));
+    EXPECT_TRUE(scheduler.enqueue(from(0x0A000003, 6), now)) << "The oldest network was forgotten";
+}
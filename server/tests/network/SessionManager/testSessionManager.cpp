@@ -165,4 +165,38 @@ TEST(SessionManagerTests, TestApplyFunctionToMultipleSessions)
     EXPECT_NE(std::find(collectedIds.begin(), collectedIds.end(), id1), collectedIds.end());
     EXPECT_NE(std::find(collectedIds.begin(), collectedIds.end(), id2), collectedIds.end());
     EXPECT_NE(std::find(collectedIds.begin(), collectedIds.end(), id3), collectedIds.end());
-}
\ No newline at end of file
+}
+TEST(SessionManagerTests, VersionDefaultsToOneAndIsDroppedWithSession)
+{
+    SessionManager sm;
+
+    const int id = sm.getOrCreateSession(makeAddr(0x01020304, 4100));
+    EXPECT_EQ(sm.getVersion(id), 1);
+
+    sm.setVersion(id, 2);
+    EXPECT_EQ(sm.getVersion(id), 2);
+
+    sm.removeSession(id);
+    EXPECT_EQ(sm.getVersion(id), 1);
+    sm.setVersion(id, 2);
+    EXPECT_EQ(sm.getVersion(id), 1);
+}
+
+TEST(SessionManagerTests, CountsSessionsPerIp)
+{
+    SessionManager sm;
+
+    const int id1 = sm.getOrCreateSession(makeAddr(0x01020304, 4200));
+    const int id2 = sm.getOrCreateSession(makeAddr(0x01020304, 4201));
+    sm.getOrCreateSession(makeAddr(0x0A0B0C0D, 4200));
+    sm.getOrCreateSession(makeAddr(0x01020304, 4200));
+
+    EXPECT_EQ(sm.sessionCount(), 3u);
+    EXPECT_EQ(sm.sessionCountForIp(0x01020304), 2u);
+    EXPECT_EQ(sm.sessionCountForIp(0x0A0B0C0D), 1u);
+
+    sm.removeSession(id1);
+    sm.removeSession(id2);
+    EXPECT_EQ(sm.sessionCount(), 1u);
+    EXPECT_EQ(sm.sessionCountForIp(0x01020304), 0u);
+}
@@ -0,0 +1,95 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** testShardedSessionManager
+*/
+
+#include <gtest/gtest.h>
+#ifdef _WIN32
+    #include <winsock2.h>
+#else
+    #include <netinet/in.h>
+#endif
+
+#include <set>
+#include <thread>
+#include <vector>
+#include "ShardedSessionManager.hpp"
+
+using namespace Net::Server;
+
+static sockaddr_in makeAddr(uint32_t ip, uint16_t port)
+{
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = ip;
+    addr.sin_port = port;
+    return addr;
+}
+
+TEST(ShardedSessionManagerTests, IdsAreUniqueAndResolveBothWays)
+{
+    ShardedSessionManager sm(4);
+    std::set<int> ids;
+
+    for (uint16_t port = 1; port <= 200; port++) {
+        const int id = sm.getOrCreateSession(makeAddr(0x01020304, port));
+        EXPECT_GE(id, 1);
+        EXPECT_TRUE(ids.insert(id).second);
+        EXPECT_EQ(sm.getSessionId(makeAddr(0x01020304, port)), id);
+        EXPECT_EQ(sm.getOrCreateSession(makeAddr(0x01020304, port)), id);
+        ASSERT_NE(sm.getAddress(id), nullptr);
+        EXPECT_EQ(sm.getAddress(id)->sin_port, port);
+    }
+    EXPECT_EQ(sm.sessionCount(), 200u);
+    EXPECT_EQ(sm.sessionCountForIp(0x01020304), 200u);
+    EXPECT_EQ(sm.getAllSessions().size(), 200u);
+}
+
+TEST(ShardedSessionManagerTests, RemoveAndVersionReachTheOwningShard)
+{
+    ShardedSessionManager sm(3);
+    const int id = sm.getOrCreateSession(makeAddr(0x0A000001, 5000));
+
+    sm.setVersion(id, 2);
+    EXPECT_EQ(sm.getVersion(id), 2);
+
+    sm.removeSession(id);
+    EXPECT_EQ(sm.getAddress(id), nullptr);
+    EXPECT_EQ(sm.getSessionId(makeAddr(0x0A000001, 5000)), -1);
+    EXPECT_EQ(sm.getVersion(id), 1);
+    EXPECT_EQ(sm.sessionCount(), 0u);
+}
+
+TEST(ShardedSessionManagerTests, UnknownIdsAreIgnored)
+{
+    ShardedSessionManager sm(2);
+
+    EXPECT_EQ(sm.getAddress(-1), nullptr);
+    EXPECT_EQ(sm.getAddress(0), nullptr);
+    sm.removeSession(-1);
+    sm.setVersion(0, 2);
+    EXPECT_EQ(sm.getVersion(0), 1);
+}
+
+TEST(ShardedSessionManagerTests, ConcurrentCreationFromSeveralThreads)
+{
+    constexpr int Threads = 4;
+    constexpr uint16_t PerThread = 500;
+    ShardedSessionManager sm(Threads);
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < Threads; t++)
+        threads.emplace_back([&sm, t]() {
+            for (uint16_t port = 1; port <= PerThread; port++)
+                sm.getOrCreateSession(makeAddr(static_cast<uint32_t>(t + 1), port));
+        });
+    for (auto &thread : threads)
+        thread.join();
+
+    std::set<int> ids;
+    for (const auto &[id, addr] : sm.getAllSessions())
+        ids.insert(id);
+    EXPECT_EQ(ids.size(), static_cast<size_t>(Threads * PerThread));
+}
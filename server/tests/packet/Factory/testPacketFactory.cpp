@@ -78,3 +78,43 @@ TEST(UDPPacketFactory, MakeDamagePacket)
     EXPECT_EQ(raw->id, htonl(id));
     EXPECT_EQ(raw->amount, htons(amount));
 }
+
+TEST(UDPPacketFactory, SnapshotPacketKeepsLegacyFormatByDefault)
+{
+    Net::Factory::UDPPacketFactory f(std::make_shared<MockPacket>());
+    const std::vector<SnapshotEntity> entities = {{3, 10.f, 20.f, 7}, {300, 1279.5f, 719.25f, 6}};
+
+    const auto p = f.createSnapshotPacket(entities);
+    ASSERT_NE(p, nullptr);
+
+    SnapshotBatchHeader header{};
+    std::memcpy(&header, p->buffer(), sizeof(header));
+    EXPECT_EQ(header.header.version, Net::Snapshot::LEGACY_VERSION);
+    EXPECT_EQ(ntohs(header.count), 2);
+    EXPECT_EQ(p->size(), sizeof(SnapshotBatchHeader) + 2 * sizeof(SnapshotEntityData));
+}
+
+TEST(UDPPacketFactory, CompactSnapshotPacketRoundTrips)
+{
+    Net::Factory::UDPPacketFactory f(std::make_shared<MockPacket>());
+    const std::vector<SnapshotEntity> entities = {{3, 10.f, 20.f, 7}, {300, 1279.5f, 719.25f, 6}};
+
+    const auto p = f.createSnapshotPacket(entities, Net::Snapshot::COMPACT_VERSION);
+    ASSERT_NE(p, nullptr);
+
+    SnapshotBatchHeader header{};
+    std::memcpy(&header, p->buffer(), sizeof(header));
+    EXPECT_EQ(header.header.type, Net::Protocol::UDP::SNAPSHOT);
+    EXPECT_EQ(header.header.version, Net::Snapshot::COMPACT_VERSION);
+    EXPECT_EQ(ntohs(header.header.size), p->size());
+    EXPECT_EQ(p->size(), sizeof(SnapshotBatchHeader) + 6 + 7);
+
+    std::vector<SnapshotEntity> decoded;
+    ASSERT_TRUE(Net::Snapshot::decodeCompact(
+        p->buffer() + sizeof(header), p->size() - sizeof(header), ntohs(header.count), decoded));
+    ASSERT_EQ(decoded.size(), 2u);
+    EXPECT_EQ(decoded[1].id, 300u);
+    EXPECT_FLOAT_EQ(decoded[1].x, 1279.5f);
+    EXPECT_FLOAT_EQ(decoded[1].y, 719.25f);
+    EXPECT_EQ(decoded[1].spriteId, 6u);
+}
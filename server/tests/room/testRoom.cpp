@@ -0,0 +1,74 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** testRoom
+*/
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <thread>
+#include "../game/gameServer/MockServer.hpp"
+#include "Room.hpp"
+#include "SessionManager.hpp"
+#include "UDPPacket.hpp"
+#include "UDPPacketFactory.hpp"
+
+namespace
+{
+    std::unique_ptr<Engine::Room> makeRoom(const std::chrono::milliseconds idleTimeout)
+    {
+        auto room = std::make_unique<Engine::Room>(std::make_shared<Net::Server::SessionManager>(),
+            std::make_shared<MockServer>(),
+            std::make_shared<Net::Factory::UDPPacketFactory>(std::make_shared<Net::UDPPacket>()), "");
+        room->setIdleTimeout(idleTimeout);
+        return room;
+    }
+
+    bool waitFor(const Engine::Room &room, const bool hibernating)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+
+        while (room.hibernating() != hibernating) {
+            if (std::chrono::steady_clock::now() > deadline)
+                return false;
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+        }
+        return true;
+    }
+} // namespace
+
+TEST(Room, IdleRoomHibernatesAndResumesOnInput)
+{
+    const auto room = makeRoom(std::chrono::milliseconds(50));
+
+    room->start();
+    ASSERT_TRUE(waitFor(*room, true));
+    room->gameServer().onPlayerInput(1, Game::InputComponent{});
+    EXPECT_TRUE(waitFor(*room, false));
+    EXPECT_TRUE(waitFor(*room, true));
+    room->stop();
+    EXPECT_FALSE(room->hibernating());
+}
+
+TEST(Room, PingsDoNotWakeAHibernatingRoom)
+{
+    const auto room = makeRoom(std::chrono::milliseconds(20));
+
+    room->start();
+    ASSERT_TRUE(waitFor(*room, true));
+    room->gameServer().onPing(1);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_TRUE(room->hibernating());
+    room->stop();
+}
+
+TEST(Room, ZeroIdleTimeoutNeverHibernates)
+{
+    const auto room = makeRoom(std::chrono::milliseconds(0));
+
+    room->start();
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    EXPECT_FALSE(room->hibernating());
+    room->stop();
+}
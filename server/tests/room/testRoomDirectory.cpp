@@ -0,0 +1,113 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** testRoomDirectory
+*/
+
+#include <gtest/gtest.h>
+#include "RoomDirectory.hpp"
+#include "TCPReader.hpp"
+
+using Engine::RoomDirectory;
+
+namespace
+{
+    void fill(RoomDirectory &directory)
+    {
+        directory.upsert(1, "alpha", 1, 4);
+        directory.upsert(2, "beta", 4, 4);
+        directory.upsert(3, "alpha two", 0, 2);
+    }
+
+    std::vector<uint32_t> pageIds(const std::vector<uint8_t> &body, uint16_t &matching)
+    {
+        Net::TCP::Reader reader(body.data(), body.size());
+        std::vector<uint32_t> ids;
+
+        (void) reader.u64();
+        matching = reader.u16();
+        const uint16_t count = reader.u16();
+        for (uint16_t i = 0; i < count; i++) {
+            ids.push_back(reader.u32());
+            (void) reader.str16();
+            (void) reader.u8();
+            (void) reader.u8();
+        }
+        EXPECT_EQ(reader.remaining(), 0u);
+        return ids;
+    }
+} // namespace
+
+TEST(RoomDirectoryTests, ListingIsCachedUntilAChange)
+{
+    RoomDirectory directory;
+    fill(directory);
+
+    const auto first = directory.listing();
+    EXPECT_EQ(directory.listing(), first);
+    ASSERT_EQ(first->entries.size(), 3u);
+
+    Net::TCP::Reader reader(first->body.data(), first->body.size());
+    EXPECT_EQ(reader.u16(), 3);
+    EXPECT_EQ(reader.u32(), 1u);
+    EXPECT_EQ(reader.str16(), "alpha");
+
+    directory.upsert(2, "beta", 3, 4);
+    const auto second = directory.listing();
+    EXPECT_NE(second, first);
+    EXPECT_GT(second->version, first->version);
+    EXPECT_EQ(first->entries[1].currentPlayers, 4);
+    EXPECT_EQ(second->entries[1].currentPlayers, 3);
+}
+
+TEST(RoomDirectoryTests, PagesAndFilters)
+{
+    RoomDirectory directory;
+    fill(directory);
+    uint16_t matching = 0;
+
+    RoomDirectory::Query query;
+    query.offset = 1;
+    query.limit = 1;
+    EXPECT_EQ(pageIds(directory.page(query), matching), std::vector<uint32_t>{2});
+    EXPECT_EQ(matching, 3);
+
+    query = {};
+    query.limit = 10;
+    query.joinableOnly = true;
+    EXPECT_EQ(pageIds(directory.page(query), matching), (std::vector<uint32_t>{1, 3}));
+    EXPECT_EQ(matching, 2);
+
+    query.joinableOnly = false;
+    query.nameFilter = "two";
+    EXPECT_EQ(pageIds(directory.page(query), matching), std::vector<uint32_t>{3});
+
+    query.nameFilter.clear();
+    query.offset = 5;
+    EXPECT_TRUE(pageIds(directory.page(query), matching).empty());
+    EXPECT_EQ(matching, 3);
+}
+
+TEST(RoomDirectoryTests, DrainsEachChangedRoomOnce)
+{
+    RoomDirectory directory;
+    fill(directory);
+    uint64_t version = 0;
+
+    EXPECT_EQ(directory.drainChanges(version).size(), 3u);
+    EXPECT_EQ(version, directory.version());
+    EXPECT_TRUE(directory.drainChanges(version).empty());
+
+    directory.upsert(1, "alpha", 2, 4);
+    directory.upsert(1, "alpha", 3, 4);
+    directory.remove(2);
+    directory.remove(42);
+    const auto changes = directory.drainChanges(version);
+    ASSERT_EQ(changes.size(), 2u);
+    EXPECT_EQ(changes[0].id, 1u);
+    ASSERT_TRUE(changes[0].entry.has_value());
+    EXPECT_EQ(changes[0].entry->currentPlayers, 3);
+    EXPECT_EQ(changes[1].id, 2u);
+    EXPECT_FALSE(changes[1].entry.has_value());
+}
@@ -0,0 +1,214 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** testRoomManager
+*/
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "../game/gameServer/MockServer.hpp"
+#include "RoomManager.hpp"
+#include "SessionManager.hpp"
+#include "UDPPacket.hpp"
+#include "UDPPacketFactory.hpp"
+
+namespace
+{
+    std::shared_ptr<Engine::RoomManager> makeManager()
+    {
+        return std::make_shared<Engine::RoomManager>(std::make_shared<Net::Server::SessionManager>(),
+            std::make_shared<MockServer>(),
+            std::make_shared<Net::Factory::UDPPacketFactory>(std::make_shared<Net::UDPPacket>()), "");
+    }
+} // namespace
+
+TEST(RoomManagerTests, RemovingARoomReleasesItsMembers)
+{
+    const auto manager = makeManager();
+    const Engine::RoomId room = manager->createRoom("room", 4);
+    const Engine::RoomId other = manager->createRoom("other", 4);
+
+    for (int session = 1; session <= 3; session++)
+        manager->addPlayerToRoom(room, session);
+    manager->addPlayerToRoom(other, 4);
+    manager->removeRoom(room);
+
+    for (int session = 1; session <= 3; session++)
+        EXPECT_EQ(manager->getRoomIdOfPlayer(session), 0u);
+    EXPECT_EQ(manager->getRoomIdOfPlayer(4), other);
+    EXPECT_EQ(manager->getRoomById(room), nullptr);
+    EXPECT_EQ(manager->listRooms().size(), 1u);
+}
+
+TEST(RoomManagerTests, LastPlayerLeavingRemovesTheRoom)
+{
+    const auto manager = makeManager();
+    const Engine::RoomId room = manager->createRoom("room", 4);
+
+    manager->addPlayerToRoom(room, 1);
+    manager->addPlayerToRoom(room, 2);
+    EXPECT_EQ(manager->removePlayer(1), room);
+    ASSERT_NE(manager->getRoomById(room), nullptr);
+    EXPECT_EQ(manager->getRoomById(room)->getCurrentPlayers(), 1u);
+    EXPECT_EQ(manager->removePlayer(2), room);
+    EXPECT_EQ(manager->getRoomById(room), nullptr);
+    EXPECT_EQ(manager->removePlayer(2), 0u);
+}
+
+TEST(RoomManagerTests, ConcurrentCreationsRespectTheRoomLimit)
+{
+    const auto manager = makeManager();
+    std::atomic<int> created = 0;
+    std::vector<std::thread> threads;
+
+    manager->setMaxRooms(50);
+    for (int t = 0; t < 8; t++)
+        threads.emplace_back([&]() {
+            for (int i = 0; i < 20; i++)
+                if (manager->createRoom("room", 4) != 0)
+                    created++;
+        });
+    for (auto &thread : threads)
+        thread.join();
+    EXPECT_EQ(created.load(), 50);
+    EXPECT_EQ(manager->listRooms().size(), 50u);
+}
+
+TEST(RoomManagerTests, StressJoinLeaveAndLookups)
+{
+    constexpr int Threads = 8;
+    constexpr int PlayersPerThread = 32;
+    constexpr int Rounds = 50;
+    const auto manager = makeManager();
+    std::vector<std::thread> threads;
+    std::atomic<bool> running = true;
+
+    std::thread reader([&]() {
+        while (running) {
+            for (int session = 1; session <= Threads * PlayersPerThread; session++)
+                (void) manager->getRoomById(manager->getRoomIdOfPlayer(session));
+            (void) manager->listRooms();
+        }
+    });
+    for (int t = 0; t < Threads; t++)
+        threads.emplace_back([&, t]() {
+            for (int round = 0; round < Rounds; round++) {
+                const Engine::RoomId room = manager->createRoom("room", PlayersPerThread);
+                for (int p = 1; p <= PlayersPerThread; p++)
+                    manager->addPlayerToRoom(room, t * PlayersPerThread + p);
+                for (int p = 1; p <= PlayersPerThread; p++) {
+                    if (round + 1 < Rounds || p % 2 == 0) {
+                        EXPECT_EQ(manager->removePlayer(t * PlayersPerThread + p), room);
+                    }
+                }
+            }
+        });
+    for (auto &thread : threads)
+        thread.join();
+    running = false;
+    reader.join();
+
+    const auto rooms = manager->listRooms();
+    ASSERT_EQ(rooms.size(), static_cast<std::size_t>(Threads));
+    for (const auto &room : rooms)
+        EXPECT_EQ(room.currentPlayers, static_cast<std::size_t>(PlayersPerThread / 2));
+    for (int session = 1; session <= Threads * PlayersPerThread; session++) {
+        const Engine::RoomId room = manager->getRoomIdOfPlayer(session);
+        EXPECT_EQ(room != 0, session % 2 == 1);
+        if (room != 0) {
+            EXPECT_TRUE(manager->getRoomById(room)->sessions().contains(session));
+        }
+    }
+}
+
+TEST(RoomManagerTests, JoinRacingRemoveRoomLeavesNoRouteToIt)
+{
+    constexpr int Rounds = 300;
+    const auto sessions = std::make_shared<Net::Server::SessionManager>();
+    const auto manager = std::make_shared<Engine::RoomManager>(sessions, std::make_shared<MockServer>(),
+        std::make_shared<Net::Factory::UDPPacketFactory>(std::make_shared<Net::UDPPacket>()), "");
+
+    for (int round = 0; round < Rounds; round++) {
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(0x0A000001);
+        addr.sin_port = htons(static_cast<std::uint16_t>(1000 + round));
+        const int session = sessions->getOrCreateSession(addr);
+        const Engine::RoomId room = manager->createRoom("room", 4);
+        ASSERT_NE(room, 0u);
+
+        std::thread joiner([&]() {
+            manager->addPlayerToRoom(room, session);
+        });
+        manager->removeRoom(room);
+        joiner.join();
+
+        EXPECT_EQ(manager->getRoomById(room), nullptr);
+        EXPECT_FALSE(manager->onPlayerInput(addr, Game::InputComponent{}));
+        EXPECT_EQ(manager->getRoomIdOfPlayer(session), 0u);
+    }
+}
+
+TEST(RoomManagerTests, ReservedSeatPlacesTheConnectingPlayer)
+{
+    const auto sessions = std::make_shared<Net::Server::SessionManager>();
+    const auto manager = std::make_shared<Engine::RoomManager>(sessions, std::make_shared<MockServer>(),
+        std::make_shared<Net::Factory::UDPPacketFactory>(std::make_shared<Net::UDPPacket>()), "");
+    const auto connect = [&sessions](const std::uint32_t ip, const std::uint16_t port) {
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(ip);
+        addr.sin_port = htons(port);
+        return sessions->getOrCreateSession(addr);
+    };
+    const Engine::RoomId room = manager->createRoom("lobby", 4);
+
+    EXPECT_EQ(manager->reserveSeat(htonl(0x0A000001), room + 1), 0u);
+    const std::uint32_t seat = manager->reserveSeat(htonl(0x0A000001), room);
+    const std::uint32_t cancelled = manager->reserveSeat(htonl(0x0A000002), room);
+    ASSERT_NE(seat, 0u);
+    ASSERT_NE(cancelled, 0u);
+    manager->cancelSeat(cancelled, room);
+
+    const int seated = connect(0x0A000001, 5000);
+    const int stranger = connect(0x0A000002, 5000);
+    ASSERT_TRUE(manager->onPlayerConnect(seated, seat));
+    ASSERT_TRUE(manager->onPlayerConnect(stranger, cancelled));
+    EXPECT_EQ(manager->getRoomIdOfPlayer(seated), room);
+    EXPECT_NE(manager->getRoomIdOfPlayer(stranger), room);
+    EXPECT_NE(manager->getRoomIdOfPlayer(stranger), 0u);
+}
+
+TEST(RoomManagerTests, SeatsGoToTheClientsPresentingTheirToken)
+{
+    const auto sessions = std::make_shared<Net::Server::SessionManager>();
+    const auto manager = std::make_shared<Engine::RoomManager>(sessions, std::make_shared<MockServer>(),
+        std::make_shared<Net::Factory::UDPPacketFactory>(std::make_shared<Net::UDPPacket>()), "");
+    const auto connect = [&sessions](const std::uint16_t port) {
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(0x0A000001);
+        addr.sin_port = htons(port);
+        return sessions->getOrCreateSession(addr);
+    };
+    const Engine::RoomId first = manager->createRoom("first", 4);
+    const Engine::RoomId second = manager->createRoom("second", 4);
+    manager->setSeatsOnly(true);
+
+    const std::uint32_t firstSeat = manager->reserveSeat(htonl(0x0A000001), first);
+    const std::uint32_t secondSeat = manager->reserveSeat(htonl(0x0A000001), second);
+    const int secondPlayer = connect(5001);
+    const int firstPlayer = connect(5000);
+    const int stranger = connect(5002);
+    EXPECT_FALSE(manager->onPlayerConnect(stranger)) << "Same NAT, no token";
+    EXPECT_FALSE(manager->onPlayerConnect(stranger, firstSeat ^ secondSeat ^ 1u));
+    ASSERT_TRUE(manager->onPlayerConnect(secondPlayer, secondSeat));
+    ASSERT_TRUE(manager->onPlayerConnect(firstPlayer, firstSeat));
+    EXPECT_EQ(manager->getRoomIdOfPlayer(firstPlayer), first);
+    EXPECT_EQ(manager->getRoomIdOfPlayer(secondPlayer), second);
+    EXPECT_EQ(manager->getRoomIdOfPlayer(stranger), 0u);
+    EXPECT_EQ(manager->listRooms().size(), 2u);
+}
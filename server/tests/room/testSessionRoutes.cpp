@@ -0,0 +1,162 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** testSessionRoutes
+*/
+
+#include <gtest/gtest.h>
+#ifdef _WIN32
+    #include <winsock2.h>
+#else
+    #include <netinet/in.h>
+#endif
+
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "EpochDomain.hpp"
+#include "SessionRoutes.hpp"
+
+using Engine::SessionRoutes;
+
+namespace
+{
+    class CountingSink : public Net::IMessageSink {
+      public:
+        std::atomic<int> inputs{0};
+        int lastSession = -1;
+
+        void onPlayerConnect(int) override
+        {
+        }
+
+        void onPlayerDisconnect(int) override
+        {
+        }
+
+        void onPlayerInput(const int sessionId, const Game::InputComponent &) override
+        {
+            lastSession = sessionId;
+            inputs++;
+        }
+
+        void onPing(int) override
+        {
+        }
+    };
+
+    sockaddr_in makeAddr(const uint16_t port)
+    {
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = 0x0100007F;
+        addr.sin_port = port;
+        return addr;
+    }
+
+    bool deliver(const SessionRoutes &routes, const uint16_t port)
+    {
+        return routes.visit(makeAddr(port), [](const SessionRoutes::Route &route) {
+            route.sink->onPlayerInput(route.sessionId, Game::InputComponent{});
+        });
+    }
+} // namespace
+
+TEST(SessionRoutesTests, DeliversToTheRouteOfTheAddress)
+{
+    SessionRoutes routes;
+    CountingSink first;
+    CountingSink second;
+
+    routes.set(makeAddr(1), {10, &first});
+    routes.set(makeAddr(2), {20, &second});
+
+    EXPECT_TRUE(deliver(routes, 1));
+    EXPECT_TRUE(deliver(routes, 2));
+    EXPECT_FALSE(deliver(routes, 3));
+    EXPECT_EQ(first.lastSession, 10);
+    EXPECT_EQ(second.lastSession, 20);
+    EXPECT_EQ(routes.size(), 2u);
+}
+
+TEST(SessionRoutesTests, RemovesBySessionAndBySink)
+{
+    SessionRoutes routes;
+    CountingSink first;
+    CountingSink second;
+
+    routes.set(makeAddr(1), {10, &first});
+    routes.set(makeAddr(2), {20, &first});
+    routes.set(makeAddr(3), {30, &second});
+
+    routes.removeSession(30);
+    EXPECT_FALSE(deliver(routes, 3));
+    routes.removeSink(&first);
+    EXPECT_EQ(routes.size(), 0u);
+}
+
+TEST(SessionRoutesTests, MovingASessionReplacesItsRoute)
+{
+    SessionRoutes routes;
+    CountingSink sink;
+
+    routes.set(makeAddr(1), {10, &sink});
+    routes.set(makeAddr(2), {10, &sink});
+
+    EXPECT_FALSE(deliver(routes, 1));
+    EXPECT_TRUE(deliver(routes, 2));
+    EXPECT_EQ(routes.size(), 1u);
+}
+
+TEST(SessionRoutesTests, ReadersSurviveConcurrentUpdates)
+{
+    SessionRoutes routes;
+    CountingSink sink;
+    std::atomic<bool> running = true;
+    std::vector<std::thread> readers;
+
+    routes.set(makeAddr(1), {1, &sink});
+    for (int i = 0; i < 3; i++)
+        readers.emplace_back([&]() {
+            while (running)
+                EXPECT_TRUE(deliver(routes, 1));
+        });
+    for (uint16_t port = 2; port < 500; port++) {
+        routes.set(makeAddr(port), {port, &sink});
+        routes.removeSession(port);
+    }
+    running = false;
+    for (auto &reader : readers)
+        reader.join();
+    EXPECT_EQ(routes.size(), 1u);
+    EXPECT_GT(sink.inputs.load(), 0);
+}
+
+TEST(EpochDomainTests, SynchronizeWaitsForEarlierGuards)
+{
+    Utils::EpochDomain domain;
+    std::atomic<bool> entered = false;
+    std::atomic<bool> release = false;
+    std::atomic<bool> synchronized = false;
+
+    std::thread reader([&]() {
+        Utils::EpochDomain::Guard guard(domain);
+        entered = true;
+        while (!release)
+            std::this_thread::yield();
+    });
+    while (!entered)
+        std::this_thread::yield();
+
+    std::thread writer([&]() {
+        domain.synchronize();
+        synchronized = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_FALSE(synchronized);
+    release = true;
+    reader.join();
+    writer.join();
+    EXPECT_TRUE(synchronized);
+}
@@ -0,0 +1,133 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** testBatchServer
+*/
+
+#ifdef _WIN32
+    #include <winsock2.h>
+#else
+    #include <arpa/inet.h>
+#endif
+#include <cstring>
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "../game/gameServer/MockServer.hpp"
+#include "BatchServer.hpp"
+#include "HeaderData.hpp"
+#include "UDPPacket.hpp"
+#include "UDPTypesData.hpp"
+
+namespace
+{
+    class RecordingServer : public MockServer {
+      public:
+        std::vector<std::vector<uint8_t>> packets;
+        std::vector<uint16_t> ports;
+
+        bool sendPacket(const Net::IPacket &pkt) noexcept override
+        {
+            packets.emplace_back(pkt.buffer(), pkt.buffer() + pkt.size());
+            ports.push_back(ntohs(pkt.address()->sin_port));
+            return true;
+        }
+    };
+
+    Net::UDPPacket packet(const uint8_t type, const uint16_t port, const size_t size = sizeof(HeaderData))
+    {
+        Net::UDPPacket pkt;
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(port);
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        const HeaderData header{type, 1, htons(static_cast<uint16_t>(size))};
+        std::memcpy(pkt.buffer(), &header, sizeof(header));
+        pkt.setSize(size);
+        pkt.setAddress(addr);
+        return pkt;
+    }
+} // namespace
+
+class BatchServerTests : public ::testing::Test {
+  protected:
+    std::shared_ptr<RecordingServer> inner = std::make_shared<RecordingServer>();
+    Net::Server::BatchServer server{inner, std::make_shared<Net::UDPPacket>()};
+};
+
+TEST_F(BatchServerTests, packets_wait_for_flush)
+{
+    ASSERT_TRUE(server.sendPacket(packet(Net::Protocol::UDP::PONG, 4000)));
+    EXPECT_TRUE(inner->packets.empty());
+
+    server.flush();
+    ASSERT_EQ(inner->packets.size(), 1u);
+    EXPECT_EQ(inner->packets[0].size(), sizeof(HeaderData)) << "a lone packet is sent without a BATCH header";
+    EXPECT_EQ(inner->packets[0][0], Net::Protocol::UDP::PONG);
+
+    server.flush();
+    EXPECT_EQ(inner->packets.size(), 1u);
+}
+
+TEST_F(BatchServerTests, one_datagram_per_client_and_flush)
+{
+    ASSERT_TRUE(server.sendPacket(packet(Net::Protocol::UDP::SNAPSHOT, 4000, 40)));
+    ASSERT_TRUE(server.sendPacket(packet(Net::Protocol::UDP::SCORE, 4000, 8)));
+    ASSERT_TRUE(server.sendPacket(packet(Net::Protocol::UDP::PONG, 4000)));
+    ASSERT_TRUE(server.sendPacket(packet(Net::Protocol::UDP::PONG, 4001)));
+    server.flush();
+
+    ASSERT_EQ(inner->packets.size(), 2u);
+    EXPECT_EQ(server.datagramsSent(), 2u);
+    EXPECT_EQ(server.packetsSent(), 4u);
+
+    const size_t batched = inner->ports[0] == 4000 ? 0 : 1;
+    const auto &bytes = inner->packets[batched];
+    ASSERT_EQ(bytes.size(), sizeof(HeaderData) + 40 + 8 + sizeof(HeaderData));
+    HeaderData header{};
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    EXPECT_EQ(header.type, Net::Protocol::UDP::BATCH);
+    EXPECT_EQ(header.version, 1);
+    EXPECT_EQ(ntohs(header.size), bytes.size());
+    EXPECT_EQ(bytes[sizeof(HeaderData)], Net::Protocol::UDP::SNAPSHOT);
+    EXPECT_EQ(bytes[sizeof(HeaderData) + 40], Net::Protocol::UDP::SCORE);
+    EXPECT_EQ(bytes[sizeof(HeaderData) + 48], Net::Protocol::UDP::PONG);
+}
+
+TEST_F(BatchServerTests, batches_never_exceed_the_datagram_limit)
+{
+    constexpr size_t Size = 500;
+    for (int i = 0; i < 3; i++)
+        ASSERT_TRUE(server.sendPacket(packet(Net::Protocol::UDP::SNAPSHOT, 4000, Size)));
+    ASSERT_EQ(inner->packets.size(), 1u);
+    EXPECT_EQ(inner->packets[0].size(), sizeof(HeaderData) + 2 * Size);
+
+    ASSERT_TRUE(server.sendPacket(packet(Net::Protocol::UDP::SNAPSHOT, 4000, 2000)));
+    ASSERT_EQ(inner->packets.size(), 3u);
+    EXPECT_EQ(inner->packets[1].size(), Size);
+    EXPECT_EQ(inner->packets[2].size(), 2000u);
+
+    server.flush();
+    EXPECT_EQ(inner->packets.size(), 3u);
+    EXPECT_LE(inner->packets[0].size(), Net::Server::BatchServer::MAX_DATAGRAM);
+}
+
+TEST_F(BatchServerTests, flushing_a_client_leaves_the_others_queued)
+{
+    const Net::UDPPacket first = packet(Net::Protocol::UDP::PONG, 4000);
+    ASSERT_TRUE(server.sendPacket(first));
+    ASSERT_TRUE(server.sendPacket(packet(Net::Protocol::UDP::PONG, 4000)));
+    ASSERT_TRUE(server.sendPacket(packet(Net::Protocol::UDP::PONG, 4001)));
+
+    server.flush(*first.address());
+    ASSERT_EQ(inner->packets.size(), 1u);
+    EXPECT_EQ(inner->ports[0], 4000);
+    EXPECT_EQ(inner->packets[0][0], Net::Protocol::UDP::BATCH);
+
+    server.flush(*first.address());
+    EXPECT_EQ(inner->packets.size(), 1u);
+    server.flush();
+    ASSERT_EQ(inner->packets.size(), 2u);
+    EXPECT_EQ(inner->ports[1], 4001);
+}
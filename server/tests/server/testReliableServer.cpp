@@ -0,0 +1,148 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** testReliableServer
+*/
+
+#ifdef _WIN32
+    #include <winsock2.h>
+#else
+    #include <arpa/inet.h>
+#endif
+#include <cstring>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+#include "../game/gameServer/MockServer.hpp"
+#include "ReliableServer.hpp"
+#include "UDPPacket.hpp"
+
+namespace
+{
+    class RecordingServer : public MockServer {
+      public:
+        std::vector<std::vector<uint8_t>> packets;
+
+        bool sendPacket(const Net::IPacket &pkt) noexcept override
+        {
+            packets.emplace_back(pkt.buffer(), pkt.buffer() + pkt.size());
+            return true;
+        }
+    };
+
+    Net::UDPPacket packet(const uint8_t type, const uint16_t port)
+    {
+        Net::UDPPacket pkt;
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(port);
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        const HeaderData header{type, 1, htons(sizeof(HeaderData))};
+        std::memcpy(pkt.buffer(), &header, sizeof(header));
+        pkt.setSize(sizeof(header));
+        pkt.setAddress(addr);
+        return pkt;
+    }
+} // namespace
+
+class ReliableServerTests : public ::testing::Test {
+  protected:
+    std::shared_ptr<RecordingServer> inner = std::make_shared<RecordingServer>();
+    Net::Server::ReliableServer server{inner, std::make_shared<Net::UDPPacket>()};
+};
+
+TEST(ReliableServer, rejects_null_dependencies)
+{
+    EXPECT_THROW(Net::Server::ReliableServer(nullptr, std::make_shared<Net::UDPPacket>()), Net::Server::ServerError);
+    EXPECT_THROW(Net::Server::ReliableServer(std::make_shared<MockServer>(), nullptr), Net::Server::ServerError);
+}
+
+TEST_F(ReliableServerTests, snapshots_pass_through_unchanged)
+{
+    ASSERT_TRUE(server.sendPacket(packet(Net::Protocol::UDP::SNAPSHOT, 4000)));
+
+    ASSERT_EQ(inner->packets.size(), 1u);
+    EXPECT_EQ(inner->packets[0].size(), sizeof(HeaderData));
+    EXPECT_EQ(inner->packets[0][0], Net::Protocol::UDP::SNAPSHOT);
+}
+
+TEST_F(ReliableServerTests, score_is_wrapped_with_a_sequence_per_client)
+{
+    ASSERT_TRUE(server.sendPacket(packet(Net::Protocol::UDP::SCORE, 4000)));
+    ASSERT_TRUE(server.sendPacket(packet(Net::Protocol::UDP::SCORE, 4000)));
+    ASSERT_TRUE(server.sendPacket(packet(Net::Protocol::UDP::SCORE, 4001)));
+
+    ASSERT_EQ(inner->packets.size(), 3u);
+    std::vector<uint16_t> seqs;
+    for (const auto &bytes : inner->packets) {
+        ASSERT_EQ(bytes.size(), sizeof(ReliableHeader) + sizeof(HeaderData));
+        EXPECT_EQ(bytes[0], Net::Protocol::UDP::RELIABLE);
+        EXPECT_EQ(bytes[sizeof(ReliableHeader)], Net::Protocol::UDP::SCORE);
+        ReliableHeader header{};
+        std::memcpy(&header, bytes.data(), sizeof(header));
+        EXPECT_EQ(ntohs(header.header.size), bytes.size());
+        seqs.push_back(ntohs(header.seq));
+    }
+    EXPECT_EQ(seqs, (std::vector<uint16_t>{0, 1, 0}));
+}
+
+TEST_F(ReliableServerTests, ack_stops_resends)
+{
+    const Net::UDPPacket score = packet(Net::Protocol::UDP::SCORE, 4000);
+    ASSERT_TRUE(server.sendPacket(score));
+    ASSERT_TRUE(server.sendPacket(score));
+
+    server.onAck(*score.address(), AckFields{htons(0), htonl(0)});
+    std::this_thread::sleep_for(Net::Reliable::INITIAL_RTO);
+    inner->packets.clear();
+    server.resendExpired();
+
+    ASSERT_EQ(inner->packets.size(), 1u);
+    ReliableHeader header{};
+    std::memcpy(&header, inner->packets[0].data(), sizeof(header));
+    EXPECT_EQ(ntohs(header.seq), 1);
+
+    server.removePeer(*score.address());
+    std::this_thread::sleep_for(Net::Reliable::MAX_RTO / 4);
+    inner->packets.clear();
+    server.resendExpired();
+    EXPECT_TRUE(inner->packets.empty());
+}
+
+TEST_F(ReliableServerTests, client_that_stops_acking_is_dropped)
+{
+    const Net::UDPPacket score = packet(Net::Protocol::UDP::SCORE, 4000);
+    auto now = Net::Reliable::Clock::now();
+    ASSERT_TRUE(server.sendPacket(score));
+
+    for (std::size_t i = 1; i < Net::Reliable::MAX_TIMEOUTS; i++) {
+        now += Net::Reliable::MAX_RTO;
+        server.resendExpired(now);
+    }
+    EXPECT_EQ(server.linkStats(*score.address()).resent, Net::Reliable::MAX_TIMEOUTS - 1);
+
+    now += Net::Reliable::MAX_RTO;
+    server.resendExpired(now);
+    EXPECT_EQ(server.linkStats(*score.address()).sent, 0u);
+    inner->packets.clear();
+    server.resendExpired(now + Net::Reliable::MAX_RTO);
+    EXPECT_TRUE(inner->packets.empty());
+}
+
+TEST_F(ReliableServerTests, prune_drops_the_channels_of_unserved_clients)
+{
+    const Net::UDPPacket gone = packet(Net::Protocol::UDP::SCORE, 4000);
+    const Net::UDPPacket kept = packet(Net::Protocol::UDP::SCORE, 4001);
+    ASSERT_TRUE(server.sendPacket(gone));
+    ASSERT_TRUE(server.sendPacket(kept));
+
+    const auto stale = [](const sockaddr_in &addr) {
+        return ntohs(addr.sin_port) == 4000;
+    };
+
+    EXPECT_EQ(server.prunePeers(stale), 1u);
+    EXPECT_EQ(server.linkStats(*gone.address()).sent, 0u);
+    EXPECT_EQ(server.linkStats(*kept.address()).sent, 1u);
+}
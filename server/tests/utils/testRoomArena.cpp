@@ -0,0 +1,55 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** testRoomArena
+*/
+
+#include <gtest/gtest.h>
+#include "Events.hpp"
+#include "EventsRegistry.hpp"
+#include "Position.hpp"
+#include "Registry.hpp"
+#include "RoomArena.hpp"
+
+TEST(RoomArena, counts_the_heap_held_by_the_registry)
+{
+    Utils::RoomArena arena;
+    const std::size_t empty = arena.heapBytes();
+
+    {
+        Ecs::Registry registry(arena.longLived());
+        for (int i = 0; i < 10000; i++)
+            registry.emplaceComponent<Ecs::Position>(registry.createEntity(), 1.f, 2.f);
+        EXPECT_GE(arena.heapBytes(), empty + 10000 * sizeof(std::optional<Ecs::Position>));
+        registry.clear();
+    }
+    EXPECT_GE(arena.peakHeapBytes(), empty + 10000 * sizeof(std::optional<Ecs::Position>));
+    EXPECT_LT(arena.heapBytes(), arena.peakHeapBytes());
+}
+
+TEST(RoomArena, frame_is_reused_every_step)
+{
+    Utils::RoomArena arena;
+    Ecs::EventsRegistry events(arena.frame(), arena.longLived());
+    size_t handled = 0;
+
+    events.subscribe<DestroyEvent>([&handled](const DestroyEvent &) {
+        handled++;
+    });
+    for (int step = 0; step < 20; step++) {
+        for (size_t i = 0; i < 200; i++)
+            events.emit(DestroyEvent{i});
+        events.process();
+        arena.endFrame();
+    }
+    const std::size_t steady = arena.heapBytes();
+    for (int step = 0; step < 100; step++) {
+        for (size_t i = 0; i < 200; i++)
+            events.emit(DestroyEvent{i});
+        events.process();
+        arena.endFrame();
+    }
+    EXPECT_EQ(handled, 120u * 200u);
+    EXPECT_EQ(arena.heapBytes(), steady);
+}
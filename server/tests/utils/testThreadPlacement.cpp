@@ -0,0 +1,91 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** testThreadPlacement
+*/
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+#include "ThreadPlacement.hpp"
+
+#ifdef __linux__
+    #include <pthread.h>
+    #include <sched.h>
+#endif
+
+TEST(ThreadPlacement, parses_cpu_lists)
+{
+    EXPECT_EQ(Utils::ThreadPlacement::parseCpuList("0-3,6"), (std::vector<int>{0, 1, 2, 3, 6}));
+    EXPECT_EQ(Utils::ThreadPlacement::parseCpuList(" 5, 1-2 ,2"), (std::vector<int>{1, 2, 5}));
+    EXPECT_THROW((void) Utils::ThreadPlacement::parseCpuList(""), Utils::PlacementError);
+    EXPECT_THROW((void) Utils::ThreadPlacement::parseCpuList("3-1"), Utils::PlacementError);
+    EXPECT_THROW((void) Utils::ThreadPlacement::parseCpuList("1,,2"), Utils::PlacementError);
+    EXPECT_THROW((void) Utils::ThreadPlacement::parseCpuList("4096"), Utils::PlacementError);
+}
+
+TEST(ThreadPlacement, indexed_rules_take_precedence)
+{
+    Utils::ThreadPlacement placement;
+
+    EXPECT_TRUE(placement.empty());
+    placement.pin("receiver=0-1");
+    placement.pin("receiver.1 = 3");
+    EXPECT_EQ(placement.cpus("receiver", 0), (std::vector<int>{0, 1}));
+    EXPECT_EQ(placement.cpus("receiver", 1), (std::vector<int>{3}));
+    EXPECT_TRUE(placement.cpus("room", 1).empty());
+    EXPECT_THROW(placement.pin("renderer=0"), Utils::PlacementError);
+    EXPECT_THROW(placement.pin("room.x=0"), Utils::PlacementError);
+    EXPECT_THROW(placement.pin("room"), Utils::PlacementError);
+}
+
+TEST(ThreadPlacement, loads_rules_and_numa_from_a_file)
+{
+    const std::string path = (std::filesystem::temp_directory_path() / "rtype_placement.conf").string();
+    {
+        std::ofstream file(path);
+        file << "# rooms on the second socket\nroom = 4-7\n\ntcp=0 # lobby\nnuma = on\n";
+    }
+    Utils::ThreadPlacement placement;
+
+    placement.load(path);
+    EXPECT_TRUE(placement.numa());
+    EXPECT_EQ(placement.cpus("room", 12), (std::vector<int>{4, 5, 6, 7}));
+    EXPECT_EQ(placement.cpus("tcp", 0), (std::vector<int>{0}));
+
+    {
+        std::ofstream file(path);
+        file << "room = 4-7\nnuma = maybe\n";
+    }
+    EXPECT_THROW(placement.load(path), Utils::PlacementError);
+    std::filesystem::remove(path);
+    EXPECT_THROW(placement.load(path), Utils::PlacementError);
+}
+
+#ifdef __linux__
+TEST(ThreadPlacement, apply_names_and_pins_the_calling_thread)
+{
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    ASSERT_EQ(sched_getaffinity(0, sizeof(allowed), &allowed), 0);
+    int cpu = 0;
+    while (!CPU_ISSET(static_cast<std::size_t>(cpu), &allowed))
+        cpu++;
+    Utils::ThreadPlacement placement;
+    placement.pin("room.42=" + std::to_string(cpu));
+    char name[16] = {};
+    cpu_set_t pinned;
+    CPU_ZERO(&pinned);
+
+    std::thread([&placement, &name, &pinned] {
+        placement.apply("room", 42);
+        pthread_getname_np(pthread_self(), name, sizeof(name));
+        sched_getaffinity(0, sizeof(pinned), &pinned);
+    }).join();
+    EXPECT_STREQ(name, "room-42");
+    EXPECT_EQ(CPU_COUNT(&pinned), 1);
+    EXPECT_TRUE(CPU_ISSET(static_cast<std::size_t>(cpu), &pinned));
+}
+#endif
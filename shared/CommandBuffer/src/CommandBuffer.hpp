@@ -6,6 +6,10 @@
 */
 
 #pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <mutex>
 #include <queue>
 
@@ -25,10 +29,17 @@ namespace Command
     class CommandBuffer {
       public:
         /**
-         * @brief Default constructor
+         * @brief Default constructor, for an unbounded buffer
          */
         CommandBuffer() = default;
 
+        /**
+         * @brief Construct a bounded buffer
+         *
+         * @param capacity The maximum number of pending commands; push() drops commands beyond it
+         */
+        explicit CommandBuffer(std::size_t capacity) noexcept;
+
         /**
          * @brief Default destructor
          */
@@ -38,10 +49,19 @@ namespace Command
          * @brief Push a command into the buffer
          *
          * @param cmd The command to be pushed
-         * @return true if the command was successfully pushed, false otherwise
+         * @return true if the command was successfully pushed, false if the buffer was full
          */
         bool push(const T &cmd) noexcept;
 
+        /**
+         * @brief Push a command even if the buffer is full
+         *
+         * Meant for the rare commands that must not be lost (e.g. a disconnection).
+         *
+         * @param cmd The command to be pushed
+         */
+        void forcePush(const T &cmd) noexcept;
+
         /**
          * @brief Pop a command from the buffer
          *
@@ -62,9 +82,18 @@ namespace Command
          */
         bool empty() const noexcept;
 
+        /**
+         * @brief Get the number of commands dropped because the buffer was full
+         *
+         * @return The number of dropped commands since construction
+         */
+        std::uint64_t dropped() const noexcept;
+
       private:
-        mutable std::mutex _mutex; ///< Mutex for thread-safe access
-        std::queue<T> _queue;      ///< Queue to store commands
+        mutable std::mutex _mutex;                                       ///< Mutex for thread-safe access
+        std::queue<T> _queue;                                            ///< Queue to store commands
+        std::size_t _capacity = std::numeric_limits<std::size_t>::max(); ///< Maximum number of pending commands
+        std::atomic<std::uint64_t> _dropped{0};                          ///< Commands refused by push()
     };
 } // namespace Command
 
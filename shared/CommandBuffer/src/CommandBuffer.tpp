@@ -10,14 +10,30 @@
 
 namespace Command
 {
+    template <typename T>
+    CommandBuffer<T>::CommandBuffer(const std::size_t capacity) noexcept : _capacity(capacity)
+    {
+    }
+
     template <typename T>
     bool CommandBuffer<T>::push(const T &cmd) noexcept
     {
         std::scoped_lock lock(_mutex);
+        if (_queue.size() >= _capacity) {
+            _dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
         _queue.push(cmd);
         return true;
     }
 
+    template <typename T>
+    void CommandBuffer<T>::forcePush(const T &cmd) noexcept
+    {
+        std::scoped_lock lock(_mutex);
+        _queue.push(cmd);
+    }
+
     template <typename T>
     bool CommandBuffer<T>::pop(T &out) noexcept
     {
@@ -43,4 +59,10 @@ namespace Command
         std::scoped_lock lock(_mutex);
         return _queue.empty();
     }
+
+    template <typename T>
+    std::uint64_t CommandBuffer<T>::dropped() const noexcept
+    {
+        return _dropped.load(std::memory_order_relaxed);
+    }
 } // namespace Command
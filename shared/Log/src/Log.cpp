@@ -0,0 +1,225 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Log
+*/
+
+#include "Log.hpp"
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include "Logger.hpp"
+
+namespace
+{
+    constexpr std::string_view LevelNames[] = {"debug", "info", "warn", "error", "off"};
+
+    /**
+     * @brief Appends raw text, truncated to the capacity.
+     */
+    void append(char *out, std::size_t &size, const std::size_t capacity, const std::string_view text) noexcept
+    {
+        const std::size_t count = std::min(text.size(), capacity - size);
+        std::copy_n(text.data(), count, out + size);
+        size += count;
+    }
+
+    /**
+     * @brief Appends a value, quoted and escaped if it is empty or holds spaces, quotes or '='.
+     */
+    void appendValue(char *out, std::size_t &size, const std::size_t capacity, const std::string_view text) noexcept
+    {
+        const bool quoted = text.empty() || std::ranges::any_of(text, [](const char c) {
+            return c == ' ' || c == '=' || c == '"' || c == '\\' || static_cast<unsigned char>(c) < 0x20;
+        });
+
+        if (!quoted)
+            return append(out, size, capacity, text);
+        append(out, size, capacity, "\"");
+        for (const char c : text) {
+            if (c == '"' || c == '\\')
+                append(out, size, capacity, {"\\", 1});
+            if (c == '\n')
+                append(out, size, capacity, "\\n");
+            else if (static_cast<unsigned char>(c) >= 0x20)
+                append(out, size, capacity, {&c, 1});
+        }
+        append(out, size, capacity, "\"");
+    }
+
+    /**
+     * @brief Appends a number.
+     */
+    template <typename T>
+    void appendNumber(char *out, std::size_t &size, const std::size_t capacity, const T value) noexcept
+    {
+        char digits[32];
+        const auto result = std::to_chars(digits, digits + sizeof(digits), value);
+        append(out, size, capacity, {digits, static_cast<std::size_t>(result.ptr - digits)});
+    }
+
+    std::int64_t steadyNanoseconds() noexcept
+    {
+        const auto now = std::chrono::steady_clock::now().time_since_epoch();
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+    }
+
+    /**
+     * @brief Formats and queues a record, with a `suppressed` field when records were skipped before it.
+     */
+    void push(const Log::Level level, const std::string_view where, const std::string_view message,
+        const Log::Fields fields, const std::uint64_t suppressed) noexcept
+    {
+        constexpr std::size_t Capacity = Log::ThreadBuffer::MAX_LINE;
+        char line[Capacity];
+        std::size_t size = 0;
+
+        append(line, size, Capacity, "level=");
+        append(line, size, Capacity, LevelNames[static_cast<std::size_t>(level)]);
+        append(line, size, Capacity, " where=");
+        appendValue(line, size, Capacity, where);
+        append(line, size, Capacity, " msg=");
+        appendValue(line, size, Capacity, message);
+        for (const auto &field : fields)
+            field.format(line, size, Capacity);
+        if (suppressed > 0)
+            Log::Field("suppressed", suppressed).format(line, size, Capacity);
+
+        try {
+            auto &logger = Log::Logger::instance();
+            const auto now = std::chrono::system_clock::now().time_since_epoch();
+            Log::ThreadBuffer::Header header{};
+            header.size = static_cast<std::uint32_t>(size);
+            header.level = level;
+            header.timeMs = std::chrono::duration_cast<std::chrono::milliseconds>(now).count();
+            if (logger.threadBuffer().push(header, line) && level >= Log::Level::Error)
+                logger.wake();
+        } catch (...) {
+            return;
+        }
+    }
+} // namespace
+
+namespace Log
+{
+    Field::Field(const std::string_view key, const std::string_view value) noexcept : _key(key), _text(value)
+    {
+    }
+
+    Field::Field(const std::string_view key, const char *value) noexcept
+        : _key(key), _text(value ? std::string_view(value) : std::string_view())
+    {
+    }
+
+    void Field::format(char *out, std::size_t &size, const std::size_t capacity) const noexcept
+    {
+        append(out, size, capacity, " ");
+        append(out, size, capacity, _key);
+        append(out, size, capacity, "=");
+        switch (_kind) {
+            case Kind::Signed: appendNumber(out, size, capacity, _signed); break;
+            case Kind::Unsigned: appendNumber(out, size, capacity, _unsigned); break;
+            case Kind::Floating: appendNumber(out, size, capacity, _floating); break;
+            case Kind::Boolean: append(out, size, capacity, _unsigned ? "true" : "false"); break;
+            case Kind::Text: appendValue(out, size, capacity, _text); break;
+        }
+    }
+
+    void setLevel(const Level level) noexcept
+    {
+        Logger::instance().minLevel.store(level, std::memory_order_relaxed);
+    }
+
+    Level level() noexcept
+    {
+        return Logger::instance().minLevel.load(std::memory_order_relaxed);
+    }
+
+    bool enabled(const Level level) noexcept
+    {
+        return level != Level::Off && level >= Log::level();
+    }
+
+    void setSink(Sink sink)
+    {
+        Logger::instance().setSink(std::move(sink));
+    }
+
+    void write(const Level level, const std::string_view where, const std::string_view message,
+        const Fields fields) noexcept
+    {
+        if (enabled(level))
+            push(level, where, message, fields, 0);
+    }
+
+    void debug(const std::string_view where, const std::string_view message, const Fields fields) noexcept
+    {
+        write(Level::Debug, where, message, fields);
+    }
+
+    void info(const std::string_view where, const std::string_view message, const Fields fields) noexcept
+    {
+        write(Level::Info, where, message, fields);
+    }
+
+    void warn(const std::string_view where, const std::string_view message, const Fields fields) noexcept
+    {
+        write(Level::Warn, where, message, fields);
+    }
+
+    void error(const std::string_view where, const std::string_view message, const Fields fields) noexcept
+    {
+        write(Level::Error, where, message, fields);
+    }
+
+    void flush() noexcept
+    {
+        try {
+            Logger::instance().flush();
+        } catch (...) {
+            return;
+        }
+    }
+
+    RateLimit::RateLimit(const double perSecond, const double burst) noexcept
+        : _interval(static_cast<std::int64_t>(1e9 / std::max(perSecond, 1e-9))),
+          _tolerance(static_cast<std::int64_t>(static_cast<double>(_interval) * (std::max(burst, 1.0) - 1.0)))
+    {
+    }
+
+    void RateLimit::write(const Level level, const std::string_view where, const std::string_view message,
+        const Fields fields) noexcept
+    {
+        std::uint64_t suppressed = 0;
+
+        if (enabled(level) && allow(suppressed))
+            push(level, where, message, fields, suppressed);
+    }
+
+    void RateLimit::warn(const std::string_view where, const std::string_view message, const Fields fields) noexcept
+    {
+        write(Level::Warn, where, message, fields);
+    }
+
+    void RateLimit::error(const std::string_view where, const std::string_view message, const Fields fields) noexcept
+    {
+        write(Level::Error, where, message, fields);
+    }
+
+    bool RateLimit::allow(std::uint64_t &suppressed) noexcept
+    {
+        const std::int64_t now = steadyNanoseconds();
+        std::int64_t spent = _spentUntil.load(std::memory_order_relaxed);
+
+        do {
+            if (spent - now > _tolerance) {
+                _suppressed.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+        } while (!_spentUntil.compare_exchange_weak(
+            spent, std::max(spent, now) + _interval, std::memory_order_relaxed));
+        suppressed = _suppressed.exchange(0, std::memory_order_relaxed);
+        return true;
+    }
+} // namespace Log
@@ -0,0 +1,233 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Log
+*/
+
+#pragma once
+#include <atomic>
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <string_view>
+
+/**
+ * @namespace Log
+ * @brief Asynchronous structured logging.
+ * @details A log call formats one logfmt line (`level=warn where=Class::method msg="..." key=value`)
+ * into a lock-free buffer owned by the calling thread and returns; a background thread
+ * writes the buffered lines to the sink. When a thread's buffer is full, its records
+ * are dropped and counted instead of blocking the caller.
+ */
+namespace Log
+{
+    /**
+     * @brief Severity of a record.
+     */
+    enum class Level : std::uint8_t {
+        Debug, ///> Diagnostics, off by default
+        Info,  ///> Normal operation
+        Warn,  ///> Unexpected but handled
+        Error, ///> Failed operation
+        Off,   ///> Disables logging when used as the minimum level
+    };
+
+    /**
+     * @class Field
+     * @brief A key/value pair attached to a record.
+     * @details Fields only reference their key and text; they are formatted before the log call returns.
+     */
+    class Field {
+      public:
+        /**
+         * @brief Kind of value held by the field.
+         */
+        enum class Kind : std::uint8_t {
+            Signed,   ///> Signed integer
+            Unsigned, ///> Unsigned integer
+            Floating, ///> Floating point number
+            Boolean,  ///> true or false
+            Text,     ///> String, quoted when needed
+        };
+
+        /**
+         * @brief Constructs an integer or boolean field.
+         * @param key The key.
+         * @param value The value.
+         */
+        template <typename T>
+            requires std::integral<T>
+        Field(const std::string_view key, const T value) noexcept : _key(key)
+        {
+            if constexpr (std::same_as<T, bool>) {
+                _kind = Kind::Boolean;
+                _unsigned = value;
+            } else if constexpr (std::signed_integral<T>) {
+                _kind = Kind::Signed;
+                _signed = value;
+            } else {
+                _kind = Kind::Unsigned;
+                _unsigned = value;
+            }
+        }
+
+        /**
+         * @brief Constructs a floating point field.
+         * @param key The key.
+         * @param value The value.
+         */
+        template <typename T>
+            requires std::floating_point<T>
+        Field(const std::string_view key, const T value) noexcept
+            : _key(key), _kind(Kind::Floating), _floating(static_cast<double>(value))
+        {
+        }
+
+        /**
+         * @brief Constructs a text field.
+         * @param key The key.
+         * @param value The text, referenced until the log call returns.
+         */
+        Field(std::string_view key, std::string_view value) noexcept;
+
+        /**
+         * @brief Constructs a text field from a C string.
+         * @param key The key.
+         * @param value The text, or nullptr for an empty one.
+         */
+        Field(std::string_view key, const char *value) noexcept;
+
+        /**
+         * @brief Appends ` key=value` to a line.
+         * @param out The line.
+         * @param size The current length of the line, updated.
+         * @param capacity The capacity of the line; the field is truncated to fit.
+         */
+        void format(char *out, std::size_t &size, std::size_t capacity) const noexcept;
+
+      private:
+        std::string_view _key;       ///> Key of the field
+        Kind _kind = Kind::Text;     ///> Which of the members below holds the value
+        std::int64_t _signed = 0;    ///> Value of a Signed field
+        std::uint64_t _unsigned = 0; ///> Value of an Unsigned or Boolean field
+        double _floating = 0.0;      ///> Value of a Floating field
+        std::string_view _text;      ///> Value of a Text field
+    };
+
+    using Fields = std::initializer_list<Field>; ///> Fields of a record, written `{{"key", value}, ...}`
+
+    /**
+     * @brief Receives the formatted lines, on the background thread.
+     */
+    using Sink = std::function<void(Level level, std::string_view line)>;
+
+    /**
+     * @brief Sets the minimum level of the records kept; Info by default.
+     * @param level The minimum level.
+     */
+    void setLevel(Level level) noexcept;
+
+    /**
+     * @brief Gets the minimum level of the records kept.
+     * @return The minimum level.
+     */
+    [[nodiscard]] Level level() noexcept;
+
+    /**
+     * @brief Tells whether records of a level are kept.
+     * @param level The level.
+     * @return True if it is at least the minimum level.
+     */
+    [[nodiscard]] bool enabled(Level level) noexcept;
+
+    /**
+     * @brief Replaces the sink; by default Debug and Info lines go to stdout and the others to stderr.
+     * @param sink The new sink, or an empty function to restore the default one.
+     */
+    void setSink(Sink sink);
+
+    /**
+     * @brief Queues a record.
+     * @param level The level of the record, ignored below the minimum level.
+     * @param where The call site, usually `Class::method`.
+     * @param message The message.
+     * @param fields The fields of the record.
+     */
+    void write(Level level, std::string_view where, std::string_view message, Fields fields = {}) noexcept;
+
+    /**
+     * @brief Queues a Debug record; see write().
+     */
+    void debug(std::string_view where, std::string_view message, Fields fields = {}) noexcept;
+
+    /**
+     * @brief Queues an Info record; see write().
+     */
+    void info(std::string_view where, std::string_view message, Fields fields = {}) noexcept;
+
+    /**
+     * @brief Queues a Warn record; see write().
+     */
+    void warn(std::string_view where, std::string_view message, Fields fields = {}) noexcept;
+
+    /**
+     * @brief Queues an Error record; see write().
+     */
+    void error(std::string_view where, std::string_view message, Fields fields = {}) noexcept;
+
+    /**
+     * @brief Waits until every record queued before the call has reached the sink.
+     */
+    void flush() noexcept;
+
+    /**
+     * @class RateLimit
+     * @brief Bounds how often one call site logs, with a token bucket.
+     * @details Meant to be a function-local static next to a log call on a hot path:
+     * records beyond the rate are skipped, and the next record kept carries
+     * their number in a `suppressed` field. Thread-safe and lock-free.
+     */
+    class RateLimit {
+      public:
+        /**
+         * @brief Constructs a limit.
+         * @param perSecond Records kept per second on average.
+         * @param burst Records that may be kept in a row.
+         */
+        explicit RateLimit(double perSecond = 1.0, double burst = 5.0) noexcept;
+
+        /**
+         * @brief Queues a record unless the call site is over its rate.
+         * @param level The level of the record.
+         * @param where The call site.
+         * @param message The message.
+         * @param fields The fields of the record.
+         */
+        void write(Level level, std::string_view where, std::string_view message, Fields fields = {}) noexcept;
+
+        /**
+         * @brief Rate-limited Warn record; see write().
+         */
+        void warn(std::string_view where, std::string_view message, Fields fields = {}) noexcept;
+
+        /**
+         * @brief Rate-limited Error record; see write().
+         */
+        void error(std::string_view where, std::string_view message, Fields fields = {}) noexcept;
+
+        /**
+         * @brief Takes a token if one is available.
+         * @param suppressed Receives the records skipped since the last token taken, if one is.
+         * @return True if the record may be logged.
+         */
+        [[nodiscard]] bool allow(std::uint64_t &suppressed) noexcept;
+
+      private:
+        std::int64_t _interval;                    ///> Nanoseconds to earn one token
+        std::int64_t _tolerance;                   ///> How far ahead of the clock the bucket may be spent
+        std::atomic<std::int64_t> _spentUntil{0};  ///> Steady time, in ns, at which the spent tokens are earned back
+        std::atomic<std::uint64_t> _suppressed{0}; ///> Records skipped since the last one kept
+    };
+} // namespace Log
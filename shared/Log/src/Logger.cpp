@@ -0,0 +1,206 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Logger
+*/
+
+#include "Logger.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+namespace
+{
+    /**
+     * @brief Writes a line to stdout (Debug, Info) or stderr (Warn, Error).
+     */
+    void defaultSink(const Log::Level level, const std::string_view line)
+    {
+        std::FILE *stream = level >= Log::Level::Warn ? stderr : stdout;
+        std::fwrite(line.data(), 1, line.size(), stream);
+        std::fputc('\n', stream);
+    }
+
+    /**
+     * @brief Releases the calling thread's buffer to the logger when the thread exits.
+     */
+    struct BufferOwner {
+        std::shared_ptr<Log::ThreadBuffer> buffer; ///> The thread's buffer
+
+        ~BufferOwner()
+        {
+            if (buffer)
+                buffer->retired.store(true, std::memory_order_release);
+        }
+    };
+} // namespace
+
+namespace Log
+{
+    bool ThreadBuffer::push(const Header &header, const char *line) noexcept
+    {
+        const std::size_t size = sizeof(Header) + header.size;
+        const std::size_t head = _head.load(std::memory_order_relaxed);
+
+        if (size > CAPACITY - (head - _tail.load(std::memory_order_acquire))) {
+            _dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        copyIn(head, &header, sizeof(Header));
+        copyIn(head + sizeof(Header), line, header.size);
+        _head.store(head + size, std::memory_order_release);
+        return true;
+    }
+
+    void ThreadBuffer::drain(const std::function<void(const Header &, std::string_view)> &func)
+    {
+        const std::size_t head = _head.load(std::memory_order_acquire);
+        std::size_t tail = _tail.load(std::memory_order_relaxed);
+        char line[MAX_LINE];
+
+        while (tail != head) {
+            Header header{};
+            copyOut(tail, &header, sizeof(Header));
+            copyOut(tail + sizeof(Header), line, header.size);
+            tail += sizeof(Header) + header.size;
+            func(header, std::string_view(line, header.size));
+        }
+        _tail.store(tail, std::memory_order_release);
+    }
+
+    std::uint64_t ThreadBuffer::takeDropped() noexcept
+    {
+        return _dropped.exchange(0, std::memory_order_relaxed);
+    }
+
+    bool ThreadBuffer::empty() const noexcept
+    {
+        return _head.load(std::memory_order_acquire) == _tail.load(std::memory_order_acquire);
+    }
+
+    void ThreadBuffer::copyIn(const std::size_t at, const void *data, const std::size_t size) noexcept
+    {
+        const std::size_t offset = at & (CAPACITY - 1);
+        const std::size_t first = std::min(size, CAPACITY - offset);
+        const auto *bytes = static_cast<const std::uint8_t *>(data);
+
+        std::memcpy(_data.data() + offset, bytes, first);
+        std::memcpy(_data.data(), bytes + first, size - first);
+    }
+
+    void ThreadBuffer::copyOut(const std::size_t at, void *data, const std::size_t size) const noexcept
+    {
+        const std::size_t offset = at & (CAPACITY - 1);
+        const std::size_t first = std::min(size, CAPACITY - offset);
+        auto *bytes = static_cast<std::uint8_t *>(data);
+
+        std::memcpy(bytes, _data.data() + offset, first);
+        std::memcpy(bytes + first, _data.data(), size - first);
+    }
+
+    Logger &Logger::instance()
+    {
+        static Logger logger;
+        return logger;
+    }
+
+    Logger::Logger() : _thread(&Logger::run, this)
+    {
+    }
+
+    Logger::~Logger()
+    {
+        {
+            std::scoped_lock lock(_mutex);
+            _stop = true;
+        }
+        _cv.notify_all();
+        if (_thread.joinable())
+            _thread.join();
+    }
+
+    ThreadBuffer &Logger::threadBuffer()
+    {
+        thread_local BufferOwner owner;
+
+        if (!owner.buffer) {
+            owner.buffer = std::make_shared<ThreadBuffer>();
+            std::scoped_lock lock(_mutex);
+            _buffers.push_back(owner.buffer);
+        }
+        return *owner.buffer;
+    }
+
+    void Logger::wake() noexcept
+    {
+        _wake.store(true, std::memory_order_release);
+        _cv.notify_all();
+    }
+
+    void Logger::flush()
+    {
+        std::unique_lock lock(_mutex);
+        const std::uint64_t target = _drained + 2;
+
+        _wake.store(true, std::memory_order_release);
+        _cv.notify_all();
+        _cv.wait(lock, [this, target]() {
+            return _drained >= target || _stop;
+        });
+    }
+
+    void Logger::setSink(Sink sink)
+    {
+        std::scoped_lock lock(_mutex);
+        _sink = std::move(sink);
+    }
+
+    void Logger::run()
+    {
+        std::unique_lock lock(_mutex);
+
+        while (true) {
+            _cv.wait_for(lock, DRAIN_PERIOD, [this]() {
+                return _wake.load(std::memory_order_acquire) || _stop;
+            });
+            _wake.store(false, std::memory_order_relaxed);
+            const bool stop = _stop;
+            const std::vector<std::shared_ptr<ThreadBuffer>> buffers = _buffers;
+            const Sink sink = _sink;
+
+            // Sinks and terminals may block: threads registering or waking must not wait on them.
+            lock.unlock();
+            drainAll(buffers, sink);
+            lock.lock();
+            std::erase_if(_buffers, [](const auto &buffer) {
+                return buffer->retired.load(std::memory_order_acquire) && buffer->empty();
+            });
+            _drained++;
+            _cv.notify_all();
+            if (stop)
+                return;
+        }
+    }
+
+    void Logger::drainAll(const std::vector<std::shared_ptr<ThreadBuffer>> &buffers, const Sink &custom)
+    {
+        const Sink fallback = defaultSink;
+        const Sink &sink = custom ? custom : fallback;
+        std::string line;
+
+        for (const auto &buffer : buffers) {
+            buffer->drain([&](const ThreadBuffer::Header &header, const std::string_view text) {
+                line = "ts=" + std::to_string(header.timeMs / 1000) + '.';
+                const auto millis = std::to_string(header.timeMs % 1000);
+                line.append(3 - millis.size(), '0').append(millis).append(" ").append(text);
+                sink(header.level, line);
+            });
+            if (const std::uint64_t dropped = buffer->takeDropped(); dropped > 0)
+                sink(Level::Warn, "level=warn where=Log msg=\"log buffer full\" dropped=" + std::to_string(dropped));
+        }
+        std::fflush(stdout);
+        std::fflush(stderr);
+    }
+} // namespace Log
@@ -0,0 +1,157 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Logger
+*/
+
+#pragma once
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include "Log.hpp"
+
+namespace Log
+{
+    /**
+     * @class ThreadBuffer
+     * @brief Single-producer single-consumer ring of records, owned by one logging thread.
+     * @details Each record is a Header followed by its line. The producer only moves _head
+     * and the consumer only moves _tail, so neither ever waits for the other.
+     */
+    class ThreadBuffer {
+      public:
+        static constexpr std::size_t CAPACITY = 64 * 1024; ///> Bytes per thread, a power of two
+        static constexpr std::size_t MAX_LINE = 1024;      ///> Longest line, longer ones are truncated
+
+        /**
+         * @brief Header of a record in the ring.
+         */
+        struct Header {
+            std::uint32_t size;  ///> Length of the line
+            Level level;         ///> Level of the record
+            std::int64_t timeMs; ///> Wall-clock time of the record, in ms since the Unix epoch
+        };
+
+        /**
+         * @brief Appends a record; called by the owning thread only.
+         * @param header The header of the record.
+         * @param line The line.
+         * @return False if the ring is full, in which case the record is counted as dropped.
+         */
+        bool push(const Header &header, const char *line) noexcept;
+
+        /**
+         * @brief Takes every record pushed so far; called by the background thread only.
+         * @param func Called with each header and line.
+         */
+        void drain(const std::function<void(const Header &, std::string_view)> &func);
+
+        /**
+         * @brief Takes the number of records dropped since the last call.
+         * @return The number of records dropped.
+         */
+        [[nodiscard]] std::uint64_t takeDropped() noexcept;
+
+        /**
+         * @brief Tells whether the ring holds no record.
+         * @return True if it is empty.
+         */
+        [[nodiscard]] bool empty() const noexcept;
+
+        std::atomic<bool> retired{false}; ///> Set when the owning thread exits
+
+      private:
+        /**
+         * @brief Copies bytes into the ring, wrapping around its end.
+         */
+        void copyIn(std::size_t at, const void *data, std::size_t size) noexcept;
+
+        /**
+         * @brief Copies bytes out of the ring, wrapping around its end.
+         */
+        void copyOut(std::size_t at, void *data, std::size_t size) const noexcept;
+
+        alignas(64) std::atomic<std::size_t> _head{0}; ///> Bytes ever pushed, moved by the producer
+        alignas(64) std::atomic<std::size_t> _tail{0}; ///> Bytes ever drained, moved by the consumer
+        std::atomic<std::uint64_t> _dropped{0};        ///> Records dropped since takeDropped()
+        std::array<std::uint8_t, CAPACITY> _data{};    ///> The ring
+    };
+
+    /**
+     * @class Logger
+     * @brief Process-wide registry of the thread buffers and the background thread writing them.
+     */
+    class Logger {
+      public:
+        static constexpr auto DRAIN_PERIOD = std::chrono::milliseconds(10); ///> Longest delay before writing a record
+
+        /**
+         * @brief Gets the logger, starting its thread on first use.
+         * @return The logger.
+         */
+        static Logger &instance();
+
+        ~Logger();
+
+        Logger(const Logger &) = delete;
+        Logger &operator=(const Logger &) = delete;
+
+        /**
+         * @brief Gets the buffer of the calling thread, registering it on first use.
+         * @return The buffer.
+         */
+        ThreadBuffer &threadBuffer();
+
+        /**
+         * @brief Wakes the background thread early, e.g. for an error.
+         */
+        void wake() noexcept;
+
+        /**
+         * @brief Waits until everything pushed before the call has been written.
+         */
+        void flush();
+
+        /**
+         * @brief Replaces the sink.
+         * @param sink The new sink, or an empty function for the default one; it must not log.
+         */
+        void setSink(Sink sink);
+
+        std::atomic<Level> minLevel{Level::Info}; ///> Records below it are not formatted
+
+      private:
+        Logger();
+
+        /**
+         * @brief Background loop, draining the buffers every DRAIN_PERIOD or when woken.
+         */
+        void run();
+
+        /**
+         * @brief Writes every buffered record to the sink, without holding the mutex.
+         * @param buffers The buffers registered when the drain started.
+         * @param custom The sink, or an empty function for the default one.
+         */
+        static void drainAll(const std::vector<std::shared_ptr<ThreadBuffer>> &buffers, const Sink &custom);
+
+        std::mutex _mutex;                                   ///> Guards the members below
+        std::condition_variable _cv;                         ///> Wakes run() and flush()
+        std::vector<std::shared_ptr<ThreadBuffer>> _buffers; ///> Buffers of the logging threads
+        Sink _sink;                                          ///> Destination of the lines, default when empty
+        std::uint64_t _drained = 0;                          ///> Completed drains, awaited by flush()
+        std::atomic<bool> _wake{false};                      ///> Set by wake() and flush(), read without the mutex
+        bool _stop = false;                                  ///> Set by the destructor
+        std::thread _thread;                                 ///> Runs run()
+    };
+} // namespace Log
@@ -0,0 +1,85 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** BitStream
+*/
+
+#include "BitStream.hpp"
+
+namespace Net::Bits
+{
+    BitWriter::BitWriter(std::vector<uint8_t> &out) noexcept : _out(out)
+    {
+    }
+
+    void BitWriter::write(const uint32_t value, const unsigned bits)
+    {
+        const uint64_t mask = (uint64_t{1} << bits) - 1;
+        _acc |= (value & mask) << _count;
+        _count += bits;
+        while (_count >= 8) {
+            _out.push_back(static_cast<uint8_t>(_acc));
+            _acc >>= 8;
+            _count -= 8;
+        }
+    }
+
+    void BitWriter::writeVarint(uint64_t value)
+    {
+        while (value >= 0x80) {
+            write(static_cast<uint32_t>(value & 0x7F) | 0x80u, 8);
+            value >>= 7;
+        }
+        write(static_cast<uint32_t>(value), 8);
+    }
+
+    void BitWriter::flush()
+    {
+        if (_count > 0)
+            _out.push_back(static_cast<uint8_t>(_acc));
+        _acc = 0;
+        _count = 0;
+    }
+
+    BitReader::BitReader(const uint8_t *data, const std::size_t size) noexcept : _data(data), _size(size)
+    {
+    }
+
+    uint32_t BitReader::read(const unsigned bits) noexcept
+    {
+        while (_count < bits) {
+            if (_pos >= _size) {
+                _ok = false;
+                return 0;
+            }
+            _acc |= static_cast<uint64_t>(_data[_pos++]) << _count;
+            _count += 8;
+        }
+        const auto value = static_cast<uint32_t>(_acc & ((uint64_t{1} << bits) - 1));
+        _acc >>= bits;
+        _count -= bits;
+        return value;
+    }
+
+    uint64_t BitReader::readVarint() noexcept
+    {
+        uint64_t value = 0;
+
+        for (unsigned shift = 0; shift < 64; shift += 7) {
+            const uint32_t group = read(8);
+            if (!_ok)
+                return 0;
+            value |= static_cast<uint64_t>(group & 0x7F) << shift;
+            if ((group & 0x80) == 0)
+                return value;
+        }
+        _ok = false;
+        return 0;
+    }
+
+    bool BitReader::ok() const noexcept
+    {
+        return _ok;
+    }
+} // namespace Net::Bits
@@ -0,0 +1,98 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** BitStream
+*/
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Streaming bit-level serialization.
+ *
+ * Values are packed least significant bit first, without padding between
+ * fields; only the end of the stream is padded to a whole byte.
+ */
+namespace Net::Bits
+{
+    /**
+     * @class BitWriter
+     * @brief Appends bit fields to a byte buffer.
+     */
+    class BitWriter {
+      public:
+        /**
+         * @brief Constructs a writer appending to a buffer.
+         * @param out The buffer to append to; existing bytes are kept.
+         */
+        explicit BitWriter(std::vector<uint8_t> &out) noexcept;
+
+        /**
+         * @brief Writes the low bits of a value.
+         * @param value The value; bits above `bits` are ignored.
+         * @param bits The number of bits to write, at most 32.
+         */
+        void write(uint32_t value, unsigned bits);
+
+        /**
+         * @brief Writes an unsigned value in groups of 7 bits, each followed by a continuation bit.
+         * @param value The value to write.
+         */
+        void writeVarint(uint64_t value);
+
+        /**
+         * @brief Writes the pending bits, padding the last byte with zeros.
+         */
+        void flush();
+
+      private:
+        std::vector<uint8_t> &_out; ///> Destination buffer
+        uint64_t _acc = 0;          ///> Bits not yet written to _out
+        unsigned _count = 0;        ///> Number of bits in _acc
+    };
+
+    /**
+     * @class BitReader
+     * @brief Reads bit fields written by a BitWriter.
+     * @details Reading past the end yields zeros and clears ok().
+     */
+    class BitReader {
+      public:
+        /**
+         * @brief Constructs a reader over a byte range.
+         * @param data The first byte.
+         * @param size The number of bytes.
+         */
+        BitReader(const uint8_t *data, std::size_t size) noexcept;
+
+        /**
+         * @brief Reads a bit field.
+         * @param bits The number of bits to read, at most 32.
+         * @return The value, or 0 past the end.
+         */
+        [[nodiscard]] uint32_t read(unsigned bits) noexcept;
+
+        /**
+         * @brief Reads a value written by BitWriter::writeVarint().
+         * @return The value, or 0 if it is truncated or longer than 64 bits.
+         */
+        [[nodiscard]] uint64_t readVarint() noexcept;
+
+        /**
+         * @brief Tells whether every read so far stayed within the data.
+         * @return False once the data was overrun.
+         */
+        [[nodiscard]] bool ok() const noexcept;
+
+      private:
+        const uint8_t *_data; ///> Source bytes
+        std::size_t _size;    ///> Number of source bytes
+        std::size_t _pos = 0; ///> Next byte to load into _acc
+        uint64_t _acc = 0;    ///> Loaded bits not read yet
+        unsigned _count = 0;  ///> Number of bits in _acc
+        bool _ok = true;      ///> False once the data was overrun
+    };
+} // namespace Net::Bits
@@ -40,6 +40,16 @@ namespace Net::TCP
         return ntohl(v);
     }
 
+    uint64_t Reader::u64() noexcept
+    {
+        if (!need(8))
+            return 0;
+        uint64_t v;
+        std::memcpy(&v, _cursor, 8);
+        _cursor += 8;
+        return ntohll(v);
+    }
+
     std::string Reader::str16() noexcept
     {
         if (!need(2))
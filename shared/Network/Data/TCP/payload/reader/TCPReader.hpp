@@ -17,7 +17,7 @@ namespace Net::TCP
     /**
      * @brief Reader class for deserializing data from a byte buffer
      * Provides methods to read various data types from a byte array.
-     * Supports reading uint8_t, uint16_t, uint32_t, and length-prefixed strings.
+     * Supports reading uint8_t, uint16_t, uint32_t, uint64_t, and length-prefixed strings.
      * Handles endianness for multibyte types.
      */
     class Reader {
@@ -47,6 +47,12 @@ namespace Net::TCP
          */
         [[nodiscard]] uint32_t u32() noexcept;
 
+        /**
+         * @brief Read a 64-bit unsigned integer from the buffer
+         * @return The read value
+         */
+        [[nodiscard]] uint64_t u64() noexcept;
+
         /**
          * @brief Read a length-prefixed string from the buffer
          * @return The read string
@@ -26,6 +26,12 @@ namespace Net::TCP
         push(&v, 4);
     }
 
+    void Writer::u64(uint64_t v)
+    {
+        v = htonll(v);
+        push(&v, 8);
+    }
+
     void Writer::str16(const std::string_view s)
     {
         if (s.size() > 0xFFFFu)
@@ -73,6 +73,12 @@ namespace Net::TCP
          */
         void u32(uint32_t v);
 
+        /**
+         * @brief Write a 64-bit unsigned integer to the buffer.
+         * @param v The value to write.
+         */
+        void u64(uint64_t v);
+
         /**
          * @brief Write a length-prefixed string to the buffer.
          * @param s The string to write.
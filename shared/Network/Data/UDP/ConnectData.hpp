@@ -0,0 +1,28 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** ConnectData
+*/
+
+#pragma once
+#include "HeaderData.hpp"
+
+#pragma pack(push, 1)
+
+/**
+ * @brief Structure representing a connection request, and the server's challenge in reply.
+ * @details A client first sends CONNECT with a zero cookie. The server answers with a
+ * CHALLENGE carrying a cookie derived from the client's address, without allocating
+ * anything; the client then repeats CONNECT with that cookie. Both packets have the
+ * same size so that replying cannot amplify spoofed traffic.
+ */
+struct ConnectData {
+    HeaderData header; ///> The packet header containing type, version, and size.
+    uint64_t cookie;   ///> The cookie returned by the server, 0 on the first attempt (network order).
+    uint32_t seat;     ///> The seat token from ROOM_JOINED, 0 without one; 0 in CHALLENGE (network order).
+};
+
+#pragma pack(pop)
+
+static_assert(sizeof(ConnectData) == 16, "ConnectData layout mismatch");
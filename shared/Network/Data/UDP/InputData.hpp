@@ -9,6 +9,7 @@
 
 #include <cstddef>
 #include "HeaderData.hpp"
+#include "ReliableData.hpp"
 
 #pragma pack(push, 1)
 
@@ -31,6 +32,23 @@ struct PlayerInputData {
 
 static_assert(sizeof(PlayerInputData) == 5, "PlayerInputData layout mismatch");
 
+#pragma pack(push, 1)
+
+/**
+ * @brief Player input followed by the acknowledgement state of the client.
+ * @details Sent instead of PlayerInputData, with the same type, so that INPUT
+ * packets also acknowledge the reliable messages received from the server.
+ */
+struct PlayerInputAckData {
+    HeaderData header; ///> The packet header containing type, version, and size.
+    uint8_t flags;     ///> Bitwise flags representing player inputs (see PlayerInputData).
+    AckFields fields;  ///> The acknowledgement state.
+};
+
+#pragma pack(pop)
+
+static_assert(sizeof(PlayerInputAckData) == 11, "PlayerInputAckData layout mismatch");
+
 struct PlayerInput {
     bool up = false;    ///> Flag indicating upward movement.
     bool down = false;  ///> Flag indicating downward movement.
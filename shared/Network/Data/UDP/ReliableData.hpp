@@ -0,0 +1,59 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** ReliableData
+*/
+
+#pragma once
+#include "HeaderData.hpp"
+#include "UDPTypesData.hpp"
+
+#pragma pack(push, 1)
+
+/**
+ * @brief Header of a RELIABLE packet.
+ * @details It is followed by a complete inner packet (with its own HeaderData),
+ * delivered to the receiver once, in sequence order.
+ */
+struct ReliableHeader {
+    HeaderData header; ///> The packet header (type RELIABLE, size including the inner packet).
+    uint16_t seq = 0;  ///> Sequence number of the reliable message.
+};
+
+/**
+ * @brief Acknowledgement state of a reliable channel receiver.
+ * @details Every message up to and including ack has been received.
+ * Bit i of bits is set if message ack + 1 + i has also been received.
+ */
+struct AckFields {
+    uint16_t ack = 0;  ///> Last sequence number received in order.
+    uint32_t bits = 0; ///> Messages received after ack.
+};
+
+/**
+ * @brief Standalone acknowledgement packet, sent when no INPUT carries it.
+ */
+struct AckData {
+    HeaderData header; ///> The packet header containing type, version, and size.
+    AckFields fields;  ///> The acknowledgement state.
+};
+
+#pragma pack(pop)
+
+static_assert(sizeof(ReliableHeader) == 6, "ReliableHeader layout mismatch");
+static_assert(sizeof(AckFields) == 6, "AckFields layout mismatch");
+static_assert(sizeof(AckData) == 10, "AckData layout mismatch");
+
+namespace Net::Protocol::UDP
+{
+    /**
+     * @brief Tells whether packets of a type belong to the reliable message class.
+     * @param type The packet type.
+     * @return True if the packet must be sent through a reliable channel.
+     */
+    constexpr bool isReliable(const uint8_t type) noexcept
+    {
+        return type == DAMAGE_EVENT || type == GAME_OVER || type == SCORE;
+    }
+} // namespace Net::Protocol::UDP
@@ -33,6 +33,7 @@ namespace Net::Protocol::UDP
     constexpr uint8_t DISCONNECT = 0x02; ///> Client notifies server of disconnection
     constexpr uint8_t INPUT = 0x03;      ///> Client sends input commands to the server
     constexpr uint8_t PING = 0x04;       ///> Client sends a ping to check server latency
+    constexpr uint8_t ACK = 0x05;        ///> Client acknowledges reliable messages
 
     /**
      * @brief Packet from server to client.
@@ -44,5 +45,8 @@ namespace Net::Protocol::UDP
     constexpr uint8_t DAMAGE_EVENT = 0x14; ///> Server notifies client of a damage event
     constexpr uint8_t GAME_OVER = 0x15;    ///> Server notifies client of game over event
     constexpr uint8_t SCORE = 0x16;        ///> Server sends score update to the client
+    constexpr uint8_t RELIABLE = 0x17;     ///> Server wraps a packet in a sequenced, acknowledged message
+    constexpr uint8_t BATCH = 0x18;        ///> Server packs several packets of one tick in a single datagram
+    constexpr uint8_t CHALLENGE = 0x19;    ///> Server answers a CONNECT with the cookie to send back
 
 } // namespace Net::Protocol::UDP
\ No newline at end of file
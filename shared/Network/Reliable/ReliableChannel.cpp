@@ -0,0 +1,185 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** ReliableChannel
+*/
+
+#include "ReliableChannel.hpp"
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#ifdef _WIN32
+    #include <winsock2.h>
+#else
+    #include <arpa/inet.h>
+#endif
+
+namespace Net::Reliable
+{
+    AckFields swapAck(const AckFields &fields) noexcept
+    {
+        return AckFields{ntohs(fields.ack), ntohl(fields.bits)};
+    }
+
+    bool Sender::push(const uint8_t *packet, const std::size_t size)
+    {
+        const std::size_t total = sizeof(ReliableHeader) + size;
+        if (_pending.size() >= MAX_PENDING || size < sizeof(HeaderData) || total > std::numeric_limits<uint16_t>::max())
+            return false;
+
+        ReliableHeader header{};
+        header.header.type = Protocol::UDP::RELIABLE;
+        header.header.version = packet[1];
+        header.header.size = htons(static_cast<uint16_t>(total));
+        header.seq = htons(_nextSeq);
+
+        Pending entry;
+        entry.seq = _nextSeq++;
+        entry.datagram.resize(total);
+        std::memcpy(entry.datagram.data(), &header, sizeof(header));
+        std::memcpy(entry.datagram.data() + sizeof(header), packet, size);
+        _pending.push_back(std::move(entry));
+        return true;
+    }
+
+    void Sender::poll(const Clock::time_point now, const SendFunction &send)
+    {
+        bool expired = false;
+
+        for (auto &entry : _pending) {
+            if (!entry.sent) {
+                if (static_cast<uint16_t>(entry.seq - _pending.front().seq) >= WINDOW)
+                    break;
+                entry.sent = true;
+            } else if (now - entry.sentAt >= _rto) {
+                entry.resent = true;
+                expired = true;
+                _resent++;
+            } else {
+                continue;
+            }
+            entry.sentAt = now;
+            _sent++;
+            send(entry.datagram);
+        }
+        if (expired) {
+            _rto = std::min(_rto * 2, MAX_RTO);
+            _timeouts++;
+        }
+    }
+
+    void Sender::onAck(const AckFields &fields, const Clock::time_point now)
+    {
+        Clock::time_point latestSample{};
+        bool sampled = false;
+
+        _timeouts = 0;
+        std::erase_if(_pending, [&](const Pending &entry) {
+            if (!entry.sent)
+                return false;
+            const auto ahead = static_cast<uint16_t>(entry.seq - fields.ack - 1);
+            const bool acked = !seqAfter(entry.seq, fields.ack) || (ahead < WINDOW && ((fields.bits >> ahead) & 1u));
+            if (acked && !entry.resent && (!sampled || entry.sentAt > latestSample)) {
+                latestSample = entry.sentAt;
+                sampled = true;
+            }
+            return acked;
+        });
+        if (sampled)
+            sampleRtt(std::chrono::duration_cast<Duration>(now - latestSample));
+    }
+
+    void Sender::sampleRtt(const Duration sample) noexcept
+    {
+        if (!_hasSample) {
+            _srtt = sample;
+            _rttvar = sample / 2;
+            _hasSample = true;
+        } else {
+            const Duration delta = _srtt > sample ? _srtt - sample : sample - _srtt;
+            _rttvar = (_rttvar * 3 + delta) / 4;
+            _srtt = (_srtt * 7 + sample) / 8;
+        }
+        _rto = std::clamp(_srtt + _rttvar * 4, MIN_RTO, MAX_RTO);
+    }
+
+    Duration Sender::rto() const noexcept
+    {
+        return _rto;
+    }
+
+    Duration Sender::srtt() const noexcept
+    {
+        return _srtt;
+    }
+
+    std::size_t Sender::pending() const noexcept
+    {
+        return _pending.size();
+    }
+
+    std::uint64_t Sender::transmissions() const noexcept
+    {
+        return _sent;
+    }
+
+    std::uint64_t Sender::retransmissions() const noexcept
+    {
+        return _resent;
+    }
+
+    std::size_t Sender::timeouts() const noexcept
+    {
+        return _timeouts;
+    }
+
+    void Receiver::receive(
+        const uint16_t seq, const uint8_t *packet, const std::size_t size, const DeliverFunction &deliver)
+    {
+        _ackPending = true;
+        const auto ahead = static_cast<uint16_t>(seq - _expected);
+        if (ahead >= WINDOW)
+            return;
+
+        if (ahead != 0) {
+            const std::size_t slot = seq % WINDOW;
+            if (!_filled[slot]) {
+                _slots[slot].assign(packet, packet + size);
+                _filled[slot] = true;
+            }
+            return;
+        }
+
+        deliver(packet, size);
+        _expected++;
+        for (std::size_t slot = _expected % WINDOW; _filled[slot]; slot = _expected % WINDOW) {
+            _filled[slot] = false;
+            deliver(_slots[slot].data(), _slots[slot].size());
+            _expected++;
+        }
+    }
+
+    AckFields Receiver::ack() const noexcept
+    {
+        AckFields fields;
+        fields.ack = static_cast<uint16_t>(_expected - 1);
+        for (std::size_t i = 1; i < WINDOW; i++) {
+            if (_filled[(_expected + i) % WINDOW])
+                fields.bits |= 1u << i;
+        }
+        return fields;
+    }
+
+    bool Receiver::ackPending() const noexcept
+    {
+        return _ackPending;
+    }
+
+    AckFields Receiver::takeAck() noexcept
+    {
+        _ackPending = false;
+        return ack();
+    }
+} // namespace Net::Reliable
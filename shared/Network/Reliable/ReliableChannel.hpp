@@ -0,0 +1,195 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** ReliableChannel
+*/
+
+#pragma once
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <vector>
+#include "ReliableData.hpp"
+
+/**
+ * @brief Reliable, ordered message delivery on top of UDP.
+ *
+ * A Sender wraps each message in a RELIABLE packet carrying a 16-bit sequence
+ * number, keeps it until it is acknowledged and resends it once its
+ * retransmission timeout (RTO) expires. The RTO follows RFC 6298: it is derived
+ * from the smoothed round-trip time and its variation, measured on messages
+ * acknowledged without being resent (Karn's algorithm), and doubled on timeout.
+ *
+ * A Receiver delivers messages in sequence order exactly once, buffering the
+ * ones received ahead of a gap, and exposes the AckFields the peer needs.
+ *
+ * Neither class is thread-safe; callers serialize access.
+ */
+namespace Net::Reliable
+{
+    using Clock = std::chrono::steady_clock;    ///> Clock used for RTT and timeouts
+    using Duration = std::chrono::microseconds; ///> Resolution of RTT and timeouts
+
+    inline constexpr std::size_t WINDOW = 32;                               ///> Messages covered by the ack bits
+    inline constexpr std::size_t MAX_PENDING = 256;                         ///> Unacknowledged messages per sender
+    inline constexpr Duration INITIAL_RTO = std::chrono::milliseconds(200); ///> RTO before any RTT sample
+    inline constexpr Duration MIN_RTO = std::chrono::milliseconds(30);      ///> Lower bound of the RTO
+    inline constexpr Duration MAX_RTO = std::chrono::seconds(2);            ///> Upper bound of the RTO
+    inline constexpr std::size_t MAX_TIMEOUTS = 8;                          ///> Timeouts in a row telling the peer left
+
+    /**
+     * @brief Compare two sequence numbers, taking wrap-around into account.
+     * @return True if a comes strictly after b.
+     */
+    [[nodiscard]] constexpr bool seqAfter(const uint16_t a, const uint16_t b) noexcept
+    {
+        return static_cast<int16_t>(static_cast<uint16_t>(a - b)) > 0;
+    }
+
+    /**
+     * @brief Convert AckFields between host and network byte order.
+     * @param fields The fields to convert.
+     * @return The converted fields.
+     */
+    [[nodiscard]] AckFields swapAck(const AckFields &fields) noexcept;
+
+    /**
+     * @class Sender
+     * @brief Sending half of a reliable channel.
+     */
+    class Sender {
+      public:
+        using SendFunction = std::function<void(const std::vector<uint8_t> &)>; ///> Sends one datagram
+
+        /**
+         * @brief Queue a message.
+         * @param packet A complete packet (HeaderData included), sent as the RELIABLE payload.
+         * @param size The size of the packet.
+         * @return False if too many messages are waiting for an acknowledgement.
+         */
+        bool push(const uint8_t *packet, std::size_t size);
+
+        /**
+         * @brief Send the queued messages that fit in the window and resend the expired ones.
+         * @param now The current time.
+         * @param send Called with every datagram to put on the wire.
+         */
+        void poll(Clock::time_point now, const SendFunction &send);
+
+        /**
+         * @brief Process an acknowledgement from the peer.
+         * @param fields The acknowledgement, in host byte order.
+         * @param now The current time, used to sample the round-trip time.
+         */
+        void onAck(const AckFields &fields, Clock::time_point now);
+
+        /**
+         * @brief Get the current retransmission timeout.
+         * @return The RTO.
+         */
+        [[nodiscard]] Duration rto() const noexcept;
+
+        /**
+         * @brief Get the smoothed round-trip time.
+         * @return The SRTT, or zero before the first sample.
+         */
+        [[nodiscard]] Duration srtt() const noexcept;
+
+        /**
+         * @brief Get the number of messages not acknowledged yet.
+         * @return The number of pending messages.
+         */
+        [[nodiscard]] std::size_t pending() const noexcept;
+
+        /**
+         * @brief Get the number of datagrams put on the wire, retransmissions included.
+         * @return The number of transmissions.
+         */
+        [[nodiscard]] std::uint64_t transmissions() const noexcept;
+
+        /**
+         * @brief Get the number of datagrams resent after their timeout expired.
+         * @return The number of retransmissions.
+         */
+        [[nodiscard]] std::uint64_t retransmissions() const noexcept;
+
+        /**
+         * @brief Get the number of timeouts since the peer last acknowledged anything.
+         * @return The consecutive timeouts, compared to MAX_TIMEOUTS to tell a vanished peer.
+         */
+        [[nodiscard]] std::size_t timeouts() const noexcept;
+
+      private:
+        /**
+         * @brief A message waiting for its acknowledgement.
+         */
+        struct Pending {
+            uint16_t seq = 0;              ///> Sequence number
+            std::vector<uint8_t> datagram; ///> Complete RELIABLE packet
+            Clock::time_point sentAt{};    ///> Time of the last transmission
+            bool sent = false;             ///> Whether it has been transmitted at least once
+            bool resent = false;           ///> Whether it has been retransmitted (no RTT sample)
+        };
+
+        /**
+         * @brief Update the RTT estimators with a new sample.
+         * @param sample The measured round-trip time.
+         */
+        void sampleRtt(Duration sample) noexcept;
+
+        std::deque<Pending> _pending; ///> Unacknowledged messages, by sequence number
+        uint16_t _nextSeq = 0;        ///> Sequence number of the next message
+        Duration _srtt{0};            ///> Smoothed round-trip time
+        Duration _rttvar{0};          ///> Round-trip time variation
+        Duration _rto = INITIAL_RTO;  ///> Retransmission timeout
+        bool _hasSample = false;      ///> Whether the RTT has been measured yet
+        std::uint64_t _sent = 0;      ///> Datagrams put on the wire
+        std::uint64_t _resent = 0;    ///> Datagrams resent after a timeout
+        std::size_t _timeouts = 0;    ///> Timeouts since the last acknowledgement
+    };
+
+    /**
+     * @class Receiver
+     * @brief Receiving half of a reliable channel.
+     */
+    class Receiver {
+      public:
+        using DeliverFunction = std::function<void(const uint8_t *, std::size_t)>; ///> Handles one inner packet
+
+        /**
+         * @brief Process a RELIABLE packet payload.
+         * @param seq The sequence number, in host byte order.
+         * @param packet The inner packet.
+         * @param size The size of the inner packet.
+         * @param deliver Called with every message that becomes deliverable, in order.
+         */
+        void receive(uint16_t seq, const uint8_t *packet, std::size_t size, const DeliverFunction &deliver);
+
+        /**
+         * @brief Get the acknowledgement state, in host byte order.
+         * @return The fields to send to the peer.
+         */
+        [[nodiscard]] AckFields ack() const noexcept;
+
+        /**
+         * @brief Tells whether messages were received since the last takeAck().
+         * @return True if the peer is waiting for an acknowledgement.
+         */
+        [[nodiscard]] bool ackPending() const noexcept;
+
+        /**
+         * @brief Get the acknowledgement state and clear the pending flag.
+         * @return The fields to send to the peer, in host byte order.
+         */
+        [[nodiscard]] AckFields takeAck() noexcept;
+
+      private:
+        uint16_t _expected = 0;                            ///> Next sequence number to deliver
+        std::array<std::vector<uint8_t>, WINDOW> _slots{}; ///> Messages received ahead of _expected
+        std::array<bool, WINDOW> _filled{};                ///> Whether each slot holds a message
+        bool _ackPending = false;                          ///> Messages received since the last ack
+    };
+} // namespace Net::Reliable
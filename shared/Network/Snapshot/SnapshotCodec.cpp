@@ -0,0 +1,58 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** SnapshotCodec
+*/
+
+#include "SnapshotCodec.hpp"
+#include <algorithm>
+#include <cmath>
+#include "BitStream.hpp"
+
+namespace Net::Snapshot
+{
+    uint16_t quantize(const float value) noexcept
+    {
+        constexpr float Max = static_cast<float>((1u << POSITION_BITS) - 1);
+        const float steps = std::round((value - POSITION_MIN) * POSITION_SCALE);
+        return static_cast<uint16_t>(std::clamp(steps, 0.f, Max));
+    }
+
+    float dequantize(const uint16_t value) noexcept
+    {
+        return static_cast<float>(value) / POSITION_SCALE + POSITION_MIN;
+    }
+
+    void encodeCompact(const std::vector<SnapshotEntity> &entities, std::vector<uint8_t> &out)
+    {
+        Bits::BitWriter writer(out);
+
+        for (const auto &[id, x, y, spriteId] : entities) {
+            writer.writeVarint(id);
+            writer.write(quantize(x), POSITION_BITS);
+            writer.write(quantize(y), POSITION_BITS);
+            writer.write(std::min(spriteId, (1u << SPRITE_BITS) - 1), SPRITE_BITS);
+        }
+        writer.flush();
+    }
+
+    bool decodeCompact(
+        const uint8_t *data, const std::size_t size, const uint16_t count, std::vector<SnapshotEntity> &out)
+    {
+        Bits::BitReader reader(data, size);
+
+        out.reserve(out.size() + count);
+        for (uint16_t i = 0; i < count; i++) {
+            SnapshotEntity entity{};
+            entity.id = static_cast<size_t>(reader.readVarint());
+            entity.x = dequantize(static_cast<uint16_t>(reader.read(POSITION_BITS)));
+            entity.y = dequantize(static_cast<uint16_t>(reader.read(POSITION_BITS)));
+            entity.spriteId = reader.read(SPRITE_BITS);
+            if (!reader.ok())
+                return false;
+            out.push_back(entity);
+        }
+        return true;
+    }
+} // namespace Net::Snapshot
@@ -0,0 +1,65 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** SnapshotCodec
+*/
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "SnapEntityData.hpp"
+
+/**
+ * @brief Compact snapshot encoding (protocol version 2).
+ *
+ * A compact SNAPSHOT keeps the SnapshotBatchHeader of version 1 but replaces
+ * the array of SnapshotEntityData by a bit-packed stream, each entity being:
+ * - its id as a varint (8 bits below 128),
+ * - x and y as 16-bit fixed point (see POSITION_MIN and POSITION_SCALE),
+ * - its sprite id on 8 bits.
+ * That is 6 bytes for most entities instead of 20.
+ */
+namespace Net::Snapshot
+{
+    inline constexpr uint8_t LEGACY_VERSION = 1;  ///> Header version of SnapshotEntityData snapshots
+    inline constexpr uint8_t COMPACT_VERSION = 2; ///> Header version of bit-packed snapshots
+
+    inline constexpr float POSITION_MIN = -1024.f; ///> Smallest encodable coordinate
+    inline constexpr float POSITION_SCALE = 16.f;  ///> Steps per pixel (1/16 px precision)
+    inline constexpr unsigned POSITION_BITS = 16;  ///> Bits per coordinate
+    inline constexpr unsigned SPRITE_BITS = 8;     ///> Bits per sprite id
+
+    /**
+     * @brief Converts a coordinate to fixed point, clamping it to the encodable range.
+     * @param value The coordinate.
+     * @return The fixed-point coordinate.
+     */
+    [[nodiscard]] uint16_t quantize(float value) noexcept;
+
+    /**
+     * @brief Converts a fixed-point coordinate back to a float.
+     * @param value The fixed-point coordinate.
+     * @return The coordinate.
+     */
+    [[nodiscard]] float dequantize(uint16_t value) noexcept;
+
+    /**
+     * @brief Appends the compact encoding of entities to a buffer.
+     * @param entities The entities to encode.
+     * @param out The buffer to append to.
+     */
+    void encodeCompact(const std::vector<SnapshotEntity> &entities, std::vector<uint8_t> &out);
+
+    /**
+     * @brief Decodes compact entities.
+     * @param data The bit-packed stream following the SnapshotBatchHeader.
+     * @param size The size of the stream.
+     * @param count The number of entities announced by the header.
+     * @param out Receives the decoded entities.
+     * @return False if the stream is shorter than announced.
+     */
+    [[nodiscard]] bool decodeCompact(
+        const uint8_t *data, std::size_t size, uint16_t count, std::vector<SnapshotEntity> &out);
+} // namespace Net::Snapshot
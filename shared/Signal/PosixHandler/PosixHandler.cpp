@@ -8,7 +8,7 @@
 #ifndef _WIN32
 
     #include "PosixHandler.hpp"
-    #include <iostream>
+    #include "Log.hpp"
 
 using namespace Signal;
 
@@ -24,7 +24,7 @@ PosixHandler::~PosixHandler()
     try {
         stop();
     } catch (...) {
-        std::cerr << "{PosixHandler::~PosixHandler} Exception occurred during destruction" << std::endl;
+        Log::error("PosixHandler::~PosixHandler", "exception occurred during destruction");
     }
     instance = nullptr;
 }
@@ -46,7 +46,7 @@ void PosixHandler::start() noexcept
         sigaction(SIGTERM, &action, nullptr);
         sigaction(SIGHUP, &action, nullptr);
     } catch (const std::exception &e) {
-        std::cerr << "{PosixHandler::start} Failed to start signal handler" << std::endl;
+        Log::error("PosixHandler::start", "failed to start signal handler", {{"error", e.what()}});
         stop();
     }
 }
@@ -62,7 +62,7 @@ void PosixHandler::stop() noexcept
         signal(SIGTERM, SIG_DFL);
         signal(SIGHUP, SIG_DFL);
     } catch (...) {
-        std::cerr << "{PosixHandler::stop} Failed to stop signal handler" << std::endl;
+        Log::error("PosixHandler::stop", "failed to stop signal handler");
     }
 }
 
@@ -78,7 +78,7 @@ void PosixHandler::registerCallback(SignalType type, std::function<void()> callb
             return;
         _handlers[type].push_back(callback);
     } catch (...) {
-        std::cerr << "{PosixHandler::registerCallback} Failed to register callback" << std::endl;
+        Log::error("PosixHandler::registerCallback", "failed to register callback");
     }
 }
 
@@ -10,7 +10,7 @@
     #include "WinHandler.hpp"
 
     #include <csignal>
-    #include <iostream>
+    #include "Log.hpp"
 
 using namespace Signal;
 
@@ -35,7 +35,7 @@ WinHandler::~WinHandler()
     try {
         stop();
     } catch (...) {
-        std::cerr << "{WinHandler::~WinHandler} Exception occurred during destruction" << std::endl;
+        Log::error("WinHandler::~WinHandler", "exception occurred during destruction");
     }
     instance = nullptr;
 }
@@ -51,7 +51,7 @@ void WinHandler::start() noexcept
         std::signal(SIGTERM, &WinHandler::handleSignal);
     } catch (...) {
         stop();
-        std::cerr << "{WinHandler::start} Exception occurred while starting signal handler" << std::endl;
+        Log::error("WinHandler::start", "exception occurred while starting signal handler");
     }
 }
 
@@ -64,7 +64,7 @@ void WinHandler::stop() noexcept
         std::signal(SIGINT, SIG_DFL);
         std::signal(SIGTERM, SIG_DFL);
     } catch (...) {
-        std::cerr << "{WinHandler::stop} Exception occurred while stopping signal handler" << std::endl;
+        Log::error("WinHandler::stop", "exception occurred while stopping signal handler");
     }
 }
 
@@ -73,7 +73,7 @@ void WinHandler::registerCallback(SignalType type, std::function<void()> callbac
     try {
         callbacks[type] = std::move(callback);
     } catch (...) {
-        std::cerr << "{WinHandler::registerCallback} Exception occurred while registering callback" << std::endl;
+        Log::error("WinHandler::registerCallback", "exception occurred while registering callback");
     }
 }
 
@@ -95,7 +95,7 @@ void WinHandler::handleSignal(int signum)
     try {
         cb();
     } catch (...) {
-        std::cerr << "{WinHandler::handleSignal} Unknown exception in signal callback" << std::endl;
+        Log::error("WinHandler::handleSignal", "unknown exception in signal callback");
     }
 }
 
@@ -0,0 +1,71 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** benchCommandBuffer
+*/
+
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <thread>
+#include "CommandBuffer.hpp"
+
+namespace
+{
+    /**
+     * @brief Command shaped like the server's GameCommand.
+     */
+    struct GameCommand {
+        int type = 0;
+        int sessionId = 0;
+        bool input[5] = {};
+    };
+} // namespace
+
+static void BM_CommandBuffer_PushPop(benchmark::State &state)
+{
+    Command::CommandBuffer<GameCommand> buffer(1024);
+    GameCommand cmd;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(buffer.push(cmd));
+        benchmark::DoNotOptimize(buffer.pop(cmd));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_CommandBuffer_PushPop);
+
+static void BM_CommandBuffer_Drain(benchmark::State &state)
+{
+    Command::CommandBuffer<GameCommand> buffer(static_cast<std::size_t>(state.range(0)));
+    GameCommand cmd;
+
+    for (auto _ : state) {
+        for (int64_t i = 0; i < state.range(0); i++)
+            benchmark::DoNotOptimize(buffer.push(cmd));
+        while (buffer.pop(cmd))
+            benchmark::DoNotOptimize(cmd);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_CommandBuffer_Drain)->Arg(64)->Arg(1024);
+
+static void BM_CommandBuffer_ContendedPush(benchmark::State &state)
+{
+    Command::CommandBuffer<GameCommand> buffer(1024);
+    std::atomic<bool> running = true;
+    std::thread consumer([&buffer, &running]() {
+        GameCommand cmd;
+        while (running.load(std::memory_order_relaxed))
+            while (buffer.pop(cmd))
+                benchmark::DoNotOptimize(cmd);
+    });
+    const GameCommand cmd;
+
+    for (auto _ : state)
+        buffer.forcePush(cmd);
+    running = false;
+    consumer.join();
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_CommandBuffer_ContendedPush);
@@ -0,0 +1,289 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** benchRegistry
+*/
+
+#include <benchmark/benchmark.h>
+#include <vector>
+#include "Registry.hpp"
+#include "Serializer.hpp"
+
+namespace
+{
+    struct Position {
+        float x;
+        float y;
+    };
+
+    struct Velocity {
+        float vx;
+        float vy;
+    };
+
+    struct Health {
+        int current;
+        int max;
+    };
+
+    struct Tag {
+        unsigned int id;
+    };
+
+    /**
+     * @brief Fills a registry where every entity has a Position, every second one a Velocity,
+     * every third one a Health and every fourth one a Tag.
+     */
+    void populate(Ecs::Registry &reg, const int64_t count)
+    {
+        for (int64_t i = 0; i < count; i++) {
+            const Ecs::Entity ent = reg.createEntity();
+            reg.emplaceComponent<Position>(ent, Position{static_cast<float>(i), 0.f});
+            if (i % 2 == 0)
+                reg.emplaceComponent<Velocity>(ent, Velocity{1.f, 1.f});
+            if (i % 3 == 0)
+                reg.emplaceComponent<Health>(ent, Health{100, 100});
+            if (i % 4 == 0)
+                reg.emplaceComponent<Tag>(ent, Tag{static_cast<unsigned int>(i)});
+        }
+    }
+} // namespace
+
+static void BM_Registry_CreateEntity(benchmark::State &state)
+{
+    for (auto _ : state) {
+        Ecs::Registry reg;
+        for (int64_t i = 0; i < state.range(0); i++)
+            benchmark::DoNotOptimize(reg.createEntity());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Registry_CreateEntity)->Arg(1024)->Arg(16384);
+
+static void BM_Registry_Emplace(benchmark::State &state)
+{
+    for (auto _ : state) {
+        Ecs::Registry reg;
+        for (int64_t i = 0; i < state.range(0); i++) {
+            const Ecs::Entity ent = reg.createEntity();
+            reg.emplaceComponent<Position>(ent, Position{1.f, 2.f});
+            reg.emplaceComponent<Velocity>(ent, Velocity{3.f, 4.f});
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Registry_Emplace)->Arg(1024)->Arg(16384);
+
+template <typename... Components>
+static void BM_Registry_View(benchmark::State &state)
+{
+    Ecs::Registry reg;
+    populate(reg, state.range(0));
+
+    for (auto _ : state) {
+        size_t visited = 0;
+        reg.view<Components...>([&visited](Ecs::Entity, Components &...) {
+            visited++;
+        });
+        benchmark::DoNotOptimize(visited);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Registry_View<Position>)->Arg(1024)->Arg(16384);
+BENCHMARK(BM_Registry_View<Position, Velocity>)->Arg(1024)->Arg(16384);
+BENCHMARK(BM_Registry_View<Position, Velocity, Health>)->Arg(1024)->Arg(16384);
+BENCHMARK(BM_Registry_View<Position, Velocity, Health, Tag>)->Arg(1024)->Arg(16384);
+
+static void BM_Registry_Destroy(benchmark::State &state)
+{
+    for (auto _ : state) {
+        state.PauseTiming();
+        Ecs::Registry reg;
+        populate(reg, state.range(0));
+        state.ResumeTiming();
+        for (int64_t i = 0; i < state.range(0); i++)
+            reg.destroyEntity(Ecs::Entity(static_cast<size_t>(i)));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Registry_Destroy)->Arg(1024)->Arg(16384);
+
+static void BM_Registry_ViewExclude(benchmark::State &state)
+{
+    Ecs::Registry reg;
+    populate(reg, state.range(0));
+
+    for (auto _ : state) {
+        size_t visited = 0;
+        reg.view<Position, Velocity>(Ecs::Exclude<Tag>{}, [&visited](Ecs::Entity, Position &, Velocity &) {
+            visited++;
+        });
+        benchmark::DoNotOptimize(visited);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Registry_ViewExclude)->Arg(1024)->Arg(16384);
+
+template <typename... Components>
+static void BM_Registry_Group(benchmark::State &state)
+{
+    Ecs::Registry reg;
+    populate(reg, state.range(0));
+    auto &group = reg.group<Components...>();
+
+    for (auto _ : state) {
+        size_t visited = 0;
+        group.each([&visited](Ecs::Entity, Components &...) {
+            visited++;
+        });
+        benchmark::DoNotOptimize(visited);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Registry_Group<Position, Velocity>)->Arg(1024)->Arg(16384);
+BENCHMARK(BM_Registry_Group<Position, Velocity, Health, Tag>)->Arg(1024)->Arg(16384);
+
+/**
+ * @brief Moves 100k entities on a job system of range(0) threads; real time shows the scaling.
+ */
+static void BM_Registry_ParallelView(benchmark::State &state)
+{
+    constexpr int64_t Entities = 100000;
+    Ecs::Registry reg;
+    Ecs::JobSystem jobs(static_cast<size_t>(state.range(0)));
+    populate(reg, Entities);
+
+    for (auto _ : state) {
+        reg.parallelView<Position, Velocity>(jobs, [](Ecs::Entity, Position &pos, const Velocity &vel) {
+            pos.x += vel.vx * 0.016f;
+            pos.y += vel.vy * 0.016f;
+        });
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * Entities);
+}
+BENCHMARK(BM_Registry_ParallelView)->RangeMultiplier(2)->Range(1, 16)->UseRealTime();
+
+/**
+ * @brief Visits the 1% of range(0) entities patched since the last tick, against a full view.
+ */
+static void BM_Registry_Observe(benchmark::State &state)
+{
+    Ecs::Registry reg;
+    populate(reg, state.range(0));
+    reg.track<Position>();
+
+    for (auto _ : state) {
+        for (int64_t i = 0; i < state.range(0); i += 100)
+            reg.patch<Position>(Ecs::Entity(static_cast<size_t>(i)))->y += 1.f;
+        size_t visited = 0;
+        reg.observe<Position>(Ecs::Change::Modified, [&visited](Ecs::Entity, Ecs::Change) {
+            visited++;
+        });
+        reg.clearChanges();
+        benchmark::DoNotOptimize(visited);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Registry_Observe)->Arg(16384)->Arg(100000);
+
+/**
+ * @brief Destroys every other entity, each one three times as colliding systems do, one by one.
+ */
+static void BM_Registry_DestroyWave(benchmark::State &state)
+{
+    for (auto _ : state) {
+        state.PauseTiming();
+        Ecs::Registry reg;
+        populate(reg, state.range(0));
+        state.ResumeTiming();
+        for (int repeat = 0; repeat < 3; repeat++)
+            for (int64_t i = 0; i < state.range(0); i += 2)
+                reg.destroyEntity(Ecs::Entity(static_cast<size_t>(i)));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0) / 2);
+}
+BENCHMARK(BM_Registry_DestroyWave)->Arg(1024)->Arg(16384);
+
+/**
+ * @brief Same wave as BM_Registry_DestroyWave, deferred and applied by a single flush().
+ */
+static void BM_Registry_DeferredDestroyWave(benchmark::State &state)
+{
+    for (auto _ : state) {
+        state.PauseTiming();
+        Ecs::Registry reg;
+        populate(reg, state.range(0));
+        state.ResumeTiming();
+        for (int repeat = 0; repeat < 3; repeat++)
+            for (int64_t i = 0; i < state.range(0); i += 2)
+                reg.deferDestroy(Ecs::Entity(static_cast<size_t>(i)));
+        reg.flush();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0) / 2);
+}
+BENCHMARK(BM_Registry_DeferredDestroyWave)->Arg(1024)->Arg(16384);
+
+template <>
+struct Ecs::Codec<Position> : Ecs::TrivialCodec<Position, 1> {};
+template <>
+struct Ecs::Codec<Velocity> : Ecs::TrivialCodec<Velocity, 2> {};
+template <>
+struct Ecs::Codec<Health> : Ecs::TrivialCodec<Health, 3> {};
+template <>
+struct Ecs::Codec<Tag> : Ecs::TrivialCodec<Tag, 4> {};
+
+namespace
+{
+    Ecs::Serializer makeSerializer()
+    {
+        Ecs::Serializer serializer;
+        serializer.add<Position>().add<Velocity>().add<Health>().add<Tag>();
+        return serializer;
+    }
+} // namespace
+
+/**
+ * @brief Saves a populated registry to a blob whose memory is reused, as a periodic checkpoint does.
+ */
+static void BM_Serializer_Save(benchmark::State &state)
+{
+    Ecs::Registry reg;
+    const Ecs::Serializer serializer = makeSerializer();
+    std::vector<std::uint8_t> blob;
+
+    populate(reg, state.range(0));
+    for (auto _ : state) {
+        blob.clear();
+        Ecs::ByteWriter out(blob);
+        serializer.save(reg, out);
+        benchmark::DoNotOptimize(blob.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(blob.size()));
+}
+BENCHMARK(BM_Serializer_Save)->Arg(1024)->Arg(16384)->Arg(100000);
+
+/**
+ * @brief Restores a populated registry from a blob, as the server taking over a room does.
+ */
+static void BM_Serializer_Load(benchmark::State &state)
+{
+    Ecs::Registry source;
+    Ecs::Registry target;
+    const Ecs::Serializer serializer = makeSerializer();
+    std::vector<std::uint8_t> blob;
+    Ecs::ByteWriter out(blob);
+
+    populate(source, state.range(0));
+    serializer.save(source, out);
+    for (auto _ : state) {
+        Ecs::ByteReader in(blob.data(), blob.size());
+        serializer.load(target, in);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(blob.size()));
+}
+BENCHMARK(BM_Serializer_Load)->Arg(1024)->Arg(16384)->Arg(100000);
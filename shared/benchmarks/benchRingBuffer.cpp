@@ -0,0 +1,55 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** benchRingBuffer
+*/
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <vector>
+#include "RingBuffer/RingBuffer.hpp"
+
+static void BM_RingBuffer_PushPop(benchmark::State &state)
+{
+    Buffer::RingBuffer<std::uint64_t> ring(1024);
+    std::uint64_t value = 0;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ring.push(value));
+        benchmark::DoNotOptimize(ring.pop(value));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_RingBuffer_PushPop);
+
+static void BM_RingBuffer_FillDrain(benchmark::State &state)
+{
+    const auto count = static_cast<size_t>(state.range(0));
+    Buffer::RingBuffer<std::uint64_t> ring(count);
+    std::uint64_t value = 0;
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < count; i++)
+            benchmark::DoNotOptimize(ring.push(i));
+        for (size_t i = 0; i < count; i++)
+            benchmark::DoNotOptimize(ring.pop(value));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RingBuffer_FillDrain)->Arg(64)->Arg(4096);
+
+static void BM_RingBuffer_WriteRead(benchmark::State &state)
+{
+    const auto count = static_cast<size_t>(state.range(0));
+    Buffer::RingBuffer<std::uint8_t> ring(count * 2);
+    std::vector<std::uint8_t> in(count, 0x5a);
+    std::vector<std::uint8_t> out(count);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ring.write(in.data(), count));
+        benchmark::DoNotOptimize(ring.read(out.data(), count));
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RingBuffer_WriteRead)->Arg(64)->Arg(1500)->Arg(65536);
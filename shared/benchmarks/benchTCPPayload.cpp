@@ -0,0 +1,78 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** benchTCPPayload
+*/
+
+#include <benchmark/benchmark.h>
+#include <string>
+#include "TCPReader.hpp"
+#include "TCPWriter.hpp"
+
+namespace
+{
+    /**
+     * @brief Writes a room entry shaped like the LIST_ROOMS ones.
+     */
+    void writeRoom(Net::TCP::Writer &writer, const std::uint32_t id, const std::string &name)
+    {
+        writer.u32(id);
+        writer.str16(name);
+        writer.u8(2);
+        writer.u8(4);
+    }
+} // namespace
+
+static void BM_TCPWriter_Rooms(benchmark::State &state)
+{
+    const std::string name = "room of the benchmark";
+
+    for (auto _ : state) {
+        Net::TCP::Writer writer;
+        writer.u16(static_cast<std::uint16_t>(state.range(0)));
+        for (int64_t i = 0; i < state.range(0); i++)
+            writeRoom(writer, static_cast<std::uint32_t>(i), name);
+        benchmark::DoNotOptimize(writer.bytes().data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_TCPWriter_Rooms)->Arg(1)->Arg(64)->Arg(256);
+
+static void BM_TCPReader_Rooms(benchmark::State &state)
+{
+    Net::TCP::Writer writer;
+    writer.u16(static_cast<std::uint16_t>(state.range(0)));
+    for (int64_t i = 0; i < state.range(0); i++)
+        writeRoom(writer, static_cast<std::uint32_t>(i), "room of the benchmark");
+    const auto &bytes = writer.bytes();
+
+    for (auto _ : state) {
+        Net::TCP::Reader reader(bytes.data(), bytes.size());
+        const std::uint16_t count = reader.u16();
+        for (std::uint16_t i = 0; i < count; i++) {
+            benchmark::DoNotOptimize(reader.u32());
+            benchmark::DoNotOptimize(reader.str16());
+            benchmark::DoNotOptimize(reader.u8());
+            benchmark::DoNotOptimize(reader.u8());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_TCPReader_Rooms)->Arg(1)->Arg(64)->Arg(256);
+
+static void BM_TCPWriter_Integers(benchmark::State &state)
+{
+    for (auto _ : state) {
+        Net::TCP::Writer writer;
+        for (std::uint32_t i = 0; i < 256; i++) {
+            writer.u8(static_cast<std::uint8_t>(i));
+            writer.u16(static_cast<std::uint16_t>(i));
+            writer.u32(i);
+            writer.u64(i);
+        }
+        benchmark::DoNotOptimize(writer.bytes().data());
+    }
+    state.SetBytesProcessed(state.iterations() * 256 * 15);
+}
+BENCHMARK(BM_TCPWriter_Integers);
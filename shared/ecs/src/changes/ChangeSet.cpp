@@ -0,0 +1,54 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** ChangeSet
+*/
+
+#include "ChangeSet.hpp"
+#include <algorithm>
+
+namespace Ecs
+{
+    void ChangeSet::mark(const size_t index, const Change change)
+    {
+        if (index >= _flags.size())
+            _flags.resize(index + 1, 0);
+        if (_flags[index] == 0) {
+            _sorted = _sorted && (_dirty.empty() || _dirty.back() < index);
+            _dirty.push_back(index);
+        }
+        _flags[index] |= static_cast<std::uint8_t>(change);
+    }
+
+    Change ChangeSet::get(const size_t index) const noexcept
+    {
+        if (index >= _flags.size())
+            return Change::None;
+        return static_cast<Change>(_flags[index]);
+    }
+
+    size_t ChangeSet::size() const noexcept
+    {
+        return _dirty.size();
+    }
+
+    void ChangeSet::clear() noexcept
+    {
+        for (const size_t index : _dirty)
+            _flags[index] = 0;
+        _dirty.clear();
+        _sorted = true;
+    }
+
+    void ChangeSet::shrink() noexcept
+    {
+        size_t end = 0;
+
+        for (const size_t index : _dirty)
+            end = std::max(end, index + 1);
+        _flags.resize(end);
+        _flags.shrink_to_fit();
+        _dirty.shrink_to_fit();
+    }
+} // namespace Ecs
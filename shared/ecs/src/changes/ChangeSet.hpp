@@ -0,0 +1,105 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** ChangeSet
+*/
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @namespace Ecs
+ * @brief Entity Component System namespace
+ */
+namespace Ecs
+{
+    /**
+     * @brief Kinds of change recorded for a component, combined with `|`.
+     */
+    enum class Change : std::uint8_t {
+        None = 0,     ///> Nothing changed
+        Added = 1,    ///> The component was emplaced on an entity lacking it
+        Removed = 2,  ///> The component was removed, or its entity destroyed
+        Modified = 4, ///> The component was replaced or patched
+        Any = 7       ///> Any of the above
+    };
+
+    /**
+     * @brief Combines two sets of changes.
+     */
+    [[nodiscard]] constexpr Change operator|(const Change a, const Change b) noexcept
+    {
+        return static_cast<Change>(static_cast<std::uint8_t>(a) | static_cast<std::uint8_t>(b));
+    }
+
+    /**
+     * @brief Keeps the changes found in both sets.
+     */
+    [[nodiscard]] constexpr Change operator&(const Change a, const Change b) noexcept
+    {
+        return static_cast<Change>(static_cast<std::uint8_t>(a) & static_cast<std::uint8_t>(b));
+    }
+
+    /**
+     * @class ChangeSet
+     * @brief Changes of one component type since the last clear(), per entity slot.
+     *
+     * Each slot holds one flag byte, and the slots with a flag are also listed so that
+     * iterating the changes costs O(changed) rather than O(entities). Flags accumulate: a
+     * component added then patched in the same tick reads as `Added | Modified`.
+     */
+    class ChangeSet {
+      public:
+        /**
+         * @brief Records a change of a slot.
+         * @param index Entity index
+         * @param change The change to add to the slot's flags
+         */
+        void mark(size_t index, Change change);
+
+        /**
+         * @brief Gets the changes recorded for a slot.
+         * @param index Entity index
+         * @return The slot's flags, Change::None if it did not change
+         */
+        [[nodiscard]] Change get(size_t index) const noexcept;
+
+        /**
+         * @brief Visits the changed slots matching a mask, in ascending ID order.
+         *
+         * Function signature must be:
+         * `void(size_t index, Change changes)`
+         *
+         * @param mask The changes to look for
+         * @param fn Function called for each slot with at least one change of the mask
+         */
+        template <typename Function>
+        void each(Change mask, Function fn);
+
+        /**
+         * @brief Gets the number of changed slots.
+         * @return Slots with at least one change
+         */
+        [[nodiscard]] size_t size() const noexcept;
+
+        /**
+         * @brief Forgets every change, in O(changed).
+         */
+        void clear() noexcept;
+
+        /**
+         * @brief Releases the memory of the flags beyond the last changed slot.
+         */
+        void shrink() noexcept;
+
+      private:
+        std::vector<std::uint8_t> _flags; ///> Changes of each slot
+        std::vector<size_t> _dirty;       ///> Slots with a change, in the order of their first change
+        bool _sorted = true;              ///> Whether _dirty is in ascending order
+    };
+} // namespace Ecs
+
+#include "ChangeSet.tpp"
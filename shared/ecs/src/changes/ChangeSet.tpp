@@ -0,0 +1,26 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** ChangeSet
+*/
+
+#pragma once
+#include <algorithm>
+
+namespace Ecs
+{
+    template <typename Function>
+    void ChangeSet::each(const Change mask, Function fn)
+    {
+        if (!_sorted) {
+            std::ranges::sort(_dirty);
+            _sorted = true;
+        }
+        for (const size_t index : _dirty) {
+            const Change changes = static_cast<Change>(_flags[index]);
+            if ((changes & mask) != Change::None)
+                fn(index, changes);
+        }
+    }
+} // namespace Ecs
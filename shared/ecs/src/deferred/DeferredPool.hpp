@@ -0,0 +1,83 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** DeferredPool
+*/
+
+#pragma once
+#include <cstddef>
+#include <optional>
+#include <utility>
+#include <vector>
+
+/**
+ * @namespace Ecs
+ * @brief Entity Component System namespace
+ */
+namespace Ecs
+{
+    class Registry;
+
+    /**
+     * @class IDeferredPool
+     * @brief Type-erased interface the Registry uses to apply the deferred operations of one component type.
+     */
+    class IDeferredPool {
+      public:
+        /**
+         * @brief Default destructor
+         */
+        virtual ~IDeferredPool() = default;
+
+        /**
+         * @brief Applies the recorded operations in order, then forgets them.
+         * @param registry The registry owning the components
+         * @param destroyed Sorted indices of the entities destroyed by the same flush, whose operations are dropped
+         */
+        virtual void apply(Registry &registry, const std::vector<size_t> &destroyed) = 0;
+
+        /**
+         * @brief Checks if operations are waiting.
+         * @return true if nothing was recorded since the last apply()
+         */
+        [[nodiscard]] virtual bool empty() const noexcept = 0;
+
+        /**
+         * @brief Forgets the recorded operations without applying them.
+         */
+        virtual void clear() noexcept = 0;
+    };
+
+    /**
+     * @class DeferredPool
+     * @brief Emplace and remove operations of one component type, recorded by Registry::deferEmplace()
+     * and Registry::deferRemove() and applied by Registry::flush().
+     * @tparam T Component type
+     */
+    template <typename T>
+    class DeferredPool final : public IDeferredPool {
+      public:
+        /**
+         * @brief Records the emplacement of a component.
+         * @param index Entity index
+         * @param component The component to emplace
+         */
+        void emplace(size_t index, T component);
+
+        /**
+         * @brief Records the removal of a component.
+         * @param index Entity index
+         */
+        void remove(size_t index);
+
+        void apply(Registry &registry, const std::vector<size_t> &destroyed) override;
+
+        [[nodiscard]] bool empty() const noexcept override;
+
+        void clear() noexcept override;
+
+      private:
+        std::vector<std::pair<size_t, std::optional<T>>> _operations; ///> Entity and component, empty to remove
+    };
+} // namespace Ecs
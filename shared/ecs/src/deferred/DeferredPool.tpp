@@ -0,0 +1,50 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** DeferredPool
+*/
+
+#pragma once
+#include <algorithm>
+
+namespace Ecs
+{
+    template <typename T>
+    void DeferredPool<T>::emplace(const size_t index, T component)
+    {
+        _operations.emplace_back(index, std::move(component));
+    }
+
+    template <typename T>
+    void DeferredPool<T>::remove(const size_t index)
+    {
+        _operations.emplace_back(index, std::nullopt);
+    }
+
+    template <typename T>
+    void DeferredPool<T>::apply(Registry &registry, const std::vector<size_t> &destroyed)
+    {
+        for (auto &[index, component] : _operations) {
+            if (std::ranges::binary_search(destroyed, index))
+                continue;
+            if (component)
+                registry.emplaceComponent<T>(Entity(index), std::move(*component));
+            else
+                registry.removeComponent<T>(Entity(index));
+        }
+        _operations.clear();
+    }
+
+    template <typename T>
+    bool DeferredPool<T>::empty() const noexcept
+    {
+        return _operations.empty();
+    }
+
+    template <typename T>
+    void DeferredPool<T>::clear() noexcept
+    {
+        _operations.clear();
+    }
+} // namespace Ecs
@@ -0,0 +1,137 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** Group
+*/
+
+#pragma once
+#include <cstddef>
+#include <typeindex>
+#include <vector>
+#include "Entity.hpp"
+
+/**
+ * @namespace Ecs
+ * @brief Entity Component System namespace
+ */
+namespace Ecs
+{
+    class Registry;
+
+    /**
+     * @class IGroup
+     * @brief Type-erased interface the Registry uses to keep its groups in sync.
+     */
+    class IGroup {
+      public:
+        /**
+         * @brief Default destructor
+         */
+        virtual ~IGroup() = default;
+
+        /**
+         * @brief Re-evaluates whether an entity belongs to the group, after one of its components changed.
+         * @param index Entity index
+         * @throws std::bad_alloc if the group cannot grow
+         */
+        virtual void refresh(size_t index) = 0;
+
+        /**
+         * @brief Removes an entity from the group, after it was destroyed.
+         * @param index Entity index
+         */
+        virtual void erase(size_t index) noexcept = 0;
+
+        /**
+         * @brief Removes a batch of entities from the group, after they were destroyed by Registry::flush().
+         * @param sorted Entity indices, in ascending order
+         */
+        virtual void erase(const std::vector<size_t> &sorted) noexcept = 0;
+
+        /**
+         * @brief Removes every entity from the group, after the registry was cleared.
+         */
+        virtual void clear() noexcept = 0;
+
+        /**
+         * @brief Checks if a component type is part of the group's signature.
+         * @param type Component type
+         * @return true if changes of this component may change the group
+         */
+        [[nodiscard]] virtual bool watches(const std::type_index &type) const noexcept = 0;
+    };
+
+    /**
+     * @class Group
+     * @brief Persistent, packed list of the entities owning a set of components.
+     *
+     * A group is created once by Registry::group() and kept in sync by the registry on every
+     * emplaceComponent(), removeComponent(), destroyEntity() and clear(). Iterating it visits
+     * only matching entities, in ascending ID order like Registry::view(), with no membership
+     * check per entity.
+     *
+     * Components are still stored in their SparseArray, indexed by entity ID; the group only
+     * owns the packed list of IDs.
+     *
+     * @tparam Components Component types every entity of the group owns
+     */
+    template <typename... Components>
+    class Group final : public IGroup {
+      public:
+        /**
+         * @brief Builds the group from the entities already in the registry.
+         * @param registry The registry owning the components
+         */
+        explicit Group(Registry &registry);
+
+        /**
+         * @brief Calls a function for every entity of the group, in ascending ID order.
+         *
+         * Function signature must be:
+         * `void(Entity, Components&...)`
+         *
+         * The function must not add or remove components of the group's signature.
+         *
+         * @param fn Function called for each entity
+         */
+        template <typename Function>
+        void each(Function fn);
+
+        /**
+         * @brief Gets the IDs of the entities of the group.
+         * @return The IDs, sorted
+         */
+        [[nodiscard]] const std::vector<size_t> &entities() const noexcept;
+
+        /**
+         * @brief Gets the number of entities in the group.
+         * @return Number of entities
+         */
+        [[nodiscard]] size_t size() const noexcept;
+
+        /**
+         * @brief Checks if an entity belongs to the group.
+         * @param entity Target entity
+         * @return true if the entity owns every component of the group
+         */
+        [[nodiscard]] bool contains(Entity entity) const noexcept;
+
+        void refresh(size_t index) override;
+        void erase(size_t index) noexcept override;
+        void erase(const std::vector<size_t> &sorted) noexcept override;
+        void clear() noexcept override;
+        [[nodiscard]] bool watches(const std::type_index &type) const noexcept override;
+
+      private:
+        /**
+         * @brief Adds an entity, keeping the list sorted.
+         * @param index Entity index
+         * @throws std::bad_alloc if the list cannot grow, leaving it unchanged
+         */
+        void insert(size_t index);
+
+        Registry &_registry;                ///> Registry owning the components
+        std::vector<size_t> _entities = {}; ///> Sorted IDs of the matching entities
+    };
+} // namespace Ecs
@@ -0,0 +1,99 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** Group
+*/
+
+#pragma once
+#include <algorithm>
+
+namespace Ecs
+{
+    template <typename... Components>
+    Group<Components...>::Group(Registry &registry) : _registry(registry)
+    {
+        _registry.view<Components...>([this](const Entity entity, Components &...) {
+            _entities.push_back(static_cast<size_t>(entity));
+        });
+    }
+
+    template <typename... Components>
+    template <typename Function>
+    void Group<Components...>::each(Function fn)
+    {
+        auto arrays = std::forward_as_tuple(_registry.getComponents<Components>()...);
+
+        for (const size_t index : _entities)
+            fn(Entity(index), *std::get<SparseArray<Components> &>(arrays).at(index)...);
+    }
+
+    template <typename... Components>
+    const std::vector<size_t> &Group<Components...>::entities() const noexcept
+    {
+        return _entities;
+    }
+
+    template <typename... Components>
+    size_t Group<Components...>::size() const noexcept
+    {
+        return _entities.size();
+    }
+
+    template <typename... Components>
+    bool Group<Components...>::contains(const Entity entity) const noexcept
+    {
+        return std::ranges::binary_search(_entities, static_cast<size_t>(entity));
+    }
+
+    template <typename... Components>
+    void Group<Components...>::refresh(const size_t index)
+    {
+        const Entity entity(index);
+
+        if ((_registry.hasComponent<Components>(entity) && ...))
+            insert(index);
+        else
+            erase(index);
+    }
+
+    template <typename... Components>
+    void Group<Components...>::erase(const size_t index) noexcept
+    {
+        const auto it = std::ranges::lower_bound(_entities, index);
+
+        if (it != _entities.end() && *it == index)
+            _entities.erase(it);
+    }
+
+    template <typename... Components>
+    void Group<Components...>::erase(const std::vector<size_t> &sorted) noexcept
+    {
+        std::erase_if(_entities, [&sorted](const size_t index) {
+            return std::ranges::binary_search(sorted, index);
+        });
+    }
+
+    template <typename... Components>
+    void Group<Components...>::clear() noexcept
+    {
+        _entities.clear();
+    }
+
+    template <typename... Components>
+    bool Group<Components...>::watches(const std::type_index &type) const noexcept
+    {
+        return ((type == std::type_index(typeid(Components))) || ...);
+    }
+
+    template <typename... Components>
+    void Group<Components...>::insert(const size_t index)
+    {
+        if (_entities.empty() || _entities.back() < index) {
+            _entities.push_back(index);
+            return;
+        }
+        if (const auto it = std::ranges::lower_bound(_entities, index); *it != index)
+            _entities.insert(it, index);
+    }
+} // namespace Ecs
@@ -0,0 +1,154 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** JobSystem
+*/
+
+#include "JobSystem.hpp"
+#include <algorithm>
+#include <utility>
+
+namespace
+{
+    thread_local const Ecs::JobSystem::Chunk *currentChunkOfThread = nullptr;
+
+    /**
+     * @brief Publishes the chunk the thread runs for as long as it lives.
+     */
+    class ChunkScope {
+      public:
+        explicit ChunkScope(const Ecs::JobSystem::Chunk &chunk) noexcept : _previous(currentChunkOfThread)
+        {
+            currentChunkOfThread = &chunk;
+        }
+
+        ~ChunkScope()
+        {
+            currentChunkOfThread = _previous;
+        }
+
+        ChunkScope(const ChunkScope &) = delete;
+        ChunkScope &operator=(const ChunkScope &) = delete;
+
+      private:
+        const Ecs::JobSystem::Chunk *_previous; ///> Chunk of the enclosing run(), if nested
+    };
+} // namespace
+
+namespace Ecs
+{
+    std::atomic<std::uint64_t> JobSystem::_sections = 0;
+
+    JobSystem::JobSystem(const size_t concurrency)
+    {
+        const size_t workers = std::max<size_t>(concurrency, 1) - 1;
+
+        _workers.reserve(workers);
+        for (size_t i = 0; i < workers; i++)
+            _workers.emplace_back(&JobSystem::work, this);
+    }
+
+    JobSystem::~JobSystem()
+    {
+        {
+            std::scoped_lock lock(_mutex);
+            _stop = true;
+        }
+        _wake.notify_all();
+        for (auto &worker : _workers)
+            worker.join();
+    }
+
+    void JobSystem::run(const size_t count, const std::function<void(size_t)> &job)
+    {
+        if (count == 0)
+            return;
+        const std::uint64_t section = _sections.fetch_add(1, std::memory_order_relaxed) + 1;
+        std::unique_lock runLock(_runMutex, std::try_to_lock);
+        if (_workers.empty() || count == 1 || !runLock.owns_lock() || currentChunkOfThread)
+            return runInline(count, job, section);
+
+        {
+            std::scoped_lock lock(_mutex);
+            _next.store(0, std::memory_order_relaxed);
+            _job = &job;
+            _count = count;
+            _section = section;
+            _error = nullptr;
+        }
+        _wake.notify_all();
+        execute(job, count, section);
+
+        std::exception_ptr error = nullptr;
+        {
+            std::unique_lock lock(_mutex);
+            _done.wait(lock, [this] {
+                return _active == 0;
+            });
+            _job = nullptr;
+            error = std::exchange(_error, nullptr);
+        }
+        if (error)
+            std::rethrow_exception(error);
+    }
+
+    size_t JobSystem::concurrency() const noexcept
+    {
+        return _workers.size() + 1;
+    }
+
+    const JobSystem::Chunk *JobSystem::currentChunk() noexcept
+    {
+        return currentChunkOfThread;
+    }
+
+    void JobSystem::work()
+    {
+        std::uint64_t seen = 0;
+        std::unique_lock lock(_mutex);
+
+        while (true) {
+            _wake.wait(lock, [this, &seen] {
+                return _stop || (_job && _section != seen);
+            });
+            if (_stop)
+                return;
+            seen = _section;
+            const auto *job = _job;
+            const size_t count = _count;
+            _active++;
+            lock.unlock();
+
+            execute(*job, count, seen);
+
+            lock.lock();
+            if (--_active == 0)
+                _done.notify_all();
+        }
+    }
+
+    void JobSystem::execute(const std::function<void(size_t)> &job, const size_t count, const std::uint64_t section)
+    {
+        for (size_t index = _next.fetch_add(1); index < count; index = _next.fetch_add(1)) {
+            const Chunk chunk{section, index};
+            const ChunkScope scope(chunk);
+            try {
+                job(index);
+            } catch (...) {
+                std::scoped_lock lock(_mutex);
+                if (!_error)
+                    _error = std::current_exception();
+            }
+        }
+    }
+
+    void JobSystem::runInline(const size_t count, const std::function<void(size_t)> &job, const std::uint64_t section)
+    {
+        for (size_t index = 0; index < count; index++) {
+            const Chunk chunk{section, index};
+            const ChunkScope scope(chunk);
+            job(index);
+        }
+    }
+} // namespace Ecs
@@ -0,0 +1,112 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** JobSystem
+*/
+
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @namespace Ecs
+ * @brief Entity Component System namespace
+ */
+namespace Ecs
+{
+    /**
+     * @class JobSystem
+     * @brief Fixed pool of worker threads running the chunks of a parallel loop.
+     *
+     * run() hands out chunk indices to the workers and to the calling thread, and returns once
+     * every chunk is done. One loop runs at a time: a thread calling run() while another loop is
+     * running executes its chunks itself, so rooms sharing a pool never wait for each other.
+     */
+    class JobSystem {
+      public:
+        /**
+         * @brief Identifies the chunk the current thread is running.
+         */
+        struct Chunk {
+            std::uint64_t section; ///> Index of the run() call, increasing
+            size_t index;          ///> Index of the chunk within the run() call
+        };
+
+        /**
+         * @brief Starts the workers.
+         * @param concurrency Threads running chunks, the caller of run() included; 1 runs everything inline
+         */
+        explicit JobSystem(size_t concurrency = std::thread::hardware_concurrency());
+
+        /**
+         * @brief Stops and joins the workers.
+         */
+        ~JobSystem();
+
+        JobSystem(const JobSystem &) = delete;
+        JobSystem &operator=(const JobSystem &) = delete;
+
+        /**
+         * @brief Runs a job once per chunk and waits for all of them.
+         *
+         * Chunks may run in any order and on any thread. The first exception thrown by a job is
+         * rethrown once every chunk is done.
+         *
+         * @param count Number of chunks
+         * @param job Function called with each chunk index
+         */
+        void run(size_t count, const std::function<void(size_t)> &job);
+
+        /**
+         * @brief Gets the number of threads running chunks, the caller of run() included.
+         * @return The concurrency of the pool
+         */
+        [[nodiscard]] size_t concurrency() const noexcept;
+
+        /**
+         * @brief Gets the chunk the calling thread is running.
+         * @return The chunk, or nullptr outside of run()
+         */
+        [[nodiscard]] static const Chunk *currentChunk() noexcept;
+
+      private:
+        /**
+         * @brief Worker loop: waits for a run() and helps it.
+         */
+        void work();
+
+        /**
+         * @brief Claims and runs chunks of a run() until none are left.
+         */
+        void execute(const std::function<void(size_t)> &job, size_t count, std::uint64_t section);
+
+        /**
+         * @brief Runs every chunk on the calling thread.
+         */
+        static void runInline(size_t count, const std::function<void(size_t)> &job, std::uint64_t section);
+
+        std::vector<std::thread> _workers; ///> Worker threads
+        std::mutex _runMutex;              ///> Held by the thread whose loop the workers run
+
+        std::mutex _mutex;                                 ///> Protects the fields below
+        std::condition_variable _wake;                     ///> Signals workers that a run started or the pool stops
+        std::condition_variable _done;                     ///> Signals run() that the last helping worker left
+        const std::function<void(size_t)> *_job = nullptr; ///> Job of the current run, null between runs
+        size_t _count = 0;                                 ///> Chunks of the current run
+        std::uint64_t _section = 0;                        ///> Index of the current run
+        size_t _active = 0;                                ///> Workers helping the current run
+        bool _stop = false;                                ///> Whether the pool is being destroyed
+        std::exception_ptr _error = nullptr;               ///> First exception thrown by the current run
+
+        std::atomic<size_t> _next = 0;               ///> Next chunk to claim
+        static std::atomic<std::uint64_t> _sections; ///> Run counter shared by every pool
+    };
+} // namespace Ecs
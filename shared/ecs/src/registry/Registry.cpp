@@ -6,9 +6,20 @@
 */
 
 #include "Registry.hpp"
+#include <algorithm>
+#include <ranges>
 
 namespace Ecs
 {
+    Registry::Registry(std::pmr::memory_resource *resource) noexcept : _resource(resource)
+    {
+    }
+
+    std::pmr::memory_resource *Registry::resource() const noexcept
+    {
+        return _resource;
+    }
+
     Entity Registry::createEntity() noexcept
     {
         const Entity entity(_entityCounter);
@@ -21,15 +32,101 @@ namespace Ecs
         try {
             for (auto &func : _destroyers)
                 func(*this, entity);
+            for (const auto &group : _groups | std::views::values)
+                group->erase(static_cast<size_t>(entity));
         } catch (...) {
             return;
         }
     }
 
+    void Registry::deferDestroy(const Entity entity)
+    {
+        const auto idx = static_cast<size_t>(entity);
+
+        if (idx >= _doomedFlags.size())
+            _doomedFlags.resize(idx + 1, false);
+        if (_doomedFlags[idx])
+            return;
+        _doomedFlags[idx] = true;
+        _doomed.push_back(idx);
+    }
+
+    bool Registry::destroying(const Entity entity) const noexcept
+    {
+        const auto idx = static_cast<size_t>(entity);
+
+        return idx < _doomedFlags.size() && _doomedFlags[idx];
+    }
+
+    void Registry::flush()
+    {
+        std::ranges::sort(_doomed);
+        if (!_doomed.empty()) {
+            for (auto &func : _batchDestroyers)
+                func(*this, _doomed);
+            for (const auto &group : _groups | std::views::values)
+                group->erase(_doomed);
+        }
+        for (const auto &pool : _deferred | std::views::values)
+            if (!pool->empty())
+                pool->apply(*this, _doomed);
+        for (const size_t idx : _doomed)
+            _doomedFlags[idx] = false;
+        _doomed.clear();
+    }
+
     void Registry::clear() noexcept
     {
         _entityCounter = 0;
         _entityToIndex.clear();
         _destroyers.clear();
+        _batchDestroyers.clear();
+        _shrinkers.clear();
+        _footprints.clear();
+        for (const auto &group : _groups | std::views::values)
+            group->clear();
+        for (const auto &pool : _deferred | std::views::values)
+            pool->clear();
+        _doomed.clear();
+        _doomedFlags.clear();
+        clearChanges();
+    }
+
+    void Registry::clearChanges() noexcept
+    {
+        for (auto &changes : _changes | std::views::values)
+            changes.clear();
+    }
+
+    void Registry::refreshGroups(const std::type_index &type, const size_t index)
+    {
+        for (const auto &group : _groups | std::views::values)
+            if (group->watches(type))
+                group->refresh(index);
+    }
+
+    void Registry::shrink() noexcept
+    {
+        try {
+            for (auto &func : _shrinkers)
+                func(*this);
+            for (auto &changes : _changes | std::views::values)
+                changes.shrink();
+        } catch (...) {
+            return;
+        }
+    }
+
+    size_t Registry::memoryUsage() const noexcept
+    {
+        size_t bytes = 0;
+
+        try {
+            for (const auto &func : _footprints)
+                bytes += func(*this);
+        } catch (...) {
+            return bytes;
+        }
+        return bytes;
     }
 } // namespace Ecs
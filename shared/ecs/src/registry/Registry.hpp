@@ -9,9 +9,15 @@
 #include <any>
 #include <cstddef>
 #include <functional>
+#include <memory>
+#include <memory_resource>
 #include <typeindex>
 #include <vector>
+#include "ChangeSet.hpp"
+#include "DeferredPool.hpp"
 #include "Entity.hpp"
+#include "Group.hpp"
+#include "JobSystem.hpp"
 #include "SparseArray.hpp"
 #include <unordered_map>
 
@@ -21,6 +27,22 @@
  */
 namespace Ecs
 {
+    class Serializer;
+
+    /**
+     * @brief Tag listing the components an entity must not own to be visited by Registry::view().
+     * @tparam Components Excluded component types
+     */
+    template <typename... Components>
+    struct Exclude {};
+
+    /**
+     * @brief Tag listing the components Registry::view() passes by pointer, null when the entity lacks them.
+     * @tparam Components Optional component types
+     */
+    template <typename... Components>
+    struct Optional {};
+
     /**
      * @class Registry
      * @brief Central class of the ECS that manages entities and components.
@@ -33,6 +55,26 @@ namespace Ecs
      */
     class Registry {
       public:
+        static constexpr size_t CHUNK_ALIGNMENT = 64;      ///> Slots per chunk are a multiple of this
+        static constexpr size_t PARALLEL_MIN_CHUNK = 4096; ///> Default fewest entities per parallel chunk
+
+        /**
+         * @brief Constructs a registry whose component arrays allocate from the default resource.
+         */
+        Registry() = default;
+
+        /**
+         * @brief Constructs a registry whose component arrays allocate from a memory resource.
+         * @param resource The resource, which must outlive the registry
+         */
+        explicit Registry(std::pmr::memory_resource *resource) noexcept;
+
+        /**
+         * @brief Gets the memory resource the component arrays allocate from.
+         * @return The resource given at construction, or the default one
+         */
+        [[nodiscard]] std::pmr::memory_resource *resource() const noexcept;
+
         /**
          * @brief Creates a new entity.
          * @return A newly created Entity with a unique ID.
@@ -78,6 +120,15 @@ namespace Ecs
         template <typename T, typename... Args>
         void emplaceComponent(Entity entity, Args &&...args);
 
+        /**
+         * @brief Removes a component from an entity.
+         *
+         * @tparam T Component type
+         * @param entity Target entity
+         */
+        template <typename T>
+        void removeComponent(Entity entity);
+
         /**
          * @brief Checks if an entity owns a specific component.
          *
@@ -110,12 +161,228 @@ namespace Ecs
         template <typename... Components, typename Function>
         void view(Function fn) const;
 
+        /**
+         * @brief Iterates over entities owning a set of components and none of another set.
+         *
+         * Function signature must be:
+         * `void(Entity, Components&...)`
+         *
+         * @tparam Components List of required component types
+         * @tparam Excluded List of forbidden component types
+         * @param fn Function called for each valid entity
+         */
+        template <typename... Components, typename... Excluded, typename Function>
+        void view(Exclude<Excluded...>, Function fn);
+
+        /**
+         * @brief Iterates over entities owning a set of components, with some other components if present.
+         *
+         * Function signature must be:
+         * `void(Entity, Components&..., Optionals*...)`
+         *
+         * @tparam Components List of required component types
+         * @tparam Optionals List of component types passed as a null pointer when missing
+         * @param fn Function called for each valid entity
+         */
+        template <typename... Components, typename... Optionals, typename Function>
+        void view(Optional<Optionals...>, Function fn);
+
+        /**
+         * @brief Iterates over entities owning a set of components and none of another set,
+         * with some other components if present.
+         *
+         * Function signature must be:
+         * `void(Entity, Components&..., Optionals*...)`
+         *
+         * @tparam Components List of required component types
+         * @tparam Optionals List of component types passed as a null pointer when missing
+         * @tparam Excluded List of forbidden component types
+         * @param fn Function called for each valid entity
+         */
+        template <typename... Components, typename... Optionals, typename... Excluded, typename Function>
+        void view(Optional<Optionals...>, Exclude<Excluded...>, Function fn);
+
+        /**
+         * @brief Iterates over entities owning a set of components on several threads.
+         *
+         * The ID range is split into chunks of a multiple of CHUNK_ALIGNMENT slots, so no two chunks
+         * share a cache line of a component array, and the chunks run on the job system. Ranges of
+         * less than two chunks run on the calling thread.
+         *
+         * The function must only touch the components it receives: it must not create or destroy
+         * entities, nor add or remove components. Events it emits through an EventsRegistry are
+         * deferred and queued in ID order once the view returns.
+         *
+         * Function signature must be:
+         * `void(Entity, Components&...)`
+         *
+         * @tparam Components List of required component types
+         * @param jobs The job system running the chunks
+         * @param fn Function called for each valid entity, from any thread
+         * @param minChunk Fewest entities per chunk
+         */
+        template <typename... Components, typename Function>
+        void parallelView(JobSystem &jobs, Function fn, size_t minChunk = PARALLEL_MIN_CHUNK);
+
+        /**
+         * @brief Gets the persistent group of the entities owning a set of components.
+         *
+         * The group is created on the first call and kept in sync from then on, so hot systems
+         * can iterate it instead of scanning every slot of the component arrays.
+         *
+         * @tparam Components List of required component types
+         * @return A reference to the group, valid as long as the registry
+         */
+        template <typename... Components>
+        [[nodiscard]] Group<Components...> &group();
+
+        /**
+         * @brief Starts recording the changes of a component type.
+         *
+         * From then on emplaceComponent(), removeComponent(), destroyEntity() and patch() mark
+         * the entity in the type's ChangeSet until clearChanges(). Writes through getComponents()
+         * or view() are not seen: systems feeding an observer modify components with patch().
+         *
+         * @tparam T Component type
+         */
+        template <typename T>
+        void track();
+
+        /**
+         * @brief Checks if the changes of a component type are recorded.
+         * @tparam T Component type
+         * @return true if track<T>() was called
+         */
+        template <typename T>
+        [[nodiscard]] bool tracked() const noexcept;
+
+        /**
+         * @brief Gets a component to modify, marking it modified if its type is tracked.
+         *
+         * Not safe to call from parallelView(): the ChangeSet is not synchronized.
+         *
+         * @tparam T Component type
+         * @param entity Target entity
+         * @return A pointer to the component, or nullptr if the entity lacks it
+         */
+        template <typename T>
+        [[nodiscard]] T *patch(Entity entity);
+
+        /**
+         * @brief Iterates over the entities whose component T changed since the last clearChanges().
+         *
+         * Entities are visited in ascending ID order, in O(changed). Entities not owning every one
+         * of Components right now are skipped, so listing T there hides its removals.
+         *
+         * Function signature must be:
+         * `void(Entity, Change, Components&...)`
+         *
+         * @tparam T Tracked component type
+         * @tparam Components Components the entity must currently own, passed to the function
+         * @param mask The changes to look for
+         * @param fn Function called for each matching entity
+         */
+        template <typename T, typename... Components, typename Function>
+        void observe(Change mask, Function fn);
+
+        /**
+         * @brief Forgets the changes of every tracked component type, typically at the end of a tick.
+         */
+        void clearChanges() noexcept;
+
+        /**
+         * @brief Destroys an entity at the next flush().
+         *
+         * Destroying the same entity several times before the flush costs nothing more, and
+         * the flush removes all the destroyed entities from each pool in one pass. createEntity()
+         * only reserves an ID, so it needs no deferred counterpart.
+         *
+         * @param entity The entity to destroy
+         */
+        void deferDestroy(Entity entity);
+
+        /**
+         * @brief Checks if an entity will be destroyed by the next flush().
+         * @param entity Target entity
+         * @return true if deferDestroy() was called for the entity since the last flush()
+         */
+        [[nodiscard]] bool destroying(Entity entity) const noexcept;
+
+        /**
+         * @brief Constructs a component now and assigns it to an entity at the next flush().
+         *
+         * Ignored if the entity is destroyed by the same flush.
+         *
+         * @tparam T Component type
+         * @tparam Args Constructor parameter pack
+         * @param entity Target entity
+         * @param args Arguments forwarded to the component constructor
+         */
+        template <typename T, typename... Args>
+        void deferEmplace(Entity entity, Args &&...args);
+
+        /**
+         * @brief Removes a component from an entity at the next flush().
+         *
+         * @tparam T Component type
+         * @param entity Target entity
+         */
+        template <typename T>
+        void deferRemove(Entity entity);
+
+        /**
+         * @brief Applies the deferred operations: destructions first, one pass per pool, then the
+         * emplacements and removals of each component type in the order they were recorded.
+         *
+         * Call it at a sync point, when no system is iterating the registry.
+         */
+        void flush();
+
         /**
          * @brief Clears the registry, removing all entities and components.
          */
         void clear() noexcept;
 
+        /**
+         * @brief Shrinks every component array to its last component (see SparseArray::shrink()).
+         */
+        void shrink() noexcept;
+
+        /**
+         * @brief Gets the memory reserved by every component array.
+         * @return Number of bytes allocated for component slots
+         */
+        [[nodiscard]] size_t memoryUsage() const noexcept;
+
       private:
+        friend class Serializer;
+
+        /**
+         * @brief Gets the array of a component type without registering it.
+         * @tparam T Component type
+         * @return A pointer to the component SparseArray, or nullptr if the type was never registered
+         */
+        template <typename T>
+        [[nodiscard]] SparseArray<T> *find() noexcept;
+
+        /**
+         * @brief Re-evaluates the membership of an entity in every group watching a component type.
+         * @param type The component type that changed
+         * @param index Entity index
+         */
+        void refreshGroups(const std::type_index &type, size_t index);
+
+        /**
+         * @brief Gets the ChangeSet of a component type.
+         * @tparam T Component type
+         * @return A pointer to the ChangeSet, or nullptr if the type is not tracked
+         */
+        template <typename T>
+        [[nodiscard]] ChangeSet *changeSet() noexcept;
+
+        /** @brief Resource the component arrays allocate from */
+        std::pmr::memory_resource *_resource = std::pmr::get_default_resource();
+
         /** @brief Counter used to assign unique IDs to entities */
         size_t _entityCounter = 0;
 
@@ -124,7 +391,33 @@ namespace Ecs
 
         /** @brief List of cleanup functions called during entity destruction */
         std::vector<std::function<void(Registry &, Entity)>> _destroyers = {};
+
+        /** @brief Cleanup function of each component array for the sorted entities destroyed by flush() */
+        std::vector<std::function<void(Registry &, const std::vector<size_t> &)>> _batchDestroyers = {};
+
+        /** @brief Shrink function of each component array, registered with its destroyer */
+        std::vector<std::function<void(Registry &)>> _shrinkers = {};
+
+        /** @brief Memory usage function of each component array, registered with its destroyer */
+        std::vector<std::function<size_t(const Registry &)>> _footprints = {};
+
+        /** @brief Persistent groups indexed by their Group type */
+        std::unordered_map<std::type_index, std::unique_ptr<IGroup>> _groups = {};
+
+        /** @brief Changes of the tracked component types, indexed by component type */
+        std::unordered_map<std::type_index, ChangeSet> _changes = {};
+
+        /** @brief Entities destroyed at the next flush(), in the order of their first deferDestroy() */
+        std::vector<size_t> _doomed = {};
+
+        /** @brief Whether each entity is in _doomed */
+        std::vector<bool> _doomedFlags = {};
+
+        /** @brief Emplacements and removals waiting for flush(), indexed by component type */
+        std::unordered_map<std::type_index, std::unique_ptr<IDeferredPool>> _deferred = {};
     };
 } // namespace Ecs
 
-#include "Registry.tpp"
\ No newline at end of file
+#include "Registry.tpp"
+#include "DeferredPool.tpp"
+#include "Group.tpp"
\ No newline at end of file
@@ -6,6 +6,8 @@
 */
 
 #pragma once
+#include <algorithm>
+#include <tuple>
 
 namespace Ecs
 {
@@ -15,9 +17,31 @@ namespace Ecs
         const std::type_index typeIdx(typeid(T));
 
         if (_entityToIndex.contains(typeIdx) == false) {
-            _entityToIndex[typeIdx] = SparseArray<T>();
+            _entityToIndex[typeIdx] = SparseArray<T>(_resource);
             _destroyers.push_back([](Registry &reg, const Entity ent) {
-                reg.getComponents<T>().remove(static_cast<size_t>(ent));
+                auto &arr = reg.getComponents<T>();
+                const auto idx = static_cast<size_t>(ent);
+                if (auto *changes = reg.changeSet<T>(); changes && idx < arr.size() && arr.at(idx).has_value())
+                    changes->mark(idx, Change::Removed);
+                arr.remove(idx);
+            });
+            _batchDestroyers.push_back([](Registry &reg, const std::vector<size_t> &sorted) {
+                auto &arr = reg.getComponents<T>();
+                auto *changes = reg.changeSet<T>();
+                for (const size_t idx : sorted) {
+                    if (idx >= arr.size())
+                        break;
+                    if (changes && arr.at(idx).has_value())
+                        changes->mark(idx, Change::Removed);
+                    arr.remove(idx);
+                }
+            });
+            _shrinkers.push_back([](Registry &reg) {
+                reg.getComponents<T>().shrink();
+            });
+            _footprints.push_back([](const Registry &reg) {
+                return std::any_cast<const SparseArray<T> &>(reg._entityToIndex.at(std::type_index(typeid(T))))
+                    .memoryUsage();
             });
         }
         return std::any_cast<SparseArray<T> &>(_entityToIndex[typeIdx]);
@@ -32,8 +56,29 @@ namespace Ecs
     template <typename T, typename... Args>
     void Registry::emplaceComponent(const Entity entity, Args &&...args)
     {
-        auto data = registerComponent<T>();
-        getComponents<T>().insert(static_cast<size_t>(entity), T(std::forward<Args>(args)...));
+        auto &arr = registerComponent<T>();
+        const auto idx = static_cast<size_t>(entity);
+        auto *changes = changeSet<T>();
+        const bool replaced = changes && idx < arr.size() && arr.at(idx).has_value();
+
+        arr.insert(idx, T(std::forward<Args>(args)...));
+        if (changes)
+            changes->mark(idx, replaced ? Change::Modified : Change::Added);
+        if (!_groups.empty())
+            refreshGroups(std::type_index(typeid(T)), idx);
+    }
+
+    template <typename T>
+    void Registry::removeComponent(const Entity entity)
+    {
+        if (auto *arr = find<T>()) {
+            const auto idx = static_cast<size_t>(entity);
+            if (auto *changes = changeSet<T>(); changes && idx < arr->size() && arr->at(idx).has_value())
+                changes->mark(idx, Change::Removed);
+            arr->remove(idx);
+            if (!_groups.empty())
+                refreshGroups(std::type_index(typeid(T)), static_cast<size_t>(entity));
+        }
     }
 
     template <typename T>
@@ -53,26 +98,171 @@ namespace Ecs
     template <typename... Components, typename Function>
     void Registry::view(Function fn)
     {
+        view<Components...>(Optional<>{}, Exclude<>{}, fn);
+    }
+
+    template <typename... Components, typename Function>
+    void Registry::view(Function fn) const
+    {
+        const_cast<Registry *>(this)->view<Components...>(fn);
+    }
+
+    template <typename... Components, typename... Excluded, typename Function>
+    void Registry::view(Exclude<Excluded...> excluded, Function fn)
+    {
+        view<Components...>(Optional<>{}, excluded, fn);
+    }
+
+    template <typename... Components, typename... Optionals, typename Function>
+    void Registry::view(Optional<Optionals...> optionals, Function fn)
+    {
+        view<Components...>(optionals, Exclude<>{}, fn);
+    }
+
+    template <typename... Components, typename... Optionals, typename... Excluded, typename Function>
+    void Registry::view(Optional<Optionals...>, Exclude<Excluded...>, Function fn)
+    {
+        static_assert(sizeof...(Components) > 0, "view needs at least one required component");
         if ((!_entityToIndex.contains(std::type_index(typeid(Components))) || ...))
             return;
         auto arrays = std::forward_as_tuple(getComponents<Components>()...);
-        auto &first = std::get<0>(arrays);
-        const size_t maxSize = first.size();
+        [[maybe_unused]] const std::tuple<SparseArray<Optionals> *...> optionals(find<Optionals>()...);
+        [[maybe_unused]] const std::tuple<SparseArray<Excluded> *...> excluded(find<Excluded>()...);
+        const size_t maxSize = std::min({std::get<SparseArray<Components> &>(arrays).size()...});
 
         for (size_t i = 0; i < maxSize; ++i) {
-            const bool ok = ((i < std::get<SparseArray<Components> &>(arrays).size()
-                                 && std::get<SparseArray<Components> &>(arrays).at(i).has_value())
-                && ...);
-            if (!ok)
+            if (!(std::get<SparseArray<Components> &>(arrays).at(i).has_value() && ...))
+                continue;
+            const bool banned = ([&] {
+                const auto *arr = std::get<SparseArray<Excluded> *>(excluded);
+                return arr && i < arr->size() && arr->at(i).has_value();
+            }() || ...);
+            if (banned)
                 continue;
 
-            fn(Entity(i), *std::get<SparseArray<Components> &>(arrays).at(i)...);
+            fn(Entity(i), *std::get<SparseArray<Components> &>(arrays).at(i)..., [&]() -> Optionals * {
+                auto *arr = std::get<SparseArray<Optionals> *>(optionals);
+                if (!arr || i >= arr->size() || !arr->at(i).has_value())
+                    return nullptr;
+                return &*arr->at(i);
+            }()...);
         }
     }
 
     template <typename... Components, typename Function>
-    void Registry::view(Function fn) const
+    void Registry::parallelView(JobSystem &jobs, Function fn, const size_t minChunk)
     {
-        const_cast<Registry *>(this)->view<Components...>(fn);
+        if ((!_entityToIndex.contains(std::type_index(typeid(Components))) || ...))
+            return;
+        auto arrays = std::forward_as_tuple(getComponents<Components>()...);
+        const size_t maxSize = std::min({std::get<SparseArray<Components> &>(arrays).size()...});
+        const size_t perChunk = (maxSize + jobs.concurrency() * 4 - 1) / (jobs.concurrency() * 4);
+        const size_t chunk = (std::max({perChunk, minChunk, size_t{1}}) + CHUNK_ALIGNMENT - 1) / CHUNK_ALIGNMENT
+            * CHUNK_ALIGNMENT;
+        const size_t count = (maxSize + chunk - 1) / chunk;
+
+        jobs.run(count, [&](const size_t index) {
+            const size_t end = std::min(maxSize, (index + 1) * chunk);
+            for (size_t i = index * chunk; i < end; ++i) {
+                if (!(std::get<SparseArray<Components> &>(arrays).at(i).has_value() && ...))
+                    continue;
+                fn(Entity(i), *std::get<SparseArray<Components> &>(arrays).at(i)...);
+            }
+        });
+    }
+
+    template <typename... Components>
+    Group<Components...> &Registry::group()
+    {
+        const std::type_index typeIdx(typeid(Group<Components...>));
+
+        if (!_groups.contains(typeIdx)) {
+            (registerComponent<Components>(), ...);
+            _groups.emplace(typeIdx, std::make_unique<Group<Components...>>(*this));
+        }
+        return static_cast<Group<Components...> &>(*_groups.at(typeIdx));
+    }
+
+    template <typename T, typename... Args>
+    void Registry::deferEmplace(const Entity entity, Args &&...args)
+    {
+        auto &pool = _deferred[std::type_index(typeid(T))];
+
+        if (!pool)
+            pool = std::make_unique<DeferredPool<T>>();
+        static_cast<DeferredPool<T> &>(*pool).emplace(static_cast<size_t>(entity), T(std::forward<Args>(args)...));
+    }
+
+    template <typename T>
+    void Registry::deferRemove(const Entity entity)
+    {
+        auto &pool = _deferred[std::type_index(typeid(T))];
+
+        if (!pool)
+            pool = std::make_unique<DeferredPool<T>>();
+        static_cast<DeferredPool<T> &>(*pool).remove(static_cast<size_t>(entity));
+    }
+
+    template <typename T>
+    void Registry::track()
+    {
+        registerComponent<T>();
+        _changes.try_emplace(std::type_index(typeid(T)));
+    }
+
+    template <typename T>
+    bool Registry::tracked() const noexcept
+    {
+        return _changes.contains(std::type_index(typeid(T)));
+    }
+
+    template <typename T>
+    T *Registry::patch(const Entity entity)
+    {
+        auto *arr = find<T>();
+        const auto idx = static_cast<size_t>(entity);
+
+        if (!arr || idx >= arr->size() || !arr->at(idx).has_value())
+            return nullptr;
+        if (auto *changes = changeSet<T>())
+            changes->mark(idx, Change::Modified);
+        return &*arr->at(idx);
+    }
+
+    template <typename T, typename... Components, typename Function>
+    void Registry::observe(const Change mask, Function fn)
+    {
+        auto *changes = changeSet<T>();
+        if (!changes)
+            return;
+        const std::tuple<SparseArray<Components> *...> arrays(find<Components>()...);
+
+        changes->each(mask, [&](const size_t i, const Change change) {
+            const bool owned = ([&] {
+                const auto *arr = std::get<SparseArray<Components> *>(arrays);
+                return arr && i < arr->size() && arr->at(i).has_value();
+            }() && ...);
+            if (owned)
+                fn(Entity(i), change, *std::get<SparseArray<Components> *>(arrays)->at(i)...);
+        });
+    }
+
+    template <typename T>
+    ChangeSet *Registry::changeSet() noexcept
+    {
+        if (_changes.empty())
+            return nullptr;
+        const auto it = _changes.find(std::type_index(typeid(T)));
+        return it == _changes.end() ? nullptr : &it->second;
+    }
+
+    template <typename T>
+    SparseArray<T> *Registry::find() noexcept
+    {
+        const auto it = _entityToIndex.find(std::type_index(typeid(T)));
+
+        if (it == _entityToIndex.end())
+            return nullptr;
+        return std::any_cast<SparseArray<T>>(&it->second);
     }
 } // namespace Ecs
@@ -0,0 +1,104 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** ByteStream
+*/
+
+#include "ByteStream.hpp"
+#include <cstring>
+
+namespace Ecs
+{
+    ByteWriter::ByteWriter(std::vector<std::uint8_t> &out) noexcept : _out(out)
+    {
+    }
+
+    void ByteWriter::writeVarint(std::uint64_t value)
+    {
+        while (value >= 0x80) {
+            _out.push_back(static_cast<std::uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+        _out.push_back(static_cast<std::uint8_t>(value));
+    }
+
+    void ByteWriter::writeFixed(std::uint64_t value, const size_t bytes)
+    {
+        for (size_t i = 0; i < bytes; i++) {
+            _out.push_back(static_cast<std::uint8_t>(value & 0xFF));
+            value >>= 8;
+        }
+    }
+
+    void ByteWriter::patchFixed(const size_t offset, std::uint64_t value, const size_t bytes) noexcept
+    {
+        for (size_t i = 0; i < bytes && offset + i < _out.size(); i++) {
+            _out[offset + i] = static_cast<std::uint8_t>(value & 0xFF);
+            value >>= 8;
+        }
+    }
+
+    void ByteWriter::writeBytes(const void *data, const size_t size)
+    {
+        const auto *bytes = static_cast<const std::uint8_t *>(data);
+        _out.insert(_out.end(), bytes, bytes + size);
+    }
+
+    size_t ByteWriter::size() const noexcept
+    {
+        return _out.size();
+    }
+
+    ByteReader::ByteReader(const std::uint8_t *data, const size_t size) noexcept : _data(data), _size(size)
+    {
+    }
+
+    std::uint64_t ByteReader::readVarint()
+    {
+        std::uint64_t value = 0;
+
+        for (unsigned shift = 0; shift < 64; shift += 7) {
+            require(1);
+            const std::uint8_t byte = _data[_offset++];
+            value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0)
+                return value;
+        }
+        throw SerializeError("{ByteReader::readVarint} Varint longer than 64 bits");
+    }
+
+    std::uint64_t ByteReader::readFixed(const size_t bytes)
+    {
+        std::uint64_t value = 0;
+
+        require(bytes);
+        for (size_t i = 0; i < bytes; i++)
+            value |= static_cast<std::uint64_t>(_data[_offset + i]) << (8 * i);
+        _offset += bytes;
+        return value;
+    }
+
+    void ByteReader::readBytes(void *data, const size_t size)
+    {
+        require(size);
+        std::memcpy(data, _data + _offset, size);
+        _offset += size;
+    }
+
+    size_t ByteReader::offset() const noexcept
+    {
+        return _offset;
+    }
+
+    size_t ByteReader::remaining() const noexcept
+    {
+        return _size - _offset;
+    }
+
+    void ByteReader::require(const size_t size) const
+    {
+        if (size > _size - _offset)
+            throw SerializeError("{ByteReader::require} Unexpected end of data");
+    }
+} // namespace Ecs
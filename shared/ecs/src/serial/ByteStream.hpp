@@ -0,0 +1,158 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** ByteStream
+*/
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <string>
+#include <vector>
+
+/**
+ * @namespace Ecs
+ * @brief Entity Component System namespace
+ */
+namespace Ecs
+{
+    /**
+     * @class SerializeError
+     * @brief Exception thrown when a registry cannot be saved or a blob cannot be loaded.
+     */
+    class SerializeError : public std::exception {
+      public:
+        /**
+         * @brief Constructor for SerializeError.
+         * @param message The error message.
+         */
+        explicit SerializeError(const std::string &message) : _message("\n\t" + message)
+        {
+        }
+
+        /**
+         * @brief Override of what() method from std::exception.
+         * @return The error message.
+         */
+        const char *what() const noexcept override
+        {
+            return _message.c_str();
+        }
+
+      private:
+        std::string _message; ///> Error message
+    };
+
+    /**
+     * @class ByteWriter
+     * @brief Appends little-endian integers, varints and raw bytes to a byte buffer.
+     */
+    class ByteWriter {
+      public:
+        /**
+         * @brief Constructs a writer appending to a buffer.
+         * @param out The buffer to append to; existing bytes are kept.
+         */
+        explicit ByteWriter(std::vector<std::uint8_t> &out) noexcept;
+
+        /**
+         * @brief Writes an unsigned LEB128 varint.
+         * @param value The value to write.
+         */
+        void writeVarint(std::uint64_t value);
+
+        /**
+         * @brief Writes a little-endian fixed-width integer.
+         * @param value The value; bytes above `bytes` are ignored.
+         * @param bytes The number of bytes to write, at most 8.
+         */
+        void writeFixed(std::uint64_t value, size_t bytes);
+
+        /**
+         * @brief Overwrites a fixed-width integer written earlier, to fill in a size known afterwards.
+         * @param offset Position of the integer in the buffer.
+         * @param value The value.
+         * @param bytes The number of bytes of the integer, at most 8.
+         */
+        void patchFixed(size_t offset, std::uint64_t value, size_t bytes) noexcept;
+
+        /**
+         * @brief Writes raw bytes.
+         * @param data The first byte.
+         * @param size The number of bytes.
+         */
+        void writeBytes(const void *data, size_t size);
+
+        /**
+         * @brief Gets the size of the buffer.
+         * @return Bytes in the buffer, those present before the writer included.
+         */
+        [[nodiscard]] size_t size() const noexcept;
+
+      private:
+        std::vector<std::uint8_t> &_out; ///> Destination buffer
+    };
+
+    /**
+     * @class ByteReader
+     * @brief Reads values written by a ByteWriter.
+     * @details Reading past the end throws a SerializeError.
+     */
+    class ByteReader {
+      public:
+        /**
+         * @brief Constructs a reader over a byte range.
+         * @param data The first byte.
+         * @param size The number of bytes.
+         */
+        ByteReader(const std::uint8_t *data, size_t size) noexcept;
+
+        /**
+         * @brief Reads a value written by ByteWriter::writeVarint().
+         * @return The value.
+         * @throws SerializeError if it is truncated or longer than 64 bits.
+         */
+        [[nodiscard]] std::uint64_t readVarint();
+
+        /**
+         * @brief Reads a little-endian fixed-width integer.
+         * @param bytes The number of bytes to read, at most 8.
+         * @return The value.
+         * @throws SerializeError if it is truncated.
+         */
+        [[nodiscard]] std::uint64_t readFixed(size_t bytes);
+
+        /**
+         * @brief Reads raw bytes.
+         * @param data Where to copy the bytes.
+         * @param size The number of bytes.
+         * @throws SerializeError if fewer bytes are left.
+         */
+        void readBytes(void *data, size_t size);
+
+        /**
+         * @brief Gets the number of bytes read so far.
+         * @return Offset of the next byte.
+         */
+        [[nodiscard]] size_t offset() const noexcept;
+
+        /**
+         * @brief Gets the number of bytes left.
+         * @return Bytes after the offset.
+         */
+        [[nodiscard]] size_t remaining() const noexcept;
+
+      private:
+        /**
+         * @brief Throws unless enough bytes are left.
+         * @param size The number of bytes about to be read.
+         */
+        void require(size_t size) const;
+
+        const std::uint8_t *_data; ///> First byte
+        size_t _size;              ///> Number of bytes
+        size_t _offset = 0;        ///> Next byte to read
+    };
+} // namespace Ecs
@@ -0,0 +1,85 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** Codec
+*/
+
+#pragma once
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include "ByteStream.hpp"
+
+/**
+ * @namespace Ecs
+ * @brief Entity Component System namespace
+ */
+namespace Ecs
+{
+    /**
+     * @brief Binary encoding of a component type, specialized for each type a Serializer saves.
+     *
+     * A specialization provides:
+     * - `static constexpr std::uint32_t ID`, unique among the types of a Serializer and stable
+     *   across builds, since it names the pool in the blob,
+     * - `static void write(ByteWriter &, const T &)`,
+     * - `static T read(ByteReader &)`, which throws a SerializeError on malformed data.
+     *
+     * Trivially copyable components derive from TrivialCodec.
+     *
+     * @tparam T Component type
+     */
+    template <typename T>
+    struct Codec;
+
+    /**
+     * @brief Codec copying the bytes of a trivially copyable component as they are in memory.
+     *
+     * The bytes are those of the host, so the blob only loads on a server of the same build.
+     *
+     * @tparam T Component type
+     * @tparam Id Pool identifier of the type
+     */
+    template <typename T, std::uint32_t Id>
+    struct TrivialCodec {
+        static_assert(std::is_trivially_copyable_v<T>, "TrivialCodec needs a trivially copyable component");
+
+        static constexpr std::uint32_t ID = Id; ///> Pool identifier of the type
+
+        /**
+         * @brief Writes a component.
+         * @param out The writer.
+         * @param component The component.
+         */
+        static void write(ByteWriter &out, const T &component)
+        {
+            out.writeBytes(&component, sizeof(T));
+        }
+
+        /**
+         * @brief Reads a component.
+         * @param in The reader.
+         * @return The component.
+         */
+        static T read(ByteReader &in)
+        {
+            std::array<std::byte, sizeof(T)> bytes;
+            in.readBytes(bytes.data(), sizeof(T));
+            return std::bit_cast<T>(bytes);
+        }
+    };
+
+    /**
+     * @brief Component types with a Codec specialization.
+     */
+    template <typename T>
+    concept Serializable = requires(ByteWriter &out, ByteReader &in, const T &component) {
+        { Codec<T>::ID } -> std::convertible_to<std::uint32_t>;
+        Codec<T>::write(out, component);
+        { Codec<T>::read(in) } -> std::same_as<T>;
+    };
+} // namespace Ecs
@@ -0,0 +1,87 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** Serializer
+*/
+
+#include "Serializer.hpp"
+#include <algorithm>
+#include <ranges>
+
+namespace Ecs
+{
+    void Serializer::save(const Registry &registry, ByteWriter &out) const
+    {
+        if (!registry._doomed.empty()
+            || std::ranges::any_of(registry._deferred | std::views::values, [](const auto &pool) {
+                   return !pool->empty();
+               }))
+            throw SerializeError("{Serializer::save} Deferred operations pending, flush the registry first");
+        for (const auto &type : registry._entityToIndex | std::views::keys)
+            if (std::ranges::none_of(_pools, [&type](const Pool &pool) { return pool.type == type; }))
+                throw SerializeError(std::string("{Serializer::save} No codec for component ") + type.name());
+
+        out.writeBytes(MAGIC, sizeof(MAGIC));
+        out.writeFixed(VERSION, 2);
+        out.writeVarint(registry._entityCounter);
+        out.writeVarint(registry._entityToIndex.size());
+        for (const auto &pool : _pools) {
+            if (!registry._entityToIndex.contains(pool.type))
+                continue;
+            out.writeFixed(pool.id, 4);
+            const size_t header = out.size();
+            out.writeFixed(0, 8);
+            const size_t count = pool.save(registry, out);
+            out.patchFixed(header, count, 4);
+            out.patchFixed(header + 4, out.size() - header - 8, 4);
+        }
+    }
+
+    void Serializer::load(Registry &registry, ByteReader &in) const
+    {
+        registry.clear();
+        try {
+            loadPools(registry, in);
+        } catch (...) {
+            registry.clear();
+            throw;
+        }
+    }
+
+    void Serializer::loadPools(Registry &registry, ByteReader &in) const
+    {
+        char magic[sizeof(MAGIC)];
+
+        in.readBytes(magic, sizeof(magic));
+        if (!std::equal(std::begin(magic), std::end(magic), std::begin(MAGIC)))
+            throw SerializeError("{Serializer::load} Not a registry blob");
+        if (in.readFixed(2) != VERSION)
+            throw SerializeError("{Serializer::load} Unsupported blob version");
+
+        const std::uint64_t counter = in.readVarint();
+        if (counter > MAX_ENTITIES)
+            throw SerializeError("{Serializer::load} Entity counter " + std::to_string(counter) + " out of range");
+        const auto entities = static_cast<size_t>(counter);
+        const std::uint64_t pools = in.readVarint();
+        for (std::uint64_t i = 0; i < pools; i++) {
+            const auto id = static_cast<std::uint32_t>(in.readFixed(4));
+            const auto count = static_cast<size_t>(in.readFixed(4));
+            const auto bytes = static_cast<size_t>(in.readFixed(4));
+            const auto pool = std::ranges::find(_pools, id, &Pool::id);
+            if (pool == _pools.end())
+                throw SerializeError("{Serializer::load} Unknown codec ID " + std::to_string(id));
+            if (bytes > in.remaining() || count > bytes)
+                throw SerializeError("{Serializer::load} Truncated pool " + std::to_string(id));
+            const size_t start = in.offset();
+            pool->load(registry, in, count, entities);
+            if (in.offset() - start != bytes)
+                throw SerializeError("{Serializer::load} Pool " + std::to_string(id) + " size mismatch");
+        }
+
+        registry._entityCounter = entities;
+        for (const auto &group : registry._groups | std::views::values)
+            for (size_t idx = 0; idx < entities; idx++)
+                group->refresh(idx);
+    }
+} // namespace Ecs
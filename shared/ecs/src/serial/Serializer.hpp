@@ -0,0 +1,98 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** Serializer
+*/
+
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <typeindex>
+#include <vector>
+#include "ByteStream.hpp"
+#include "Codec.hpp"
+#include "Registry.hpp"
+
+/**
+ * @namespace Ecs
+ * @brief Entity Component System namespace
+ */
+namespace Ecs
+{
+    /**
+     * @class Serializer
+     * @brief Saves every component array of a registry and its entity counter to a binary blob,
+     * and restores them exactly.
+     *
+     * Blob layout:
+     *   magic "RTEC" | u16 version | varint entity counter | varint pool count
+     * followed by each pool:
+     *   u32 codec ID | u32 component count | u32 payload bytes | payload
+     * where the payload lists the components in ID order, each as a varint ID delta (the ID
+     * itself for the first one) followed by its Codec encoding. Fixed-width integers are
+     * little-endian.
+     *
+     * Groups are rebuilt on load. Recorded changes, pending deferred operations and the
+     * event queues are not part of the blob.
+     */
+    class Serializer {
+      public:
+        static constexpr char MAGIC[4] = {'R', 'T', 'E', 'C'};  ///> Blob signature
+        static constexpr std::uint16_t VERSION = 1;             ///> Blob layout version
+        static constexpr size_t MAX_ENTITIES = size_t{1} << 24; ///> Largest entity counter a blob may hold
+
+        /**
+         * @brief Adds a component type to the types the serializer knows.
+         *
+         * Adding a type twice is a no-op.
+         *
+         * @tparam T Component type with a Codec specialization
+         * @return The serializer, to chain calls
+         * @throws SerializeError if another type already uses the same codec ID
+         */
+        template <Serializable T>
+        Serializer &add();
+
+        /**
+         * @brief Appends a registry to a blob.
+         * @param registry The registry, flushed: no deferred operation may be pending
+         * @param out The writer
+         * @throws SerializeError if an operation is pending or a component type was not added
+         */
+        void save(const Registry &registry, ByteWriter &out) const;
+
+        /**
+         * @brief Replaces the content of a registry with a blob written by save().
+         *
+         * The registry is cleared first, and cleared again if the blob turns out to be malformed.
+         *
+         * @param registry The registry
+         * @param in The reader, left after the blob
+         * @throws SerializeError if the blob is malformed or holds a component type not added
+         */
+        void load(Registry &registry, ByteReader &in) const;
+
+      private:
+        /**
+         * @brief Functions saving and loading the array of one component type.
+         */
+        struct Pool {
+            std::uint32_t id;                                                   ///> Codec ID
+            std::type_index type;                                               ///> Component type
+            std::function<size_t(const Registry &, ByteWriter &)> save;         ///> Writes components, returns count
+            std::function<void(Registry &, ByteReader &, size_t, size_t)> load; ///> Reads (count, entity counter) components
+        };
+
+        /**
+         * @brief Reads the pools of a blob after its header.
+         * @param registry The registry, cleared
+         * @param in The reader
+         */
+        void loadPools(Registry &registry, ByteReader &in) const;
+
+        std::vector<Pool> _pools; ///> Known component types, in the order they were added
+    };
+} // namespace Ecs
+
+#include "Serializer.tpp"
@@ -0,0 +1,50 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** Serializer
+*/
+
+#pragma once
+#include <string>
+
+namespace Ecs
+{
+    template <Serializable T>
+    Serializer &Serializer::add()
+    {
+        const std::type_index type(typeid(T));
+
+        for (const auto &pool : _pools) {
+            if (pool.type == type)
+                return *this;
+            if (pool.id == Codec<T>::ID)
+                throw SerializeError("{Serializer::add} Codec ID " + std::to_string(pool.id) + " used twice");
+        }
+        _pools.push_back(Pool{Codec<T>::ID, type,
+            [](const Registry &reg, ByteWriter &out) {
+                size_t count = 0;
+                size_t previous = 0;
+                reg.view<T>([&](const Entity entity, const T &component) {
+                    const auto idx = static_cast<size_t>(entity);
+                    out.writeVarint(idx - previous);
+                    Codec<T>::write(out, component);
+                    previous = idx;
+                    count++;
+                });
+                return count;
+            },
+            [](Registry &reg, ByteReader &in, const size_t count, const size_t entities) {
+                auto &arr = reg.registerComponent<T>();
+                size_t idx = 0;
+                for (size_t i = 0; i < count; i++) {
+                    const std::uint64_t delta = in.readVarint();
+                    if ((i > 0 && delta == 0) || delta >= entities - idx)
+                        throw SerializeError("{Serializer::load} Component of an unknown entity");
+                    idx += delta;
+                    arr.insert(idx, Codec<T>::read(in));
+                }
+            }});
+        return *this;
+    }
+} // namespace Ecs
@@ -6,6 +6,7 @@
 */
 
 #pragma once
+#include <memory_resource>
 #include <optional>
 #include <vector>
 
@@ -31,6 +32,25 @@ namespace Ecs
          *  @brief Default constructor and destructor
          */
         SparseArray() = default;
+
+        /**
+         * @brief Constructs an empty array allocating its slots from a memory resource.
+         * @param resource The resource, which must outlive the array
+         */
+        explicit SparseArray(std::pmr::memory_resource *resource) noexcept;
+
+        /**
+         * @brief Copies the components; the copy allocates from the default resource.
+         */
+        SparseArray(const SparseArray &other) = default;
+
+        /**
+         * @brief Moves the components, keeping their memory resource.
+         */
+        SparseArray(SparseArray &&other) noexcept = default;
+
+        SparseArray &operator=(const SparseArray &other) = default;
+        SparseArray &operator=(SparseArray &&other) = default;
         /**
          * @brief Default destructor
          */
@@ -72,9 +92,22 @@ namespace Ecs
          */
         size_t size() const noexcept;
 
+        /**
+         * @brief Drops the empty slots past the last component and releases the spare capacity.
+         *
+         * Slots before the last component are kept, since their index is the entity ID.
+         */
+        void shrink() noexcept;
+
+        /**
+         * @brief Gets the memory reserved by the array.
+         * @return Number of bytes allocated for slots, used or not
+         */
+        size_t memoryUsage() const noexcept;
+
       private:
         /** @brief Underlying container */
-        std::vector<std::optional<Component>> _components;
+        std::pmr::vector<std::optional<Component>> _components;
     };
 } // namespace Ecs
 
@@ -9,6 +9,11 @@
 
 namespace Ecs
 {
+    template <typename Component>
+    SparseArray<Component>::SparseArray(std::pmr::memory_resource *resource) noexcept : _components(resource)
+    {
+    }
+
     template <typename Component>
     void SparseArray<Component>::insert(size_t index, const Component &component) noexcept
     {
@@ -47,4 +52,22 @@ namespace Ecs
     {
         return _components.size();
     }
+
+    template <typename Component>
+    void SparseArray<Component>::shrink() noexcept
+    {
+        while (!_components.empty() && !_components.back().has_value())
+            _components.pop_back();
+        try {
+            _components.shrink_to_fit();
+        } catch (...) {
+            return;
+        }
+    }
+
+    template <typename Component>
+    size_t SparseArray<Component>::memoryUsage() const noexcept
+    {
+        return _components.capacity() * sizeof(std::optional<Component>);
+    }
 } // namespace Ecs
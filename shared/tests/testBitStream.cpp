@@ -0,0 +1,82 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** testBitStream
+*/
+
+#include <gtest/gtest.h>
+#include <vector>
+#include "BitStream.hpp"
+#include "SnapshotCodec.hpp"
+
+TEST(BitStream, fields_are_packed_without_padding)
+{
+    std::vector<uint8_t> bytes;
+    Net::Bits::BitWriter writer(bytes);
+
+    writer.write(0b101, 3);
+    writer.write(0x1FF, 9);
+    writer.write(0xABCD, 16);
+    writer.flush();
+    ASSERT_EQ(bytes.size(), 4u);
+
+    Net::Bits::BitReader reader(bytes.data(), bytes.size());
+    EXPECT_EQ(reader.read(3), 0b101u);
+    EXPECT_EQ(reader.read(9), 0x1FFu);
+    EXPECT_EQ(reader.read(16), 0xABCDu);
+    EXPECT_TRUE(reader.ok());
+    EXPECT_EQ(reader.read(8), 0u);
+    EXPECT_FALSE(reader.ok());
+}
+
+TEST(BitStream, varints_use_one_byte_per_seven_bits)
+{
+    std::vector<uint8_t> bytes;
+    Net::Bits::BitWriter writer(bytes);
+
+    writer.writeVarint(5);
+    writer.writeVarint(300);
+    writer.writeVarint(UINT64_MAX);
+    writer.flush();
+    EXPECT_EQ(bytes.size(), 1u + 2u + 10u);
+
+    Net::Bits::BitReader reader(bytes.data(), bytes.size());
+    EXPECT_EQ(reader.readVarint(), 5u);
+    EXPECT_EQ(reader.readVarint(), 300u);
+    EXPECT_EQ(reader.readVarint(), UINT64_MAX);
+    EXPECT_TRUE(reader.ok());
+}
+
+TEST(SnapshotCodec, positions_keep_sub_pixel_precision_and_clamp)
+{
+    for (const float value : {0.f, 0.0625f, 640.3f, 1279.9f, -20.f, 900.f})
+        EXPECT_NEAR(Net::Snapshot::dequantize(Net::Snapshot::quantize(value)), value, 1.f / 32.f);
+    EXPECT_FLOAT_EQ(Net::Snapshot::dequantize(Net::Snapshot::quantize(-5000.f)), Net::Snapshot::POSITION_MIN);
+    EXPECT_EQ(Net::Snapshot::quantize(1e6f), UINT16_MAX);
+}
+
+TEST(SnapshotCodec, compact_round_trip_is_under_a_third_of_legacy)
+{
+    std::vector<SnapshotEntity> entities;
+    for (unsigned i = 0; i < 100; i++)
+        entities.push_back({i, static_cast<float>(i) * 12.5f, 360.f, i % 8});
+
+    std::vector<uint8_t> bytes;
+    Net::Snapshot::encodeCompact(entities, bytes);
+    EXPECT_EQ(bytes.size(), 100u * 6u);
+    EXPECT_LT(bytes.size() * 3, entities.size() * sizeof(SnapshotEntityData));
+
+    std::vector<SnapshotEntity> decoded;
+    ASSERT_TRUE(Net::Snapshot::decodeCompact(bytes.data(), bytes.size(), 100, decoded));
+    ASSERT_EQ(decoded.size(), 100u);
+    for (size_t i = 0; i < decoded.size(); i++) {
+        EXPECT_EQ(decoded[i].id, entities[i].id);
+        EXPECT_FLOAT_EQ(decoded[i].x, entities[i].x);
+        EXPECT_FLOAT_EQ(decoded[i].y, entities[i].y);
+        EXPECT_EQ(decoded[i].spriteId, entities[i].spriteId);
+    }
+
+    decoded.clear();
+    EXPECT_FALSE(Net::Snapshot::decodeCompact(bytes.data(), bytes.size() - 1, 100, decoded));
+}
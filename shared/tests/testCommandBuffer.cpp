@@ -115,3 +115,33 @@ TEST(CommandBuffer, concurrent_push_and_pop_does_not_crash)
     producer.join();
     SUCCEED();
 }
+
+TEST(CommandBuffer, bounded_buffer_drops_and_counts_overflow)
+{
+    CommandBuffer<TestCmd> cb(2);
+
+    EXPECT_TRUE(cb.push({1}));
+    EXPECT_TRUE(cb.push({2}));
+    EXPECT_FALSE(cb.push({3}));
+    EXPECT_EQ(cb.dropped(), 1u);
+
+    TestCmd out;
+    ASSERT_TRUE(cb.pop(out));
+    EXPECT_EQ(out.value, 1);
+    EXPECT_TRUE(cb.push({4}));
+    EXPECT_EQ(cb.dropped(), 1u);
+}
+
+TEST(CommandBuffer, force_push_ignores_capacity)
+{
+    CommandBuffer<TestCmd> cb(1);
+
+    EXPECT_TRUE(cb.push({1}));
+    cb.forcePush({2});
+    EXPECT_EQ(cb.dropped(), 0u);
+
+    TestCmd out;
+    ASSERT_TRUE(cb.pop(out));
+    ASSERT_TRUE(cb.pop(out));
+    EXPECT_EQ(out.value, 2);
+}
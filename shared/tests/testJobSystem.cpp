@@ -0,0 +1,88 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** testJobSystem
+*/
+
+#include <atomic>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <vector>
+#include "JobSystem.hpp"
+
+TEST(JobSystem, runs_every_chunk_once)
+{
+    Ecs::JobSystem jobs(4);
+    std::vector<std::atomic<int>> runs(1000);
+
+    ASSERT_EQ(jobs.concurrency(), 4u);
+    for (int round = 0; round < 10; round++)
+        jobs.run(runs.size(), [&runs](const size_t index) {
+            runs[index].fetch_add(1);
+        });
+    for (const auto &count : runs)
+        ASSERT_EQ(count.load(), 10);
+}
+
+TEST(JobSystem, exposes_the_current_chunk)
+{
+    Ecs::JobSystem jobs(2);
+    std::atomic<bool> consistent = true;
+
+    ASSERT_EQ(Ecs::JobSystem::currentChunk(), nullptr);
+    jobs.run(64, [&consistent](const size_t index) {
+        const auto *chunk = Ecs::JobSystem::currentChunk();
+        if (!chunk || chunk->index != index)
+            consistent = false;
+    });
+    ASSERT_TRUE(consistent);
+    ASSERT_EQ(Ecs::JobSystem::currentChunk(), nullptr);
+}
+
+TEST(JobSystem, rethrows_the_first_exception_after_every_chunk)
+{
+    Ecs::JobSystem jobs(3);
+    std::atomic<int> runs = 0;
+
+    ASSERT_THROW(jobs.run(100,
+                     [&runs](const size_t index) {
+                         runs++;
+                         if (index == 10)
+                             throw std::runtime_error("chunk failed");
+                     }),
+        std::runtime_error);
+    ASSERT_EQ(runs.load(), 100);
+    jobs.run(4, [&runs](size_t) {
+        runs++;
+    });
+    ASSERT_EQ(runs.load(), 104);
+}
+
+TEST(JobSystem, nested_runs_execute_inline)
+{
+    Ecs::JobSystem jobs(4);
+    std::atomic<int> runs = 0;
+
+    jobs.run(8, [&](const size_t outer) {
+        jobs.run(8, [&](const size_t inner) {
+            const auto *chunk = Ecs::JobSystem::currentChunk();
+            if (chunk && chunk->index == inner)
+                runs++;
+        });
+        if (Ecs::JobSystem::currentChunk()->index == outer)
+            runs++;
+    });
+    ASSERT_EQ(runs.load(), 72);
+}
+
+TEST(JobSystem, single_thread_pool_runs_inline)
+{
+    Ecs::JobSystem jobs(1);
+    std::vector<size_t> order;
+
+    jobs.run(5, [&order](const size_t index) {
+        order.push_back(index);
+    });
+    ASSERT_EQ(order, (std::vector<size_t>{0, 1, 2, 3, 4}));
+}
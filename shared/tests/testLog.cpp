@@ -0,0 +1,114 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** testLog
+*/
+
+#include <gtest/gtest.h>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Log.hpp"
+
+namespace
+{
+    /**
+     * @brief Captures the lines written while it exists.
+     */
+    class Capture {
+      public:
+        Capture()
+        {
+            Log::flush();
+            Log::setSink([this](Log::Level, const std::string_view line) {
+                std::scoped_lock lock(_mutex);
+                _lines.emplace_back(line);
+            });
+        }
+
+        ~Capture()
+        {
+            Log::setSink({});
+        }
+
+        std::vector<std::string> lines()
+        {
+            Log::flush();
+            std::scoped_lock lock(_mutex);
+            return _lines;
+        }
+
+      private:
+        std::mutex _mutex;
+        std::vector<std::string> _lines;
+    };
+} // namespace
+
+TEST(Log, FormatsLevelCallSiteAndFields)
+{
+    Capture capture;
+
+    Log::warn("Test::fields", "bad header", {{"size", 3}, {"type", 0x42u}, {"ok", false}, {"name", "a b"}});
+    const auto lines = capture.lines();
+    ASSERT_EQ(lines.size(), 1u);
+    EXPECT_EQ(lines[0].substr(0, 3), "ts=");
+    EXPECT_NE(lines[0].find(" level=warn where=Test::fields msg=\"bad header\" size=3 type=66 ok=false name=\"a b\""),
+        std::string::npos);
+}
+
+TEST(Log, EscapesQuotedValues)
+{
+    Capture capture;
+
+    Log::error("Test::escape", "say \"hi\"\nbye");
+    const auto lines = capture.lines();
+    ASSERT_EQ(lines.size(), 1u);
+    EXPECT_NE(lines[0].find("msg=\"say \\\"hi\\\"\\nbye\""), std::string::npos);
+}
+
+TEST(Log, SkipsRecordsBelowTheMinimumLevel)
+{
+    Capture capture;
+
+    Log::setLevel(Log::Level::Warn);
+    Log::info("Test::level", "hidden");
+    Log::error("Test::level", "shown");
+    Log::setLevel(Log::Level::Info);
+    const auto lines = capture.lines();
+    ASSERT_EQ(lines.size(), 1u);
+    EXPECT_NE(lines[0].find("msg=shown"), std::string::npos);
+}
+
+TEST(Log, RateLimitCountsSuppressedRecords)
+{
+    Capture capture;
+    Log::RateLimit limit(0.001, 2);
+
+    for (int i = 0; i < 10; i++)
+        limit.warn("Test::limit", "flood", {{"i", i}});
+    const auto lines = capture.lines();
+    ASSERT_EQ(lines.size(), 2u);
+
+    std::uint64_t suppressed = 0;
+    EXPECT_FALSE(limit.allow(suppressed));
+    Log::RateLimit fresh(1000, 1);
+    EXPECT_TRUE(fresh.allow(suppressed));
+    EXPECT_EQ(suppressed, 0u);
+}
+
+TEST(Log, KeepsEveryThreadsRecords)
+{
+    Capture capture;
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < 4; t++)
+        threads.emplace_back([t]() {
+            for (int i = 0; i < 100; i++)
+                Log::info("Test::threads", "record", {{"thread", t}, {"i", i}});
+        });
+    for (auto &thread : threads)
+        thread.join();
+    EXPECT_EQ(capture.lines().size(), 400u);
+}
@@ -5,6 +5,7 @@
 ** testRegistry
 */
 
+#include <atomic>
 #include <gtest/gtest.h>
 #include "../../server/src/ecs/components/Health.hpp"
 #include "../../server/src/ecs/components/Position.hpp"
@@ -78,3 +79,230 @@ TEST(Registry, view_position_velocity)
     ASSERT_EQ(pos.at(static_cast<size_t>(e1))->x, 2.f);
     ASSERT_EQ(pos.at(static_cast<size_t>(e3))->y, 4.f);
 }
+
+TEST(Registry, shrink_releases_the_slots_of_destroyed_entities)
+{
+    Ecs::Registry registry;
+    std::vector<Ecs::Entity> entities;
+
+    for (int i = 0; i < 100; i++) {
+        entities.push_back(registry.createEntity());
+        registry.emplaceComponent<Ecs::Position>(entities.back(), 1.f, 1.f);
+        registry.emplaceComponent<Ecs::Health>(entities.back(), 100);
+    }
+    for (size_t i = 1; i < entities.size(); i++)
+        registry.destroyEntity(entities[i]);
+    const size_t before = registry.memoryUsage();
+
+    registry.shrink();
+
+    ASSERT_LT(registry.memoryUsage(), before);
+    ASSERT_EQ(registry.getComponents<Ecs::Position>().size(), 1);
+    ASSERT_TRUE(registry.hasComponent<Ecs::Health>(entities[0]));
+}
+
+TEST(Registry, view_skips_excluded_components)
+{
+    Ecs::Registry registry;
+    auto e1 = registry.createEntity();
+    auto e2 = registry.createEntity();
+
+    registry.emplaceComponent<Ecs::Position>(e1, 1.f, 1.f);
+    registry.emplaceComponent<Ecs::Position>(e2, 2.f, 2.f);
+    registry.emplaceComponent<Ecs::Health>(e2, 100);
+
+    std::vector<size_t> visited;
+    registry.view<Ecs::Position>(Ecs::Exclude<Ecs::Health>{}, [&](Ecs::Entity e, Ecs::Position &) {
+        visited.push_back(static_cast<size_t>(e));
+    });
+    ASSERT_EQ(visited, std::vector<size_t>{static_cast<size_t>(e1)});
+
+    visited.clear();
+    registry.view<Ecs::Position>(Ecs::Exclude<Ecs::Velocity>{}, [&](Ecs::Entity e, Ecs::Position &) {
+        visited.push_back(static_cast<size_t>(e));
+    });
+    ASSERT_EQ(visited.size(), 2);
+}
+
+TEST(Registry, view_passes_optional_components_by_pointer)
+{
+    Ecs::Registry registry;
+    auto e1 = registry.createEntity();
+    auto e2 = registry.createEntity();
+
+    registry.emplaceComponent<Ecs::Position>(e1, 1.f, 1.f);
+    registry.emplaceComponent<Ecs::Position>(e2, 2.f, 2.f);
+    registry.emplaceComponent<Ecs::Velocity>(e2, 3.f, 0.f);
+
+    int withVelocity = 0;
+    int withoutVelocity = 0;
+    registry.view<Ecs::Position>(Ecs::Optional<Ecs::Velocity, Ecs::Health>{},
+        [&](Ecs::Entity, Ecs::Position &pos, Ecs::Velocity *vel, Ecs::Health *health) {
+            ASSERT_EQ(health, nullptr);
+            if (vel) {
+                pos.x += vel->vx;
+                withVelocity++;
+            } else {
+                withoutVelocity++;
+            }
+        });
+    ASSERT_EQ(withVelocity, 1);
+    ASSERT_EQ(withoutVelocity, 1);
+    ASSERT_FLOAT_EQ(registry.getComponents<Ecs::Position>().at(static_cast<size_t>(e2))->x, 5.f);
+}
+
+TEST(Registry, group_stays_in_sync_with_the_components)
+{
+    Ecs::Registry registry;
+    auto e1 = registry.createEntity();
+    auto e2 = registry.createEntity();
+    auto e3 = registry.createEntity();
+
+    registry.emplaceComponent<Ecs::Position>(e1, 1.f, 1.f);
+    registry.emplaceComponent<Ecs::Velocity>(e1, 1.f, 0.f);
+    registry.emplaceComponent<Ecs::Position>(e2, 2.f, 2.f);
+    auto &group = registry.group<Ecs::Position, Ecs::Velocity>();
+    ASSERT_EQ(group.entities(), std::vector<size_t>{static_cast<size_t>(e1)});
+
+    registry.emplaceComponent<Ecs::Velocity>(e3, 1.f, 0.f);
+    registry.emplaceComponent<Ecs::Position>(e3, 3.f, 3.f);
+    registry.emplaceComponent<Ecs::Velocity>(e2, 1.f, 0.f);
+    ASSERT_EQ(group.entities(), (std::vector<size_t>{0, 1, 2}));
+
+    registry.removeComponent<Ecs::Velocity>(e2);
+    registry.destroyEntity(e1);
+    ASSERT_EQ(group.entities(), std::vector<size_t>{static_cast<size_t>(e3)});
+    ASSERT_FALSE(group.contains(e2));
+
+    group.each([](Ecs::Entity, Ecs::Position &pos, Ecs::Velocity &vel) {
+        pos.x += vel.vx;
+    });
+    ASSERT_FLOAT_EQ(registry.getComponents<Ecs::Position>().at(static_cast<size_t>(e3))->x, 4.f);
+
+    registry.clear();
+    ASSERT_EQ(group.size(), 0);
+    auto e4 = registry.createEntity();
+    registry.emplaceComponent<Ecs::Position>(e4, 1.f, 1.f);
+    registry.emplaceComponent<Ecs::Velocity>(e4, 1.f, 0.f);
+    ASSERT_TRUE(group.contains(e4));
+}
+
+TEST(Registry, parallel_view_visits_the_same_entities_as_view)
+{
+    Ecs::Registry registry;
+    Ecs::JobSystem jobs(4);
+
+    for (size_t i = 0; i < 10000; i++) {
+        auto e = registry.createEntity();
+        registry.emplaceComponent<Ecs::Position>(e, static_cast<float>(i), 0.f);
+        if (i % 3 == 0)
+            registry.emplaceComponent<Ecs::Velocity>(e, 1.f, 2.f);
+    }
+
+    std::atomic<size_t> visited = 0;
+    registry.parallelView<Ecs::Position, Ecs::Velocity>(
+        jobs,
+        [&visited](Ecs::Entity, Ecs::Position &pos, const Ecs::Velocity &vel) {
+            pos.x += vel.vx;
+            pos.y += vel.vy;
+            visited++;
+        },
+        Ecs::Registry::CHUNK_ALIGNMENT);
+    ASSERT_EQ(visited.load(), 3334u);
+
+    size_t moved = 0;
+    registry.view<Ecs::Position>([&moved](const Ecs::Entity e, const Ecs::Position &pos) {
+        const size_t id = static_cast<size_t>(e);
+        if (pos.x != static_cast<float>(id) + (id % 3 == 0 ? 1.f : 0.f))
+            return;
+        if (pos.y == (id % 3 == 0 ? 2.f : 0.f))
+            moved++;
+    });
+    ASSERT_EQ(moved, 10000u);
+}
+
+TEST(Registry, tracks_added_removed_and_patched_components)
+{
+    Ecs::Registry registry;
+    auto e1 = registry.createEntity();
+    auto e2 = registry.createEntity();
+    auto e3 = registry.createEntity();
+
+    registry.emplaceComponent<Ecs::Position>(e1, 1.f, 1.f);
+    registry.track<Ecs::Position>();
+    ASSERT_TRUE(registry.tracked<Ecs::Position>());
+    ASSERT_FALSE(registry.tracked<Ecs::Velocity>());
+
+    registry.emplaceComponent<Ecs::Position>(e3, 3.f, 3.f);
+    registry.emplaceComponent<Ecs::Position>(e2, 2.f, 2.f);
+    registry.emplaceComponent<Ecs::Velocity>(e2, 1.f, 0.f);
+    registry.patch<Ecs::Position>(e1)->x = 5.f;
+    registry.destroyEntity(e3);
+    ASSERT_EQ(registry.patch<Ecs::Position>(e3), nullptr);
+
+    std::vector<std::pair<size_t, Ecs::Change>> seen;
+    registry.observe<Ecs::Position>(Ecs::Change::Any, [&seen](const Ecs::Entity e, const Ecs::Change change) {
+        seen.emplace_back(static_cast<size_t>(e), change);
+    });
+    ASSERT_EQ(seen.size(), 3u);
+    ASSERT_EQ(seen[0], std::make_pair(size_t{0}, Ecs::Change::Modified));
+    ASSERT_EQ(seen[1], std::make_pair(size_t{1}, Ecs::Change::Added));
+    ASSERT_EQ(seen[2], std::make_pair(size_t{2}, Ecs::Change::Added | Ecs::Change::Removed));
+
+    int moving = 0;
+    registry.observe<Ecs::Position, Ecs::Position, Ecs::Velocity>(Ecs::Change::Added,
+        [&moving](Ecs::Entity, Ecs::Change, const Ecs::Position &pos, const Ecs::Velocity &vel) {
+            ASSERT_FLOAT_EQ(pos.x, 2.f);
+            ASSERT_FLOAT_EQ(vel.vx, 1.f);
+            moving++;
+        });
+    ASSERT_EQ(moving, 1);
+
+    registry.clearChanges();
+    registry.removeComponent<Ecs::Position>(e2);
+    seen.clear();
+    registry.observe<Ecs::Position>(Ecs::Change::Removed, [&seen](const Ecs::Entity e, const Ecs::Change change) {
+        seen.emplace_back(static_cast<size_t>(e), change);
+    });
+    ASSERT_EQ(seen, (std::vector<std::pair<size_t, Ecs::Change>>{{1, Ecs::Change::Removed}}));
+}
+
+TEST(Registry, deferred_operations_apply_on_flush)
+{
+    Ecs::Registry registry;
+    auto e1 = registry.createEntity();
+    auto e2 = registry.createEntity();
+    auto e3 = registry.createEntity();
+
+    registry.emplaceComponent<Ecs::Position>(e1, 1.f, 1.f);
+    registry.emplaceComponent<Ecs::Velocity>(e1, 1.f, 0.f);
+    registry.emplaceComponent<Ecs::Position>(e2, 2.f, 2.f);
+    registry.emplaceComponent<Ecs::Velocity>(e2, 1.f, 0.f);
+    auto &group = registry.group<Ecs::Position, Ecs::Velocity>();
+
+    registry.deferDestroy(e1);
+    registry.deferDestroy(e1);
+    registry.deferEmplace<Ecs::Health>(e1, 10, 10);
+    registry.deferEmplace<Ecs::Position>(e3, 3.f, 3.f);
+    registry.deferEmplace<Ecs::Velocity>(e3, 1.f, 0.f);
+    registry.deferRemove<Ecs::Velocity>(e2);
+    ASSERT_TRUE(registry.destroying(e1));
+    ASSERT_FALSE(registry.destroying(e2));
+    ASSERT_TRUE(registry.hasComponent<Ecs::Position>(e1));
+    ASSERT_FALSE(registry.hasComponent<Ecs::Position>(e3));
+
+    registry.flush();
+    ASSERT_FALSE(registry.destroying(e1));
+    ASSERT_FALSE(registry.hasComponent<Ecs::Position>(e1));
+    ASSERT_FALSE(registry.hasComponent<Ecs::Health>(e1));
+    ASSERT_FALSE(registry.hasComponent<Ecs::Velocity>(e2));
+    ASSERT_TRUE(registry.hasComponent<Ecs::Position>(e3));
+    ASSERT_EQ(group.entities(), std::vector<size_t>{static_cast<size_t>(e3)});
+
+    registry.deferEmplace<Ecs::Velocity>(e2, 2.f, 0.f);
+    registry.deferRemove<Ecs::Velocity>(e2);
+    registry.deferEmplace<Ecs::Velocity>(e2, 3.f, 0.f);
+    registry.flush();
+    ASSERT_FLOAT_EQ(registry.getComponents<Ecs::Velocity>().at(static_cast<size_t>(e2))->vx, 3.f);
+    ASSERT_EQ(group.size(), 2u);
+}
@@ -0,0 +1,182 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** testReliableChannel
+*/
+
+#include <cstring>
+#include <gtest/gtest.h>
+#include <vector>
+#include "ReliableChannel.hpp"
+
+#ifdef _WIN32
+    #include <winsock2.h>
+#else
+    #include <arpa/inet.h>
+#endif
+
+namespace
+{
+    using namespace std::chrono_literals;
+
+    std::vector<uint8_t> message(const uint8_t value)
+    {
+        HeaderData header{Net::Protocol::UDP::SCORE, 1, htons(5)};
+        std::vector<uint8_t> bytes(sizeof(header));
+        std::memcpy(bytes.data(), &header, sizeof(header));
+        bytes.push_back(value);
+        return bytes;
+    }
+
+    uint16_t seqOf(const std::vector<uint8_t> &datagram)
+    {
+        ReliableHeader header{};
+        std::memcpy(&header, datagram.data(), sizeof(header));
+        return ntohs(header.seq);
+    }
+
+    void receive(Net::Reliable::Receiver &receiver, const std::vector<uint8_t> &datagram, std::vector<uint8_t> &out)
+    {
+        receiver.receive(seqOf(datagram), datagram.data() + sizeof(ReliableHeader),
+            datagram.size() - sizeof(ReliableHeader), [&out](const uint8_t *packet, const size_t size) {
+                out.push_back(packet[size - 1]);
+            });
+    }
+} // namespace
+
+TEST(ReliableChannel, wraps_messages_with_increasing_sequence)
+{
+    Net::Reliable::Sender sender;
+    std::vector<std::vector<uint8_t>> sent;
+
+    ASSERT_TRUE(sender.push(message(1).data(), 5));
+    ASSERT_TRUE(sender.push(message(2).data(), 5));
+    sender.poll(Net::Reliable::Clock::now(), [&sent](const std::vector<uint8_t> &d) {
+        sent.push_back(d);
+    });
+
+    ASSERT_EQ(sent.size(), 2u);
+    EXPECT_EQ(sent[0][0], Net::Protocol::UDP::RELIABLE);
+    EXPECT_EQ(sent[0].size(), sizeof(ReliableHeader) + 5);
+    EXPECT_EQ(seqOf(sent[0]), 0);
+    EXPECT_EQ(seqOf(sent[1]), 1);
+    EXPECT_EQ(sent[1].back(), 2);
+}
+
+TEST(ReliableChannel, delivers_in_order_once_despite_loss_and_reordering)
+{
+    Net::Reliable::Sender sender;
+    Net::Reliable::Receiver receiver;
+    std::vector<std::vector<uint8_t>> sent;
+    std::vector<uint8_t> delivered;
+    auto now = Net::Reliable::Clock::now();
+
+    for (uint8_t i = 0; i < 4; i++)
+        sender.push(message(i).data(), 5);
+    sender.poll(now, [&sent](const std::vector<uint8_t> &d) {
+        sent.push_back(d);
+    });
+
+    receive(receiver, sent[2], delivered);
+    receive(receiver, sent[0], delivered);
+    receive(receiver, sent[0], delivered);
+    EXPECT_EQ(delivered, (std::vector<uint8_t>{0}));
+
+    const AckFields ack = receiver.takeAck();
+    EXPECT_EQ(ack.ack, 0);
+    EXPECT_EQ(ack.bits, 0b10u);
+    EXPECT_FALSE(receiver.ackPending());
+
+    now += 10ms;
+    sender.onAck(ack, now);
+    EXPECT_EQ(sender.pending(), 2u);
+    EXPECT_EQ(sender.srtt(), Net::Reliable::Duration(10ms));
+
+    sent.clear();
+    now += sender.rto();
+    sender.poll(now, [&sent](const std::vector<uint8_t> &d) {
+        sent.push_back(d);
+    });
+    ASSERT_EQ(sent.size(), 2u);
+    EXPECT_EQ(seqOf(sent[0]), 1);
+    EXPECT_EQ(seqOf(sent[1]), 3);
+
+    receive(receiver, sent[1], delivered);
+    receive(receiver, sent[0], delivered);
+    EXPECT_EQ(delivered, (std::vector<uint8_t>{0, 1, 2, 3}));
+
+    sender.onAck(receiver.takeAck(), now + 10ms);
+    EXPECT_EQ(sender.pending(), 0u);
+}
+
+TEST(ReliableChannel, rto_backs_off_on_timeout_and_follows_rtt)
+{
+    Net::Reliable::Sender sender;
+    auto now = Net::Reliable::Clock::now();
+    const auto ignore = [](const std::vector<uint8_t> &) {};
+
+    sender.push(message(0).data(), 5);
+    sender.poll(now, ignore);
+    EXPECT_EQ(sender.rto(), Net::Reliable::INITIAL_RTO);
+
+    now += Net::Reliable::INITIAL_RTO;
+    sender.poll(now, ignore);
+    EXPECT_EQ(sender.rto(), Net::Reliable::INITIAL_RTO * 2);
+
+    sender.onAck(AckFields{0, 0}, now + 5ms);
+    EXPECT_EQ(sender.pending(), 0u);
+    EXPECT_EQ(sender.srtt(), Net::Reliable::Duration(0)) << "resent messages must not be sampled";
+
+    sender.push(message(1).data(), 5);
+    sender.poll(now, ignore);
+    sender.onAck(AckFields{1, 0}, now + 40ms);
+    EXPECT_EQ(sender.srtt(), Net::Reliable::Duration(40ms));
+    EXPECT_EQ(sender.rto(), Net::Reliable::Duration(40ms + 4 * 20ms));
+}
+
+TEST(ReliableChannel, timeouts_count_until_the_peer_acknowledges)
+{
+    Net::Reliable::Sender sender;
+    auto now = Net::Reliable::Clock::now();
+    const auto ignore = [](const std::vector<uint8_t> &) {};
+
+    sender.push(message(0).data(), 5);
+    sender.push(message(1).data(), 5);
+    sender.poll(now, ignore);
+    for (int i = 0; i < 3; i++) {
+        now += Net::Reliable::MAX_RTO;
+        sender.poll(now, ignore);
+    }
+    EXPECT_EQ(sender.timeouts(), 3u);
+
+    sender.onAck(AckFields{0, 0}, now);
+    EXPECT_EQ(sender.timeouts(), 0u);
+    EXPECT_EQ(sender.pending(), 1u);
+}
+
+TEST(ReliableChannel, window_limits_messages_in_flight)
+{
+    Net::Reliable::Sender sender;
+    size_t sent = 0;
+    const auto count = [&sent](const std::vector<uint8_t> &) {
+        sent++;
+    };
+    const auto now = Net::Reliable::Clock::now();
+
+    for (size_t i = 0; i < Net::Reliable::WINDOW + 8; i++)
+        sender.push(message(0).data(), 5);
+    sender.poll(now, count);
+    EXPECT_EQ(sent, Net::Reliable::WINDOW);
+
+    sender.onAck(AckFields{7, 0}, now);
+    sender.poll(now, count);
+    EXPECT_EQ(sent, Net::Reliable::WINDOW + 8);
+}
+
+TEST(ReliableChannel, sequence_numbers_wrap_around)
+{
+    EXPECT_TRUE(Net::Reliable::seqAfter(0, 65535));
+    EXPECT_FALSE(Net::Reliable::seqAfter(65535, 0));
+    EXPECT_TRUE(Net::Reliable::seqAfter(10, 5));
+}
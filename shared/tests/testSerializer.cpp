@@ -0,0 +1,170 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** testSerializer
+*/
+
+#include <gtest/gtest.h>
+#include <string>
+#include "Serializer.hpp"
+
+namespace
+{
+    struct Point {
+        float x = 0.f;
+        float y = 0.f;
+    };
+
+    struct Name {
+        std::string value;
+    };
+
+    struct Untracked {
+        int value = 0;
+    };
+
+    struct Twin {
+        int value = 0;
+    };
+} // namespace
+
+template <>
+struct Ecs::Codec<Point> : Ecs::TrivialCodec<Point, 1> {};
+
+template <>
+struct Ecs::Codec<Twin> : Ecs::TrivialCodec<Twin, 1> {};
+
+template <>
+struct Ecs::Codec<Name> {
+    static constexpr std::uint32_t ID = 2;
+
+    static void write(ByteWriter &out, const Name &name)
+    {
+        out.writeVarint(name.value.size());
+        out.writeBytes(name.value.data(), name.value.size());
+    }
+
+    static Name read(ByteReader &in)
+    {
+        Name name;
+        name.value.resize(in.readVarint());
+        in.readBytes(name.value.data(), name.value.size());
+        return name;
+    }
+};
+
+namespace
+{
+    Ecs::Serializer makeSerializer()
+    {
+        Ecs::Serializer serializer;
+        serializer.add<Point>().add<Name>();
+        return serializer;
+    }
+
+    std::vector<std::uint8_t> save(const Ecs::Registry &registry)
+    {
+        std::vector<std::uint8_t> blob;
+        Ecs::ByteWriter out(blob);
+        makeSerializer().save(registry, out);
+        return blob;
+    }
+} // namespace
+
+TEST(Serializer, round_trip_restores_components_and_entity_counter)
+{
+    Ecs::Registry source;
+    Ecs::Registry target;
+
+    for (int i = 0; i < 300; i++) {
+        const auto e = source.createEntity();
+        if (i % 3 != 0)
+            source.emplaceComponent<Point>(e, Point{static_cast<float>(i), -1.f});
+        if (i % 100 == 7)
+            source.emplaceComponent<Name>(e, Name{"entity " + std::to_string(i)});
+    }
+    source.destroyEntity(Ecs::Entity(1));
+
+    const auto blob = save(source);
+    Ecs::ByteReader in(blob.data(), blob.size());
+    makeSerializer().load(target, in);
+
+    EXPECT_EQ(in.remaining(), 0u);
+    EXPECT_EQ(static_cast<size_t>(target.createEntity()), 300u);
+    EXPECT_FALSE(target.hasComponent<Point>(Ecs::Entity(0)));
+    EXPECT_FALSE(target.hasComponent<Point>(Ecs::Entity(1)));
+    EXPECT_EQ(target.getComponents<Point>().at(299)->x, 299.f);
+    EXPECT_EQ(target.getComponents<Name>().at(207)->value, "entity 207");
+    size_t points = 0;
+    target.view<Point>([&points](Ecs::Entity, const Point &) { points++; });
+    EXPECT_EQ(points, 199u);
+}
+
+TEST(Serializer, load_rebuilds_groups)
+{
+    Ecs::Registry source;
+    Ecs::Registry target;
+    const auto e = source.createEntity();
+    source.emplaceComponent<Point>(e, Point{1.f, 2.f});
+    source.emplaceComponent<Name>(e, Name{"both"});
+    auto &group = target.group<Point, Name>();
+
+    const auto blob = save(source);
+    Ecs::ByteReader in(blob.data(), blob.size());
+    makeSerializer().load(target, in);
+
+    EXPECT_EQ(group.entities(), std::vector<size_t>{0});
+}
+
+TEST(Serializer, save_rejects_components_without_codec)
+{
+    Ecs::Registry registry;
+    registry.emplaceComponent<Untracked>(registry.createEntity(), Untracked{3});
+
+    EXPECT_THROW(save(registry), Ecs::SerializeError);
+}
+
+TEST(Serializer, load_rejects_malformed_blobs)
+{
+    Ecs::Registry source;
+    Ecs::Registry target;
+    source.emplaceComponent<Point>(source.createEntity(), Point{1.f, 2.f});
+    auto blob = save(source);
+    Ecs::Serializer pointsOnly;
+    pointsOnly.add<Point>();
+    Ecs::Serializer namesOnly;
+    namesOnly.add<Name>();
+
+    Ecs::ByteReader truncated(blob.data(), blob.size() - 1);
+    EXPECT_THROW(makeSerializer().load(target, truncated), Ecs::SerializeError);
+    Ecs::ByteReader unknown(blob.data(), blob.size());
+    EXPECT_THROW(namesOnly.load(target, unknown), Ecs::SerializeError);
+    blob[0] = 'X';
+    Ecs::ByteReader magic(blob.data(), blob.size());
+    EXPECT_THROW(pointsOnly.load(target, magic), Ecs::SerializeError);
+    EXPECT_FALSE(target.hasComponent<Point>(Ecs::Entity(0)));
+}
+
+TEST(Serializer, load_rejects_oversized_entity_counters)
+{
+    std::vector<std::uint8_t> blob;
+    Ecs::ByteWriter out(blob);
+    Ecs::Registry target;
+
+    out.writeBytes(Ecs::Serializer::MAGIC, sizeof(Ecs::Serializer::MAGIC));
+    out.writeFixed(Ecs::Serializer::VERSION, 2);
+    out.writeVarint(Ecs::Serializer::MAX_ENTITIES + 1);
+    out.writeVarint(0);
+    Ecs::ByteReader in(blob.data(), blob.size());
+    EXPECT_THROW(makeSerializer().load(target, in), Ecs::SerializeError);
+}
+
+TEST(Serializer, codec_ids_must_be_unique)
+{
+    Ecs::Serializer serializer;
+    serializer.add<Point>();
+
+    EXPECT_NO_THROW(serializer.add<Point>());
+    EXPECT_THROW(serializer.add<Twin>(), Ecs::SerializeError);
+}
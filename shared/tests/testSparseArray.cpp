@@ -38,3 +38,21 @@ TEST(SparseArray, remove)
 
     ASSERT_FALSE(arr.at(3).has_value());
 }
+
+TEST(SparseArray, shrink_keeps_components_up_to_the_last_one)
+{
+    Ecs::SparseArray<int> arr;
+    for (size_t i = 0; i < 100; i++)
+        arr.insert(i, static_cast<int>(i));
+    for (size_t i = 11; i < 100; i++)
+        arr.remove(i);
+    arr.remove(4);
+    const size_t before = arr.memoryUsage();
+
+    arr.shrink();
+
+    ASSERT_EQ(arr.size(), 11);
+    ASSERT_LT(arr.memoryUsage(), before);
+    ASSERT_FALSE(arr.at(4).has_value());
+    ASSERT_EQ(arr.at(10).value(), 10);
+}